@@ -1,3 +0,0 @@
-cd /D "%~dp0"
-
-:: @todo create SWIG wrapper for PHP
\ No newline at end of file
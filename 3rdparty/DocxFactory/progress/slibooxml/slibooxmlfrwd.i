@@ -1,16 +0,0 @@
-
-/** 
- * slibooxmlfrwd.i -
- *
- * (c) Copyright ABC Alon Blich Consulting Tech Ltd.
- *
- * Contact Information
- * Email: alonblich@gmail.com
- * Phone: +972-54-218-8086
- */
-
-
-
-function getSubPath     returns char ( pcPath as char, pcFrom as char, pcTo as char ) {1}.
-function normalizePath  returns char ( pcPath as char ) {1}.
-function isRelativePath returns log  ( pcPath as char ) {1}.
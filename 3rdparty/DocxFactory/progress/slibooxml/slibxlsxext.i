@@ -1,22 +0,0 @@
-
-/**
- * slibxlsxext.i -
- *
- * (c) Copyright ABC Alon Blich Consulting Tech Ltd.
- *
- * Contact Information
- * Email: alonblich@gmail.com
- * Phone: +972-54-218-8086
- */
-
-
-
-&if defined( xSLibXlsxExt ) = 0 &then
-
-    {slib/start-slib.i "'slibooxml/slibxlsxext.p'"}
-
-    {slibooxml/slibxlsxextfrwd.i}
-
-    &global xSLibXlsxExt defined
-
-&endif /* defined = 0 */
@@ -5,22 +5,105 @@
 #include "DebugTimeManager.h"
 #include <QDateTime>
 #include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QLoggingCategory>
+#include <QSaveFile>
 
+#include <atomic>
+#include <sys/syscall.h>
 #include <sys/time.h>
 #include <time.h>
+#include <unistd.h>
 
 Q_DECLARE_LOGGING_CATEGORY(logApp)
 
+// 最多记录的trace事件个数，超出后丢弃，避免长时间运行时内存持续增长
+const int PERF_TRACE_EVENT_MAX = 200000;
+
+/**
+ * @brief The PerfShard struct 单个线程的计数，只由所属线程写入，汇总时由其他线程读取
+ */
+struct PerfShard {
+    quint64 ownerId = 0;                // 所属实例编号，注册后不再修改
+    DebugTimeManager *owner = nullptr;  // 所属实例，实例析构后置空，在s_shardMutex内读写
+    std::atomic<qint64> count[PerfMetricCount];
+    std::atomic<qint64> value[PerfMetricCount];
+    std::atomic<qint64> totalUs[PerfMetricCount];
+    std::atomic<qint64> maxUs[PerfMetricCount];
+    std::atomic<qint64> buckets[PerfMetricCount][PERF_HISTOGRAM_BUCKETS];
+};
+
+static std::atomic<quint64> s_managerSerial {0};
+// 保护各实例的分片列表；线程可能在实例析构后才退出，使用无需析构的QBasicMutex
+static QBasicMutex s_shardMutex;
+
+/**
+ * @brief The PerfShardHolder struct 线程缓存的分片，线程退出时计数并入所属实例并释放分片
+ */
+struct PerfShardHolder {
+    PerfShard *shard = nullptr;
+    ~PerfShardHolder()
+    {
+        DebugTimeManager::releaseShard(shard);
+    }
+};
+static thread_local PerfShardHolder t_shardHolder;
+
+// 将分片的计数累加到into，调用方持有s_shardMutex
+static void mergeShard(PerfShard *into, const PerfShard *from)
+{
+    for (int m = 0; m < PerfMetricCount; ++m) {
+        into->count[m].fetch_add(from->count[m].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        into->value[m].fetch_add(from->value[m].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        into->totalUs[m].fetch_add(from->totalUs[m].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        const qint64 maxUs = from->maxUs[m].load(std::memory_order_relaxed);
+        if (maxUs > into->maxUs[m].load(std::memory_order_relaxed))
+            into->maxUs[m].store(maxUs, std::memory_order_relaxed);
+        for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b)
+            into->buckets[m][b].fetch_add(from->buckets[m][b].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+static int bucketOf(qint64 durationUs)
+{
+    if (durationUs <= 0)
+        return 0;
+    const int bucket = 64 - __builtin_clzll(static_cast<unsigned long long>(durationUs));
+    return qMin(bucket, PERF_HISTOGRAM_BUCKETS - 1);
+}
+
+// 桶的上界，微秒
+static qint64 bucketUpperUs(int bucket)
+{
+    return qint64(1) << bucket;
+}
+
 DebugTimeManager::DebugTimeManager()
+    : m_id(++s_managerSerial)
+    , m_retired(new PerfShard())
 {
     qCDebug(logApp) << "DebugTimeManager initialized";
 
 }
 
+DebugTimeManager::~DebugTimeManager()
+{
+    // 仍在运行的线程持有各自的分片，由线程退出时释放
+    QMutexLocker locker(&s_shardMutex);
+    for (PerfShard *shard : m_shards)
+        shard->owner = nullptr;
+    m_shards.clear();
+    delete m_retired;
+    m_retired = nullptr;
+}
+
 void DebugTimeManager::clear()
 {
     qCDebug(logApp) << "Clearing all time points";
+    QMutexLocker locker(&m_mutex);
     m_MapPoint.clear();
     m_MapLinuxPoint.clear();
 }
@@ -28,6 +111,7 @@ void DebugTimeManager::clear()
 void DebugTimeManager::beginPointLinux(const QString &point, const QString &status)
 {
     qCDebug(logApp) << QString("Starting time point: %1 (%2)").arg(point).arg(status);
+    QMutexLocker locker(&m_mutex);
     PointInfoLinux info;
     info.desc = status;
     timespec beginTime;
@@ -38,11 +122,20 @@ void DebugTimeManager::beginPointLinux(const QString &point, const QString &stat
     }
     info.time = beginTime;
     m_MapLinuxPoint.insert(point, info);
+    if (!m_traceOriginSet) {
+        m_traceOrigin = beginTime;
+        m_traceOriginSet = true;
+        timespec realTime;
+        if (clock_gettime(CLOCK_REALTIME, &realTime) == 0)
+            m_traceOriginUnixUs = realTime.tv_sec * 1000000LL + realTime.tv_nsec / 1000;
+    }
 
 }
 
 void DebugTimeManager::endPointLinux(const QString &point, const QString &status)
 {
+    std::function<void()> finished;
+    QMutexLocker locker(&m_mutex);
     if (m_MapLinuxPoint.contains(point)) {
         timespec endTime;
         int result = clock_gettime(CLOCK_MONOTONIC, &endTime);
@@ -51,8 +144,75 @@ void DebugTimeManager::endPointLinux(const QString &point, const QString &status
         }
         timespec diffTime =  diff(m_MapLinuxPoint[point].time, endTime);
         qCInfo(logApp) << QString("[GRABPOINT] %1 %2 %3 time=%4s").arg(point).arg(m_MapLinuxPoint[point].desc).arg(status).arg(QString::number((diffTime.tv_sec * 1000 + (diffTime.tv_nsec) / 1000000) / 1000.0, 'g', 4));
+        if (!m_traceFile.isEmpty()) {
+            timespec beginTime = diff(m_traceOrigin, m_MapLinuxPoint[point].time);
+            TracePointInfo info;
+            info.point = point;
+            info.desc = (m_MapLinuxPoint[point].desc + " " + status).trimmed();
+            info.beginUs = beginTime.tv_sec * 1000000 + beginTime.tv_nsec / 1000;
+            info.durationUs = diffTime.tv_sec * 1000000 + diffTime.tv_nsec / 1000;
+            m_tracePoints.append(info);
+        }
+        if (isChromeTraceEnabled() && m_traceEvents.size() < PERF_TRACE_EVENT_MAX) {
+            const timespec &begin = m_MapLinuxPoint[point].time;
+            ChromeTraceEvent event;
+            event.name = point;
+            event.category = "point";
+            event.tsUs = begin.tv_sec * 1000000 + begin.tv_nsec / 1000;
+            event.durUs = diffTime.tv_sec * 1000000 + diffTime.tv_nsec / 1000;
+            event.tid = static_cast<qint64>(::syscall(SYS_gettid));
+            m_traceEvents.append(event);
+        }
         m_MapLinuxPoint.remove(point);
+
+        if (!m_traceFile.isEmpty() && point == m_traceEndPoint)
+            finished = writeTrace();
+    }
+    locker.unlock();
+
+    // 回调可能再次打点，解锁后调用
+    if (finished)
+        finished();
+}
+
+void DebugTimeManager::setTraceFile(const QString &filePath, const QString &endPoint, const std::function<void()> &finished)
+{
+    qCDebug(logApp) << "Trace points until" << endPoint << "to file:" << filePath;
+    QMutexLocker locker(&m_mutex);
+    m_traceFile = filePath;
+    m_traceEndPoint = endPoint;
+    m_traceFinished = finished;
+    m_tracePoints.clear();
+}
+
+QList<TracePointInfo> DebugTimeManager::tracePoints() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_tracePoints;
+}
+
+std::function<void()> DebugTimeManager::writeTrace()
+{
+    QFile file(m_traceFile);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(logApp) << "Failed to open trace file:" << m_traceFile;
+    } else {
+        for (const TracePointInfo &info : m_tracePoints) {
+            QJsonObject obj {
+                {"point", info.point},
+                {"desc", info.desc},
+                {"begin_ms", info.beginUs / 1000.0},
+                {"duration_ms", info.durationUs / 1000.0},
+                {"origin_unix_us", static_cast<double>(m_traceOriginUnixUs)}
+            };
+            file.write(QJsonDocument(obj).toJson(QJsonDocument::Compact) + "\n");
+        }
     }
+
+    // 只记录一次
+    m_traceFile.clear();
+    m_tracePoints.clear();
+    return m_traceFinished;
 }
 
 timespec DebugTimeManager::diff(timespec start, timespec end)
@@ -65,3 +225,256 @@ timespec DebugTimeManager::diff(timespec start, timespec end)
     temp.tv_nsec = end.tv_nsec - start.tv_nsec;
     return temp;
 }
+
+PerfShard *DebugTimeManager::localShard()
+{
+    PerfShard *shard = t_shardHolder.shard;
+    if (shard && shard->ownerId == m_id)
+        return shard;
+
+    // 每个线程首次计数时注册一个分片，之后的计数都不加锁；线程改为向其他实例计数时先释放原分片
+    releaseShard(shard);
+    shard = new PerfShard();
+    shard->ownerId = m_id;
+    shard->owner = this;
+    QMutexLocker locker(&s_shardMutex);
+    m_shards.append(shard);
+    t_shardHolder.shard = shard;
+    return shard;
+}
+
+void DebugTimeManager::releaseShard(PerfShard *shard)
+{
+    if (!shard)
+        return;
+
+    QMutexLocker locker(&s_shardMutex);
+    if (DebugTimeManager *owner = shard->owner) {
+        owner->m_shards.removeOne(shard);
+        mergeShard(owner->m_retired, shard);
+        ++owner->m_retiredThreads;
+    }
+    if (t_shardHolder.shard == shard)
+        t_shardHolder.shard = nullptr;
+    delete shard;
+}
+
+void DebugTimeManager::addDuration(PerfMetric metric, qint64 durationUs, qint64 value)
+{
+    PerfShard *shard = localShard();
+    shard->count[metric].fetch_add(1, std::memory_order_relaxed);
+    shard->value[metric].fetch_add(value, std::memory_order_relaxed);
+    shard->totalUs[metric].fetch_add(durationUs, std::memory_order_relaxed);
+    shard->buckets[metric][bucketOf(durationUs)].fetch_add(1, std::memory_order_relaxed);
+    // 只有本线程写入，读后写不会丢失更新
+    if (durationUs > shard->maxUs[metric].load(std::memory_order_relaxed))
+        shard->maxUs[metric].store(durationUs, std::memory_order_relaxed);
+}
+
+void DebugTimeManager::addValue(PerfMetric metric, qint64 value)
+{
+    localShard()->value[metric].fetch_add(value, std::memory_order_relaxed);
+}
+
+void DebugTimeManager::addTraceEvent(const QString &name, const QString &category, qint64 beginUs, qint64 durUs)
+{
+    if (!isChromeTraceEnabled())
+        return;
+
+    ChromeTraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.tsUs = beginUs;
+    event.durUs = durUs;
+    event.tid = static_cast<qint64>(::syscall(SYS_gettid));
+
+    QMutexLocker locker(&m_mutex);
+    if (m_traceEvents.size() < PERF_TRACE_EVENT_MAX)
+        m_traceEvents.append(event);
+}
+
+QJsonObject DebugTimeManager::metricsJson() const
+{
+    QJsonObject metrics;
+    QMutexLocker locker(&s_shardMutex);
+    QList<PerfShard *> shards = m_shards;
+    shards.append(m_retired);
+    for (int m = 0; m < PerfMetricCount; ++m) {
+        qint64 count = 0;
+        qint64 value = 0;
+        qint64 totalUs = 0;
+        qint64 maxUs = 0;
+        qint64 buckets[PERF_HISTOGRAM_BUCKETS] = {0};
+        for (const PerfShard *shard : shards) {
+            count += shard->count[m].load(std::memory_order_relaxed);
+            value += shard->value[m].load(std::memory_order_relaxed);
+            totalUs += shard->totalUs[m].load(std::memory_order_relaxed);
+            maxUs = qMax(maxUs, shard->maxUs[m].load(std::memory_order_relaxed));
+            for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b)
+                buckets[b] += shard->buckets[m][b].load(std::memory_order_relaxed);
+        }
+
+        // 分位数取所在桶的上界
+        auto percentile = [&](double p) -> qint64 {
+            const qint64 target = static_cast<qint64>(count * p + 0.5);
+            qint64 seen = 0;
+            for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b) {
+                seen += buckets[b];
+                if (seen >= target && seen > 0)
+                    return qMin(bucketUpperUs(b), maxUs);
+            }
+            return maxUs;
+        };
+
+        QJsonArray histogram;
+        for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b) {
+            if (buckets[b] > 0)
+                histogram.append(QJsonObject {{"le_us", bucketUpperUs(b)}, {"count", buckets[b]}});
+        }
+
+        metrics.insert(metricName(static_cast<PerfMetric>(m)), QJsonObject {
+            {"count", count},
+            {"value", value},
+            {"total_us", totalUs},
+            {"max_us", maxUs},
+            {"p50_us", percentile(0.5)},
+            {"p90_us", percentile(0.9)},
+            {"p99_us", percentile(0.99)},
+            {"per_second", totalUs > 0 ? value * 1e6 / totalUs : 0.0},
+            {"histogram", histogram}
+        });
+    }
+
+    return QJsonObject {{"threads", m_shards.size() + m_retiredThreads}, {"metrics", metrics}};
+}
+
+void DebugTimeManager::resetMetrics()
+{
+    {
+        QMutexLocker locker(&s_shardMutex);
+        QList<PerfShard *> shards = m_shards;
+        shards.append(m_retired);
+        for (PerfShard *shard : shards) {
+            for (int m = 0; m < PerfMetricCount; ++m) {
+                shard->count[m].store(0, std::memory_order_relaxed);
+                shard->value[m].store(0, std::memory_order_relaxed);
+                shard->totalUs[m].store(0, std::memory_order_relaxed);
+                shard->maxUs[m].store(0, std::memory_order_relaxed);
+                for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b)
+                    shard->buckets[m][b].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+    QMutexLocker locker(&m_mutex);
+    m_traceEvents.clear();
+}
+
+void DebugTimeManager::setDumpFiles(const QString &metricsFile, const QString &chromeTraceFile)
+{
+    qCDebug(logApp) << "Dump perf metrics to:" << metricsFile << "chrome trace to:" << chromeTraceFile;
+    QMutexLocker locker(&m_mutex);
+    m_metricsDumpFile = metricsFile;
+    m_chromeTraceDumpFile = chromeTraceFile;
+    m_chromeTraceEnabled.storeRelease(chromeTraceFile.isEmpty() ? 0 : 1);
+}
+
+void DebugTimeManager::dump()
+{
+    QString metricsFile;
+    QString chromeTraceFile;
+    {
+        QMutexLocker locker(&m_mutex);
+        metricsFile = m_metricsDumpFile;
+        chromeTraceFile = m_chromeTraceDumpFile;
+    }
+    if (!metricsFile.isEmpty())
+        writeMetrics(metricsFile);
+    if (!chromeTraceFile.isEmpty())
+        writeChromeTrace(chromeTraceFile);
+}
+
+bool DebugTimeManager::writeMetrics(const QString &filePath) const
+{
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logApp) << "Failed to open perf metrics file:" << filePath;
+        return false;
+    }
+    file.write(QJsonDocument(metricsJson()).toJson());
+    return file.commit();
+}
+
+bool DebugTimeManager::writeChromeTrace(const QString &filePath) const
+{
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logApp) << "Failed to open chrome trace file:" << filePath;
+        return false;
+    }
+
+    const qint64 pid = ::getpid();
+    QJsonArray events;
+    {
+        QMutexLocker locker(&m_mutex);
+        for (const ChromeTraceEvent &event : m_traceEvents) {
+            events.append(QJsonObject {
+                {"name", event.name},
+                {"cat", event.category},
+                {"ph", "X"},
+                {"ts", event.tsUs},
+                {"dur", event.durUs},
+                {"pid", pid},
+                {"tid", event.tid}
+            });
+        }
+    }
+    file.write(QJsonDocument(QJsonObject {{"traceEvents", events}, {"displayTimeUnit", "ms"}}).toJson(QJsonDocument::Compact));
+    return file.commit();
+}
+
+const char *DebugTimeManager::metricName(PerfMetric metric)
+{
+    switch (metric) {
+    case PerfReadBytes:
+        return "read_bytes";
+    case PerfParseRows:
+        return "parse_rows";
+    case PerfDBusCall:
+        return "dbus_call";
+    case PerfModelInsert:
+        return "model_insert";
+    case PerfExportBytes:
+        return "export_bytes";
+    case PerfMemoryBytes:
+        return "memory_bytes";
+    case PerfSpillBytes:
+        return "spill_bytes";
+    case PerfSortRows:
+        return "sort_rows";
+    default:
+        return "unknown";
+    }
+}
+
+qint64 DebugTimeManager::monotonicUs()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+}
+
+PerfScope::PerfScope(PerfMetric metric, const char *name)
+    : m_metric(metric)
+    , m_name(name)
+    , m_beginUs(DebugTimeManager::monotonicUs())
+{
+}
+
+PerfScope::~PerfScope()
+{
+    DebugTimeManager *manager = DebugTimeManager::getInstance();
+    const qint64 durUs = DebugTimeManager::monotonicUs() - m_beginUs;
+    manager->addDuration(m_metric, durUs, m_value);
+    if (manager->isChromeTraceEnabled())
+        manager->addTraceEvent(QString::fromLatin1(m_name), DebugTimeManager::metricName(m_metric), m_beginUs, durUs);
+}
@@ -6,17 +6,50 @@
 #define DEBUGTIMEMANAGER_H
 
 #include <QObject>
+#include <QList>
 #include <QMap>
+#include <QAtomicInt>
+#include <QMutex>
+#include <QJsonObject>
 #include <QString>
+#include <QVector>
 #include "config.h"
+
+#include <functional>
+#include <time.h>
 #define PERF_ON
 #ifdef PERF_ON
 #define PERF_PRINT_BEGIN(point, dsec) DebugTimeManager::getInstance()->beginPointLinux(point,dsec)
 #define PERF_PRINT_END(point, dsec) DebugTimeManager::getInstance()->endPointLinux(point, dsec)
+#define PERF_SCOPE(var, metric, name) PerfScope var(metric, name)
+#define PERF_SCOPE_VALUE(var, value) var.setValue(value)
+#define PERF_ADD(metric, value) DebugTimeManager::getInstance()->addValue(metric, value)
 #else
 #define PERF_PRINT_BEGIN(point, dsec)
 #define PERF_PRINT_END(point, dsec)
+#define PERF_SCOPE(var, metric, name)
+#define PERF_SCOPE_VALUE(var, value)
+#define PERF_ADD(metric, value)
 #endif
+
+/**
+ * @brief The PerfMetric enum 性能计数项
+ * 每项记录调用次数、累计耗时、耗时分布以及累计数值(字节数、行数)，累计数值/累计耗时即吞吐量
+ */
+enum PerfMetric {
+    PerfReadBytes = 0,  // 读取日志，数值为数据量，文本按UTF-8编码后的字节数计
+    PerfParseRows,      // 解析日志，数值为行数
+    PerfDBusCall,       // D-Bus调用
+    PerfModelInsert,    // 插入表格model，数值为行数
+    PerfExportBytes,    // 导出日志，数值为写入的字节数
+    PerfMemoryBytes,    // 已解析日志的内存占用，增加时累计正数、释放时累计负数，数值即当前占用
+    PerfSpillBytes,     // 缓存数据写入或读回磁盘，数值为压缩后的字节数
+    PerfSortRows,       // 按列排序，数值为行数
+    PerfMetricCount
+};
+
+// 耗时分布的桶数，第i个桶统计耗时在[2^(i-1), 2^i)微秒内的次数
+const int PERF_HISTOGRAM_BUCKETS = 32;
 /**
  * @brief The PointInfo struct
  */
@@ -28,6 +61,29 @@ struct PointInfoLinux {
     QString desc;
     timespec  time;
 };
+/**
+ * @brief The TracePointInfo struct 已结束的打点，时间相对于第一个打点的开始时间
+ */
+struct TracePointInfo {
+    QString point;
+    QString desc;
+    qint64 beginUs;
+    qint64 durationUs;
+};
+
+/**
+ * @brief The ChromeTraceEvent struct Chrome trace格式的完整事件(ph为X)
+ */
+struct ChromeTraceEvent {
+    QString name;
+    QString category;
+    qint64 tsUs;
+    qint64 durUs;
+    qint64 tid;
+};
+
+struct PerfShard;
+struct PerfShardHolder;
 
 class DebugTimeManager
 {
@@ -79,14 +135,111 @@ public:
      * @return  时间差
      */
     timespec diff(timespec start, timespec end);
+
+    /**
+     * @brief setTraceFile 开启打点记录，endPoint结束时把已结束的打点按JSON行写入文件
+     * @param filePath 记录文件路径
+     * @param endPoint 记录结束的点，如启动完成的点
+     * @param finished endPoint结束并写入文件后的回调
+     */
+    void setTraceFile(const QString &filePath, const QString &endPoint, const std::function<void()> &finished = nullptr);
+    /**
+     * @brief tracePoints 已记录的打点
+     */
+    QList<TracePointInfo> tracePoints() const;
+
+    /**
+     * @brief addDuration 记录一次计数项的耗时，可在任意线程调用，计数写入本线程的分片，不加锁
+     * @param metric 计数项
+     * @param durationUs 耗时，微秒
+     * @param value 本次处理的数值，如字节数、行数
+     */
+    void addDuration(PerfMetric metric, qint64 durationUs, qint64 value = 0);
+    /**
+     * @brief addValue 只累计数值，不计调用次数和耗时，用于数值与耗时分开统计的场景
+     */
+    void addValue(PerfMetric metric, qint64 value);
+    /**
+     * @brief addTraceEvent 开启Chrome trace时记录一个事件
+     * @param beginUs 开始时间，CLOCK_MONOTONIC微秒
+     */
+    void addTraceEvent(const QString &name, const QString &category, qint64 beginUs, qint64 durUs);
+    bool isChromeTraceEnabled() const { return m_chromeTraceEnabled.loadAcquire() != 0; }
+
+    /**
+     * @brief metricsJson 汇总各线程分片的计数
+     */
+    QJsonObject metricsJson() const;
+    /**
+     * @brief resetMetrics 清空计数及已记录的trace事件
+     */
+    void resetMetrics();
+    /**
+     * @brief setDumpFiles 设置dump写入的文件，计数写入metricsFile(JSON)，trace事件写入chromeTraceFile
+     * @param metricsFile 为空时不写计数
+     * @param chromeTraceFile 为空时不记录trace事件
+     */
+    void setDumpFiles(const QString &metricsFile, const QString &chromeTraceFile);
+    /**
+     * @brief dump 立即写入setDumpFiles指定的文件，由程序退出流程显式调用，实例析构时不再写入
+     */
+    void dump();
+    bool writeMetrics(const QString &filePath) const;
+    bool writeChromeTrace(const QString &filePath) const;
+
+    static const char *metricName(PerfMetric metric);
+    static qint64 monotonicUs();
 protected:
     DebugTimeManager();
+    ~DebugTimeManager();
 
 
 private:
     QMap<QString, PointInfo>    m_MapPoint;      //<! 保存所打的点
     QMap<QString, PointInfoLinux>    m_MapLinuxPoint;      //<! 保存所打的点
 
+    friend struct PerfShardHolder;
+
+    std::function<void()> writeTrace();
+    PerfShard *localShard();
+    static void releaseShard(PerfShard *shard);
+
+    mutable QMutex m_mutex;                     //<! 保护打点及trace事件
+
+    QString m_traceFile;                        //<! 打点记录文件，为空时不记录
+    QString m_traceEndPoint;                    //<! 记录结束的点
+    std::function<void()> m_traceFinished;      //<! 记录结束后的回调
+    bool m_traceOriginSet = false;              //<! 是否已记录时间起点
+    timespec m_traceOrigin {0, 0};              //<! 时间起点，第一个打点的开始时间
+    qint64 m_traceOriginUnixUs = 0;             //<! 时间起点对应的系统时间(微秒)，用于换算为相对进程启动的时间
+    QList<TracePointInfo> m_tracePoints;        //<! 已结束的打点
+
+    const quint64 m_id;                         //<! 实例编号，用于区分线程缓存的分片属于哪个实例
+    QList<PerfShard *> m_shards;                //<! 仍在运行的各线程的计数分片，只在注册、释放及汇总时加锁
+    PerfShard *m_retired;                       //<! 已退出线程的计数，线程退出时并入
+    int m_retiredThreads = 0;                   //<! 已退出并释放分片的线程数
+    QAtomicInt m_chromeTraceEnabled;            //<! 是否记录Chrome trace事件
+    QVector<ChromeTraceEvent> m_traceEvents;    //<! 已记录的trace事件
+    QString m_metricsDumpFile;                  //<! 退出时写入计数的文件
+    QString m_chromeTraceDumpFile;              //<! 退出时写入trace事件的文件
+};
+
+/**
+ * @brief The PerfScope class 作用域计时，析构时记录耗时，开启Chrome trace时同时记录事件
+ */
+class PerfScope
+{
+public:
+    PerfScope(PerfMetric metric, const char *name);
+    ~PerfScope();
+    // 本次处理的数值，如字节数、行数
+    void setValue(qint64 value) { m_value = value; }
+
+private:
+    PerfMetric m_metric;
+    const char *m_name;
+    qint64 m_beginUs;
+    qint64 m_value = 0;
 };
 
 #endif // DEBUGTIMEMANAGER_H
@@ -0,0 +1,60 @@
+# SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+#主程序与基准测试程序共用的源码列表，路径相对application目录，不含入口main.cpp与命令行辅助类
+set (APP_SHARED_CPP_FILES
+     filtercontent.cpp
+     displaycontent.cpp
+     logcollectormain.cpp
+     logfileparser.cpp
+     logtreeview.cpp
+     journalwork.cpp
+     logexportthread.cpp
+     utils.cpp
+     loglistview.cpp
+     logperiodbutton.cpp
+     logviewheaderview.cpp
+     logviewitemdelegate.cpp
+     logiconbutton.cpp
+     logspinnerwidget.cpp
+     logdetailinfowidget.cpp
+     logauththread.cpp
+     logapplicationhelper.cpp
+     logapplicationparsethread.cpp
+     logoocfileparsethread.cpp
+     journalbootwork.cpp
+     exportprogressdlg.cpp
+     logscrollbar.cpp
+     logcombox.cpp
+     dbusmanager.cpp
+     lognormalbutton.cpp
+     logapplication.cpp
+     sharedmemorymanager.cpp
+     dbusproxy/dldbusinterface.cpp
+     dbusproxy/dldbushandler.cpp
+     logsettings.cpp
+     DebugTimeManager.cpp
+     wtmpparse.cpp
+     logdetailedit.cpp
+#     viewsortfilter.cpp
+     logallexportthread.cpp
+     eventlogutils.cpp
+     logbackend.cpp
+     logsegementexportthread.cpp
+     parsethread/parsethreadbase.cpp
+     parsethread/parsethreadkern.cpp
+     parsethread/parsethreadkwin.cpp
+     logcolumnsorter.cpp
+     logmemorygovernor.cpp
+     logparsescheduler.cpp
+     logbatchchannel.cpp
+     docxstreamwriter.cpp
+     logauditparser.cpp
+     loghistogramwidget.cpp
+     loghistogram.cpp
+     logparsecache.cpp
+     logtimeline.cpp
+     logquery.cpp
+     coredumpstatistics.cpp
+    )
@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "coredumpstatistics.h"
+#include "dbusproxy/dldbushandler.h"
+#include "qtcompat.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QSaveFile>
+
+#include <algorithm>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 统计数据存储路径
+const QString COREDUMP_STATISTICS_PATH = "/.cache/deepin/deepin-log-viewer/coredumpStatistics.json";
+// 旧版本以空格分隔保存的高频重复崩溃记录exe路径名单，首次加载时迁移
+const QString COREDUMP_REPEAT_LEGACY_PATH = "/.cache/deepin/deepin-log-viewer/repeatCoredumpApp.list";
+const int COREDUMP_STATISTICS_VERSION = 1;
+// 精确时间点保留时长，覆盖上报定时器的时间窗口
+const qint64 COREDUMP_RECENT_SECS = 2 * 24 * 3600;
+// 按天计数的保留天数
+const qint64 COREDUMP_KEEP_DAYS = 365;
+const float COREDUMP_HIGH_REPETITION = 0.8f;
+const int COREDUMP_TIME_THRESHOLD = 3;
+
+CoredumpStatistics::CoredumpStatistics()
+    : m_storePath(Utils::homePath + COREDUMP_STATISTICS_PATH)
+{
+    qCDebug(logApp) << "CoredumpStatistics constructor, store path:" << m_storePath;
+    load();
+}
+
+void CoredumpStatistics::setStorePath(const QString &path)
+{
+    m_storePath = path;
+    clear();
+    load();
+}
+
+void CoredumpStatistics::clear()
+{
+    m_stats.clear();
+    m_cursor = 0;
+    m_cursorPids.clear();
+    m_repeatExePaths.clear();
+    m_repeatListTime = 0;
+}
+
+int CoredumpStatistics::sync()
+{
+    qCDebug(logApp) << "Syncing coredump statistics since cursor:" << m_cursor;
+    // 首次统计拉取全量记录，之后仅拉取游标之后的新记录
+    QString cmd = m_cursor > 0 ? QString("coredumpctl-list-since %1").arg(m_cursor) : QString("coredumpctl-list");
+    QString data = DLDBusHandler::instance()->executeCmd(cmd);
+
+    int nAdded = ingest(data);
+    pruneRecentTimes();
+    if (!save())
+        return -1;
+
+    qCDebug(logApp) << "Coredump statistics synced, new records:" << nAdded << "cursor:" << m_cursor;
+    return nAdded;
+}
+
+int CoredumpStatistics::ingest(const QString &data)
+{
+    int nAdded = 0;
+    const QStringList strList = data.split('\n', SKIP_EMPTY_PARTS);
+    for (const QString &str : strList) {
+        QStringList tmpList = str.split(" ", SKIP_EMPTY_PARTS);
+        if (tmpList.count() < 10)
+            continue;
+
+        QDateTime dt = QDateTime::fromString(tmpList[1] + " " + tmpList[2], "yyyy-MM-dd hh:mm:ss");
+        if (!dt.isValid())
+            continue;
+
+        const qint64 secs = dt.toMSecsSinceEpoch() / 1000;
+        const QString &pid = tmpList[4];
+        if (secs < m_cursor || (secs == m_cursor && m_cursorPids.contains(pid)))
+            continue;
+
+        if (secs > m_cursor) {
+            m_cursor = secs;
+            m_cursorPids.clear();
+        }
+        m_cursorPids.insert(pid);
+
+        ExeStat &stat = m_stats[tmpList[9]];
+        stat.dayCounts[dt.date().toJulianDay()]++;
+        stat.recentTimes.insert(std::upper_bound(stat.recentTimes.begin(), stat.recentTimes.end(), secs), secs);
+        nAdded++;
+    }
+
+    return nAdded;
+}
+
+void CoredumpStatistics::pruneRecentTimes()
+{
+    const qint64 recentFloor = QDateTime::currentMSecsSinceEpoch() / 1000 - COREDUMP_RECENT_SECS;
+    const qint64 dayFloor = QDate::currentDate().toJulianDay() - COREDUMP_KEEP_DAYS;
+    for (auto it = m_stats.begin(); it != m_stats.end();) {
+        QVector<qint64> &times = it->recentTimes;
+        times.erase(times.begin(), std::lower_bound(times.begin(), times.end(), recentFloor));
+
+        QMap<qint64, int> &days = it->dayCounts;
+        while (!days.isEmpty() && days.firstKey() < dayFloor)
+            days.erase(days.begin());
+
+        if (days.isEmpty())
+            it = m_stats.erase(it);
+        else
+            ++it;
+    }
+}
+
+int CoredumpStatistics::countInRange(const ExeStat &stat, qint64 timeBegin, qint64 timeEnd) const
+{
+    int nCount = 0;
+    if (timeBegin <= 0 || timeEnd <= 0) {
+        for (int n : stat.dayCounts)
+            nCount += n;
+        return nCount;
+    }
+
+    const qint64 beginDay = QDateTime::fromMSecsSinceEpoch(timeBegin).date().toJulianDay();
+    const qint64 endDay = QDateTime::fromMSecsSinceEpoch(timeEnd).date().toJulianDay();
+    // 精确时间点完整覆盖的最早一天，更早的边界日只能按整天计数
+    const qint64 recentFloorDay = QDateTime::fromMSecsSinceEpoch((QDateTime::currentMSecsSinceEpoch() / 1000 - COREDUMP_RECENT_SECS) * 1000)
+                                  .date().toJulianDay() + 1;
+
+    for (auto it = stat.dayCounts.lowerBound(beginDay); it != stat.dayCounts.end() && it.key() <= endDay; ++it) {
+        const bool isBoundaryDay = (it.key() == beginDay || it.key() == endDay);
+        if (isBoundaryDay && it.key() >= recentFloorDay) {
+            // 边界日按精确时间统计
+            auto lower = std::lower_bound(stat.recentTimes.begin(), stat.recentTimes.end(), timeBegin / 1000);
+            auto upper = std::upper_bound(stat.recentTimes.begin(), stat.recentTimes.end(), timeEnd / 1000);
+            for (auto t = lower; t < upper; ++t) {
+                if (QDateTime::fromMSecsSinceEpoch(*t * 1000).date().toJulianDay() == it.key())
+                    nCount++;
+            }
+        } else {
+            nCount += it.value();
+        }
+    }
+
+    return nCount;
+}
+
+QList<LOG_REPEAT_COREDUMP_INFO> CoredumpStatistics::countRepeat(qint64 timeBegin, qint64 timeEnd) const
+{
+    qCDebug(logApp) << "Counting repeat coredumps from statistics:" << timeBegin << "to:" << timeEnd;
+    QList<LOG_REPEAT_COREDUMP_INFO> result;
+    int total = 0;
+    for (auto it = m_stats.cbegin(); it != m_stats.cend(); ++it) {
+        int nTimes = countInRange(it.value(), timeBegin, timeEnd);
+        if (nTimes <= 0)
+            continue;
+
+        LOG_REPEAT_COREDUMP_INFO info;
+        info.exePath = it.key();
+        info.times = nTimes;
+        result.push_back(info);
+        total += nTimes;
+    }
+
+    // 计算重复率
+    for (auto &info : result) {
+        if (info.times > 1)
+            info.repetitionRate = static_cast<float>(info.times) / total;
+    }
+
+    return result;
+}
+
+QSet<QString> CoredumpStatistics::repeatExePaths() const
+{
+    return m_repeatExePaths;
+}
+
+void CoredumpStatistics::updateRepeatExePaths(const QList<LOG_REPEAT_COREDUMP_INFO> &infos)
+{
+    qCDebug(logApp) << "Updating repeat coredump exe paths";
+    // 每隔24小时强制清空一次名单内容，以便重复的崩溃exe路径是最新的
+    const qint64 now = QDateTime::currentMSecsSinceEpoch() / 1000;
+    if (m_repeatListTime <= 0 || now - m_repeatListTime >= 24 * 3600 || now < m_repeatListTime) {
+        m_repeatExePaths.clear();
+        m_repeatListTime = now;
+    }
+
+    // 确定当前时间范围的崩溃数据高频重复路径
+    for (const auto &info : infos) {
+        if (info.repetitionRate > COREDUMP_HIGH_REPETITION || info.times >= COREDUMP_TIME_THRESHOLD)
+            m_repeatExePaths.insert(info.exePath);
+    }
+
+    save();
+}
+
+void CoredumpStatistics::load()
+{
+    QFile file(m_storePath);
+    if (file.open(QIODevice::ReadOnly)) {
+        QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+        file.close();
+        if (root.value("version").toInt() != COREDUMP_STATISTICS_VERSION) {
+            qCWarning(logApp) << "Coredump statistics version mismatch, rebuilding:" << m_storePath;
+            return;
+        }
+
+        m_cursor = root.value("cursor").toVariant().toLongLong();
+        for (const QJsonValue &pid : root.value("cursorPids").toArray())
+            m_cursorPids.insert(pid.toString());
+        m_repeatListTime = root.value("repeatListTime").toVariant().toLongLong();
+        for (const QJsonValue &exe : root.value("repeatExePaths").toArray())
+            m_repeatExePaths.insert(exe.toString());
+
+        const QJsonObject exes = root.value("exes").toObject();
+        for (auto it = exes.constBegin(); it != exes.constEnd(); ++it) {
+            const QJsonObject obj = it.value().toObject();
+            ExeStat &stat = m_stats[it.key()];
+            const QJsonObject days = obj.value("days").toObject();
+            for (auto day = days.constBegin(); day != days.constEnd(); ++day)
+                stat.dayCounts.insert(day.key().toLongLong(), day.value().toInt());
+            for (const QJsonValue &t : obj.value("recent").toArray())
+                stat.recentTimes.push_back(t.toVariant().toLongLong());
+            std::sort(stat.recentTimes.begin(), stat.recentTimes.end());
+        }
+        return;
+    }
+
+    // 迁移旧版本名单文件
+    const QString legacyPath = QFileInfo(m_storePath).absolutePath() + "/" + QFileInfo(COREDUMP_REPEAT_LEGACY_PATH).fileName();
+    QFile legacyFile(legacyPath);
+    if (legacyFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qCDebug(logApp) << "Migrating legacy repeat coredump list:" << legacyPath;
+        for (const QString &exe : QString(legacyFile.readAll()).split(' ', SKIP_EMPTY_PARTS))
+            m_repeatExePaths.insert(exe);
+        m_repeatListTime = QFileInfo(legacyPath).birthTime().toMSecsSinceEpoch() / 1000;
+        legacyFile.close();
+        legacyFile.remove();
+    }
+}
+
+bool CoredumpStatistics::save() const
+{
+    QFileInfo fi(m_storePath);
+    // 目录不存在，则创建目录
+    if (!QFileInfo::exists(fi.absolutePath())) {
+        QDir dir;
+        dir.mkpath(fi.absolutePath());
+    }
+
+    QJsonObject exes;
+    for (auto it = m_stats.cbegin(); it != m_stats.cend(); ++it) {
+        QJsonObject days;
+        for (auto day = it->dayCounts.cbegin(); day != it->dayCounts.cend(); ++day)
+            days.insert(QString::number(day.key()), day.value());
+        QJsonArray recent;
+        for (qint64 t : it->recentTimes)
+            recent.append(t);
+        exes.insert(it.key(), QJsonObject{{"days", days}, {"recent", recent}});
+    }
+
+    QJsonArray cursorPids;
+    for (const QString &pid : m_cursorPids)
+        cursorPids.append(pid);
+    QJsonArray repeatExePaths;
+    for (const QString &exe : m_repeatExePaths)
+        repeatExePaths.append(exe);
+
+    QJsonObject root{
+        {"version", COREDUMP_STATISTICS_VERSION},
+        {"cursor", m_cursor},
+        {"cursorPids", cursorPids},
+        {"repeatListTime", m_repeatListTime},
+        {"repeatExePaths", repeatExePaths},
+        {"exes", exes}
+    };
+
+    // 先写临时文件再替换，避免定时上报被中断时损坏统计数据
+    QSaveFile file(m_storePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logApp) << "failed to open coredump statistics file:" << m_storePath;
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    return file.commit();
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef COREDUMPSTATISTICS_H
+#define COREDUMPSTATISTICS_H
+
+#include "utils.h"
+
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QVector>
+
+/**
+ * @brief The CoredumpStatistics class 崩溃记录持久化统计
+ * 以exe路径为键，保存按天的崩溃次数和已统计到的崩溃记录游标，
+ * 每次仅从崩溃日志中增量拉取游标之后的新记录，按时间范围查询时无需重新执行coredumpctl list
+ */
+class CoredumpStatistics
+{
+public:
+    static CoredumpStatistics *instance()
+    {
+        static CoredumpStatistics m_statistics;
+        return &m_statistics;
+    }
+
+    /**
+     * @brief sync 增量同步上次游标之后新产生的崩溃记录，并落盘
+     * @return 本次新增统计的崩溃记录条数，失败返回-1
+     */
+    int sync();
+
+    /**
+     * @brief countRepeat 统计时间范围内各exe的崩溃次数和重复率
+     * @param timeBegin 开始时间(ms)，<=0表示不限制
+     * @param timeEnd 结束时间(ms)，<=0表示不限制
+     */
+    QList<LOG_REPEAT_COREDUMP_INFO> countRepeat(qint64 timeBegin = -1, qint64 timeEnd = -1) const;
+
+    // 高频重复崩溃记录exe路径名单
+    QSet<QString> repeatExePaths() const;
+    void updateRepeatExePaths(const QList<LOG_REPEAT_COREDUMP_INFO> &infos);
+
+    // 解析coredumpctl list输出并累加到统计数据中，返回新增条数
+    int ingest(const QString &data);
+    void clear();
+
+    QString storePath() const { return m_storePath; }
+    void setStorePath(const QString &path);
+
+protected:
+    CoredumpStatistics();
+
+private:
+    struct ExeStat {
+        QMap<qint64, int> dayCounts;      // 儒略日 -> 崩溃次数
+        QVector<qint64> recentTimes;      // 最近时间窗口内的崩溃时间(秒)，用于不足一天的精确范围查询
+    };
+
+    void load();
+    bool save() const;
+    void pruneRecentTimes();
+    int countInRange(const ExeStat &stat, qint64 timeBegin, qint64 timeEnd) const;
+
+    QString m_storePath;
+    QHash<QString, ExeStat> m_stats;
+    qint64 m_cursor = 0;                // 最近一条已统计崩溃记录的时间(秒)
+    QSet<QString> m_cursorPids;         // 游标所在秒内已统计记录的pid，用于增量拉取时去重
+    QSet<QString> m_repeatExePaths;
+    qint64 m_repeatListTime = 0;        // 高频名单创建时间(秒)，每隔24小时清空一次
+};
+
+#endif // COREDUMPSTATISTICS_H
@@ -7,12 +7,18 @@
 
 #include <unistd.h>
 #include <pwd.h>
-#include <QDBusInterface>
-#include <QDBusReply>
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+#include <QDBusVariant>
+#include <QMutex>
 #include <QDebug>
 #include <QLoggingCategory>
 #include <QProcess>
 
+#include <functional>
+
 Q_DECLARE_LOGGING_CATEGORY(logApp)
 
 /**
@@ -25,29 +31,222 @@ DBusManager::DBusManager(QObject *parent) : QObject(parent)
     qCDebug(logApp) << "DBusManager initialized";
 }
 
-bool DBusManager::isSEOpen()
+/**
+ * @brief isBusUnavailable 服务、对象或接口不存在，与原先接口无效的情况相同
+ */
+static bool isBusUnavailable(const QDBusError &error)
+{
+    switch (error.type()) {
+    case QDBusError::ServiceUnknown:
+    case QDBusError::UnknownObject:
+    case QDBusError::UnknownInterface:
+    case QDBusError::Disconnected:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static QDBusPendingCall asyncCallSE(const QString &method, const QVariantList &args = QVariantList())
+{
+    // 直接构造方法调用，不需要QDBusInterface的同步自省
+    QDBusMessage msg = QDBusMessage::createMethodCall("com.deepin.daemon.SecurityEnhance", "/com/deepin/daemon/SecurityEnhance", "com.deepin.daemon.SecurityEnhance", method);
+    msg.setArguments(args);
+    return QDBusConnection::systemBus().asyncCall(msg);
+}
+
+static QString currentUserName()
+{
+    struct passwd *pwd = getpwuid(getuid());
+    return pwd ? QString(pwd->pw_name) : QString();
+}
+
+/**
+ * @brief The DBusQueryCache struct 查询结果缓存，尚未得到结果时保存在途的请求
+ * 锁只保护缓存本身，等待应答时不持有
+ */
+struct DBusQueryCache {
+    QMutex mutex;
+    QDBusPendingReply<QString> seStatusReply;
+    QDBusPendingReply<QString> seUserReply;
+    QDBusPendingReply<QDBusVariant> userNameReply;
+    bool seStatusRequested = false;
+    bool seUserRequested = false;
+    bool userNameRequested = false;
+
+    bool seOpenCached = false;
+    bool seOpen = false;
+    bool auditAdminCached = false;
+    bool auditAdmin = false;
+    bool homePathCached = false;
+    QString homePath;
+
+    void requestSEStatus()
+    {
+        if (!seStatusRequested) {
+            seStatusReply = asyncCallSE(QStringLiteral("Status"));
+            seStatusRequested = true;
+        }
+    }
+    void requestSEUser()
+    {
+        if (!seUserRequested) {
+            seUserReply = asyncCallSE(QStringLiteral("GetSEUserByName"), {currentUserName()});
+            seUserRequested = true;
+        }
+    }
+    void requestUserName()
+    {
+        if (!userNameRequested) {
+            QDBusMessage msg = QDBusMessage::createMethodCall("org.freedesktop.login1", "/org/freedesktop/login1/user/self", "org.freedesktop.DBus.Properties", "Get");
+            msg.setArguments({QStringLiteral("org.freedesktop.login1.User"), QStringLiteral("Name")});
+            userNameReply = QDBusConnection::systemBus().asyncCall(msg);
+            userNameRequested = true;
+        }
+    }
+
+    // 先到的结果生效，之后同一查询的结果不再覆盖
+    bool storeSEOpen(bool value)
+    {
+        QMutexLocker locker(&mutex);
+        if (!seOpenCached) {
+            seOpen = value;
+            seOpenCached = true;
+            seStatusReply = QDBusPendingReply<QString>();
+        }
+        return seOpen;
+    }
+    bool storeAuditAdmin(bool value)
+    {
+        QMutexLocker locker(&mutex);
+        if (!auditAdminCached) {
+            auditAdmin = value;
+            auditAdminCached = true;
+            seUserReply = QDBusPendingReply<QString>();
+        }
+        return auditAdmin;
+    }
+    QString storeHomePath(const QString &value)
+    {
+        QMutexLocker locker(&mutex);
+        if (!homePathCached) {
+            homePath = value;
+            homePathCached = true;
+            userNameReply = QDBusPendingReply<QDBusVariant>();
+        }
+        return homePath;
+    }
+};
+Q_GLOBAL_STATIC(DBusQueryCache, queryCache)
+
+static bool seOpenFromReply(const QDBusPendingReply<QString> &reply)
 {
-    qCDebug(logApp) << "Checking SecurityEnhance status";
     bool bIsSEOpen = false;
-    QDBusInterface interfaceSE("com.deepin.daemon.SecurityEnhance", "/com/deepin/daemon/SecurityEnhance", "com.deepin.daemon.SecurityEnhance", QDBusConnection::systemBus());
-    if (interfaceSE.isValid()) {
-        qCInfo(logApp) << "SecurityEnhance interface is valid, calling Status method";
-        QDBusReply<QString> reply = interfaceSE.call(QStringLiteral("Status"));
-        if (!reply.error().message().isEmpty()) {
+    if (reply.isError() && isBusUnavailable(reply.error())) {
+        qCWarning(logApp) << qPrintable(QString("isSEOpen failed! interface error: %1").arg(reply.error().message()));
+    } else {
+        if (reply.isError()) {
             qCWarning(logApp) << qPrintable(QString("com.deepin.daemon.SecurityEnhance.Status DBus error: %1").arg(reply.error().message()));
         }
 
-        if (reply.value() == "close") {
+        if (!reply.isError() && reply.value() == "close") {
             qCInfo(logApp) << "SecurityEnhance status: closed";
             bIsSEOpen = false;
         } else {
             qCInfo(logApp) << "SecurityEnhance status: open";
             bIsSEOpen = true;
         }
+    }
+    return bIsSEOpen;
+}
+
+static bool auditAdminFromReply(const QDBusPendingReply<QString> &reply)
+{
+    bool bIsAuditAdmin = false;
+    if (reply.isError() && isBusUnavailable(reply.error())) {
+        qCWarning(logApp) << qPrintable(QString("isAuditAdmin failed! interface error: %1").arg(reply.error().message()));
+    } else if (reply.isError()) {
+        qCWarning(logApp) << qPrintable(QString("com.deepin.daemon.SecurityEnhance.GetSEUserByName DBus error: %1").arg(reply.error().message()));
+    } else if (reply.value() == "audadm_u" || reply.value() == "auditadm_u") {
+        qCInfo(logApp) << "User is audit admin";
+        bIsAuditAdmin = true;
+    } else {
+        qCInfo(logApp) << "User is not audit admin";
+    }
+    return bIsAuditAdmin;
+}
+
+static QString homePathFromReply(const QDBusPendingReply<QDBusVariant> &reply)
+{
+    QString userName;
+    if (reply.isError())
+        qCWarning(logApp) << "Get login1 user name failed:" << reply.error().message();
+    else
+        userName = reply.value().variant().toString();
+    qCInfo(logApp) << "Got user name from FreeDesktop:" << userName;
+
+    QString homePath;
+    if (!userName.isEmpty()) {
+        homePath = "/home/" + userName;
+        qCInfo(logApp) << "Home path determined:" << homePath;
     } else {
-        qCWarning(logApp) << qPrintable(QString("isSEOpen failed! interface error: %1").arg(interfaceSE.lastError().message()));
+        qCWarning(logApp) << "Empty user name received from FreeDesktop";
     }
+    return homePath;
+}
 
+/**
+ * @brief watchReply 应答到达时在事件循环中执行done，不阻塞调用线程
+ */
+static void watchReply(const QDBusPendingCall &call, const std::function<void(const QDBusPendingCall &)> &done)
+{
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(call);
+    QObject::connect(watcher, &QDBusPendingCallWatcher::finished, [done](QDBusPendingCallWatcher *self) {
+        done(*self);
+        self->deleteLater();
+    });
+}
+
+void DBusManager::prefetch()
+{
+    qCDebug(logApp) << "Prefetching immutable DBus queries";
+    QMutexLocker locker(&queryCache->mutex);
+    if (!queryCache->seOpenCached) {
+        queryCache->requestSEStatus();
+        watchReply(queryCache->seStatusReply, [](const QDBusPendingCall &call) {
+            queryCache->storeSEOpen(seOpenFromReply(call));
+        });
+    }
+    if (!queryCache->auditAdminCached) {
+        queryCache->requestSEUser();
+        watchReply(queryCache->seUserReply, [](const QDBusPendingCall &call) {
+            queryCache->storeAuditAdmin(auditAdminFromReply(call));
+        });
+    }
+    if (!queryCache->homePathCached) {
+        queryCache->requestUserName();
+        watchReply(queryCache->userNameReply, [](const QDBusPendingCall &call) {
+            queryCache->storeHomePath(homePathFromReply(call));
+        });
+    }
+}
+
+bool DBusManager::isSEOpen()
+{
+    qCDebug(logApp) << "Checking SecurityEnhance status";
+    QDBusPendingReply<QString> reply;
+    {
+        QMutexLocker locker(&queryCache->mutex);
+        if (queryCache->seOpenCached)
+            return queryCache->seOpen;
+
+        queryCache->requestSEStatus();
+        reply = queryCache->seStatusReply;
+    }
+
+    // 预取的应答尚未处理时才在此等待，等待期间不持有锁
+    reply.waitForFinished();
+    const bool bIsSEOpen = queryCache->storeSEOpen(seOpenFromReply(reply));
     qCDebug(logApp) << "SecurityEnhance status check completed, returning:" << bIsSEOpen;
     return bIsSEOpen;
 }
@@ -55,32 +254,19 @@ bool DBusManager::isSEOpen()
 bool DBusManager::isAuditAdmin()
 {
     qCDebug(logApp) << "Checking audit admin status";
-    bool bIsAuditAdmin = false;
-
-    // 获取当前系统用户名
-    struct passwd* pwd = getpwuid(getuid());
-    QString currentUserName = pwd->pw_name;
-    qCInfo(logApp) << "Current user name:" << currentUserName;
-
-    // 根据用户名判断用户身份，查看是否为审计管理员
-    QDBusInterface interfaceSE("com.deepin.daemon.SecurityEnhance", "/com/deepin/daemon/SecurityEnhance", "com.deepin.daemon.SecurityEnhance", QDBusConnection::systemBus());
-    if (interfaceSE.isValid()) {
-        qCInfo(logApp) << "SecurityEnhance interface is valid, calling GetSEUserByName method";
-        QDBusReply<QString> reply = interfaceSE.call(QStringLiteral("GetSEUserByName"), currentUserName);
-        if (!reply.error().message().isEmpty()) {
-            qCWarning(logApp) << qPrintable(QString("com.deepin.daemon.SecurityEnhance.GetSEUserByName DBus error: %1").arg(reply.error().message()));
-        }
+    QDBusPendingReply<QString> reply;
+    {
+        QMutexLocker locker(&queryCache->mutex);
+        if (queryCache->auditAdminCached)
+            return queryCache->auditAdmin;
 
-        if (reply.value() == "audadm_u" || reply.value() == "auditadm_u") {
-            qCInfo(logApp) << "User is audit admin";
-            bIsAuditAdmin = true;
-        } else {
-            qCInfo(logApp) << "User is not audit admin";
-        }
-    } else {
-        qCWarning(logApp) << qPrintable(QString("isAuditAdmin failed! interface error: %1").arg(interfaceSE.lastError().message()));
+        // 根据当前系统用户名判断用户身份，查看是否为审计管理员
+        queryCache->requestSEUser();
+        reply = queryCache->seUserReply;
     }
 
+    reply.waitForFinished();
+    const bool bIsAuditAdmin = queryCache->storeAuditAdmin(auditAdminFromReply(reply));
     qCDebug(logApp) << "Audit admin check completed, returning:" << bIsAuditAdmin;
     return bIsAuditAdmin;
 }
@@ -88,18 +274,18 @@ bool DBusManager::isAuditAdmin()
 QString DBusManager::getHomePathByFreeDesktop()
 {
     qCDebug(logApp) << "Getting home path via FreeDesktop";
-    QString homePath;
-    QDBusInterface interface("org.freedesktop.login1", "/org/freedesktop/login1/user/self", "org.freedesktop.login1.User", QDBusConnection::systemBus());
-    QString userName = qvariant_cast<QString>(interface.property("Name"));
-    qCInfo(logApp) << "Got user name from FreeDesktop:" << userName;
+    QDBusPendingReply<QDBusVariant> reply;
+    {
+        QMutexLocker locker(&queryCache->mutex);
+        if (queryCache->homePathCached)
+            return queryCache->homePath;
 
-    if (!userName.isEmpty()) {
-        homePath = "/home/" + userName;
-        qCInfo(logApp) << "Home path determined:" << homePath;
-    } else {
-        qCWarning(logApp) << "Empty user name received from FreeDesktop";
+        queryCache->requestUserName();
+        reply = queryCache->userNameReply;
     }
 
+    reply.waitForFinished();
+    const QString homePath = queryCache->storeHomePath(homePathFromReply(reply));
     qCDebug(logApp) << "Home path lookup completed, returning:" << homePath;
     return homePath;
 }
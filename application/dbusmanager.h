@@ -15,6 +15,9 @@ class DBusManager : public QObject
     Q_OBJECT
 public:
     explicit DBusManager(QObject *parent = nullptr);
+    // 启动时提前发出下列查询，结果在运行期间不变，应答到达时在事件循环中写入缓存；
+    // 之后的调用直接使用缓存，应答尚未处理时不持锁等待已在途的请求
+    static void prefetch();
     // 是否开启等保四
     static bool isSEOpen();
     // 开启等保四情况下，判断是否为审计管理员身份
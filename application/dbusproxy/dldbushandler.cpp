@@ -3,14 +3,38 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "dldbushandler.h"
+#include "../DebugTimeManager.h"
 #include <QDebug>
 #include <QStandardPaths>
 #include <QLoggingCategory>
+#include <QDateTime>
 
 Q_DECLARE_LOGGING_CATEGORY(logApp)
 
+// 提权读取会话有效时长(ms)，与服务端保持一致，预留余量避免临界时刻会话在服务端已过期
+const qint64 READER_SESSION_LIFETIME = 10 * 60 * 1000;
+const qint64 READER_SESSION_MARGIN = 30 * 1000;
+// 需要等待用户输入密码的请求的超时时间(ms)
+const int DBUS_AUTH_TIMEOUT = 1200000;
+
 DLDBusHandler *DLDBusHandler::m_statichandeler = nullptr;
 
+// 文本按UTF-8编码(D-Bus传输的编码)计算字节数，不生成编码后的副本
+static qint64 utf8Size(const QString &text)
+{
+    qint64 size = 0;
+    for (const QChar ch : text) {
+        const ushort unicode = ch.unicode();
+        if (unicode < 0x80)
+            size += 1;
+        else if (unicode < 0x800 || ch.isSurrogate())
+            size += 2;  // 代理对合计4字节
+        else
+            size += 3;
+    }
+    return size;
+}
+
 DLDBusHandler *DLDBusHandler::instance(QObject *parent)
 {
     // qCDebug(logApp) << "DLDBusHandler::instance called with parent:" << parent;
@@ -24,6 +48,7 @@ DLDBusHandler *DLDBusHandler::instance(QObject *parent)
 DLDBusHandler::~DLDBusHandler()
 {
     qCDebug(logApp) << "DLDBusHandler destructor called";
+    closeSession();
     quit();
 }
 
@@ -35,6 +60,9 @@ DLDBusHandler::DLDBusHandler(QObject *parent)
                                           "/com/deepin/logviewer",
                                           QDBusConnection::systemBus(),
                                           this);
+    connect(m_dbus, &DeepinLogviewerInterface::kernelMessagesAvailable, this, [this](qulonglong lastSeq) {
+        emit kernelMessagesAvailable(lastSeq);
+    });
     //Note: when dealing with remote objects, it is not always possible to determine if it exists when creating a QDBusInterface.
     if (!m_dbus->isValid() && !m_dbus->lastError().message().isEmpty()) {
         qCCritical(logApp) << "dbus com.deepin.logviewer isValid false error:" << m_dbus->lastError() << m_dbus->lastError().message();
@@ -50,24 +78,18 @@ DLDBusHandler::DLDBusHandler(QObject *parent)
 QString DLDBusHandler::readLog(const QString &filePath)
 {
     qCDebug(logApp) << "DLDBusHandler::readLog called with filePath:" << filePath;
-    QString tempFilePath = createFilePathCacheFile(filePath);
-    QFile file(tempFilePath);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qWarning() << "Failed to open filePath cache file:" << tempFilePath;
-        return QString("");
-    }
-    const int fd = file.handle();
-    if (fd <= 0) {
-        qWarning() << "originPath file fd error. filePath cache file:" << tempFilePath;
-        return QString("");
+    PERF_SCOPE(readScope, PerfReadBytes, "readLog");
+    QString log;
+    {
+        PERF_SCOPE(dbusScope, PerfDBusCall, "readLog");
+        QDBusPendingReply<QString> reply = readLogAsync(filePath);
+        reply.waitForFinished();
+        if (reply.isError())
+            qCWarning(logApp) << "readLog failed:" << reply.error().message();
+        else
+            log = reply.value();
     }
-
-    qCDebug(logApp) << "Creating DBus file descriptor for reading log";
-    QDBusUnixFileDescriptor dbusFd(fd);
-    QString log = m_dbus->readLog(dbusFd);
-
-    file.close();
-    releaseFilePathCacheFile(tempFilePath);
+    PERF_SCOPE_VALUE(readScope, utf8Size(log));
     qCDebug(logApp) << "DLDBusHandler::readLog completed, log length:" << log.length();
 
     return log;
@@ -83,27 +105,114 @@ QString DLDBusHandler::readLog(const QString &filePath)
 QStringList DLDBusHandler::readLogLinesInRange(const QString &filePath, qint64 startLine, qint64 lineCount, bool bReverse)
 {
     qCDebug(logApp) << "DLDBusHandler::readLogLinesInRange called with filePath:" << filePath << "startLine:" << startLine << "lineCount:" << lineCount << "bReverse:" << bReverse;
+    PERF_SCOPE(readScope, PerfReadBytes, "readLogLinesInRange");
+    QStringList lines;
+    {
+        PERF_SCOPE(dbusScope, PerfDBusCall, "readLogLinesInRange");
+        QDBusPendingReply<QStringList> reply = readLogLinesInRangeAsync(filePath, startLine, lineCount, bReverse);
+        reply.waitForFinished();
+        if (reply.isError())
+            qCWarning(logApp) << "readLogLinesInRange failed:" << reply.error().message();
+        else
+            lines = reply.value();
+    }
+    qint64 readSize = 0;
+    for (const QString &line : lines)
+        readSize += utf8Size(line);
+    PERF_SCOPE_VALUE(readScope, readSize);
+    qCDebug(logApp) << "DLDBusHandler::readLogLinesInRange completed, lines count:" << lines.size();
+
+    return lines;
+}
+
+template<typename T, typename Call>
+QDBusPendingReply<T> DLDBusHandler::callWithPathFd(const QString &filePath, Call call)
+{
     QString tempFilePath = createFilePathCacheFile(filePath);
     QFile file(tempFilePath);
     if (!file.open(QIODevice::ReadOnly)) {
         qWarning() << "Failed to open filePath cache file:" << tempFilePath;
-        return QStringList();
+        releaseFilePathCacheFile(tempFilePath);
+        return QDBusPendingCall::fromError(QDBusError(QDBusError::Failed, "open filePath cache file failed"));
     }
     const int fd = file.handle();
     if (fd <= 0) {
         qWarning() << "originPath file fd error. filePath cache file:" << tempFilePath;
-        return QStringList();
+        releaseFilePathCacheFile(tempFilePath);
+        return QDBusPendingCall::fromError(QDBusError(QDBusError::Failed, "filePath cache file fd error"));
     }
 
-    qCDebug(logApp) << "Creating DBus file descriptor for reading log lines in range";
+    // 描述符在构造时被复制并随请求发出，之后关闭和删除缓存文件不影响服务端读取
     QDBusUnixFileDescriptor dbusFd(fd);
-    QStringList lines = m_dbus->readLogLinesInRange(dbusFd, startLine, lineCount, bReverse);
-
+    QDBusPendingReply<T> reply = call(dbusFd);
     file.close();
     releaseFilePathCacheFile(tempFilePath);
-    qCDebug(logApp) << "DLDBusHandler::readLogLinesInRange completed, lines count:" << lines.size();
+    return reply;
+}
 
-    return lines;
+QDBusPendingReply<QString> DLDBusHandler::readLogAsync(const QString &filePath)
+{
+    return callWithPathFd<QString>(filePath, [this](const QDBusUnixFileDescriptor &fd) {
+        return m_dbus->readLog(fd);
+    });
+}
+
+QDBusPendingReply<QStringList> DLDBusHandler::readLogLinesInRangeAsync(const QString &filePath, qint64 startLine, qint64 lineCount, bool bReverse)
+{
+    return callWithPathFd<QStringList>(filePath, [this, startLine, lineCount, bReverse](const QDBusUnixFileDescriptor &fd) {
+        return m_dbus->readLogLinesInRange(fd, startLine, lineCount, bReverse);
+    });
+}
+
+QDBusPendingReply<QStringList> DLDBusHandler::getFileInfoAsync(const QString &flag, bool unzip)
+{
+    return m_dbus->getFileInfo(flag, unzip);
+}
+
+QDBusPendingReply<qint64> DLDBusHandler::getLineCountAsync(const QString &filePath)
+{
+    return m_dbus->getLineCount(filePath);
+}
+
+QDBusPendingReply<quint64> DLDBusHandler::getFileSizeAsync(const QString &filePath)
+{
+    return m_dbus->getFileSize(filePath);
+}
+
+QDBusPendingReply<QString> DLDBusHandler::isFileExistAsync(const QString &filePath)
+{
+    return m_dbus->isFileExist(filePath);
+}
+
+QDBusPendingReply<QString> DLDBusHandler::executeCmdAsync(const QString &cmd)
+{
+    return m_dbus->executeCmd(cmd);
+}
+
+/*!
+ * \~chinese \brief DLDBusHandler::getLineCounts 获取多个文件的行数，请求全部发出后再等待结果
+ * \~chinese \param filePaths 文件路径
+ * \~chinese \return 与filePaths一一对应的行数，获取失败的文件为0
+ */
+QList<qint64> DLDBusHandler::getLineCounts(const QStringList &filePaths)
+{
+    qCDebug(logApp) << "DLDBusHandler::getLineCounts called with" << filePaths.size() << "files";
+    PERF_SCOPE(dbusScope, PerfDBusCall, "getLineCounts");
+    QList<QDBusPendingReply<qint64>> replies;
+    for (const QString &filePath : filePaths)
+        replies.append(getLineCountAsync(filePath));
+
+    QList<qint64> counts;
+    for (int i = 0; i < replies.size(); ++i) {
+        replies[i].waitForFinished();
+        if (replies[i].isError()) {
+            qCWarning(logApp) << "getLineCount failed:" << filePaths.at(i) << replies[i].error().message();
+            counts.append(0);
+        } else {
+            counts.append(replies[i].value());
+        }
+    }
+    return counts;
 }
 
 QString DLDBusHandler::openLogStream(const QString &filePath)
@@ -115,13 +224,104 @@ QString DLDBusHandler::openLogStream(const QString &filePath)
 QString DLDBusHandler::readLogInStream(const QString &token)
 {
     qCDebug(logApp) << "DLDBusHandler::readLogInStream called with token:" << token;
-    return m_dbus->readLogInStream(token);
+    PERF_SCOPE(readScope, PerfReadBytes, "readLogInStream");
+    QString log;
+    {
+        PERF_SCOPE(dbusScope, PerfDBusCall, "readLogInStream");
+        log = m_dbus->readLogInStream(token);
+    }
+    PERF_SCOPE_VALUE(readScope, utf8Size(log));
+    return log;
 }
 
 QStringList DLDBusHandler::whiteListOutPaths()
 {
     qCDebug(logApp) << "DLDBusHandler::whiteListOutPaths called";
-    return m_dbus->whiteListOutPaths();
+    QMutexLocker locker(&m_cacheMutex);
+    if (m_whiteListCached)
+        return m_whiteListOutPaths;
+
+    QDBusPendingReply<QStringList> reply = m_dbus->whiteListOutPaths();
+    reply.waitForFinished();
+    if (reply.isError()) {
+        // 服务未就绪时不缓存，下次重新获取
+        qCWarning(logApp) << "whiteListOutPaths failed:" << reply.error().message();
+        return QStringList();
+    }
+    m_whiteListOutPaths = reply.value();
+    m_whiteListCached = true;
+    return m_whiteListOutPaths;
+}
+
+/*!
+ * \~chinese \brief DLDBusHandler::ensureSession 确保持有有效的提权读取会话，
+ * \~chinese 会话过期或不存在时向服务端重新鉴权(可能弹出鉴权对话框)，多个读取线程共享同一会话
+ * \~chinese \return 鉴权是否通过
+ */
+bool DLDBusHandler::ensureSession()
+{
+    QMutexLocker locker(&m_sessionMutex);
+    if (!m_session.isEmpty() && QDateTime::currentMSecsSinceEpoch() < m_sessionExpireTime)
+        return true;
+
+    qCDebug(logApp) << "DLDBusHandler::ensureSession opening reader session";
+    // 等待用户输入密码，不使用默认的dbus超时时间
+    QDBusPendingReply<QString> reply = asyncCallWithTimeout(QStringLiteral("openSession"), {}, DBUS_AUTH_TIMEOUT);
+    reply.waitForFinished();
+
+    if (reply.isError() || reply.value().isEmpty()) {
+        qCWarning(logApp) << "open reader session failed:" << reply.error().message();
+        m_session.clear();
+        return false;
+    }
+
+    m_session = reply.value();
+    m_sessionExpireTime = QDateTime::currentMSecsSinceEpoch() + READER_SESSION_LIFETIME - READER_SESSION_MARGIN;
+    return true;
+}
+
+void DLDBusHandler::closeSession()
+{
+    QMutexLocker locker(&m_sessionMutex);
+    if (m_session.isEmpty())
+        return;
+
+    qCDebug(logApp) << "DLDBusHandler::closeSession called";
+    m_dbus->closeSession(m_session);
+    m_session.clear();
+    m_sessionExpireTime = 0;
+}
+
+void DLDBusHandler::cancelRequest(const QString &token)
+{
+    qCDebug(logApp) << "DLDBusHandler::cancelRequest called with token:" << token;
+    if (!token.isEmpty())
+        m_dbus->cancelRequest(token);
+}
+
+/*!
+ * \~chinese \brief DLDBusHandler::readKernelMessages 分批读取内核日志记录
+ * \~chinese \param sinceSeq 只读取序号大于该值的记录，0表示读取全部
+ * \~chinese \param maxCount 本次最多读取的记录数
+ * \~chinese \return 每行一条记录，格式为"级别,序号,时间戳(us);消息"，为空表示读取结束
+ */
+QString DLDBusHandler::readKernelMessages(quint64 sinceSeq, int maxCount)
+{
+    qCDebug(logApp) << "DLDBusHandler::readKernelMessages called with sinceSeq:" << sinceSeq << "maxCount:" << maxCount;
+    PERF_SCOPE(dbusScope, PerfDBusCall, "readKernelMessages");
+    QDBusPendingReply<QString> reply = m_dbus->readKernelMessages(sinceSeq, maxCount);
+    reply.waitForFinished();
+    if (reply.isError()) {
+        qCWarning(logApp) << "call dbus iterface 'readKernelMessages()' failed. error info:" << reply.error().message();
+        return QString();
+    }
+    return reply.value();
+}
+
+bool DLDBusHandler::followKernelMessages(bool enable)
+{
+    qCDebug(logApp) << "DLDBusHandler::followKernelMessages called with enable:" << enable;
+    return m_dbus->followKernelMessages(enable);
 }
 
 /*!
@@ -146,7 +346,8 @@ void DLDBusHandler::quit()
 QStringList DLDBusHandler::getFileInfo(const QString &flag, bool unzip)
 {
     qCDebug(logApp) << "DLDBusHandler::getFileInfo called with flag:" << flag << "unzip:" << unzip;
-    QDBusPendingReply<QStringList> reply = m_dbus->getFileInfo(flag, unzip);
+    PERF_SCOPE(dbusScope, PerfDBusCall, "getFileInfo");
+    QDBusPendingReply<QStringList> reply = getFileInfoAsync(flag, unzip);
     reply.waitForFinished();
     if (reply.isError()) {
         qCWarning(logApp) << "call dbus iterface 'getFileInfo()' failed. error info:" << reply.error().message();
@@ -160,6 +361,7 @@ QStringList DLDBusHandler::getFileInfo(const QString &flag, bool unzip)
 QStringList DLDBusHandler::getOtherFileInfo(const QString &flag, bool unzip)
 {
     qCDebug(logApp) << "DLDBusHandler::getOtherFileInfo called with flag:" << flag << "unzip:" << unzip;
+    PERF_SCOPE(dbusScope, PerfDBusCall, "getOtherFileInfo");
     QDBusPendingReply<QStringList> reply = m_dbus->getOtherFileInfo(flag, unzip);
     reply.waitForFinished();
     QStringList filePathList;
@@ -176,10 +378,9 @@ bool DLDBusHandler::exportOpsLog(const QString &outDir, const QString &userHomeD
 {
     qCDebug(logApp) << "DLDBusHandler::exportOpsLog called:" << outDir << userHomeDir;
 
-    m_dbus->setTimeout(1200000);
-    QDBusPendingReply<bool> reply = m_dbus->exportOpsLog(outDir, userHomeDir);
+    QDBusPendingReply<bool> reply = asyncCallWithTimeout(QStringLiteral("exportOpsLog"),
+                                                         {QVariant::fromValue(outDir), QVariant::fromValue(userHomeDir)}, DBUS_AUTH_TIMEOUT);
     reply.waitForFinished();
-    m_dbus->setTimeout(-1);
 
     if (reply.isError()) {
         qCWarning(logApp) << "call dbus iterface 'exportOpsLog()' failed. error info:" << reply.error().message();
@@ -193,13 +394,14 @@ bool DLDBusHandler::exportOpsLog(const QString &outDir, const QString &userHomeD
 bool DLDBusHandler::exportLog(const QString &outDir, const QString &in, bool isFile)
 {
     qCDebug(logApp) << "DLDBusHandler::exportLog called with outDir:" << outDir << "in:" << in << "isFile:" << isFile;
+    PERF_SCOPE(dbusScope, PerfDBusCall, "exportLog");
     return m_dbus->exportLog(outDir, in, isFile);
 }
 
 bool DLDBusHandler::isFileExist(const QString &filePath)
 {
     qCDebug(logApp) << "DLDBusHandler::isFileExist called with filePath:" << filePath;
-    QString ret = m_dbus->isFileExist(filePath);
+    QString ret = isFileExistAsync(filePath);
     qCDebug(logApp) << "isFileExist result:" << ret;
     return ret == "exist";
 }
@@ -207,25 +409,73 @@ bool DLDBusHandler::isFileExist(const QString &filePath)
 quint64 DLDBusHandler::getFileSize(const QString &filePath)
 {
     qCDebug(logApp) << "DLDBusHandler::getFileSize called with filePath:" << filePath;
-    return m_dbus->getFileSize(filePath);
+    return getFileSizeAsync(filePath);
 }
 
 qint64 DLDBusHandler::getLineCount(const QString &filePath)
 {
     qCDebug(logApp) << "DLDBusHandler::getLineCount called with filePath:" << filePath;
-    return m_dbus->getLineCount(filePath);
+    PERF_SCOPE(dbusScope, PerfDBusCall, "getLineCount");
+    return getLineCountAsync(filePath);
+}
+
+QStringList DLDBusHandler::getFileIdentity(const QString &filePath)
+{
+    qCDebug(logApp) << "DLDBusHandler::getFileIdentity called with filePath:" << filePath;
+    PERF_SCOPE(dbusScope, PerfDBusCall, "getFileIdentity");
+    QDBusPendingReply<QStringList> reply = m_dbus->getFileIdentity(filePath);
+    reply.waitForFinished();
+    if (reply.isError()) {
+        // 旧版本服务没有该接口，调用方不使用解析缓存
+        qCWarning(logApp) << "getFileIdentity failed:" << reply.error().message();
+        return QStringList();
+    }
+    return reply.value();
+}
+
+QByteArray DLDBusHandler::readLogFromOffset(const QString &filePath, qint64 offset, qint64 maxBytes)
+{
+    qCDebug(logApp) << "DLDBusHandler::readLogFromOffset called with filePath:" << filePath << "offset:" << offset;
+    PERF_SCOPE(readScope, PerfReadBytes, "readLogFromOffset");
+    QByteArray log;
+    {
+        PERF_SCOPE(dbusScope, PerfDBusCall, "readLogFromOffset");
+        QDBusPendingReply<QByteArray> reply = m_dbus->readLogFromOffset(filePath, offset, maxBytes);
+        reply.waitForFinished();
+        if (reply.isError())
+            qCWarning(logApp) << "readLogFromOffset failed:" << reply.error().message();
+        else
+            log = reply.value();
+    }
+    PERF_SCOPE_VALUE(readScope, log.size());
+    return log;
+}
+
+QStringList DLDBusHandler::filterLogFilesByTime(const QStringList &files, qint64 timeBegin, qint64 timeEnd)
+{
+    qCDebug(logApp) << "DLDBusHandler::filterLogFilesByTime called with" << files.size() << "files";
+    PERF_SCOPE(dbusScope, PerfDBusCall, "filterLogFilesByTime");
+    QDBusPendingReply<QStringList> reply = m_dbus->filterLogFilesByTime(files, timeBegin, timeEnd);
+    reply.waitForFinished();
+    if (reply.isError()) {
+        // 过滤失败时不跳过任何文件
+        qCWarning(logApp) << "filterLogFilesByTime failed:" << reply.error().message();
+        return files;
+    }
+    return reply.value();
 }
 
 QString DLDBusHandler::executeCmd(const QString &cmd)
 {
     qCDebug(logApp) << "DLDBusHandler::executeCmd called with cmd:" << cmd;
-    return m_dbus->executeCmd(cmd);
+    return executeCmdAsync(cmd);
 }
 
 QString DLDBusHandler::createFilePathCacheFile(const QString &logFilePath)
 {
     qCDebug(logApp) << "DLDBusHandler::createFilePathCacheFile called with logFilePath:" << logFilePath;
-    QString tempFilePath = m_tempDir.path() + QDir::separator() + "Log_file_path.txt";
+    // 多个线程的请求可能同时在途，每次使用不同的文件
+    QString tempFilePath = m_tempDir.path() + QDir::separator() + QString("Log_file_path_%1.txt").arg(++m_cacheFileSerial);
 
     QFile tmpFile(tempFilePath);
     if (!tmpFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
@@ -249,3 +499,10 @@ void DLDBusHandler::releaseFilePathCacheFile(const QString &cacheFilePath)
         QFile::remove(cacheFilePath);
     }
 }
+
+QDBusPendingCall DLDBusHandler::asyncCallWithTimeout(const QString &method, const QList<QVariant> &args, int timeout)
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(m_dbus->service(), m_dbus->path(), m_dbus->interface(), method);
+    msg.setArguments(args);
+    return m_dbus->connection().asyncCall(msg, timeout);
+}
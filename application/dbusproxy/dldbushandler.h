@@ -7,6 +7,9 @@
 
 #include "dldbusinterface.h"
 #include <QObject>
+#include <QMutex>
+
+#include <atomic>
 
 class DLDBusHandler : public QObject
 {
@@ -25,17 +28,52 @@ public:
     bool isFileExist(const QString &filePath);
     quint64 getFileSize(const QString &filePath);
     qint64 getLineCount(const QString &filePath);
+    // 文件标识[设备号, inode, 修改时间, 大小, 开头摘要]，服务不支持时为空
+    QStringList getFileIdentity(const QString &filePath);
+    // 从字节偏移读取完整行，返回空表示已到文件末尾或读取失败
+    QByteArray readLogFromOffset(const QString &filePath, qint64 offset, qint64 maxBytes);
+    // 跳过首尾行时间与[timeBegin, timeEnd]无交集的日志文件，避免解压无关的轮转归档
+    QStringList filterLogFilesByTime(const QStringList &files, qint64 timeBegin, qint64 timeEnd);
     QString executeCmd(const QString &cmd);
     QString openLogStream(const QString &filePath);
     QString readLogInStream(const QString &token);
     QStringList whiteListOutPaths();
 
+    // 异步接口：立即发出请求并返回，多个请求可同时在途，调用方需要结果时再等待，可在任意线程调用
+    QDBusPendingReply<QString> readLogAsync(const QString &filePath);
+    QDBusPendingReply<QStringList> readLogLinesInRangeAsync(const QString &filePath, qint64 startLine = 0, qint64 lineCount = 500, bool bReverse = true);
+    QDBusPendingReply<QStringList> getFileInfoAsync(const QString &flag, bool unzip = true);
+    QDBusPendingReply<qint64> getLineCountAsync(const QString &filePath);
+    QDBusPendingReply<quint64> getFileSizeAsync(const QString &filePath);
+    // 返回"exist"表示文件存在
+    QDBusPendingReply<QString> isFileExistAsync(const QString &filePath);
+    QDBusPendingReply<QString> executeCmdAsync(const QString &cmd);
+    // 同时发出各文件的行数请求再统一等待，多个轮转文件只需一次往返
+    QList<qint64> getLineCounts(const QStringList &filePaths);
+    // 确保持有有效的提权读取会话，会话有效期内多次读取只需鉴权一次
+    bool ensureSession();
+    void closeSession();
+    // 取消流式读取请求
+    void cancelRequest(const QString &token);
+    // 读取序号大于sinceSeq的内核日志记录
+    QString readKernelMessages(quint64 sinceSeq, int maxCount);
+    bool followKernelMessages(bool enable);
+
+signals:
+    // 跟随模式下内核日志有新记录
+    void kernelMessagesAvailable(quint64 lastSeq);
+
 private:
     explicit DLDBusHandler(QObject *parent = nullptr);
 
 private:
     QString createFilePathCacheFile(const QString& logFilePath);
     void releaseFilePathCacheFile(const QString &cacheFilePath);
+    // 通过文件描述符传递路径发出请求，请求发出后即可删除路径缓存文件
+    template<typename T, typename Call>
+    QDBusPendingReply<T> callWithPathFd(const QString &filePath, Call call);
+    // 以单独的超时时间发出请求，不修改共享接口对象的超时设置，其他线程的请求不受影响
+    QDBusPendingCall asyncCallWithTimeout(const QString &method, const QList<QVariant> &args, int timeout);
 
 private:
     static DLDBusHandler *m_statichandeler;
@@ -43,6 +81,17 @@ private:
     QStringList filePath;
 
     QTemporaryDir m_tempDir;
+
+    QMutex m_sessionMutex;
+    QString m_session;
+    qint64 m_sessionExpireTime = 0;
+
+    // 路径缓存文件序号，同时在途的请求各用一个文件
+    std::atomic<quint64> m_cacheFileSerial {0};
+    // 导出白名单在服务运行期间不变，只获取一次
+    QMutex m_cacheMutex;
+    QStringList m_whiteListOutPaths;
+    bool m_whiteListCached = false;
 };
 
 #endif // DLDBUSHANDLER_H
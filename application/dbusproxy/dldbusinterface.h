@@ -134,6 +134,27 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("getLineCount"), argumentList);
     }
 
+    inline QDBusPendingReply<QStringList> getFileIdentity(const QString &filePath)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(filePath);
+        return asyncCallWithArgumentList(QStringLiteral("getFileIdentity"), argumentList);
+    }
+
+    inline QDBusPendingReply<QByteArray> readLogFromOffset(const QString &filePath, qint64 offset, qint64 maxBytes)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(filePath) << QVariant::fromValue(offset) << QVariant::fromValue(maxBytes);
+        return asyncCallWithArgumentList(QStringLiteral("readLogFromOffset"), argumentList);
+    }
+
+    inline QDBusPendingReply<QStringList> filterLogFilesByTime(const QStringList &files, qint64 timeBegin, qint64 timeEnd)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(files) << QVariant::fromValue(timeBegin) << QVariant::fromValue(timeEnd);
+        return asyncCallWithArgumentList(QStringLiteral("filterLogFilesByTime"), argumentList);
+    }
+
     inline QDBusPendingReply<QString> executeCmd(const QString &cmd)
     {
         QList<QVariant> argumentList;
@@ -153,7 +174,42 @@ public Q_SLOTS: // METHODS
         argumentList << QVariant::fromValue(outDir) << QVariant::fromValue(userHomeDir);
         return asyncCallWithArgumentList(QStringLiteral("exportOpsLog"), argumentList);
     }
+
+    inline QDBusPendingReply<QString> openSession()
+    {
+        QList<QVariant> argumentList;
+        return asyncCallWithArgumentList(QStringLiteral("openSession"), argumentList);
+    }
+
+    inline QDBusPendingReply<bool> closeSession(const QString &session)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(session);
+        return asyncCallWithArgumentList(QStringLiteral("closeSession"), argumentList);
+    }
+
+    inline QDBusPendingReply<bool> cancelRequest(const QString &token)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(token);
+        return asyncCallWithArgumentList(QStringLiteral("cancelRequest"), argumentList);
+    }
+
+    inline QDBusPendingReply<QString> readKernelMessages(qulonglong sinceSeq, int maxCount)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(sinceSeq) << QVariant::fromValue(maxCount);
+        return asyncCallWithArgumentList(QStringLiteral("readKernelMessages"), argumentList);
+    }
+
+    inline QDBusPendingReply<bool> followKernelMessages(bool enable)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(enable);
+        return asyncCallWithArgumentList(QStringLiteral("followKernelMessages"), argumentList);
+    }
 Q_SIGNALS: // SIGNALS
+    void kernelMessagesAvailable(qulonglong lastSeq);
 };
 
 namespace com {
@@ -8,6 +8,8 @@
 #include "logfileparser.h"
 #include "exportprogressdlg.h"
 #include "logbackend.h"
+#include "logcolumnsorter.h"
+#include "logtimeline.h"
 #include "utils.h"
 #include "DebugTimeManager.h"
 #include "parsethread/parsethreadbase.h"
@@ -170,7 +172,12 @@ void DisplayContent::initUI()
     //this->setStyleSheet("background-color:rgb(255,0,0)");
 
     // layout for widgets
+    m_histogramWgt = new LogHistogramWidget(this);
+    m_histogramWgt->setAccessibleName("histogramWidget");
+    m_histogramWgt->setHistogram(m_pLogBackend->histogram());
+
     QVBoxLayout *vLayout = new QVBoxLayout(this);
+    vLayout->addWidget(m_histogramWgt);
     vLayout->addWidget(m_splitter);
     vLayout->setContentsMargins(0, 0, 0, 0);
     vLayout->setSpacing(3);
@@ -238,6 +245,13 @@ void DisplayContent::initTableView()
     m_pModel = new QStandardItemModel(this);
     m_treeView->setModel(m_pModel);
     m_treeView->setContextMenuPolicy(Qt::CustomContextMenu);
+
+    // 点击表头按列排序，不使用model自带的排序，逐个比较item在数据量大时会阻塞界面
+    // 未排序时指示列为-1，不绘制排序箭头
+    m_treeView->header()->setSectionsClickable(true);
+    m_treeView->header()->setSortIndicatorShown(true);
+    m_treeView->header()->setSortIndicator(-1, Qt::AscendingOrder);
+    m_sorter = new LogColumnSorter(this);
 }
 
 /**
@@ -251,6 +265,9 @@ void DisplayContent::initConnections()
             SLOT(slot_tableItemClicked(const QModelIndex &)));
 
     connect(this, &DisplayContent::sigDetailInfo, m_detailWgt, &logDetailInfoWidget::slot_DetailInfo);
+    connect(m_histogramWgt, &LogHistogramWidget::rangeSelected, this, &DisplayContent::slot_histogramRangeSelected);
+    connect(m_treeView->header(), &QHeaderView::sortIndicatorChanged, this, &DisplayContent::slot_sortIndicatorChanged);
+    connect(m_sorter, &LogColumnSorter::sorted, this, &DisplayContent::slot_sorted);
     connect(m_pLogBackend, &LogBackend::parseFinished, this, &DisplayContent::slot_parseFinished,
             Qt::QueuedConnection);
     connect(m_pLogBackend, &LogBackend::logData, this, &DisplayContent::slot_logData,
@@ -303,6 +320,8 @@ void DisplayContent::initConnections()
     connect(m_pLogBackend, SIGNAL(dnfFinished(QList<LOG_MSG_DNF>)), this, SLOT(slot_dnfFinished(QList<LOG_MSG_DNF>)));
     connect(m_pLogBackend, &LogBackend::dmesgFinished, this, &DisplayContent::slot_dmesgFinished,
             Qt::QueuedConnection);
+    // 内核日志跟随模式，新记录插入到表格头部，不重建表格
+    connect(m_pLogBackend, &LogBackend::dmesgAppended, this, &DisplayContent::slot_dmesgAppended);
     connect(m_pLogBackend, &LogBackend::OOCData, this, &DisplayContent::slot_OOCData,
             Qt::QueuedConnection);
     connect(m_pLogBackend, &LogBackend::OOCFinished, this, &DisplayContent::slot_OOCFinished,
@@ -364,6 +383,8 @@ void DisplayContent::insertLogTable(const QList<QString> &list, int start, int e
         midList = midList.mid(start, end - start);
     }
 
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertLogTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel, type);
 }
 
@@ -421,6 +442,20 @@ void DisplayContent::parseListToModel(const QList<QString> &list, QStandardItemM
 int DisplayContent::loadSegementPage(bool bNext/* = true*/, bool bReset/* = true*/)
 {
     qCDebug(logApp) << "Loading segment page, direction:" << (bNext ? "next" : "previous") << "reset:" << bReset;
+    // 分段数由文件总行数决定，行数应答到达后再继续加载，界面线程不等待
+    if (!m_pLogBackend->isSegementCountReady(m_flag)) {
+        if (bReset)
+            clearAllDatas();
+        setLoadState(DATA_LOADING, !bReset);
+        const LOG_FLAG flag = m_flag;
+        m_pLogBackend->requestSegementCount(flag, [this, flag, bNext, bReset]() {
+            if (m_flag == flag)
+                loadSegementPage(bNext, bReset);
+        });
+        // 尚不能确定是否还有数据，按仍有数据处理
+        return 0;
+    }
+
     int nSegementIndex = m_pLogBackend->getNextSegementIndex(m_flag, bNext);
     qCDebug(logApp) << "Segment page index:" << nSegementIndex;
     if(nSegementIndex == -1) {
@@ -756,6 +791,7 @@ void DisplayContent::generateKernFile(int id, const QString &iSearchStr)
 
     if (id >= ALL && id <= THREE_MONTHS) {
         m_pLogBackend->m_type2Filter[KERN] = kernFilter;
+        m_pLogBackend->resetSegementCount();
         loadSegementPage();
     }
 }
@@ -811,6 +847,8 @@ void DisplayContent::insertKernTable(const QList<LOG_MSG_JOURNAL> &list, int sta
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertKernTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -827,6 +865,8 @@ void DisplayContent::insertDpkgTable(const QList<LOG_MSG_DPKG> &list, int start,
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertDpkgTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -837,6 +877,8 @@ void DisplayContent::insertXorgTable(const QList<LOG_MSG_XORG> &list, int start,
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertXorgTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -847,6 +889,8 @@ void DisplayContent::insertBootTable(const QList<LOG_MSG_BOOT> &list, int start,
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertBootTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -857,6 +901,8 @@ void DisplayContent::insertKwinTable(const QList<LOG_MSG_KWIN> &list, int start,
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertKwinTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -867,6 +913,8 @@ void DisplayContent::insertNormalTable(const QList<LOG_MSG_NORMAL> &list, int st
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertNormalTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -877,6 +925,8 @@ void DisplayContent::insertOOCTable(const QList<LOG_FILE_OTHERORCUSTOM> &list, i
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertOOCTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -887,6 +937,8 @@ void DisplayContent::insertAuditTable(const QList<LOG_MSG_AUDIT> &list, int star
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertAuditTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -897,6 +949,8 @@ void DisplayContent::insertAuthTable(const QList<LOG_MSG_AUTH> &list, int start,
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertAuthTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -907,6 +961,8 @@ void DisplayContent::insertCoredumpTable(const QList<LOG_MSG_COREDUMP> &list, in
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertCoredumpTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -1183,6 +1239,7 @@ void DisplayContent::generateKwinFile(const KWIN_FILTERS &iFilters)
     filter.type = Kwin;
     filter.segementIndex = -1;
     m_pLogBackend->m_type2Filter[Kwin] = filter;
+    m_pLogBackend->resetSegementCount();
     loadSegementPage();
 }
 
@@ -1292,6 +1349,8 @@ void DisplayContent::generateNormalFile(int id)
 void DisplayContent::insertJournalTable(QList<LOG_MSG_JOURNAL> logList, int start, int end)
 {
     qCDebug(logApp) << "DisplayContent::insertJournalTable called with start:" << start << "end:" << end;
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertJournalTable");
+    PERF_SCOPE_VALUE(insertScope, end - start);
     DStandardItem *item = nullptr;
     QList<QStandardItem *> items;
     for (int i = start; i < end; i++) {
@@ -1443,6 +1502,8 @@ void DisplayContent::createJournalBootTableForm()
 void DisplayContent::insertJournalBootTable(QList<LOG_MSG_JOURNAL> logList, int start, int end)
 {
     qCDebug(logApp) << "DisplayContent::insertJournalBootTable called with start:" << start << "end:" << end;
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertJournalBootTable");
+    PERF_SCOPE_VALUE(insertScope, end - start);
     DStandardItem *item = new DStandardItem();
     QList<QStandardItem *> items;
     for (int i = start; i < end; i++) {
@@ -1633,6 +1694,8 @@ void DisplayContent::insertDmesgTable(const QList<LOG_MSG_DMESG> &list, int star
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertDmesgTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -1643,6 +1706,8 @@ void DisplayContent::insertDnfTable(const QList<LOG_MSG_DNF> &list, int start, i
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertDnfTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -1733,6 +1798,8 @@ void DisplayContent::slot_BtnSelected(int btnId, int lId, QModelIndex idx)
         generateAuthFile(BUTTONID(m_curBtnId));
     } else if(treeData.contains(COREDUMP_TREE_DATA, Qt::CaseInsensitive)) {
         generateCoredumpFile(btnId);
+    } else if (treeData == TIMELINE_TREE_DATA) {
+        generateTimelineFile(btnId);
     }
 }
 
@@ -1859,7 +1926,14 @@ void DisplayContent::slot_logCatelogueClicked(const QModelIndex &index)
     } else if (itemData.contains(COREDUMP_TREE_DATA, Qt::CaseInsensitive)) {
         m_flag = COREDUMP;
         m_pLogBackend->setFlag(m_flag);
+    } else if (itemData == TIMELINE_TREE_DATA) {
+        m_flag = TIMELINE;
+        m_pLogBackend->setFlag(m_flag);
     }
+
+    // 切换到其他日志种类时停止时间线的各来源解析
+    if (m_flag != TIMELINE)
+        retireTimeline();
 }
 
 /**
@@ -1868,6 +1942,8 @@ void DisplayContent::slot_logCatelogueClicked(const QModelIndex &index)
 void DisplayContent::slot_exportClicked()
 {
     qCDebug(logApp) << "DisplayContent::slot_exportClicked called";
+    if (m_flag == TIMELINE)
+        return;
     QString logName;
     if (m_curListIdx.isValid())
         logName = QString("/%1").arg(m_curListIdx.data().toString());
@@ -2225,10 +2301,34 @@ void DisplayContent::slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list)
         return;
     }
 
+    // 跟随模式下新记录按最新在前合入，排序失效
+    resetSort();
     createDmesgTable(list);
     PERF_PRINT_END("POINT-03", "type=dmesg");
 }
 
+/**
+ * @brief DisplayContent::slot_dmesgAppended 跟随模式读取到新的内核日志，插入到表格头部
+ * 保留已加载的行、选中项与滚动位置，未处于顶部时可见内容不随新行移动
+ * @param list 按当前条件筛选后的新记录，最新在前
+ */
+void DisplayContent::slot_dmesgAppended(const QList<LOG_MSG_DMESG> &list)
+{
+    qCDebug(logApp) << "DisplayContent::slot_dmesgAppended called with list size:" << list.size();
+    if (m_flag != Dmesg || list.isEmpty())
+        return;
+
+    // 新行按时间插入在前，原排序失效
+    resetSort();
+    QScrollBar *scrollBar = m_treeView->verticalScrollBar();
+    const int valuePixel = scrollBar->value();
+    parseListToModel(list, m_pModel, 0);
+    if (m_curTreeIndex.isValid())
+        m_curTreeIndex = m_pModel->index(m_curTreeIndex.row() + list.size(), m_curTreeIndex.column());
+    if (valuePixel > scrollBar->minimum())
+        scrollBar->setValue(valuePixel + list.size() * m_treeView->singleRowHeight());
+}
+
 /**
  * @brief DisplayContent::slot_journalData 系统日志数据获取线程槽函数,系统日志为获取500条就会执行此信号,不是一次把所有数据传进来,所以执行槽函数应该为每次获取向现在的model中添加而不是重置
  * @param index 槽函数发出线程的标记量序号
@@ -2525,6 +2625,14 @@ void DisplayContent::slot_vScrollValueChanged(int valuePixel)
     //算出现在滚动了多少页
     int rateValue = (value + 25) / SINGLE_LOAD;
 
+    // 接近分段边缘时在后台预取相邻分段，翻页时不必等待解析
+    if (m_flag == KERN || m_flag == Kwin) {
+        if (value + SEGEMENT_PREFETCH_DISTANCE >= m_pLogBackend->m_type2LogData[m_flag].size())
+            m_pLogBackend->prefetchSegement(m_flag, true);
+        else if (value <= SEGEMENT_PREFETCH_DISTANCE)
+            m_pLogBackend->prefetchSegement(m_flag, false);
+    }
+
     // 滚动到顶部，启动向上分段加载
     if (m_treeView->verticalScrollBar()->minimum() == m_treeView->verticalScrollBar()->value() && 0 == rateValue) {
         loadSegementPage(false);
@@ -2674,10 +2782,11 @@ void DisplayContent::slot_vScrollValueChanged(int valuePixel)
         if (value < SINGLE_LOAD * rateValue - 20 || value < SINGLE_LOAD * rateValue) {
             if (m_limitTag >= rateValue)
                 return;
-            int leftCnt = m_pLogBackend->dmesgList.count() - SINGLE_LOAD * rateValue;
-            int end = leftCnt > SINGLE_LOAD ? SINGLE_LOAD : leftCnt;
+            // 跟随模式会在头部插入新行，从已加载的行数开始续加载
+            int start = m_pModel->rowCount();
+            int end = qBound(0, m_pLogBackend->dmesgList.count() - start, SINGLE_LOAD);
 
-            insertDmesgTable(m_pLogBackend->dmesgList, SINGLE_LOAD * rateValue, SINGLE_LOAD * rateValue + end);
+            insertDmesgTable(m_pLogBackend->dmesgList, start, start + end);
             m_limitTag = rateValue;
             m_treeView->verticalScrollBar()->setValue(value);
         }
@@ -2739,6 +2848,18 @@ void DisplayContent::slot_vScrollValueChanged(int valuePixel)
         }
     }
     break;
+    case TIMELINE: {
+        if (value < SINGLE_LOAD * rateValue - 20 || value < SINGLE_LOAD * rateValue) {
+            if (m_limitTag >= rateValue || !m_timeline)
+                return;
+
+            // 归并结果按页取出，只归并到将要显示的位置
+            insertTimelineTable(SINGLE_LOAD * (rateValue + 1) - m_pModel->rowCount());
+            m_limitTag = rateValue;
+            m_treeView->verticalScrollBar()->setValue(valuePixel);
+        }
+    }
+    break;
     default:
         break;
     }
@@ -2752,18 +2873,26 @@ void DisplayContent::slot_searchResult(const QString &str)
 {
     qCDebug(logApp) << "DisplayContent::slot_searchResult called";
     m_pLogBackend->m_currentSearchStr = str;
+    // 筛选结果按原有顺序重新生成
+    resetSort();
     if (m_flag == NONE) {
         qCDebug(logApp) << "m_flag == NONE";
         return;
     }
 
+    // 时间线在各来源解析时按关键字筛选，重新生成
+    if (m_flag == TIMELINE) {
+        generateTimelineFile(m_curBtnId, str);
+        return;
+    }
+
     bool bHasNext = false;
     switch (m_flag) {
     case JOURNAL: {
         qCDebug(logApp) << "DisplayContent::slot_searchResult JOURNAL";
         m_pLogBackend->jList = m_pLogBackend->jListOrigin;
         m_pLogBackend->jList.clear();
-        m_pLogBackend->jList = LogBackend::filterJournal(m_pLogBackend->m_currentSearchStr, m_pLogBackend->jListOrigin);
+        m_pLogBackend->jList = m_pLogBackend->narrowByTime(LogBackend::filterJournal(m_pLogBackend->m_currentSearchStr, m_pLogBackend->jListOrigin));
         //清空model和分页重新加载
         createJournalTableForm();
         createJournalTableStart(m_pLogBackend->jList);
@@ -2822,7 +2951,7 @@ void DisplayContent::slot_searchResult(const QString &str)
     case DPKG: {
         qCDebug(logApp) << "DisplayContent::slot_searchResult DPKG";
         m_pLogBackend->dList.clear();
-        m_pLogBackend->dList = LogBackend::filterDpkg(m_pLogBackend->m_currentSearchStr, m_pLogBackend->dListOrigin);
+        m_pLogBackend->dList = m_pLogBackend->narrowByTime(LogBackend::filterDpkg(m_pLogBackend->m_currentSearchStr, m_pLogBackend->dListOrigin));
         createDpkgTableForm();
         createDpkgTableStart(m_pLogBackend->dList);
     }
@@ -2831,7 +2960,7 @@ void DisplayContent::slot_searchResult(const QString &str)
         qCDebug(logApp) << "DisplayContent::slot_searchResult APP";
         m_pLogBackend->appList.clear();
         m_pLogBackend->m_appFilter.searchstr = m_pLogBackend->m_currentSearchStr;
-        m_pLogBackend->appList = LogBackend::filterApp(m_pLogBackend->m_appFilter, m_pLogBackend->appListOrigin);
+        m_pLogBackend->appList = m_pLogBackend->narrowByTime(LogBackend::filterApp(m_pLogBackend->m_appFilter, m_pLogBackend->appListOrigin));
         createAppTableForm();
         createAppTable(m_pLogBackend->appList);
     }
@@ -2839,7 +2968,7 @@ void DisplayContent::slot_searchResult(const QString &str)
     case Normal: {
         qCDebug(logApp) << "DisplayContent::slot_searchResult Normal";
         m_pLogBackend->m_normalFilter.searchstr = m_pLogBackend->m_currentSearchStr;
-        m_pLogBackend->nortempList = LogBackend::filterNomal(m_pLogBackend->m_normalFilter, m_pLogBackend->norList);
+        m_pLogBackend->nortempList = m_pLogBackend->narrowByTime(LogBackend::filterNomal(m_pLogBackend->m_normalFilter, m_pLogBackend->norList));
         createNormalTableForm();
         createNormalTable(m_pLogBackend->nortempList);
     }
@@ -2847,7 +2976,7 @@ void DisplayContent::slot_searchResult(const QString &str)
     case Dnf: {
         qCDebug(logApp) << "DisplayContent::slot_searchResult DNF";
         m_pLogBackend->dnfList.clear();
-        m_pLogBackend->dnfList = LogBackend::filterDnf(m_pLogBackend->m_currentSearchStr, m_pLogBackend->dnfListOrigin);
+        m_pLogBackend->dnfList = m_pLogBackend->narrowByTime(LogBackend::filterDnf(m_pLogBackend->m_currentSearchStr, m_pLogBackend->dnfListOrigin));
         createDnfForm();
         createDnfTable(m_pLogBackend->dnfList);
     }
@@ -2855,7 +2984,7 @@ void DisplayContent::slot_searchResult(const QString &str)
     case Dmesg: {
         qCDebug(logApp) << "DisplayContent::slot_searchResult Dmesg";
         m_pLogBackend->dmesgList.clear();
-        m_pLogBackend->dmesgList = LogBackend::filterDmesg(m_pLogBackend->m_currentSearchStr, m_pLogBackend->dmesgListOrigin);
+        m_pLogBackend->dmesgList = m_pLogBackend->narrowByTime(LogBackend::filterDmesg(m_pLogBackend->m_currentSearchStr, m_pLogBackend->dmesgListOrigin));
         createDmesgForm();
         createDmesgTable(m_pLogBackend->dmesgList);
     }
@@ -2880,7 +3009,7 @@ void DisplayContent::slot_searchResult(const QString &str)
         qCDebug(logApp) << "DisplayContent::slot_searchResult Audit";
         m_pLogBackend->aList.clear();
         m_pLogBackend->m_auditFilter.searchstr = m_pLogBackend->m_currentSearchStr;
-        m_pLogBackend->aList = LogBackend::filterAudit(m_pLogBackend->m_auditFilter, m_pLogBackend->aListOrigin);
+        m_pLogBackend->aList = m_pLogBackend->narrowByTime(LogBackend::filterAudit(m_pLogBackend->m_auditFilter, m_pLogBackend->aListOrigin));
         createAuditTableForm();
         createAuditTable(m_pLogBackend->aList);
     }
@@ -2888,7 +3017,7 @@ void DisplayContent::slot_searchResult(const QString &str)
     case COREDUMP: {
         qCDebug(logApp) << "DisplayContent::slot_searchResult COREDUMP";
         m_pLogBackend->m_currentCoredumpList.clear();
-        m_pLogBackend->m_currentCoredumpList = LogBackend::filterCoredump(m_pLogBackend->m_currentSearchStr, m_pLogBackend->m_coredumpList);
+        m_pLogBackend->m_currentCoredumpList = m_pLogBackend->narrowByTime(LogBackend::filterCoredump(m_pLogBackend->m_currentSearchStr, m_pLogBackend->m_coredumpList));
         createCoredumpTableForm();
         createCoredumpTable(m_pLogBackend->m_currentCoredumpList);
     }
@@ -2920,6 +3049,239 @@ void DisplayContent::slot_searchResult(const QString &str)
     }
 }
 
+/**
+ * @brief DisplayContent::slot_histogramRangeSelected 统计条选中时间段后，在已加载的数据中按时间段重新筛选
+ * @param begin 时间段起点，毫秒时间戳，-1表示取消选择
+ * @param end 时间段终点，不包含
+ */
+void DisplayContent::slot_histogramRangeSelected(qint64 begin, qint64 end)
+{
+    qCDebug(logApp) << "DisplayContent::slot_histogramRangeSelected called with begin:" << begin << "end:" << end;
+    m_pLogBackend->setTimeNarrow(begin, end);
+    slot_searchResult(m_pLogBackend->m_currentSearchStr);
+}
+
+/**
+ * @brief sortColumnTexts 取出排序列每行的文本
+ * @param fields 各显示列对应的字段，下标为列号
+ * @param timeColumn 时间列的列号
+ * @param levelColumn 等级列的列号，没有等级列时为-1
+ * @return 排序列的类型，列号无效时texts为空
+ */
+template<typename T>
+static LogColumnSorter::KeyType sortColumnTexts(const QList<T> &list, int column, const QVector<QString T::*> &fields,
+                                                int timeColumn, int levelColumn, QStringList &texts)
+{
+    if (column < 0 || column >= fields.size())
+        return LogColumnSorter::TextKey;
+
+    const QString T::*field = fields.at(column);
+    texts.reserve(list.size());
+    for (const T &msg : list)
+        texts.append(msg.*field);
+    if (column == timeColumn)
+        return LogColumnSorter::TimeKey;
+    return column == levelColumn ? LogColumnSorter::LevelKey : LogColumnSorter::TextKey;
+}
+
+// 排序期间数据未变化且排列有效时按排列重排，否则丢弃结果
+template<typename T>
+static bool applySortPermutation(QList<T> &list, const QVector<int> &permutation)
+{
+    if (!LogColumnSorter::isPermutation(permutation, list.size()))
+        return false;
+    list = LogColumnSorter::permute(list, permutation);
+    return true;
+}
+
+/**
+ * @brief DisplayContent::slot_sortIndicatorChanged 点击表头后在后台按该列排序已加载的数据
+ * 内核、窗管日志按分段加载，只对完整加载的日志类型排序
+ * @param logicalIndex 排序列
+ * @param order 升序或降序
+ */
+void DisplayContent::slot_sortIndicatorChanged(int logicalIndex, Qt::SortOrder order)
+{
+    qCDebug(logApp) << "DisplayContent::slot_sortIndicatorChanged called with column:" << logicalIndex << "order:" << order;
+    if (logicalIndex < 0)
+        return;
+
+    QStringList texts;
+    LogColumnSorter::KeyType keyType = LogColumnSorter::TextKey;
+    if (m_isDataLoadComplete) {
+        switch (m_flag) {
+        case JOURNAL:
+            keyType = sortColumnTexts(m_pLogBackend->jList, logicalIndex,
+                                      {&LOG_MSG_JOURNAL::level, &LOG_MSG_JOURNAL::daemonName, &LOG_MSG_JOURNAL::dateTime,
+                                       &LOG_MSG_JOURNAL::msg, &LOG_MSG_JOURNAL::hostName, &LOG_MSG_JOURNAL::daemonId},
+                                      JOURNAL_SPACE::journalDateTimeColumn, JOURNAL_SPACE::journalLevelColumn, texts);
+            break;
+        case BOOT_KLU:
+            keyType = sortColumnTexts(m_pLogBackend->jBootList, logicalIndex,
+                                      {&LOG_MSG_JOURNAL::level, &LOG_MSG_JOURNAL::daemonName, &LOG_MSG_JOURNAL::dateTime,
+                                       &LOG_MSG_JOURNAL::msg, &LOG_MSG_JOURNAL::hostName, &LOG_MSG_JOURNAL::daemonId},
+                                      JOURNAL_SPACE::journalDateTimeColumn, JOURNAL_SPACE::journalLevelColumn, texts);
+            break;
+        case DPKG:
+            keyType = sortColumnTexts(m_pLogBackend->dList, logicalIndex,
+                                      {&LOG_MSG_DPKG::dateTime, &LOG_MSG_DPKG::msg},
+                                      DKPG_SPACE::dkpgDateTimeColumn, -1, texts);
+            break;
+        case APP:
+            keyType = sortColumnTexts(m_pLogBackend->appList, logicalIndex,
+                                      {&LOG_MSG_APPLICATOIN::level, &LOG_MSG_APPLICATOIN::dateTime,
+                                       &LOG_MSG_APPLICATOIN::subModule, &LOG_MSG_APPLICATOIN::msg},
+                                      APP_SPACE::appDateTimeColumn, APP_SPACE::appLevelColumn, texts);
+            break;
+        case Normal:
+            keyType = sortColumnTexts(m_pLogBackend->nortempList, logicalIndex,
+                                      {&LOG_MSG_NORMAL::eventType, &LOG_MSG_NORMAL::userName,
+                                       &LOG_MSG_NORMAL::dateTime, &LOG_MSG_NORMAL::msg},
+                                      NORMAL_SPACE::normalDateTimeColumn, -1, texts);
+            break;
+        case Dnf:
+            keyType = sortColumnTexts(m_pLogBackend->dnfList, logicalIndex,
+                                      {&LOG_MSG_DNF::level, &LOG_MSG_DNF::dateTime, &LOG_MSG_DNF::msg},
+                                      DNF_SPACE::dnfDateTimeColumn, DNF_SPACE::dnfLvlColumn, texts);
+            break;
+        case Dmesg:
+            keyType = sortColumnTexts(m_pLogBackend->dmesgList, logicalIndex,
+                                      {&LOG_MSG_DMESG::level, &LOG_MSG_DMESG::dateTime, &LOG_MSG_DMESG::msg},
+                                      DMESG_SPACE::dmesgDateTimeColumn, DMESG_SPACE::dmesgLevelColumn, texts);
+            break;
+        case Audit:
+            keyType = sortColumnTexts(m_pLogBackend->aList, logicalIndex,
+                                      {&LOG_MSG_AUDIT::eventType, &LOG_MSG_AUDIT::dateTime, &LOG_MSG_AUDIT::processName,
+                                       &LOG_MSG_AUDIT::status, &LOG_MSG_AUDIT::msg},
+                                      AUDIT_SPACE::auditDateTimeColumn, -1, texts);
+            break;
+        case Auth:
+            keyType = sortColumnTexts(m_pLogBackend->authList, logicalIndex,
+                                      {&LOG_MSG_AUTH::dateTime, &LOG_MSG_AUTH::hostName,
+                                       &LOG_MSG_AUTH::processName, &LOG_MSG_AUTH::msg},
+                                      0, -1, texts);
+            break;
+        case COREDUMP:
+            keyType = sortColumnTexts(m_pLogBackend->m_currentCoredumpList, logicalIndex,
+                                      {&LOG_MSG_COREDUMP::sig, &LOG_MSG_COREDUMP::dateTime, &LOG_MSG_COREDUMP::coreFile,
+                                       &LOG_MSG_COREDUMP::userName, &LOG_MSG_COREDUMP::exe},
+                                      COREDUMP_SPACE::COREDUMP_TIME_COLUMN, -1, texts);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (texts.isEmpty()) {
+        qCDebug(logApp) << "Column sort not available, type:" << m_flag << "load complete:" << m_isDataLoadComplete;
+        resetSort();
+        return;
+    }
+
+    m_sorter->sort(texts, keyType, order);
+}
+
+/**
+ * @brief DisplayContent::slot_sorted 排序完成，按排列重排当前数据并从第一页重新显示
+ * @param permutation 排序后第i行为原来的第permutation[i]行
+ */
+void DisplayContent::slot_sorted(const QVector<int> &permutation)
+{
+    qCDebug(logApp) << "DisplayContent::slot_sorted called with rows:" << permutation.size();
+    bool applied = false;
+    switch (m_flag) {
+    case JOURNAL:
+        applied = applySortPermutation(m_pLogBackend->jList, permutation);
+        break;
+    case BOOT_KLU:
+        applied = applySortPermutation(m_pLogBackend->jBootList, permutation);
+        break;
+    case DPKG:
+        applied = applySortPermutation(m_pLogBackend->dList, permutation);
+        break;
+    case APP:
+        applied = applySortPermutation(m_pLogBackend->appList, permutation);
+        break;
+    case Normal:
+        applied = applySortPermutation(m_pLogBackend->nortempList, permutation);
+        break;
+    case Dnf:
+        applied = applySortPermutation(m_pLogBackend->dnfList, permutation);
+        break;
+    case Dmesg:
+        applied = applySortPermutation(m_pLogBackend->dmesgList, permutation);
+        break;
+    case Audit:
+        applied = applySortPermutation(m_pLogBackend->aList, permutation);
+        break;
+    case Auth:
+        applied = applySortPermutation(m_pLogBackend->authList, permutation);
+        break;
+    case COREDUMP:
+        applied = applySortPermutation(m_pLogBackend->m_currentCoredumpList, permutation);
+        break;
+    default:
+        break;
+    }
+    if (!applied) {
+        qCWarning(logApp) << "Sort result does not match current data, type:" << m_flag;
+        resetSort();
+        return;
+    }
+
+    // 在一次界面刷新内替换表格内容，不显示中间状态
+    m_treeView->setUpdatesEnabled(false);
+    m_curTreeIndex = QModelIndex();
+    m_pModel->removeRows(0, m_pModel->rowCount());
+    switch (m_flag) {
+    case JOURNAL:
+        createJournalTableStart(m_pLogBackend->jList);
+        break;
+    case BOOT_KLU:
+        createJournalBootTableStart(m_pLogBackend->jBootList);
+        break;
+    case DPKG:
+        createDpkgTableStart(m_pLogBackend->dList);
+        break;
+    case APP:
+        createAppTable(m_pLogBackend->appList);
+        break;
+    case Normal:
+        createNormalTable(m_pLogBackend->nortempList);
+        break;
+    case Dnf:
+        createDnfTable(m_pLogBackend->dnfList);
+        break;
+    case Dmesg:
+        createDmesgTable(m_pLogBackend->dmesgList);
+        break;
+    case Audit:
+        createAuditTable(m_pLogBackend->aList);
+        break;
+    case Auth:
+        createAuthTable(m_pLogBackend->authList);
+        break;
+    case COREDUMP:
+        createCoredumpTable(m_pLogBackend->m_currentCoredumpList);
+        break;
+    default:
+        break;
+    }
+    m_treeView->scrollToTop();
+    m_treeView->setUpdatesEnabled(true);
+}
+
+void DisplayContent::resetSort()
+{
+    if (m_sorter)
+        m_sorter->cancel();
+    QHeaderView *header = m_treeView->header();
+    if (header->sortIndicatorSection() != -1) {
+        QSignalBlocker blocker(header);
+        header->setSortIndicator(-1, Qt::AscendingOrder);
+    }
+}
+
 /**
  * @brief DisplayContent::slot_getSubmodule 应用日志筛选子模块型的选择槽函数,根据所选子模块显示对应应用日志内容
  * @param tcbx 子模块的索引 0全部, > 0 显示指定子模块内容
@@ -2939,7 +3301,7 @@ void DisplayContent::slot_getSubmodule(int tcbx)
             m_pLogBackend->m_appFilter.submodule = logConfig.subModules[nSubModuleIndex].name;
         }
     }
-    m_pLogBackend->appList = LogBackend::filterApp(m_pLogBackend->m_appFilter, m_pLogBackend->appListOrigin);
+    m_pLogBackend->appList = m_pLogBackend->narrowByTime(LogBackend::filterApp(m_pLogBackend->m_appFilter, m_pLogBackend->appListOrigin));
     createAppTableForm();
     createAppTable(m_pLogBackend->appList);
 }
@@ -2953,7 +3315,7 @@ void DisplayContent::slot_getLogtype(int tcbx)
     qCDebug(logApp) << "DisplayContent::slot_getLogtype called";
     m_curNormalEventType = tcbx;
     m_pLogBackend->m_normalFilter.eventTypeFilter = tcbx;
-    m_pLogBackend->nortempList = LogBackend::filterNomal(m_pLogBackend->m_normalFilter, m_pLogBackend->norList);
+    m_pLogBackend->nortempList = m_pLogBackend->narrowByTime(LogBackend::filterNomal(m_pLogBackend->m_normalFilter, m_pLogBackend->norList));
     createNormalTableForm();
     createNormalTable(m_pLogBackend->nortempList);
 }
@@ -2963,7 +3325,7 @@ void DisplayContent::slot_getAuditType(int tcbx)
     qCDebug(logApp) << "DisplayContent::slot_getAuditType called";
     m_curAuditType = tcbx;
     m_pLogBackend->m_auditFilter.auditTypeFilter = tcbx;
-    m_pLogBackend->aList = LogBackend::filterAudit(m_pLogBackend->m_auditFilter, m_pLogBackend->aListOrigin);
+    m_pLogBackend->aList = m_pLogBackend->narrowByTime(LogBackend::filterAudit(m_pLogBackend->m_auditFilter, m_pLogBackend->aListOrigin));
     createAuditTableForm();
     createAuditTable(m_pLogBackend->aList);
 }
@@ -3237,7 +3599,7 @@ void DisplayContent::parseListToModel(QList<LOG_MSG_DNF> iList, QStandardItemMod
     }
 }
 
-void DisplayContent::parseListToModel(QList<LOG_MSG_DMESG> iList, QStandardItemModel *oPModel)
+void DisplayContent::parseListToModel(QList<LOG_MSG_DMESG> iList, QStandardItemModel *oPModel, int startRow)
 {
     qCDebug(logApp) << "DisplayContent::parseListToModel called";
     if (!oPModel) {
@@ -3269,7 +3631,7 @@ void DisplayContent::parseListToModel(QList<LOG_MSG_DMESG> iList, QStandardItemM
         item = new DStandardItem(iList[i].msg);
         item->setData(DMESG_TABLE_DATA);
         items << item;
-        oPModel->insertRow(oPModel->rowCount(), items);
+        oPModel->insertRow(startRow < 0 ? oPModel->rowCount() : startRow + i, items);
     }
 }
 
@@ -3478,7 +3840,8 @@ void DisplayContent::setLoadState(DisplayContent::LOAD_STATE iState, bool bSearc
         //如果为加载完成,则只显示主表,导出按钮置可用
         m_treeView->show();
         m_detailWgt->show();
-        emit setExportEnable(true);
+        // 时间线只用于浏览，合并结果由--query timeline导出
+        emit setExportEnable(m_flag != TIMELINE);
 
         break;
     }
@@ -3585,9 +3948,11 @@ void DisplayContent::clearAllDatas()
 {
     qCDebug(logApp) << "DisplayContent::clearAllDatas called";
     m_detailWgt->cleanText();
+    resetSort();
     m_pModel->clear();
 
     m_pLogBackend->clearAllDatalist();
+    m_histogramWgt->setLogFlag(m_flag);
 }
 
 /**
@@ -3697,6 +4062,8 @@ void DisplayContent::insertApplicationTable(const QList<LOG_MSG_APPLICATOIN> &li
     if (end >= start) {
         midList = midList.mid(start, end - start);
     }
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertApplicationTable");
+    PERF_SCOPE_VALUE(insertScope, midList.size());
     parseListToModel(midList, m_pModel);
 }
 
@@ -3788,6 +4155,10 @@ void DisplayContent::slot_refreshClicked(const QModelIndex &index)
         m_flag = COREDUMP;
         m_pLogBackend->setFlag(m_flag);
         generateCoredumpFile(m_curBtnId);
+    } else if (itemData == TIMELINE_TREE_DATA) {
+        m_flag = TIMELINE;
+        m_pLogBackend->setFlag(m_flag);
+        generateTimelineFile(m_curBtnId);
     }
 
     if (!itemData.contains(JOUR_TREE_DATA, Qt::CaseInsensitive) || !itemData.contains(KERN_TREE_DATA, Qt::CaseInsensitive)) { // modified by Airy
@@ -4197,6 +4568,164 @@ void DisplayContent::createCoredumpTable(const QList<LOG_MSG_COREDUMP> &list)
         p->select(m_pModel->index(0, 0), QItemSelectionModel::Rows | QItemSelectionModel::Select);
     slot_tableItemClicked(m_pModel->index(0, 0));
 }
+
+/**
+ * @brief DisplayContent::generateTimelineFile 按时间筛选合并本机各日志种类，各来源并行解析，全部完成后按页显示
+ * @param id 时间筛选id 对应BUTTONID枚举
+ * @param iSearchStr 搜索关键字，在各来源解析时筛选
+ */
+void DisplayContent::generateTimelineFile(int id, const QString &iSearchStr)
+{
+    qCDebug(logApp) << "DisplayContent::generateTimelineFile called with time filter:" << id;
+    m_pLogBackend->clearAllFilter();
+    m_pLogBackend->m_currentSearchStr = iSearchStr;
+    clearAllDatas();
+    retireTimeline();
+    setLoadState(DATA_LOADING);
+    createTimelineTableForm();
+
+    QDateTime dt = QDateTime::currentDateTime();
+    dt.setTime(QTime()); // get zero time
+    qint64 timeBegin = -1;
+    switch (id) {
+    case ONE_DAY:
+        timeBegin = dt.toMSecsSinceEpoch();
+        break;
+    case THREE_DAYS:
+        timeBegin = dt.addDays(-2).toMSecsSinceEpoch();
+        break;
+    case ONE_WEEK:
+        timeBegin = dt.addDays(-6).toMSecsSinceEpoch();
+        break;
+    case ONE_MONTH:
+        timeBegin = dt.addMonths(-1).toMSecsSinceEpoch();
+        break;
+    case THREE_MONTHS:
+        timeBegin = dt.addMonths(-3).toMSecsSinceEpoch();
+        break;
+    default:
+        break;
+    }
+
+    QString error;
+    m_timeline = new LogTimeline(this);
+    if (!m_timeline->setSources(LogTimeline::defaultSources(), error)) {
+        qCWarning(logApp) << "No timeline source available:" << error;
+        delete m_timeline;
+        m_timeline = nullptr;
+        setLoadState(DATA_COMPLETE);
+        return;
+    }
+    m_timeline->setTimeRange(timeBegin, -1);
+    m_timeline->setKeyword(iSearchStr);
+    connect(m_timeline, &LogTimeline::ready, this, &DisplayContent::slot_timelineReady);
+    m_timeline->start();
+}
+
+void DisplayContent::createTimelineTableForm()
+{
+    qCDebug(logApp) << "DisplayContent::createTimelineTableForm called";
+    m_pModel->clear();
+    m_pModel->setHorizontalHeaderLabels(QStringList()
+                                        << DApplication::translate("Table", "Date and Time")
+                                        << DApplication::translate("Table", "Source")
+                                        << DApplication::translate("Table", "Level")
+                                        << DApplication::translate("Table", "Process")
+                                        << DApplication::translate("Table", "Info"));
+    m_treeView->setColumnWidth(0, DATETIME_WIDTH);
+    m_treeView->setColumnWidth(1, DEAMON_WIDTH);
+    m_treeView->setColumnWidth(2, LEVEL_WIDTH);
+    m_treeView->setColumnWidth(3, DEAMON_WIDTH);
+}
+
+/**
+ * @brief DisplayContent::insertTimelineTable 从时间线取出下一页归并结果加入表格
+ * @param count 取出的条数
+ */
+void DisplayContent::insertTimelineTable(int count)
+{
+    qCDebug(logApp) << "DisplayContent::insertTimelineTable called with count:" << count;
+    if (!m_timeline || count <= 0)
+        return;
+
+    const QList<LOG_MSG_TIMELINE> page = m_timeline->fetch(count);
+    PERF_SCOPE(insertScope, PerfModelInsert, "insertTimelineTable");
+    PERF_SCOPE_VALUE(insertScope, page.size());
+    parseListToModel(page, m_pModel);
+}
+
+/**
+ * @brief DisplayContent::retireTimeline 停止当前时间线，解析线程仍可能写入，全部来源结束后再释放
+ */
+void DisplayContent::retireTimeline()
+{
+    if (!m_timeline)
+        return;
+
+    m_timeline->disconnect(this);
+    m_timeline->stop();
+    if (m_timeline->isReady())
+        m_timeline->deleteLater();
+    else
+        connect(m_timeline, &LogTimeline::ready, m_timeline, &QObject::deleteLater);
+    m_timeline = nullptr;
+}
+
+/**
+ * @brief DisplayContent::slot_timelineReady 各来源解析完成，显示归并结果的第一页
+ */
+void DisplayContent::slot_timelineReady()
+{
+    qCDebug(logApp) << "DisplayContent::slot_timelineReady called";
+    if (m_flag != TIMELINE || !m_timeline) {
+        qCDebug(logApp) << "m_flag != TIMELINE";
+        return;
+    }
+
+    m_limitTag = 0;
+    if (0 == m_timeline->totalCount()) {
+        setLoadState(m_pLogBackend->m_currentSearchStr.isEmpty() ? DATA_COMPLETE : DATA_NO_SEARCH_RESULT);
+        return;
+    }
+
+    setLoadState(DATA_COMPLETE);
+    insertTimelineTable(SINGLE_LOAD);
+    QItemSelectionModel *p = m_treeView->selectionModel();
+    if (p)
+        p->select(m_pModel->index(0, 0), QItemSelectionModel::Rows | QItemSelectionModel::Select);
+    slot_tableItemClicked(m_pModel->index(0, 0));
+    PERF_PRINT_END("POINT-03", "type=timeline");
+}
+
+/**
+ * @brief DisplayContent::parseListToModel 把时间线记录加入model中以供treeview显示
+ * @param iList 要加入model中的原始数据
+ * @param oPModel 要增加数据的model指针
+ */
+void DisplayContent::parseListToModel(const QList<LOG_MSG_TIMELINE> &iList, QStandardItemModel *oPModel)
+{
+    qCDebug(logApp) << "DisplayContent::parseListToModel called";
+    if (!oPModel) {
+        qCWarning(logApp) << "timeline parse model is empty";
+        return;
+    }
+
+    const int startRow = oPModel->rowCount();
+    DStandardItem *item = nullptr;
+    QList<QStandardItem *> items;
+    for (int i = 0; i < iList.size(); i++) {
+        const LOG_MSG_TIMELINE &msg = iList.at(i);
+        const QStringList columns {msg.dateTime, msg.source, msg.level, msg.origin, msg.msg};
+        items.clear();
+        for (int col = 0; col < columns.size(); ++col) {
+            item = new DStandardItem(columns.at(col));
+            item->setData(TIMELINE_TABLE_DATA);
+            item->setAccessibleText(QString("treeview_context_%1_%2").arg(startRow + i).arg(col));
+            items << item;
+        }
+        oPModel->insertRow(oPModel->rowCount(), items);
+    }
+}
 void DisplayContent::slot_requestShowRightMenu(const QPoint &pos)
 {
     qCDebug(logApp) << "DisplayContent::slot_requestShowRightMenu called";
@@ -7,6 +7,7 @@
 #include "filtercontent.h" //add by Airy
 #include "logdetailinfowidget.h"
 #include "logfileparser.h"
+#include "loghistogramwidget.h"
 #include "logiconbutton.h"
 #include "logspinnerwidget.h"
 #include "logtreeview.h"
@@ -26,6 +27,8 @@
 
 class ExportProgressDlg;
 class LogBackend;
+class LogColumnSorter;
+class LogTimeline;
 /**
  * @brief The DisplayContent class 主显示数据区域控件,包括数据表格和详情页
  */
@@ -155,6 +158,15 @@ private:
     void insertDmesgTable(const QList<LOG_MSG_DMESG> &list, int start, int end);
     void insertDnfTable(const QList<LOG_MSG_DNF> &list, int start, int end);
 
+    // 多来源合并时间线
+    void generateTimelineFile(int id, const QString &iSearchStr = "");
+    void createTimelineTableForm();
+    void insertTimelineTable(int count);
+    void retireTimeline();
+
+    // 清除排序状态，数据重新加载或筛选后调用
+    void resetSort();
+
 signals:
     void loadMoreInfo();
     /**
@@ -200,6 +212,7 @@ public slots:
     void slot_kwinData(const QList<LOG_MSG_KWIN> &list);
     void slot_dnfFinished(const QList<LOG_MSG_DNF> &list);
     void slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list);
+    void slot_dmesgAppended(const QList<LOG_MSG_DMESG> &list);
     void slot_journalFinished();
     void slot_journalBootFinished();
     void slot_journalBootData(const QList<LOG_MSG_JOURNAL> &list);
@@ -226,6 +239,10 @@ public slots:
     void slot_getAuditType(int tcbx);
     void slot_refreshClicked(const QModelIndex &index); //add by Airy for adding refresh
     void slot_dnfLevel(DNFPRIORITY iLevel);
+    void slot_histogramRangeSelected(qint64 begin, qint64 end);
+    void slot_sortIndicatorChanged(int logicalIndex, Qt::SortOrder order);
+    void slot_sorted(const QVector<int> &permutation);
+    void slot_timelineReady();
 
     //导出前把当前要导出的当前信息的Qlist转换成QStandardItemModel便于导出
     void parseListToModel(const QList<LOG_MSG_DPKG> &iList, QStandardItemModel *oPModel);
@@ -236,11 +253,12 @@ public slots:
     void parseListToModel(QList<LOG_MSG_NORMAL> iList, QStandardItemModel *oPModel);
     void parseListToModel(QList<LOG_MSG_KWIN> iList, QStandardItemModel *oPModel);
     void parseListToModel(QList<LOG_MSG_DNF> iList, QStandardItemModel *oPModel);
-    void parseListToModel(QList<LOG_MSG_DMESG> iList, QStandardItemModel *oPModel);
+    void parseListToModel(QList<LOG_MSG_DMESG> iList, QStandardItemModel *oPModel, int startRow = -1);
     void parseListToModel(QList<LOG_FILE_OTHERORCUSTOM> iList, QStandardItemModel *oPModel);
     void parseListToModel(QList<LOG_MSG_AUDIT> iList, QStandardItemModel *oPModel);
     void parseListToModel(QList<LOG_MSG_AUTH> iList, QStandardItemModel *oPModel);
     void parseListToModel(QList<LOG_MSG_COREDUMP> iList, QStandardItemModel *oPModel);
+    void parseListToModel(const QList<LOG_MSG_TIMELINE> &iList, QStandardItemModel *oPModel);
     QString getIconByname(const QString &str);
     void setLoadState(LOAD_STATE iState, bool bSearching = false);
     void onExportProgress(int nCur, int nTotal);
@@ -263,6 +281,12 @@ private:
 
     //分割布局
     Dtk::Widget::DSplitter *m_splitter;
+    // 数据表上方的分时段统计条
+    LogHistogramWidget *m_histogramWgt {nullptr};
+    // 表头点击时在后台按列排序
+    LogColumnSorter *m_sorter {nullptr};
+    // 当前显示的合并时间线，按页从中取出归并结果
+    LogTimeline *m_timeline {nullptr};
 
     //详情页控件
     logDetailInfoWidget *m_detailWgt {nullptr};
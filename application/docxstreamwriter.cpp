@@ -0,0 +1,269 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "docxstreamwriter.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QLoggingCategory>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 缓冲区达到该大小时写入zip
+const int DOCX_FLUSH_SIZE = 64 * 1024;
+// A4纸张去掉页边距后的宽度，单位为1/20磅
+const int DOCX_TEXT_WIDTH = 9026;
+
+const char DOCX_CONTENT_TYPES[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+    "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+    "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+    "<Default Extension=\"xml\" ContentType=\"application/xml\"/>"
+    "<Override PartName=\"/word/document.xml\" "
+    "ContentType=\"application/vnd.openxmlformats-officedocument.wordprocessingml.document.main+xml\"/>"
+    "</Types>";
+
+const char DOCX_RELS[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+    "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+    "<Relationship Id=\"rId1\" "
+    "Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" "
+    "Target=\"word/document.xml\"/>"
+    "</Relationships>";
+
+const char DOCX_DOCUMENT_HEAD[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+    "<w:document xmlns:w=\"http://schemas.openxmlformats.org/wordprocessingml/2006/main\">"
+    "<w:body><w:tbl><w:tblPr><w:tblW w:w=\"5000\" w:type=\"pct\"/><w:tblBorders>"
+    "<w:top w:val=\"single\" w:sz=\"4\" w:space=\"0\" w:color=\"auto\"/>"
+    "<w:left w:val=\"single\" w:sz=\"4\" w:space=\"0\" w:color=\"auto\"/>"
+    "<w:bottom w:val=\"single\" w:sz=\"4\" w:space=\"0\" w:color=\"auto\"/>"
+    "<w:right w:val=\"single\" w:sz=\"4\" w:space=\"0\" w:color=\"auto\"/>"
+    "<w:insideH w:val=\"single\" w:sz=\"4\" w:space=\"0\" w:color=\"auto\"/>"
+    "<w:insideV w:val=\"single\" w:sz=\"4\" w:space=\"0\" w:color=\"auto\"/>"
+    "</w:tblBorders></w:tblPr><w:tblGrid>";
+
+// 表格后必须跟一个段落
+const char DOCX_DOCUMENT_TAIL[] =
+    "</w:tbl><w:p/><w:sectPr><w:pgSz w:w=\"11906\" w:h=\"16838\"/>"
+    "<w:pgMar w:top=\"1440\" w:right=\"1440\" w:bottom=\"1440\" w:left=\"1440\" "
+    "w:header=\"851\" w:footer=\"992\" w:gutter=\"0\"/></w:sectPr></w:body></w:document>";
+
+static zip_fileinfo currentFileInfo()
+{
+    zip_fileinfo zfi = {};
+    const QDateTime now = QDateTime::currentDateTime();
+    zfi.tmz_date.tm_sec = static_cast<uInt>(now.time().second());
+    zfi.tmz_date.tm_min = static_cast<uInt>(now.time().minute());
+    zfi.tmz_date.tm_hour = static_cast<uInt>(now.time().hour());
+    zfi.tmz_date.tm_mday = static_cast<uInt>(now.date().day());
+    zfi.tmz_date.tm_mon = static_cast<uInt>(now.date().month() - 1);
+    zfi.tmz_date.tm_year = static_cast<uInt>(now.date().year());
+    return zfi;
+}
+
+DocxStreamWriter::~DocxStreamWriter()
+{
+    if (isOpen())
+        abort();
+}
+
+bool DocxStreamWriter::open(const QString &fileName, int columnCount)
+{
+    if (isOpen())
+        abort();
+
+    m_fileName = fileName;
+    m_columnCount = qMax(1, columnCount);
+    m_row.clear();
+    m_cellCount = 0;
+    m_buffer.clear();
+    // 预留容量，写入后截断时保留已分配的内存
+    m_buffer.reserve(DOCX_FLUSH_SIZE * 2);
+    m_rowCount = 0;
+    m_error = false;
+
+    m_zip = zipOpen64(fileName.toUtf8().constData(), APPEND_STATUS_CREATE);
+    if (!m_zip) {
+        qCWarning(logApp) << "DocxStreamWriter open file failed:" << fileName;
+        return false;
+    }
+
+    if (!writeEntry("[Content_Types].xml", QByteArray(DOCX_CONTENT_TYPES))
+            || !writeEntry("_rels/.rels", QByteArray(DOCX_RELS))) {
+        abort();
+        return false;
+    }
+
+    const zip_fileinfo zfi = currentFileInfo();
+    if (zipOpenNewFileInZip64(m_zip, "word/document.xml", &zfi, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, Z_BEST_SPEED, 1) != ZIP_OK) {
+        qCWarning(logApp) << "DocxStreamWriter open document entry failed";
+        abort();
+        return false;
+    }
+
+    m_buffer.append(DOCX_DOCUMENT_HEAD);
+    const QByteArray gridCol = QString("<w:gridCol w:w=\"%1\"/>").arg(DOCX_TEXT_WIDTH / m_columnCount).toUtf8();
+    for (int i = 0; i < m_columnCount; ++i)
+        m_buffer.append(gridCol);
+    m_buffer.append("</w:tblGrid>");
+    return true;
+}
+
+void DocxStreamWriter::appendCell(const QString &text)
+{
+    appendCell(text, false);
+}
+
+void DocxStreamWriter::appendCell(const QString &text, bool bold)
+{
+    // 超出列数的单元格不写入
+    if (m_cellCount >= m_columnCount)
+        return;
+
+    m_row.append("<w:tc><w:p><w:r>");
+    if (bold)
+        m_row.append("<w:rPr><w:b/></w:rPr>");
+    m_row.append("<w:t xml:space=\"preserve\">");
+    m_row.append(escapeText(text));
+    m_row.append("</w:t></w:r></w:p></w:tc>");
+    ++m_cellCount;
+}
+
+bool DocxStreamWriter::endRow()
+{
+    if (!isOpen())
+        return false;
+
+    // 单元格内至少包含一个段落
+    for (; m_cellCount < m_columnCount; ++m_cellCount)
+        m_row.append("<w:tc><w:p/></w:tc>");
+
+    m_buffer.append("<w:tr>");
+    m_buffer.append(m_row);
+    m_buffer.append("</w:tr>");
+    m_row.clear();
+    m_cellCount = 0;
+    ++m_rowCount;
+
+    if (m_buffer.size() >= DOCX_FLUSH_SIZE)
+        return flush();
+    return !m_error;
+}
+
+bool DocxStreamWriter::writeRow(const QStringList &cells, bool header)
+{
+    if (!isOpen())
+        return false;
+
+    if (header) {
+        // 表头行在每页重复显示
+        m_buffer.append("<w:tr><w:trPr><w:tblHeader/></w:trPr>");
+        for (const QString &cell : cells)
+            appendCell(cell, true);
+        for (; m_cellCount < m_columnCount; ++m_cellCount)
+            m_row.append("<w:tc><w:p/></w:tc>");
+        m_buffer.append(m_row);
+        m_buffer.append("</w:tr>");
+        m_row.clear();
+        m_cellCount = 0;
+        return !m_error;
+    }
+
+    for (const QString &cell : cells)
+        appendCell(cell, false);
+    return endRow();
+}
+
+bool DocxStreamWriter::close()
+{
+    if (!isOpen())
+        return false;
+
+    if (m_cellCount > 0)
+        endRow();
+    m_buffer.append(DOCX_DOCUMENT_TAIL);
+    bool bSuccess = flush();
+    bSuccess = zipCloseFileInZip(m_zip) == ZIP_OK && bSuccess;
+    bSuccess = zipClose(m_zip, nullptr) == ZIP_OK && bSuccess;
+    m_zip = nullptr;
+
+    if (!bSuccess) {
+        qCWarning(logApp) << "DocxStreamWriter write file failed:" << m_fileName;
+        QFile::remove(m_fileName);
+    }
+    return bSuccess;
+}
+
+void DocxStreamWriter::abort()
+{
+    if (m_zip) {
+        zipCloseFileInZip(m_zip);
+        zipClose(m_zip, nullptr);
+        m_zip = nullptr;
+    }
+    m_buffer.clear();
+    m_row.clear();
+    m_cellCount = 0;
+    QFile::remove(m_fileName);
+}
+
+QByteArray DocxStreamWriter::escapeText(const QString &text)
+{
+    QString result;
+    result.reserve(text.size() + text.size() / 8);
+    for (const QChar &ch : text) {
+        const ushort code = ch.unicode();
+        switch (code) {
+        case '&':
+            result.append(QLatin1String("&amp;"));
+            break;
+        case '<':
+            result.append(QLatin1String("&lt;"));
+            break;
+        case '>':
+            result.append(QLatin1String("&gt;"));
+            break;
+        case '"':
+            result.append(QLatin1String("&quot;"));
+            break;
+        case '\n':
+            result.append(QLatin1String("</w:t><w:br/><w:t xml:space=\"preserve\">"));
+            break;
+        case '\t':
+            result.append(QLatin1String("</w:t><w:tab/><w:t xml:space=\"preserve\">"));
+            break;
+        default:
+            // xml 1.0不允许的控制字符直接去掉
+            if (code >= 0x20 && code != 0xFFFE && code != 0xFFFF)
+                result.append(ch);
+            break;
+        }
+    }
+    return result.toUtf8();
+}
+
+bool DocxStreamWriter::writeEntry(const char *name, const QByteArray &data)
+{
+    const zip_fileinfo zfi = currentFileInfo();
+    if (zipOpenNewFileInZip64(m_zip, name, &zfi, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, Z_BEST_SPEED, 0) != ZIP_OK) {
+        qCWarning(logApp) << "DocxStreamWriter open entry failed:" << name;
+        return false;
+    }
+    const bool bSuccess = zipWriteInFileInZip(m_zip, data.constData(), static_cast<unsigned>(data.size())) == ZIP_OK;
+    return zipCloseFileInZip(m_zip) == ZIP_OK && bSuccess;
+}
+
+bool DocxStreamWriter::flush()
+{
+    if (m_error || !m_zip)
+        return false;
+    if (!m_buffer.isEmpty()
+            && zipWriteInFileInZip(m_zip, m_buffer.constData(), static_cast<unsigned>(m_buffer.size())) != ZIP_OK) {
+        qCWarning(logApp) << "DocxStreamWriter write document failed";
+        m_error = true;
+    }
+    m_buffer.truncate(0);
+    return !m_error;
+}
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef DOCXSTREAMWRITER_H
+#define DOCXSTREAMWRITER_H
+
+#include "zip.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The DocxStreamWriter class 流式写入只含一个表格的docx文件
+ * 表格行写入缓冲区，缓冲区满时压缩写入zip中的word/document.xml，内存占用与行数无关
+ */
+class DocxStreamWriter
+{
+public:
+    DocxStreamWriter() = default;
+    // 未调用close时放弃写入，删除不完整的文件
+    ~DocxStreamWriter();
+
+    DocxStreamWriter(const DocxStreamWriter &) = delete;
+    DocxStreamWriter &operator=(const DocxStreamWriter &) = delete;
+
+    /**
+     * @brief open 创建文件并写入文档头，已存在的文件会被覆盖
+     * @param columnCount 表格列数
+     */
+    bool open(const QString &fileName, int columnCount);
+    bool isOpen() const { return m_zip != nullptr; }
+
+    // 向当前行追加一个单元格，超出列数的单元格被忽略
+    void appendCell(const QString &text);
+    // 结束当前行，不足列数的单元格补空
+    bool endRow();
+    // 写入一整行，header为true时作为表头，分页时重复显示
+    bool writeRow(const QStringList &cells, bool header = false);
+
+    // 写入文档尾并关闭文件
+    bool close();
+    // 放弃写入并删除文件
+    void abort();
+
+    qint64 rowCount() const { return m_rowCount; }
+
+    // 转换为w:t中的文本，转义xml特殊字符，去掉xml不允许的控制字符，换行与制表符转为对应的元素
+    static QByteArray escapeText(const QString &text);
+
+private:
+    void appendCell(const QString &text, bool bold);
+    bool writeEntry(const char *name, const QByteArray &data);
+    bool flush();
+
+private:
+    zipFile m_zip {nullptr};
+    QString m_fileName;
+    int m_columnCount {0};
+    // 当前行已写入的单元格
+    QByteArray m_row;
+    int m_cellCount {0};
+    // 待压缩写入的行
+    QByteArray m_buffer;
+    qint64 m_rowCount {0};
+    bool m_error {false};
+};
+
+#endif // DOCXSTREAMWRITER_H
@@ -712,6 +712,9 @@ void FilterContent::updateDataState()
     if (!m_config.contains(m_currentType)) {
         qCDebug(logApp) << "No config found for current type, creating default config";
         FILTER_CONFIG newConfig;
+        // 时间线合并多个来源，默认只看当天
+        if (m_currentType == TIMELINE_TREE_DATA)
+            newConfig.dateBtn = ONE_DAY;
         m_config.insert(m_currentType, newConfig);
     }
     //按记录的筛选器选项还原控件选项
@@ -819,6 +822,10 @@ void FilterContent::slot_logCatelogueClicked(const QModelIndex &index)
         qCDebug(logApp) << "slot_logCatelogueClicked COREDUMP_TREE_DATA";
         m_currentType = COREDUMP_TREE_DATA;
         this->setSelectorVisible(false, false, false, true, true, false, false, false);
+    } else if (itemData == TIMELINE_TREE_DATA) {
+        qCDebug(logApp) << "slot_logCatelogueClicked TIMELINE_TREE_DATA";
+        m_currentType = TIMELINE_TREE_DATA;
+        this->setSelectorVisible(false, false, false, true, true, false, false, false);
     }
     updateDataState();
     //必须需要,因为会丢失当前焦点顺序
@@ -84,6 +84,7 @@ JournalBootWork::~JournalBootWork()
 void JournalBootWork::stopWork()
 {
     qCDebug(logApp) << "JournalBootWork::stopWork called";
+    m_isStopProccess = true;
     m_canRun = false;
 }
 
@@ -140,6 +141,12 @@ void JournalBootWork::doWork()
     qCDebug(logApp) << "JournalBootWork::doWork started";
     //此线程刚开始把可以继续变量置true，不然下面没法跑
     m_canRun = true;
+    //排队期间已收到停止请求时不再执行，先置位再检查，不会覆盖并发的停止请求
+    if (m_isStopProccess) {
+        qCDebug(logApp) << "JournalBootWork stopped before start";
+        m_canRun = false;
+        return;
+    }
     mutex.lock();
     logList.clear();
     mutex.unlock();
@@ -241,7 +248,6 @@ void JournalBootWork::doWork()
         sd_journal_close(j);
         return;
     }
-    int cnt = 0;
     //调用宏开始迭代
     SD_JOURNAL_FOREACH_BACKWARDS(j) {
         if ((!m_canRun)) {
@@ -327,12 +333,11 @@ void JournalBootWork::doWork()
             logMsg.level = i2str(getReplaceColorStr(d).split("=").value(1).toInt());
         }
 
-        cnt++;
         mutex.lock();
         logList.append(logMsg);
         mutex.unlock();
-        //每获得500个数据就发出信号给控件加载
-        if (cnt % 500 == 0) {
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(logList.count(), m_canRun)) {
             mutex.lock();
             emit journaBootlData(m_threadIndex, logList);
             logList.clear();
@@ -340,8 +345,9 @@ void JournalBootWork::doWork()
             mutex.unlock();;
         }
     }
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (logList.count() >= 0) {
+        m_batchSender.commit();
         emit journaBootlData(m_threadIndex, logList);
     }
 
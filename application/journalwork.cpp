@@ -5,6 +5,7 @@
 #include "journalwork.h"
 #include "utils.h"
 #include "qtcompat.h"
+#include "DebugTimeManager.h"
 
 #include <DApplication>
 
@@ -88,6 +89,7 @@ journalWork::~journalWork()
 void journalWork::stopWork()
 {
     qCDebug(logApp) << "journalWork::stopWork called";
+    m_isStopProccess = true;
     m_canRun = false;
 }
 
@@ -132,6 +134,7 @@ void journalWork::setArg(QStringList arg)
 void journalWork::run()
 {
     qCDebug(logApp) << "journalWork::run thread started";
+    PERF_SCOPE(parseScope, PerfParseRows, "journalWork");
     doWork();
     qCDebug(logApp) << "journalWork::run thread finished";
 }
@@ -144,6 +147,12 @@ void journalWork::doWork()
     qCDebug(logApp) << "journalWork::doWork started";
     //此线程刚开始把可以继续变量置true，不然下面没法跑
     m_canRun = true;
+    //排队期间已收到停止请求时不再执行，先置位再检查，不会覆盖并发的停止请求
+    if (m_isStopProccess) {
+        qCDebug(logApp) << "journalWork stopped before start";
+        m_canRun = false;
+        return;
+    }
     mutex.lock();
     logList.clear();
     mutex.unlock();
@@ -187,7 +196,6 @@ void journalWork::doWork()
         sd_journal_close(j);
         return;
     }
-    int cnt = 0;
     //调用宏开始迭代
     SD_JOURNAL_FOREACH_BACKWARDS(j) {
         if ((!m_canRun)) {
@@ -278,22 +286,24 @@ void journalWork::doWork()
             //获取等级为字段名= 数字 ，数字为0-7 ，对应紧急到调试，需要转换
             logMsg.level = i2str(getReplaceColorStr(d).split("=").value(1).toInt());
         }
-        cnt++;
         mutex.lock();
         logList.append(logMsg);
         mutex.unlock();
 
-        //每获得500个数据就发出信号给控件加载
-        if (cnt % 500 == 0) {
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(logList.count(), m_canRun)) {
             mutex.lock();
+            PERF_ADD(PerfParseRows, logList.size());
             emit journalData(m_threadIndex, logList);
             logList.clear();
             //sleep(100);
             mutex.unlock();
         }
     }
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (logList.count() >= 0) {
+        PERF_ADD(PerfParseRows, logList.size());
+        m_batchSender.commit();
         emit journalData(m_threadIndex, logList);
     }
 
@@ -6,6 +6,7 @@
 #define JOURNALWORK_H
 
 #include "structdef.h"
+#include "logbatchchannel.h"
 
 #include <QMap>
 #include <QObject>
@@ -46,6 +47,8 @@ public:
 
 
     void setArg(QStringList arg);
+    // 设置与接收端共享的批次计数，接收端处理不及时时解析线程合并批次或等待
+    void setBatchChannel(const QSharedPointer<LogBatchChannel> &channel) { m_batchSender.setChannel(channel); }
     void run() override;
 
 signals:
@@ -97,6 +100,12 @@ private:
      * @brief m_canRun  是否允许标记量，用于停止该线程
      */
     std::atomic_bool m_canRun = false;
+    //已收到停止请求，排队中的任务开始执行时据此直接返回
+    std::atomic_bool m_isStopProccess = false;
+    /**
+     * @brief m_batchSender 按耗时划分发送批次
+     */
+    LogBatchSender m_batchSender;
     /**
      * @brief m_threadIndex 当前线程标号
      */
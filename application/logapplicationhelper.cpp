@@ -15,7 +15,11 @@
 #include <QJsonArray>
 #include <QLoggingCategory>
 #include <QDateTime>
+#include <QElapsedTimer>
+#include <QFileSystemWatcher>
 #include <QRegularExpression>
+#include <QTimer>
+#include <QtConcurrent>
 
 #include <algorithm>
 
@@ -34,6 +38,9 @@ const QString COREDUMP_REPORT_MAX_GSETTING = "coredumpreportmax";
 const QString DCONFIG_APPID = "org.deepin.log.viewer";
 const QString GSETTING_APPID = "com.deepin.log.viewer";
 
+// 监视到应用目录变化后，等待变化平息再重新发现的时间(ms)
+const int APP_LOG_REFRESH_DELAY = 500;
+
 // 默认崩溃上报最大条数
 #define MAX_COREDUMP_REPORT 50
 
@@ -45,19 +52,44 @@ LogApplicationHelper::LogApplicationHelper(QObject *parent)
     : QObject(parent)
 {
     qCDebug(logApp) << "LogApplicationHelper constructor called";
+    m_appLogWatcher = new QFileSystemWatcher(this);
+    m_appLogTimer = new QTimer(this);
+    m_appLogTimer->setSingleShot(true);
+    m_appLogTimer->setInterval(APP_LOG_REFRESH_DELAY);
+    connect(m_appLogWatcher, &QFileSystemWatcher::directoryChanged, this, &LogApplicationHelper::onAppLogDirChanged);
+    connect(m_appLogTimer, &QTimer::timeout, this, [this]() {
+        // 上次发现尚未结束时稍后再试
+        if (m_appLogFuture.isRunning()) {
+            m_appLogTimer->start();
+            return;
+        }
+        m_appLogFuture = QtConcurrent::run([this]() {
+            QMutexLocker locker(&m_appLogMutex);
+            refreshAppLog();
+        });
+    });
     init();
 }
 
+LogApplicationHelper::~LogApplicationHelper()
+{
+    m_appLogFuture.waitForFinished();
+}
+
 /**
  * @brief LogApplicationHelper::init  初始化数据函数
  */
 void LogApplicationHelper::init()
 {
     qCDebug(logApp) << "LogApplicationHelper::init called";
-    getAppLogConfigs();
-    initOtherLog();
+    // 其他日志列表在首次使用时生成，应用日志发现排除其他日志时会通过getOtherLogList生成
+    // 应用日志发现需解析大量desktop文件，在后台线程执行，访问应用日志信息时若未完成则等待
+    m_appLogFuture = QtConcurrent::run([this]() {
+        QMutexLocker locker(&m_appLogMutex);
+        refreshAppLog();
+    });
     initCustomLog();
-    initAuthLog();
+    // 认证日志列表在首次使用时再扫描
     qCDebug(logApp) << "LogApplicationHelper initialization completed";
 }
 
@@ -80,11 +112,93 @@ void LogApplicationHelper::initAppLog()
     qCDebug(logApp) << "App log initialization completed";
 }
 
+/**
+ * @brief LogApplicationHelper::appLogWatchDirs 影响应用日志发现结果的目录
+ * desktop文件目录、json配置目录、~/.cache/deepin及已发现的各应用日志目录
+ */
+QStringList LogApplicationHelper::appLogWatchDirs() const
+{
+    QStringList dirs {
+        "/usr/share/applications",
+        "/var/lib/linglong/entries/share/applications",
+        APP_LOG_CONFIG_PATH
+    };
+    if (!Utils::homePath.isEmpty())
+        dirs.append(Utils::homePath + "/.cache/deepin");
+
+    for (auto it = m_en_log_map.constBegin(); it != m_en_log_map.constEnd(); ++it) {
+        if (it.value().startsWith("/") && !dirs.contains(it.value()))
+            dirs.append(it.value());
+    }
+    return dirs;
+}
+
+/**
+ * @brief LogApplicationHelper::appLogDirStamps 各相关目录的修改时间，目录不存在记为-1
+ */
+QHash<QString, qint64> LogApplicationHelper::appLogDirStamps() const
+{
+    QHash<QString, qint64> stamps;
+    for (const QString &dir : appLogWatchDirs()) {
+        QFileInfo info(dir);
+        stamps.insert(dir, info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1);
+    }
+    return stamps;
+}
+
+bool LogApplicationHelper::isAppLogStale() const
+{
+    return m_appLogDirty || appLogDirStamps() != m_appLogDirStamps;
+}
+
+/**
+ * @brief LogApplicationHelper::refreshAppLog 相关目录有变化时重新发现应用日志，调用方需持有m_appLogMutex
+ */
+void LogApplicationHelper::refreshAppLog()
+{
+    if (!isAppLogStale())
+        return;
+
+    // 先清除标记，发现过程中目录再次变化时会重新置位
+    m_appLogDirty = false;
+
+    QElapsedTimer timer;
+    timer.start();
+    initAppLog();
+    buildAppLogConfigs();
+    m_appLogDirStamps = appLogDirStamps();
+    qCDebug(logApp) << "App log discovery finished in" << timer.elapsed() << "ms, apps:" << m_appLogConfigs.size();
+
+    // 监视器属于主线程，在主线程中更新监视目录
+    const QStringList dirs = m_appLogDirStamps.keys();
+    QMetaObject::invokeMethod(this, [this, dirs]() {
+        QStringList watched = m_appLogWatcher->directories();
+        for (const QString &dir : watched) {
+            if (!dirs.contains(dir))
+                m_appLogWatcher->removePath(dir);
+        }
+        for (const QString &dir : dirs) {
+            if (!watched.contains(dir) && QFileInfo(dir).isDir())
+                m_appLogWatcher->addPath(dir);
+        }
+    }, Qt::QueuedConnection);
+}
+
+void LogApplicationHelper::onAppLogDirChanged()
+{
+    m_appLogDirty = true;
+    m_appLogTimer->start();
+}
+
+/**
+ * @brief LogApplicationHelper::initOtherLog 生成其他日志列表，调用方需持有m_otherLogMutex
+ */
 void LogApplicationHelper::initOtherLog()
 {
     qCDebug(logApp) << "LogApplicationHelper::initOtherLog called";
     //配置其他日志文件(可以是目录)
     m_other_log_list.clear();
+    m_otherLogInited = true;
 
     QList<QStringList> m_other_log_list_temp;
     m_other_log_list_temp.append(QStringList() << "alternatives.log" << "/var/log/alternatives.log");
@@ -245,6 +359,7 @@ void LogApplicationHelper::createDesktopFiles()
     qCDebug(logApp) << "LogApplicationHelper::createDesktopFiles called";
     m_desktop_files.clear();
     m_en_trans_map.clear();
+    m_trans_en_map.clear();
 
     // 定义要搜索的目录列表
     QStringList searchPaths = {
@@ -341,6 +456,13 @@ void LogApplicationHelper::createDesktopFiles()
             }
         }
     }
+
+    // 显示文本到包名的反向索引，显示文本重复时取包名排序靠前的一项
+    m_trans_en_map.clear();
+    for (auto it = m_en_trans_map.constBegin(); it != m_en_trans_map.constEnd(); ++it) {
+        if (!m_trans_en_map.contains(it.value()))
+            m_trans_en_map.insert(it.value(), it.key());
+    }
 }
 
 /**
@@ -680,21 +802,30 @@ void LogApplicationHelper::validityJsonLogPath(SubModuleConfig &submodule)
     }
 }
 
-//刷新并返回所有显示文本对应的应用日志路径
+//返回所有显示文本对应的应用日志路径
 QMap<QString, QString> LogApplicationHelper::getMap()
 {
     qCDebug(logApp) << "LogApplicationHelper::getMap called";
-    initAppLog();
+    QMutexLocker locker(&m_appLogMutex);
+    refreshAppLog();
     qCDebug(logApp) << "Returning translation log map with" << m_trans_log_map.size() << "entries";
     return m_trans_log_map;
 }
 
-// 刷新并返回最新的应用配置信息
+// 返回最新的应用配置信息，相关目录未变化时直接返回缓存
 AppLogConfigList LogApplicationHelper::getAppLogConfigs()
 {
     qCDebug(logApp) << "LogApplicationHelper::getAppLogConfigs called";
-    initAppLog();
+    QMutexLocker locker(&m_appLogMutex);
+    refreshAppLog();
+    return m_appLogConfigs;
+}
 
+/**
+ * @brief LogApplicationHelper::buildAppLogConfigs 根据发现结果生成应用配置信息
+ */
+void LogApplicationHelper::buildAppLogConfigs()
+{
     m_appLogConfigs.clear();
 
     // 根据m_trans_log_map的顺序转换未做json配置的应用信息到appConfig中
@@ -707,15 +838,7 @@ AppLogConfigList LogApplicationHelper::getAppLogConfigs()
         }
 
         // 根据翻译名称获取应用项目名称
-        QString appName = "";
-        QMap<QString, QString>::const_iterator iterApp = m_en_trans_map.constBegin();
-        while (iterApp != m_en_trans_map.constEnd()) {
-            if (iterApp.value() == transName) {
-                appName = iterApp.key();
-                break;
-            }
-            ++iterApp;
-        }
+        QString appName = m_trans_en_map.value(transName);
 
         if (isJsonAppLogConfigExist(appName)) {
             // 若该应用已被json配置过，则直接将json配置添加应用配置列表中
@@ -742,16 +865,17 @@ AppLogConfigList LogApplicationHelper::getAppLogConfigs()
 
     // 将新增的json配置应用更新到应用配置列表中
     for (auto appConfig : m_JsonAppLogConfigs) {
-        if (!isAppLogConfigExist(appConfig.name))
+        if (!hasAppLogConfig(appConfig.name))
             m_appLogConfigs.push_back(appConfig);
     }
-
-    return m_appLogConfigs;
 }
 
 //获取所有其他日志文件列表
 QList<QStringList> LogApplicationHelper::getOtherLogList()
 {
+    QMutexLocker locker(&m_otherLogMutex);
+    if (!m_otherLogInited)
+        initOtherLog();
     qCDebug(logApp) << "LogApplicationHelper::getOtherLogList called, returning" << m_other_log_list.size() << "entries";
     return m_other_log_list;
 }
@@ -764,7 +888,7 @@ QList<QStringList> LogApplicationHelper::getCustomLogList()
 }
 
 /**
- * @brief LogApplicationHelper::initAuthLog 初始化认证日志列表
+ * @brief LogApplicationHelper::initAuthLog 初始化认证日志列表，调用方需持有m_authLogMutex
  * 扫描/var/log/auth.log及其历史文件auth.log.1, auth.log.2...auth.log.n
  */
 void LogApplicationHelper::initAuthLog()
@@ -805,6 +929,7 @@ void LogApplicationHelper::initAuthLog()
         qCDebug(logApp) << "Added auth.log history file:" << fullPath;
     }
 
+    m_authLogInited = true;
     qCDebug(logApp) << "Auth log initialization completed, found" << m_auth_log_list.size() << "files";
 }
 
@@ -814,6 +939,9 @@ void LogApplicationHelper::initAuthLog()
  */
 QStringList LogApplicationHelper::getAuthLogList()
 {
+    QMutexLocker locker(&m_authLogMutex);
+    if (!m_authLogInited)
+        initAuthLog();
     qCDebug(logApp) << "LogApplicationHelper::getAuthLogList called, returning" << m_auth_log_list.size() << "files";
     return m_auth_log_list;
 }
@@ -821,6 +949,7 @@ QStringList LogApplicationHelper::getAuthLogList()
 void LogApplicationHelper::refreshAuthLogList()
 {
     qCDebug(logApp) << "LogApplicationHelper::refreshAuthLogList called";
+    QMutexLocker locker(&m_authLogMutex);
     initAuthLog();
 }
 
@@ -832,9 +961,10 @@ AppLogConfig LogApplicationHelper::appLogConfig(const QString &app)
         return AppLogConfig();
     }
 
+    QMutexLocker locker(&m_appLogMutex);
     if (m_appLogConfigs.isEmpty()) {
         qCDebug(logApp) << "m_appLogConfigs is empty, refreshing";
-        getAppLogConfigs();
+        refreshAppLog();
     }
 
     foreach (AppLogConfig config, m_appLogConfigs) {
@@ -850,11 +980,15 @@ AppLogConfig LogApplicationHelper::appLogConfig(const QString &app)
 bool LogApplicationHelper::isAppLogConfigExist(const QString &app)
 {
     qCDebug(logApp) << "LogApplicationHelper::isAppLogConfigExist called with app:" << app;
+    QMutexLocker locker(&m_appLogMutex);
+    return hasAppLogConfig(app);
+}
+
+bool LogApplicationHelper::hasAppLogConfig(const QString &app) const
+{
     foreach (AppLogConfig config, m_appLogConfigs) {
-        if (config.contains(app)) {
-            qCDebug(logApp) << "LogApplicationHelper::isAppLogConfigExist found config for app:" << app;
+        if (config.contains(app))
             return true;
-        }
     }
 
     return false;
@@ -863,6 +997,7 @@ bool LogApplicationHelper::isAppLogConfigExist(const QString &app)
 bool LogApplicationHelper::isValidAppName(const QString &appName)
 {
     qCDebug(logApp) << "LogApplicationHelper::isValidAppName called with appName:" << appName;
+    QMutexLocker locker(&m_appLogMutex);
     if (m_en_log_map.find(appName) != m_en_log_map.end()) {
         qCDebug(logApp) << "LogApplicationHelper::isValidAppName found appName:" << appName;
         return true;
@@ -933,11 +1068,13 @@ int LogApplicationHelper::getMaxReportCoredump()
 QString LogApplicationHelper::transName(const QString &str)
 {
     // qCDebug(logApp) << "LogApplicationHelper::transName called with:" << str;
+    QMutexLocker locker(&m_appLogMutex);
     return m_en_trans_map.value(str);
 }
 
 QString LogApplicationHelper::getPathByAppId(const QString &str)
 {
     // qCDebug(logApp) << "LogApplicationHelper::getPathByAppId called with:" << str;
+    QMutexLocker locker(&m_appLogMutex);
     return m_en_log_map.value(str);
 }
@@ -11,15 +11,22 @@
 #include <DConfig>
 #endif
 
+#include <QFuture>
+#include <QHash>
 #include <QMap>
+#include <QMutex>
 #include <QObject>
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 #include <QGSettings>
 #endif
 
+#include <atomic>
 #include <mutex>
 
+class QFileSystemWatcher;
+class QTimer;
+
 /**
  * @brief The LogApplicationHelper class 获取应用日志文件路径信息工具类
  */
@@ -46,8 +53,10 @@ public:
         return sin;
     }
 
+    ~LogApplicationHelper() override;
+
     QMap<QString, QString> getMap();
-    // 刷新并返回最新的应用配置信息
+    // 返回最新的应用配置信息，相关目录未变化时直接返回缓存
     AppLogConfigList getAppLogConfigs();
 
     //根据包名获得显示名称
@@ -84,6 +93,13 @@ private:
 
     void init();
     void initAppLog();
+    // 应用日志发现缓存
+    QStringList appLogWatchDirs() const;
+    QHash<QString, qint64> appLogDirStamps() const;
+    bool isAppLogStale() const;
+    void refreshAppLog();
+    void buildAppLogConfigs();
+    void onAppLogDirChanged();
     void initOtherLog();
     void initCustomLog();
     void initAuthLog();
@@ -100,6 +116,7 @@ private:
 
     AppLogConfig jsonAppLogConfig(const QString& app);
     bool isJsonAppLogConfigExist(const QString& app);
+    bool hasAppLogConfig(const QString& app) const;
 
     void validityJsonLogPath(SubModuleConfig& submodule);
 
@@ -117,6 +134,10 @@ private:
      * @brief m_en_trans_map 应用包名-应用显示文本键值对
      */
     QMap<QString, QString> m_en_trans_map;
+    /**
+     * @brief m_trans_en_map 应用显示文本-应用包名键值对，m_en_trans_map的反向索引
+     */
+    QHash<QString, QString> m_trans_en_map;
     /**
      * @brief m_trans_log_map 应用显示文本-日志路径键值对
      */
@@ -125,6 +146,11 @@ private:
      * @brief m_other_log_list 所有其他日志列表，每项包含名称、路径
      */
     QList<QStringList> m_other_log_list;
+    /**
+     * @brief m_otherLogMutex 其他日志列表首次使用时生成，不占用启动时间，可能在后台线程中访问
+     */
+    QMutex m_otherLogMutex;
+    bool m_otherLogInited = false;
     /**
      * @brief m_custom_log_list 所有自定义日志列表，每项包含名称、路径
      */
@@ -133,6 +159,11 @@ private:
      * @brief m_auth_log_list 所有认证日志文件列表
      */
     QStringList m_auth_log_list;
+    /**
+     * @brief m_authLogMutex 认证日志列表首次使用时扫描，可能在导出线程中访问
+     */
+    QMutex m_authLogMutex;
+    bool m_authLogInited = false;
     /**
      * @brief m_desktop_files 所有符合条件的应用的desktop文件路径
      */
@@ -154,6 +185,30 @@ private:
      * @brief m_appLogConfigs 应用日志配置信息（包含json配置信息）
      */
     AppLogConfigList m_appLogConfigs;
+    /**
+     * @brief m_appLogMutex 保护应用日志发现结果，发现过程在后台线程执行
+     */
+    mutable QMutex m_appLogMutex;
+    /**
+     * @brief m_appLogDirStamps 上次发现时各相关目录的修改时间，作为缓存键
+     */
+    QHash<QString, qint64> m_appLogDirStamps;
+    /**
+     * @brief m_appLogDirty 监视到目录变化后置位，下次访问时重新发现
+     */
+    std::atomic<bool> m_appLogDirty {true};
+    /**
+     * @brief m_appLogWatcher 监视desktop文件、json配置及日志目录的变化(inotify)
+     */
+    QFileSystemWatcher *m_appLogWatcher = nullptr;
+    /**
+     * @brief m_appLogTimer 合并短时间内的多次目录变化，再在后台重新发现
+     */
+    QTimer *m_appLogTimer = nullptr;
+    /**
+     * @brief m_appLogFuture 后台发现任务
+     */
+    QFuture<void> m_appLogFuture;
     /**
      * @brief m_instance 单例用的本类指针的原子性封装
      */
@@ -6,6 +6,7 @@
 #include "utils.h"
 #include "dbusproxy/dldbushandler.h"
 #include "qtcompat.h"
+#include "DebugTimeManager.h"
 
 #include <DMessageBox>
 #include <DApplication>
@@ -15,6 +16,10 @@
 #include <QDateTime>
 #include <QDebug>
 #include <QProcess>
+#include <QRegularExpression>
+#include <QtConcurrent>
+
+#include <functional>
 
 #include <QLoggingCategory>
 
@@ -25,6 +30,24 @@ DWIDGET_USE_NAMESPACE
 //std::atomic<LogApplicationParseThread *> LogApplicationParseThread::m_instance;
 //std::mutex LogApplicationParseThread::m_mutex;
 int LogApplicationParseThread::thread_count = 0;
+
+// 应用日志解析缓存，缓存内容与子模块的筛选条件无关
+const QString APP_CACHE_KIND = "app";
+const int APP_CACHE_VERSION = 1;
+enum AppCacheColumn {
+    AppDateTime = 0,
+    AppLevel,
+    AppDetail,
+    AppColumnCount
+};
+
+// 应用日志行的解析正则，开启贪婪匹配
+static QRegularExpression appLineRegExp()
+{
+    QRegularExpression re("^(\\d{4}-[0-2]\\d-[0-3]\\d)\\D*([0-2]\\d:[0-5]\\d:[0-5]\\d.\\d*)[^A-Za-z]*([A-Za-z]*)[^\\[]*[^\\]]*\\]*\\s*(.*)$");
+    re.optimize();
+    return re;
+}
 /**
  * @brief LogApplicationParseThread::LogApplicationParseThread 构造函数
  * @param parent 父对象
@@ -93,6 +116,8 @@ int LogApplicationParseThread::getIndex()
 
 /**
  * @brief LogApplicationParseThread::doWork 获取数据线程逻辑
+ * 文件类型子模块的各日志文件在本线程依次读取，解析提交到线程池并发执行，
+ * 各子模块当前最新的数据都已解析出来时即按时间归并分批发出，不必等全部文件解析完成
  */
 void LogApplicationParseThread::doWork()
 {
@@ -106,29 +131,49 @@ void LogApplicationParseThread::doWork()
 
     qCDebug(logApp) << "Processing" << m_AppFilers.size() << "app filters";
     
+    // 每个文件类型子模块一路，尚未读取的子模块也先占位，避免其更新的数据被提前越过
+    QList<MergeStream> streams;
+    for (const auto &appFilter : m_AppFilers) {
+        if (appFilter.logType == "file")
+            streams.append(MergeStream());
+    }
+
+    int streamIndex = 0;
     // 遍历每个子模块对应的日志过滤配置项
     for (auto appFilter : m_AppFilers) {
         qCDebug(logApp) << "Processing filter type:" << appFilter.logType
                        << "for submodule:" << appFilter.submodule;
                        
         if (appFilter.logType == "file") {
-            if (!parseByFile(appFilter)) {
+            if (!parseByFile(appFilter, streams, streamIndex++)) {
                 qCWarning(logApp) << "Failed to parse by file for submodule:"
                                 << appFilter.submodule;
+                m_canRun = false;
+                waitStreams(streams);
                 return;
             }
         } else if (appFilter.logType == "journal") {
             if (!parseByJournal(appFilter)) {
                 qCWarning(logApp) << "Failed to parse by journal for submodule:"
                                 << appFilter.submodule;
+                m_canRun = false;
+                waitStreams(streams);
                 return;
             }
         }
     }
 
-    //最后可能有余下不足500的数据
+    drainMerged(streams, true);
+    if (!m_canRun) {
+        waitStreams(streams);
+        return;
+    }
+
+    //最后余下不足一批的数据
     if (m_appList.count() >= 0) {
         qCDebug(logApp) << "Emitting" << m_appList.count() << "remaining app data";
+        PERF_ADD(PerfParseRows, m_appList.size());
+        m_batchSender.commit();
         emit appData(m_threadCount, m_appList);
     }
 
@@ -136,95 +181,286 @@ void LogApplicationParseThread::doWork()
     emit appFinished(m_threadCount);
 }
 
-bool LogApplicationParseThread::parseByFile(const APP_FILTERS &app_filter)
+/**
+ * @brief LogApplicationParseThread::parseByFile 读取子模块的各日志文件，解析任务提交到线程池
+ * 每提交一个文件就尝试归并发出已能确定顺序的数据
+ * @param streams 各文件类型子模块的待归并结果
+ * @param index 本子模块在streams中的序号，读取结束后标记为已全部提交
+ */
+bool LogApplicationParseThread::parseByFile(const APP_FILTERS &app_filter, QList<MergeStream> &streams, int index)
 {
     qCDebug(logApp) << "LogApplicationParseThread::parseByFile called with submodule:" << app_filter.submodule;
     m_AppFiler = app_filter;
 
-    initProccess();
-    //connect(m_process, SIGNAL(finished(int)), m_process, SLOT(deleteLater()));
     //因为筛选信息中含有日志文件路径，所以不能为空，否则无法获取
     if (m_AppFiler.path.isEmpty()) {  //modified by Airy for bug 20457::if path is empty,item is not empty
         qCWarning(logApp) << "Empty path for submodule:" << app_filter.submodule;
+        streams[index].closed = true;
         emit appFinished(m_threadCount);
-    } else {
-        QStringList filePath = DLDBusHandler::instance(this)->getFileInfo(m_AppFiler.path);
-        for (int i = 0; i < filePath.count(); i++) {
-            if (!m_canRun) {
-                mutex.unlock();
-                return false;
-            }
-            //按行解析
-            QByteArray outByte = DLDBusHandler::instance(this)->readLog(filePath[i]).toUtf8();
-            // dbus鉴权失败，不再继续解析
-            if (outByte.endsWith("is not allowed to configrate firewall. checkAuthorization failed.")) {
-                qCWarning(logApp) << "D-Bus authorization failed for file:" << filePath[i];
-                mutex.unlock();
-                emit appFinished(m_threadCount);
-                return false;
+        return true;
+    }
+
+    // 同时在解析的文件数有上限，避免读取过快时大量文件内容堆积在内存中
+    const int maxPending = qMax(2, m_parsePool->maxThreadCount() * 2);
+    QStringList filePath = DLDBusHandler::instance(this)->getFileInfo(m_AppFiler.path);
+    for (int i = 0; i < filePath.count(); i++) {
+        if (!m_canRun)
+            return false;
+
+        QList<QFuture<FileParseResult> *> running;
+        for (auto &stream : streams) {
+            for (auto &future : stream.futures) {
+                if (!future.isFinished())
+                    running.append(&future);
             }
-            QString output = Utils::replaceEmptyByteArray(outByte);
-            QStringList strList = QString(output ).split('\n', SKIP_EMPTY_PARTS);
-            //开启贪婪匹配
-            QRegularExpression re("^(\\d{4}-[0-2]\\d-[0-3]\\d)\\D*([0-2]\\d:[0-5]\\d:[0-5]\\d.\\d*)[^A-Za-z]*([A-Za-z]*)[^\\[]*[^\\]]*\\]*\\s*(.*)$");
-
-            for (int j = strList.size() - 1; j >= 0; --j) {
-                if (!m_canRun) {
-                    mutex.unlock();
-                    return false;
-                }
-                LOG_MSG_APPLICATOIN msg;
-                QString str = strList[j];
+        }
+        for (int k = 0; running.size() - k >= maxPending; ++k)
+            running[k]->waitForFinished();
+
+        // 服务支持按偏移读取时使用解析缓存，文件未变化时不再读取与解析，只追加时只解析新增部分
+        const LogFileIdentity identity = LogFileIdentity::fromList(DLDBusHandler::instance(this)->getFileIdentity(filePath[i]));
+        if (identity.isValid()) {
+            streams[index].futures.append(QtConcurrent::run(m_parsePool, &LogApplicationParseThread::parseFileCached, m_AppFiler,
+                                                            filePath[i], identity, m_levelDict, std::cref(m_canRun)));
+            drainMerged(streams, false);
+            continue;
+        }
 
-                QRegularExpressionMatch match = re.match(str);
-                bool matchRes = match.hasMatch();
-                if(!matchRes){
-                    continue;
-                }
-
-                QString dateTime = match.captured(1)+" "+match.captured(2);
-                qint64 dt = QDateTime::fromString(dateTime, "yyyy-MM-dd hh:mm:ss.zzz").toMSecsSinceEpoch();
-                //按筛选条件筛选时间段
-                if (m_AppFiler.timeFilterBegin > 0 && m_AppFiler.timeFilterEnd > 0) {
-                    if (dt < m_AppFiler.timeFilterBegin || dt > m_AppFiler.timeFilterEnd)
-                        continue;
-                }
-
-                msg.subModule = m_AppFiler.submodule;
-                msg.dateTime = dateTime;
-                msg.level = match.captured(3);
-                //筛选日志等级
-                if (m_AppFiler.lvlFilter != LVALL) {
-                    if (m_levelDict.value(msg.level) != m_AppFiler.lvlFilter)
-                        continue;
-                }
-                //获取信息
-                msg.msg=match.captured(4);
-                msg.detailInfo=match.captured(4);
-
-                //如果日志太长就显示一部分
-                if (msg.detailInfo.size() > 500) {
-                    msg.msg = msg.detailInfo.mid(0, 500);
-                }
-                mutex.lock();
-                m_appList.append(msg);
-                mutex.unlock();
-                //每获得500个数据就发出信号给控件加载
-                if (m_appList.count() % SINGLE_READ_CNT == 0) {
-                    mutex.lock();
-                    emit appData(m_threadCount, m_appList);
-                    m_appList.clear();
-                    mutex.unlock();
-                }
+        QByteArray outByte = DLDBusHandler::instance(this)->readLog(filePath[i]).toUtf8();
+        // dbus鉴权失败，不再继续解析
+        if (outByte.endsWith("is not allowed to configrate firewall. checkAuthorization failed.")) {
+            qCWarning(logApp) << "D-Bus authorization failed for file:" << filePath[i];
+            emit appFinished(m_threadCount);
+            return false;
+        }
+
+        streams[index].futures.append(QtConcurrent::run(m_parsePool, &LogApplicationParseThread::parseFileContent, m_AppFiler,
+                                                        QString::fromUtf8(Utils::replaceEmptyByteArray(outByte)), m_levelDict, std::cref(m_canRun)));
+        drainMerged(streams, false);
+    }
+    streams[index].closed = true;
+
+    return m_canRun;
+}
+
+/**
+ * @brief LogApplicationParseThread::parseLineTime 解析行首的日期时间
+ * 格式与解析正则的前半部分一致：yyyy-MM-dd，若干非数字字符，hh:mm:ss及任一分隔字符
+ * @param dt 行首时间，日期时间数值无效时为-1
+ * @return 行首不符合格式时返回false，此时整行必然不能匹配解析正则
+ */
+bool LogApplicationParseThread::parseLineTime(const QString &line, qint64 &dt)
+{
+    const QChar *p = line.constData();
+    const int size = line.size();
+    auto digit = [p](int i) {
+        const ushort c = p[i].unicode();
+        return (c >= '0' && c <= '9') ? static_cast<int>(c - '0') : -1;
+    };
+    auto number = [&digit](int i) {
+        return digit(i) * 10 + digit(i + 1);
+    };
+
+    if (size < 19)
+        return false;
+    for (int i : {0, 1, 2, 3, 6, 9}) {
+        if (digit(i) < 0)
+            return false;
+    }
+    if (p[4] != '-' || p[7] != '-' || digit(5) < 0 || digit(5) > 2 || digit(8) < 0 || digit(8) > 3)
+        return false;
+
+    int pos = 10;
+    while (pos < size && digit(pos) < 0)
+        ++pos;
+    if (pos + 9 > size)
+        return false;
+    if (digit(pos) > 2 || digit(pos + 1) < 0 || p[pos + 2] != ':'
+            || digit(pos + 3) < 0 || digit(pos + 3) > 5 || digit(pos + 4) < 0 || p[pos + 5] != ':'
+            || digit(pos + 6) < 0 || digit(pos + 6) > 5 || digit(pos + 7) < 0)
+        return false;
+
+    // 毫秒取小数部分前三位
+    int msec = 0;
+    int scale = 100;
+    for (int i = pos + 9; i < size && i < pos + 12 && digit(i) >= 0; ++i, scale /= 10)
+        msec += digit(i) * scale;
+
+    const QDate date(digit(0) * 1000 + digit(1) * 100 + number(2), number(5), number(8));
+    const QTime time(number(pos), number(pos + 3), number(pos + 6), msec);
+    dt = (date.isValid() && time.isValid()) ? QDateTime(date, time).toMSecsSinceEpoch() : -1;
+    return true;
+}
+
+/**
+ * @brief LogApplicationParseThread::parseFileContent 解析单个日志文件内容，在线程池中执行
+ * 先按行首时间过滤，再用正则提取等级和信息
+ */
+LogApplicationParseThread::FileParseResult LogApplicationParseThread::parseFileContent(const APP_FILTERS &app_filter, const QString &content,
+                                                                                       const QMap<QString, int> &levelDict, const std::atomic<bool> &canRun)
+{
+    FileParseResult result;
+    const bool timeFilter = app_filter.timeFilterBegin > 0 && app_filter.timeFilterEnd > 0;
+    QStringList strList = content.split('\n', SKIP_EMPTY_PARTS);
+    const QRegularExpression re = appLineRegExp();
+
+    for (int j = strList.size() - 1; j >= 0; --j) {
+        if (!canRun)
+            return FileParseResult();
+
+        const QString &str = strList.at(j);
+        qint64 dt = -1;
+        if (!parseLineTime(str, dt))
+            continue;
+        //按筛选条件筛选时间段
+        if (timeFilter && (dt < app_filter.timeFilterBegin || dt > app_filter.timeFilterEnd))
+            continue;
+
+        QRegularExpressionMatch match = re.match(str);
+        if (!match.hasMatch())
+            continue;
+
+        LOG_MSG_APPLICATOIN msg;
+        msg.subModule = app_filter.submodule;
+        msg.dateTime = match.captured(1) + " " + match.captured(2);
+        msg.level = match.captured(3);
+        //筛选日志等级
+        if (app_filter.lvlFilter != LVALL) {
+            if (levelDict.value(msg.level) != app_filter.lvlFilter)
+                continue;
+        }
+        //获取信息，列表显示与详情共用同一份数据，日志太长时列表只显示一部分
+        msg.detailInfo = match.captured(4);
+        msg.msg = msg.detailInfo.size() > 500 ? msg.detailInfo.left(500) : msg.detailInfo;
+
+        result.msgs.append(msg);
+        result.times.append(dt);
+    }
+
+    return result;
+}
+
+/**
+ * @brief LogApplicationParseThread::parseFileCached 通过解析缓存获取单个日志文件的解析结果，在线程池中执行
+ * 缓存中保存全部可解析的行，时间与等级筛选在取出时进行
+ */
+LogApplicationParseThread::FileParseResult LogApplicationParseThread::parseFileCached(const APP_FILTERS &app_filter, const QString &filePath,
+                                                                                      const LogFileIdentity &identity,
+                                                                                      const QMap<QString, int> &levelDict,
+                                                                                      const std::atomic<bool> &canRun)
+{
+    LogCacheTable table;
+    auto parse = [](const QStringList &lines, LogCacheTable &table) {
+        const QRegularExpression re = appLineRegExp();
+        for (const QString &str : lines) {
+            qint64 dt = -1;
+            if (!parseLineTime(str, dt))
+                continue;
+            QRegularExpressionMatch match = re.match(str);
+            if (!match.hasMatch())
+                continue;
+
+            table.times.append(dt);
+            table.columns[AppDateTime].append(match.captured(1) + " " + match.captured(2));
+            table.columns[AppLevel].append(match.captured(3));
+            table.columns[AppDetail].append(match.captured(4));
+        }
+    };
+    auto read = [&filePath](qint64 offset, qint64 maxBytes) {
+        return DLDBusHandler::instance()->readLogFromOffset(filePath, offset, maxBytes);
+    };
+    if (!LogParseCache::instance()->update(APP_CACHE_KIND, APP_CACHE_VERSION, filePath, identity, AppColumnCount,
+                                           table, read, parse, canRun)) {
+        const QByteArray outByte = DLDBusHandler::instance()->readLog(filePath).toUtf8();
+        return parseFileContent(app_filter, QString::fromUtf8(Utils::replaceEmptyByteArray(outByte)), levelDict, canRun);
+    }
+
+    FileParseResult result;
+    const bool timeFilter = app_filter.timeFilterBegin > 0 && app_filter.timeFilterEnd > 0;
+    for (int row = table.rowCount() - 1; row >= 0; --row) {
+        if (!canRun)
+            return FileParseResult();
+
+        const qint64 dt = table.times.at(row);
+        //按筛选条件筛选时间段
+        if (timeFilter && (dt < app_filter.timeFilterBegin || dt > app_filter.timeFilterEnd))
+            continue;
+        //筛选日志等级
+        const QString &level = table.columns[AppLevel].at(row);
+        if (app_filter.lvlFilter != LVALL && levelDict.value(level) != app_filter.lvlFilter)
+            continue;
+
+        LOG_MSG_APPLICATOIN msg;
+        msg.subModule = app_filter.submodule;
+        msg.dateTime = table.columns[AppDateTime].at(row);
+        msg.level = level;
+        //列表显示与详情共用同一份数据，日志太长时列表只显示一部分
+        msg.detailInfo = table.columns[AppDetail].at(row);
+        msg.msg = msg.detailInfo.size() > 500 ? msg.detailInfo.left(500) : msg.detailInfo;
+
+        result.msgs.append(msg);
+        result.times.append(dt);
+    }
+    return result;
+}
+
+/**
+ * @brief LogApplicationParseThread::drainMerged 按时间由新到旧归并各子模块的解析结果并分批发出
+ * 每个子模块只在当前文件取完后才取下一个文件的结果；有子模块的下一条数据尚未解析出来时停止，
+ * 等下次调用再继续。时间相同时保持子模块、文件的原有顺序
+ * @param wait 是否等待未完成的解析任务，为true时调用方需保证各子模块均已全部提交
+ * @return 全部数据已发出时返回true
+ */
+bool LogApplicationParseThread::drainMerged(QList<MergeStream> &streams, bool wait)
+{
+    while (m_canRun) {
+        int best = -1;
+        for (int i = 0; i < streams.size(); ++i) {
+            MergeStream &stream = streams[i];
+            while (stream.row >= stream.current.msgs.size() && !stream.futures.isEmpty()) {
+                if (!wait && !stream.futures.first().isFinished())
+                    return false;
+                stream.current = stream.futures.takeFirst().result();
+                stream.row = 0;
             }
-            if (!m_canRun) {
-                mutex.unlock();
+            if (stream.row < stream.current.msgs.size()) {
+                if (best < 0 || stream.current.times[stream.row] > streams[best].current.times[streams[best].row])
+                    best = i;
+            } else if (!stream.closed) {
                 return false;
             }
         }
+        if (best < 0)
+            return true;
+
+        MergeStream &stream = streams[best];
+        mutex.lock();
+        m_appList.append(stream.current.msgs[stream.row++]);
+        mutex.unlock();
+        if (stream.row >= stream.current.msgs.size())
+            stream.current = FileParseResult();
+
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(m_appList.count(), m_canRun)) {
+            mutex.lock();
+            PERF_ADD(PerfParseRows, m_appList.size());
+            emit appData(m_threadCount, m_appList);
+            m_appList.clear();
+            mutex.unlock();
+        }
     }
+    return false;
+}
 
-    return true;
+/**
+ * @brief LogApplicationParseThread::waitStreams 停止时等待已提交的解析任务结束
+ */
+void LogApplicationParseThread::waitStreams(QList<MergeStream> &streams)
+{
+    for (auto &stream : streams) {
+        for (auto &future : stream.futures)
+            future.waitForFinished();
+    }
 }
 
 bool LogApplicationParseThread::parseByJournal(const APP_FILTERS &app_filter)
@@ -318,7 +554,6 @@ bool LogApplicationParseThread::parseByJournal(const APP_FILTERS &app_filter)
         endTime = static_cast<uint64_t>(m_AppFiler.timeFilterEnd * 1000);
     }
 
-    int cnt = 0;
     //调用宏开始迭代
     SD_JOURNAL_FOREACH_BACKWARDS(j) {
         if ((!m_canRun)) {
@@ -391,14 +626,14 @@ bool LogApplicationParseThread::parseByJournal(const APP_FILTERS &app_filter)
             //获取等级为字段名= 数字 ，数字为0-7 ，对应紧急到调试，需要转换
             logMsg.level = i2str(Utils::getReplaceColorStr(d).split("=").value(1).toInt());
         }
-        cnt++;
         mutex.lock();
         m_appList.append(logMsg);
         mutex.unlock();
 
-        //每获得500个数据就发出信号给控件加载
-        if (cnt % SINGLE_READ_CNT == 0) {
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(m_appList.count(), m_canRun)) {
             mutex.lock();
+            PERF_ADD(PerfParseRows, m_appList.size());
             emit appData(m_threadCount, m_appList);
             m_appList.clear();
             //sleep(100);
@@ -490,6 +725,7 @@ void LogApplicationParseThread::initProccess()
 void LogApplicationParseThread::run()
 {
     qCDebug(logApp) << "LogApplicationParseThread::run thread started";
+    PERF_SCOPE(parseScope, PerfParseRows, "LogApplicationParseThread");
     doWork();
     qCDebug(logApp) << "LogApplicationParseThread::run thread finished";
 }
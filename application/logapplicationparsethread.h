@@ -5,11 +5,18 @@
 #ifndef LOGAPPLICATIONPARSETHREAD_H
 #define LOGAPPLICATIONPARSETHREAD_H
 #include "structdef.h"
+#include "logbatchchannel.h"
+#include "logparsecache.h"
 
+#include <QFuture>
 #include <QMap>
 #include <QObject>
 #include <QThread>
+#include <QThreadPool>
 #include <QMutex>
+#include <QVector>
+
+#include <atomic>
 #include <mutex>
 
 class QProcess;
@@ -23,6 +30,10 @@ public:
     explicit LogApplicationParseThread(QObject *parent = nullptr);
     ~LogApplicationParseThread() override;
     void setFilters(const APP_FILTERSList &iFilters);
+    // 设置解析文件内容的线程池，未设置时使用全局线程池
+    void setParsePool(QThreadPool *pool) { m_parsePool = pool; }
+    // 设置与接收端共享的批次计数，接收端处理不及时时解析线程合并批次或等待
+    void setBatchChannel(const QSharedPointer<LogBatchChannel> &channel) { m_batchSender.setChannel(channel); }
     static int thread_count;
 signals:
     /**
@@ -38,8 +49,34 @@ public slots:
     int getIndex();
 
 private:
-    bool parseByFile(const APP_FILTERS& app_filter);
+    /**
+     * @brief The FileParseResult struct 单个日志文件的解析结果，按时间由新到旧排列
+     */
+    struct FileParseResult {
+        QList<LOG_MSG_APPLICATOIN> msgs;
+        QVector<qint64> times;
+    };
+    /**
+     * @brief The MergeStream struct 一个文件类型子模块待归并的解析结果
+     * 子模块的日志文件按修改时间由新到旧排列，文件内已由新到旧，逐个文件取出即为该子模块的时间顺序
+     */
+    struct MergeStream {
+        QList<QFuture<FileParseResult>> futures;    // 尚未取出的各文件解析任务
+        FileParseResult current;                    // 正在归并的文件
+        int row = 0;                                // current中下一条待发出的数据
+        bool closed = false;                        // 子模块的文件已全部提交
+    };
+
+    bool parseByFile(const APP_FILTERS& app_filter, QList<MergeStream> &streams, int index);
     bool parseByJournal(const APP_FILTERS& app_filter);
+    static FileParseResult parseFileContent(const APP_FILTERS &app_filter, const QString &content,
+                                            const QMap<QString, int> &levelDict, const std::atomic<bool> &canRun);
+    // 通过解析缓存获取单个日志文件的解析结果，服务无法按偏移读取时完整读取
+    static FileParseResult parseFileCached(const APP_FILTERS &app_filter, const QString &filePath, const LogFileIdentity &identity,
+                                           const QMap<QString, int> &levelDict, const std::atomic<bool> &canRun);
+    static bool parseLineTime(const QString &line, qint64 &dt);
+    bool drainMerged(QList<MergeStream> &streams, bool wait);
+    static void waitStreams(QList<MergeStream> &streams);
 protected:
     QString getDateTimeFromStamp(const QString &str);
     void initMap();
@@ -69,10 +106,18 @@ private:
      */
     QList<LOG_MSG_APPLICATOIN> m_appList;
     QMutex mutex;
+    /**
+     * @brief m_parsePool 解析各文件内容的线程池
+     */
+    QThreadPool *m_parsePool {QThreadPool::globalInstance()};
     /**
      * @brief m_canRun 是否可以继续运行的标记量，用于停止运行线程
      */
-    bool m_canRun = false;
+    std::atomic<bool> m_canRun {false};
+    /**
+     * @brief m_batchSender 按耗时划分发送批次
+     */
+    LogBatchSender m_batchSender;
     /**
      * @brief m_threadIndex 当前线程标号
      */
@@ -0,0 +1,413 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logauditparser.h"
+#include "utils.h"
+
+#include <QDateTime>
+#include <QSet>
+#include <QStringList>
+
+namespace {
+
+// 字段分隔符，0x1d为auditd附加解析字段前的分隔符，单引号为嵌套字段的起止
+inline bool isSeparator(QChar c)
+{
+    return c == QLatin1Char(' ') || c == QLatin1Char('\t') || c.unicode() == 0x1d || c == QLatin1Char('\'');
+}
+
+inline bool isDigit(QChar c)
+{
+    return c >= QLatin1Char('0') && c <= QLatin1Char('9');
+}
+
+bool isHexDigit(QChar c)
+{
+    return isDigit(c) || (c >= QLatin1Char('A') && c <= QLatin1Char('F')) || (c >= QLatin1Char('a') && c <= QLatin1Char('f'));
+}
+
+bool isIPv4(const QString &addr)
+{
+    const QStringList parts = addr.split(QLatin1Char('.'));
+    if (parts.size() != 4)
+        return false;
+    for (const QString &part : parts) {
+        if (part.isEmpty() || part.size() > 3)
+            return false;
+        for (const QChar c : part) {
+            if (!isDigit(c))
+                return false;
+        }
+        if (part.toInt() > 255)
+            return false;
+    }
+    return true;
+}
+
+// 原文pos处是否为text，不生成子串
+bool matchAt(const QString &line, int pos, QLatin1String text)
+{
+    if (pos < 0 || pos + text.size() > line.size())
+        return false;
+    for (int i = 0; i < text.size(); ++i) {
+        if (line.at(pos + i) != QLatin1Char(text.data()[i]))
+            return false;
+    }
+    return true;
+}
+
+// 匹配"\d+(;\d+){0,2}m"，返回匹配结束的位置，不匹配时返回-1
+int matchColorCode(const QChar *data, int pos, int size)
+{
+    for (int group = 0; group < 3; ++group) {
+        if (group > 0) {
+            if (pos >= size || data[pos] != QLatin1Char(';') || pos + 1 >= size || !isDigit(data[pos + 1]))
+                break;
+            ++pos;
+        }
+        if (pos >= size || !isDigit(data[pos]))
+            return -1;
+        while (pos < size && isDigit(data[pos]))
+            ++pos;
+    }
+    return pos < size && data[pos] == QLatin1Char('m') ? pos + 1 : -1;
+}
+
+}
+
+LogAuditParser::Span LogAuditParser::Record::value(QLatin1String key) const
+{
+    const QChar *data = line.constData();
+    for (const Field &field : fields) {
+        if (field.key.len != key.size())
+            continue;
+        int i = 0;
+        while (i < field.key.len && data[field.key.pos + i] == QLatin1Char(key.data()[i]))
+            ++i;
+        if (i == field.key.len)
+            return field.value;
+    }
+    return Span();
+}
+
+QString LogAuditParser::Record::text(const Span &span) const
+{
+    return span.isValid() ? line.mid(span.pos, span.len) : QString();
+}
+
+QString LogAuditParser::Record::decoded(const Span &span) const
+{
+    if (!span.isValid())
+        return QString();
+    return span.quoted ? text(span) : decodeHex(text(span));
+}
+
+LogAuditParser::LogAuditParser(bool reverse, int window)
+    : m_reverse(reverse)
+    , m_window(qMax(1, window))
+{
+}
+
+bool LogAuditParser::scanLine(const QString &line, Record &record)
+{
+    record = Record();
+    record.line = line;
+    record.fields.reserve(16);
+
+    const QChar *data = line.constData();
+    const int size = line.size();
+    int pos = 0;
+    while (pos < size) {
+        while (pos < size && isSeparator(data[pos]))
+            ++pos;
+        if (pos >= size)
+            break;
+
+        const int keyStart = pos;
+        while (pos < size && data[pos] != QLatin1Char('=') && data[pos] != QLatin1Char('"') && !isSeparator(data[pos]))
+            ++pos;
+        if (pos >= size || data[pos] != QLatin1Char('=') || pos == keyStart) {
+            // 不是key=value形式的内容，跳过
+            while (pos < size && !isSeparator(data[pos]))
+                ++pos;
+            continue;
+        }
+
+        Field field;
+        field.key.pos = keyStart;
+        field.key.len = pos - keyStart;
+        ++pos;
+        if (pos < size && data[pos] == QLatin1Char('\'')) {
+            // msg='op=... res=success'，单引号内为嵌套的字段，继续切分
+            ++pos;
+            continue;
+        }
+        if (pos < size && data[pos] == QLatin1Char('"')) {
+            const int valueStart = ++pos;
+            while (pos < size && data[pos] != QLatin1Char('"'))
+                ++pos;
+            field.value.pos = valueStart;
+            field.value.len = pos - valueStart;
+            field.value.quoted = true;
+            if (pos < size)
+                ++pos;
+        } else {
+            const int valueStart = pos;
+            while (pos < size && !isSeparator(data[pos]))
+                ++pos;
+            field.value.pos = valueStart;
+            field.value.len = pos - valueStart;
+        }
+        record.fields.append(field);
+    }
+
+    record.type = record.value(QLatin1String("type"));
+    if (!record.type.isValid())
+        return false;
+
+    // msg=audit(1688526389.214:61):
+    const Span stamp = record.value(QLatin1String("msg"));
+    if (stamp.isValid() && !stamp.quoted && matchAt(line, stamp.pos, QLatin1String("audit("))) {
+        const int idStart = stamp.pos + 6;
+        const int stampEnd = stamp.pos + stamp.len;
+        int idEnd = idStart;
+        qint64 secs = 0;
+        bool inSecs = true;
+        bool hasSecs = false;
+        while (idEnd < stampEnd && data[idEnd] != QLatin1Char(')')) {
+            if (inSecs && isDigit(data[idEnd])) {
+                secs = secs * 10 + data[idEnd].unicode() - '0';
+                hasSecs = true;
+            } else {
+                inSecs = false;
+            }
+            ++idEnd;
+        }
+        if (idEnd < stampEnd) {
+            record.id.pos = idStart;
+            record.id.len = idEnd - idStart;
+            if (hasSecs)
+                record.time = secs * 1000;
+            // 跳过"): "
+            record.msgPos = qMin(idEnd + 3, size);
+        }
+    }
+    return true;
+}
+
+QString LogAuditParser::stripColor(const QString &line)
+{
+    if (line.indexOf(QChar(0x1b)) < 0 && line.indexOf(QLatin1String("#033[")) < 0)
+        return line;
+
+    const QChar *data = line.constData();
+    const int size = line.size();
+    QString result;
+    result.reserve(size);
+    int pos = 0;
+    while (pos < size) {
+        int codeStart = -1;
+        if (data[pos].unicode() == 0x1b && pos + 1 < size && data[pos + 1] == QLatin1Char('['))
+            codeStart = pos + 2;
+        else if (data[pos] == QLatin1Char('#') && matchAt(line, pos, QLatin1String("#033[")))
+            codeStart = pos + 5;
+
+        if (codeStart >= 0) {
+            const int codeEnd = matchColorCode(data, codeStart, size);
+            if (codeEnd >= 0) {
+                pos = codeEnd;
+                continue;
+            }
+        }
+        result.append(data[pos]);
+        ++pos;
+    }
+    return result;
+}
+
+QString LogAuditParser::decodeHex(const QString &value)
+{
+    if (value.isEmpty() || value.size() % 2 != 0)
+        return QString();
+    for (const QChar c : value) {
+        if (!isHexDigit(c))
+            return QString();
+    }
+
+    // proctitle等字段的各参数以0分隔
+    QByteArray bytes = QByteArray::fromHex(value.toLatin1());
+    bytes.replace('\0', ' ');
+    return QString::fromUtf8(bytes).trimmed();
+}
+
+bool LogAuditParser::isAuxiliary(const QString &eventType)
+{
+    static const QSet<QString> auxiliaryTypes = {
+        "PATH", "CWD", "PROCTITLE", "EXECVE", "SOCKADDR", "BPRM_FCAPS", "MMAP", "OBJ_PID",
+        "FD_PAIR", "IPC", "CAPSET", "SOCKETCALL", "KERN_MODULE", "EOE"
+    };
+    return auxiliaryTypes.contains(eventType);
+}
+
+LogAuditParser::Event LogAuditParser::toEvent(const QList<Record> &records)
+{
+    Event event;
+    if (records.isEmpty())
+        return event;
+
+    // 主记录为第一条不是附属信息的记录，其余记录只用于补充字段
+    int primary = 0;
+    for (int i = 0; i < records.size(); ++i) {
+        if (!isAuxiliary(records.at(i).eventType())) {
+            primary = i;
+            break;
+        }
+    }
+    const Record &main = records.at(primary);
+    QList<const Record *> order;
+    order.append(&main);
+    for (int i = 0; i < records.size(); ++i) {
+        if (i != primary)
+            order.append(&records.at(i));
+    }
+
+    LOG_MSG_AUDIT &msg = event.msg;
+    msg.eventType = main.eventType();
+
+    // 审计类型，先按事件类型识别，再判断是否为远程连接，最后按自定义的key识别
+    msg.auditType = Utils::auditType(msg.eventType);
+    if (msg.auditType.isEmpty()) {
+        for (const Record *record : order) {
+            if (isIPv4(record->text(record->value(QLatin1String("addr"))))) {
+                msg.auditType = Audit_Remote;
+                break;
+            }
+        }
+    }
+    if (msg.auditType.isEmpty()) {
+        for (const Record *record : order) {
+            const QString key = record->text(record->value(QLatin1String("key")));
+            if (!key.isEmpty()) {
+                msg.auditType = Utils::auditType(key);
+                break;
+            }
+        }
+    }
+    if (msg.auditType.isEmpty())
+        msg.auditType = Audit_Other;
+
+    event.time = main.time;
+    if (event.time >= 0)
+        msg.dateTime = QDateTime::fromMSecsSinceEpoch(event.time).toString("yyyy-MM-dd hh:mm:ss");
+
+    // 进程名，优先取comm，其次取exe的文件名
+    for (const Record *record : order) {
+        msg.processName = record->decoded(record->value(QLatin1String("comm")));
+        if (!msg.processName.isEmpty())
+            break;
+    }
+    if (msg.processName.isEmpty()) {
+        for (const Record *record : order) {
+            msg.processName = record->decoded(record->value(QLatin1String("exe"))).split("/").last();
+            if (!msg.processName.isEmpty())
+                break;
+        }
+    }
+    if (msg.processName.isEmpty())
+        msg.processName = "N/A";
+    msg.processId = main.text(main.value(QLatin1String("pid")));
+
+    // 状态，系统调用记录为success=yes/no，用户态记录为res=success/failed
+    for (const Record *record : order) {
+        const Span success = record->value(QLatin1String("success"));
+        if (success.isValid()) {
+            msg.status = record->text(success) == "yes" ? "OK" : "Failed";
+            break;
+        }
+    }
+    if (msg.status.isEmpty()) {
+        for (const Record *record : order) {
+            const Span res = record->value(QLatin1String("res"));
+            if (res.isValid()) {
+                msg.status = record->text(res) == "success" ? "OK" : "Failed";
+                break;
+            }
+        }
+    }
+    if (msg.status.isEmpty())
+        msg.status = "OK";
+
+    // 原文为事件的各行按文件中的顺序拼接，详细信息为主记录"):"之后的内容
+    int mainStart = 0;
+    for (int i = 0; i < records.size(); ++i) {
+        if (i > 0)
+            msg.origin.append(QLatin1Char('\n'));
+        if (i == primary)
+            mainStart = msg.origin.size();
+        msg.origin.append(records.at(i).line);
+    }
+    const int msgStart = main.msgPos >= 0 ? main.msgPos : 0;
+    event.msgPos = mainStart + msgStart;
+    msg.msg = main.line.mid(msgStart);
+    return event;
+}
+
+void LogAuditParser::addLine(const QString &line, QList<Event> &events)
+{
+    Record record;
+    if (!scanLine(stripColor(line), record))
+        return;
+
+    const QString id = record.text(record.id);
+    int index = -1;
+    if (!id.isEmpty()) {
+        // 同一事件的记录通常相邻，从最近的事件开始查找
+        for (int i = m_pending.size() - 1; i >= 0; --i) {
+            if (m_pending.at(i).id == id) {
+                index = i;
+                break;
+            }
+        }
+    }
+
+    if (index < 0) {
+        if (m_pending.size() >= m_window)
+            emitReady(events, true);
+        Pending pending;
+        pending.id = id;
+        // 没有序号的记录单独作为一条日志
+        pending.complete = id.isEmpty();
+        m_pending.append(pending);
+        index = m_pending.size() - 1;
+    }
+
+    Pending &pending = m_pending[index];
+    // 正序读取时EOE为事件的最后一条记录
+    if (!m_reverse && record.eventType() == "EOE")
+        pending.complete = true;
+    if (m_reverse)
+        pending.records.prepend(record);
+    else
+        pending.records.append(record);
+
+    emitReady(events, false);
+}
+
+void LogAuditParser::flush(QList<Event> &events)
+{
+    while (!m_pending.isEmpty())
+        events.append(toEvent(m_pending.takeFirst().records));
+}
+
+/**
+ * @brief LogAuditParser::emitReady 按到达顺序输出已完成的事件
+ * @param force 为true时无论最早的事件是否完成都先输出该事件
+ */
+void LogAuditParser::emitReady(QList<Event> &events, bool force)
+{
+    while (!m_pending.isEmpty() && (force || m_pending.first().complete)) {
+        events.append(toEvent(m_pending.takeFirst().records));
+        force = false;
+    }
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGAUDITPARSER_H
+#define LOGAUDITPARSER_H
+
+#include "structdef.h"
+
+#include <QList>
+#include <QString>
+#include <QVector>
+
+// 重排窗口内最多同时等待的事件数
+const int AUDIT_REORDER_WINDOW = 64;
+
+/**
+ * @brief The LogAuditParser class 审计日志解析
+ * 每行只扫描一次，按key=value切分字段，不使用正则；字段只记录在原文中的位置，
+ * 未加引号的十六进制编码值(如comm、exe、proctitle)在取值时才解码。
+ * msg=audit(时间:序号)相同的多条记录(如SYSCALL、PATH、CWD、PROCTITLE)属于同一事件，合并为一条日志，
+ * 各事件的记录可能交错出现，在有限的窗口内等待同一事件的后续记录，超出窗口的最早事件先行输出
+ */
+class LogAuditParser
+{
+public:
+    // 字段在原文中的位置
+    struct Span {
+        int pos {-1};
+        int len {0};
+        bool quoted {false};
+
+        bool isValid() const { return pos >= 0; }
+    };
+
+    struct Field {
+        Span key;
+        Span value;
+    };
+
+    /**
+     * @brief The Record struct 一行审计记录，原文只保存一份，各字段以位置引用原文
+     */
+    struct Record {
+        QString line; // 去除颜色控制字符后的原文
+        Span type;
+        Span id; // audit(...)括号内的"秒.毫秒:序号"
+        qint64 time {-1}; // 毫秒时间戳，精确到秒
+        int msgPos {-1}; // 详细信息在原文中的起点，即"):"之后
+        QVector<Field> fields;
+
+        Span value(QLatin1String key) const;
+        QString text(const Span &span) const;
+        // 带引号的值去掉引号返回，未加引号的值按十六进制编码解码，无法解码时返回空
+        QString decoded(const Span &span) const;
+        QString eventType() const { return text(type); }
+    };
+
+    /**
+     * @brief The Event struct 合并后的一条审计日志
+     */
+    struct Event {
+        LOG_MSG_AUDIT msg;
+        qint64 time {-1};
+        // 详细信息在origin中的起点
+        int msgPos {0};
+    };
+
+    /**
+     * @param reverse 为true时按从新到旧的顺序输入各行，事件同样按从新到旧输出，事件内各行仍按文件中的顺序拼接
+     * @param window 重排窗口大小
+     */
+    explicit LogAuditParser(bool reverse = false, int window = AUDIT_REORDER_WINDOW);
+
+    // 加入一行，已完成的事件按首条记录的到达顺序追加到events
+    void addLine(const QString &line, QList<Event> &events);
+    // 输出窗口内全部事件
+    void flush(QList<Event> &events);
+
+    /**
+     * @brief scanLine 切分一行审计记录
+     * @return 没有type字段时返回false
+     */
+    static bool scanLine(const QString &line, Record &record);
+    // 去除ANSI颜色控制字符，不含控制字符时直接返回原文
+    static QString stripColor(const QString &line);
+    // 解码十六进制文本，不是合法的十六进制编码时返回空
+    static QString decodeHex(const QString &value);
+    // 只作为事件附属信息的记录类型，不作为事件的主记录
+    static bool isAuxiliary(const QString &eventType);
+    // 由同一事件的各条记录生成日志，records按文件中的顺序排列
+    static Event toEvent(const QList<Record> &records);
+
+private:
+    struct Pending {
+        QString id;
+        QList<Record> records;
+        bool complete {false};
+    };
+    void emitReady(QList<Event> &events, bool force);
+
+private:
+    bool m_reverse {false};
+    int m_window {AUDIT_REORDER_WINDOW};
+    // 按首条记录到达顺序排列的未完成事件
+    QList<Pending> m_pending;
+};
+
+#endif // LOGAUDITPARSER_H
@@ -4,12 +4,14 @@
 
 #include "logauththread.h"
 #include "utils.h"
-#include "sharedmemorymanager.h"
 #include "sys/utsname.h"
 #include "wtmpparse.h"
 #include "dbusproxy/dldbushandler.h"
 #include "dbusmanager.h"
+#include "DebugTimeManager.h"
 #include "qtcompat.h"
+#include "logparsecache.h"
+#include "logauditparser.h"
 
 #include <DGuiApplicationHelper>
 #include <DApplication>
@@ -39,6 +41,43 @@ const QStringList sigList = { "SIGHUP", "SIGINT", "SIGQUIT", "SIGILL", "SIGTRAP"
 
 // DBUS传输文件大小阈值 100MB
 #define DBUS_THRESHOLD_MAX 100
+// 每次通过DBUS读取的内核日志记录条数
+#define KMSG_READ_CNT 5000
+
+// 审计日志解析缓存，解析逻辑或缓存列变化时递增版本
+const QString AUDIT_CACHE_KIND = "audit";
+const int AUDIT_CACHE_VERSION = 2;
+// 按偏移分块读取审计日志的块大小
+const qint64 AUDIT_CACHE_READ_SIZE = 32 * 1024 * 1024;
+// 审计日志缓存的字符串列，每行为一个事件，详细信息由原文按偏移截取，时间文本由时间戳还原
+enum AuditCacheColumn {
+    AuditEventType = 0,
+    AuditAuditType,
+    AuditProcessName,
+    AuditProcessId,
+    AuditStatus,
+    AuditMsgOffset,
+    AuditOrigin,
+    AuditColumnCount
+};
+
+// dpkg与Xorg日志解析缓存，本人可读时写入磁盘
+const QString DPKG_CACHE_KIND = "dpkg";
+const int DPKG_CACHE_VERSION = 1;
+enum DpkgCacheColumn {
+    DpkgDateTime = 0,
+    DpkgAction,
+    DpkgMsg,
+    DpkgColumnCount
+};
+const QString XORG_CACHE_KIND = "xorg";
+const int XORG_CACHE_VERSION = 1;
+// Xorg日志只有相对开机的时间偏移，缓存的时间列均为-1
+enum XorgCacheColumn {
+    XorgOffset = 0,
+    XorgMsg,
+    XorgColumnCount
+};
 
 /**
  * @brief LogAuthThread::LogAuthThread 构造函数
@@ -122,14 +161,14 @@ void LogAuthThread::stopProccess()
     m_isStopProccess = true;
     //停止获取线程执行，标记量置false
     m_canRun = false;
-    if (!Utils::runInCmd) {
-        qCDebug(logApp) << "Setting shared memory stop flag";
-        //共享内存数据结构，用于和获取进程共享内存，数据为是否可执行进程，用于控制数据获取进程停止，因为这里会出现需要提权执行的进程，主进程没有权限停止提权进程，所以使用共享内存变量标记量控制提权进程停止
-        ShareMemoryInfo   shareInfo ;
-        //设置进程为不可执行
-        shareInfo.isStart = false;
-        //把数据付给共享内存中对应的变量
-        SharedMemoryManager::instance()->setRunnableTag(shareInfo);
+    {
+        //取消服务端正在进行的流式读取请求
+        QMutexLocker locker(&m_streamMutex);
+        if (!m_streamToken.isEmpty()) {
+            qCDebug(logApp) << "Cancelling stream request";
+            DLDBusHandler::instance()->cancelRequest(m_streamToken);
+            m_streamToken.clear();
+        }
     }
     if (m_process) {
         qCDebug(logApp) << "Killing process";
@@ -137,6 +176,35 @@ void LogAuthThread::stopProccess()
     }
 }
 
+QString LogAuthThread::readLogStream(const QString &filePath)
+{
+    qCDebug(logApp) << "LogAuthThread::readLogStream called with filePath:" << filePath;
+    QString token = DLDBusHandler::instance(this)->openLogStream(filePath);
+    {
+        QMutexLocker locker(&m_streamMutex);
+        m_streamToken = token;
+    }
+
+    QString byte;
+    while (m_canRun) {
+        auto temp = DLDBusHandler::instance(this)->readLogInStream(token);
+        if (temp.isEmpty()) {
+            break;
+        }
+
+        byte += temp;
+    }
+
+    QMutexLocker locker(&m_streamMutex);
+    if (!m_canRun && !m_streamToken.isEmpty()) {
+        // 线程已停止但请求尚未被取消，释放服务端缓存的日志数据
+        DLDBusHandler::instance(this)->cancelRequest(m_streamToken);
+    }
+    m_streamToken.clear();
+
+    return byte;
+}
+
 void LogAuthThread::setFilePath(const QStringList &filePath)
 {
     qCDebug(logApp) << "LogAuthThread::setFilePath called with" << filePath.size() << "files";
@@ -181,6 +249,14 @@ void LogAuthThread::run()
     qCDebug(logApp) << "LogAuthThread::run called";
     //此线程刚开始把可以继续变量置true，不然下面没法跑
     m_canRun = true;
+    //排队期间已收到停止请求时不再执行，先置位再检查，不会覆盖并发的停止请求
+    if (m_isStopProccess) {
+        qCDebug(logApp) << "LogAuthThread stopped before start";
+        m_canRun = false;
+        return;
+    }
+    // 解析耗时，解析行数在各类型发送数据时累计
+    PERF_SCOPE(parseScope, PerfParseRows, "LogAuthThread");
     qCInfo(logApp) << "LogAuthThread started processing, type:" << m_type;
     //根据类型成员变量执行对应日志的获取逻辑
     switch (m_type) {
@@ -258,23 +334,11 @@ void LogAuthThread::handleBoot()
             return;
         }
 
-        if (!Utils::runInCmd) {
-            // qCDebug(logApp) << "Initializing process for boot logs";
-            initProccess();
-            m_process->setProcessChannelMode(QProcess::MergedChannels);
-            //共享内存对应变量置true，允许进程内部逻辑运行
-            ShareMemoryInfo shareInfo;
-            shareInfo.isStart = true;
-            SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-            //启动日志需要提权获取，运行的时候把对应共享内存的名称传进去，方便获取进程拿标记量判断是否继续运行
-            m_process->start("pkexec", QStringList() << "logViewerAuth"
-                             << m_FilePath.at(i) << SharedMemoryManager::instance()->getRunnableKey());
-            m_process->waitForFinished(-1);
-            if (m_process->exitCode() != 0) {
-                qCDebug(logApp) << "Process exited with code:" << m_process->exitCode();
-                emit bootFinished(m_threadCount);
-                return;
-            }
+        //启动日志需要提权获取，会话有效期内多个文件只需鉴权一次
+        if (!Utils::runInCmd && !DLDBusHandler::instance(this)->ensureSession()) {
+            qCDebug(logApp) << "Reader session authorization failed";
+            emit bootFinished(m_threadCount);
+            return;
         }
 
         QString byte = DLDBusHandler::instance(this)->readLog(m_FilePath.at(i));
@@ -311,17 +375,20 @@ void LogAuthThread::handleBoot()
                 }
             }
 
-            //每获得500个数据就发出信号给控件加载
-            if (bList.count() % SINGLE_READ_CNT == 0) {
+            //累积满一帧的数据就发出信号给控件加载
+            if (m_batchSender.due(bList.count(), m_canRun)) {
                 qCDebug(logApp) << "Emitting boot data, count:" << bList.count();
+                PERF_ADD(PerfParseRows, bList.size());
                 emit bootData(m_threadCount, bList);
                 bList.clear();
             }
         }
     }
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (bList.count() >= 0) {
         qCDebug(logApp) << "Emitting boot data, count:" << bList.count();
+        PERF_ADD(PerfParseRows, bList.size());
+        m_batchSender.commit();
         emit bootData(m_threadCount, bList);
     }
     emit bootFinished(m_threadCount);
@@ -335,6 +402,11 @@ void LogAuthThread::handleKern()
 {
     qCDebug(logApp) << "Start processing kernel logs, file count:" << m_FilePath.count();
     QList<LOG_MSG_JOURNAL> kList;
+    //跳过时间范围之外的轮转归档，避免无效解压
+    if (m_kernFilters.timeFilterBegin > 0 && m_kernFilters.timeFilterEnd > 0
+            && (Utils::runInCmd || DLDBusHandler::instance(this)->ensureSession())) {
+        m_FilePath = DLDBusHandler::instance(this)->filterLogFilesByTime(m_FilePath, m_kernFilters.timeFilterBegin, m_kernFilters.timeFilterEnd);
+    }
     for (int i = 0; i < m_FilePath.count(); i++) {
         if (!m_FilePath.at(i).contains("txt")) {
             QFile file(m_FilePath.at(i)); // add by Airy
@@ -347,55 +419,22 @@ void LogAuthThread::handleKern()
             return;
         }
 
-        if (!Utils::runInCmd) {
-            initProccess();
-            if (!m_canRun) {
-                return;
-            }
-            m_process->setProcessChannelMode(QProcess::MergedChannels);
-            if (!m_canRun) {
-                return;
-            }
-            //共享内存对应变量置true，允许进程内部逻辑运行
-            ShareMemoryInfo shareInfo;
-            shareInfo.isStart = true;
-            SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-            //启动日志需要提权获取，运行的时候把对应共享内存的名称传进去，方便获取进程拿标记量判断是否继续运行
-            m_process->start("pkexec", QStringList() << "logViewerAuth"
-                             << m_FilePath.at(i) << SharedMemoryManager::instance()->getRunnableKey());
-            m_process->waitForFinished(-1);
-            //有错则传出空数据
-            if (m_process->exitCode() != 0) {
-                emit kernFinished(m_threadCount);
-                return;
-            }
+        //内核日志需要提权获取，会话有效期内多个文件只需鉴权一次，有错则传出空数据
+        if (!Utils::runInCmd && !DLDBusHandler::instance(this)->ensureSession()) {
+            emit kernFinished(m_threadCount);
+            return;
         }
 
         if (!m_canRun) {
             return;
         }
 
-        //如果是压缩文件，对其解压缩
+        //压缩文件由服务端流式解压
         QString filePath = m_FilePath.at(i);
-        if(QString::compare(QFileInfo(filePath).suffix(), "gz", Qt::CaseInsensitive) == 0){
-            QStringList filePathList = DLDBusHandler::instance(this)->getFileInfo(filePath);
-            if(filePathList.size()){
-                filePath = filePathList.at(0);
-            }else {
-                filePath = "";
-            }
-        }
 
-        auto token = DLDBusHandler::instance(this)->openLogStream(filePath);
-        QString byte;
-        while(1) {
-            auto temp = DLDBusHandler::instance(this)->readLogInStream(token);
-
-            if(temp.isEmpty()) {
-                break;
-            }
-
-            byte += temp;
+        QString byte = readLogStream(filePath);
+        if (!m_canRun) {
+            return;
         }
 
         byte.replace('\u0000', "").replace("\x01", "");
@@ -475,9 +514,10 @@ void LogAuthThread::handleKern()
             if (!m_canRun) {
                 return;
             }
-            //每获得500个数据就发出信号给控件加载
-            if (kList.count() % SINGLE_READ_CNT == 0) {
+            //累积满一帧的数据就发出信号给控件加载
+            if (m_batchSender.due(kList.count(), m_canRun)) {
                 qCDebug(logApp) << "Emitting kernel data, count:" << kList.count();
+                PERF_ADD(PerfParseRows, kList.size());
                 emit kernData(m_threadCount, kList);
                 kList.clear();
             }
@@ -486,9 +526,11 @@ void LogAuthThread::handleKern()
             }
         }
     }
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (kList.count() >= 0) {
         qCDebug(logApp) << "Emitting kernel data, count:" << kList.count();
+        PERF_ADD(PerfParseRows, kList.size());
+        m_batchSender.commit();
         emit kernData(m_threadCount, kList);
     }
     emit kernFinished(m_threadCount);
@@ -544,9 +586,10 @@ void LogAuthThread::handleKwin()
         LOG_MSG_KWIN kwinMsg;
         kwinMsg.msg = str;
         kwinList.append(kwinMsg);
-        //每获得500个数据就发出信号给控件加载
-        if (kwinList.count() % SINGLE_READ_CNT == 0) {
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(kwinList.count(), m_canRun)) {
             // qCDebug(logApp) << "Emitting kwin data, count:" << kwinList.count();
+            PERF_ADD(PerfParseRows, kwinList.size());
             emit kwinData(m_threadCount, kwinList);
             kwinList.clear();
         }
@@ -556,9 +599,11 @@ void LogAuthThread::handleKwin()
         qCDebug(logApp) << "Thread stopped before processing kwin logs";
         return;
     }
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (kwinList.count() >= 0) {
         qCDebug(logApp) << "Emitting kwin data, count:" << kwinList.count();
+        PERF_ADD(PerfParseRows, kwinList.size());
+        m_batchSender.commit();
         emit kwinData(m_threadCount, kwinList);
     }
     emit kwinFinished(m_threadCount);
@@ -585,6 +630,14 @@ void LogAuthThread::handleXorg()
             return;
         }
         qCDebug(logApp) << "Processing Xorg file:" << m_FilePath.at(i);
+        // 服务支持按偏移读取时使用解析缓存，文件未变化时不再读取与解析，只追加时只解析新增部分
+        const LogFileIdentity identity = LogFileIdentity::fromList(DLDBusHandler::instance(this)->getFileIdentity(m_FilePath.at(i)));
+        if (identity.isValid() && loadXorgCached(m_FilePath.at(i), identity, xList)) {
+            if (!m_canRun)
+                return;
+            continue;
+        }
+
         QString m_Log = DLDBusHandler::instance(this)->readLog(m_FilePath.at(i));
         // dbus鉴权失败，不再继续解析
         if (m_Log.endsWith("is not allowed to configrate firewall. checkAuthorization failed.")) {
@@ -620,9 +673,10 @@ void LogAuthThread::handleXorg()
                 msg.msg = msgInfo + tempStr;
                 tempStr.clear();
                 xList.append(msg);
-                //每获得500个数据就发出信号给控件加载
-                if (xList.count() % SINGLE_READ_CNT == 0) {
+                //累积满一帧的数据就发出信号给控件加载
+                if (m_batchSender.due(xList.count(), m_canRun)) {
                     // qCDebug(logApp) << "Emitting xorg data, count:" << xList.count();
+                    PERF_ADD(PerfParseRows, xList.size());
                     emit xorgData(m_threadCount, xList);
                     xList.clear();
                 }
@@ -634,14 +688,68 @@ void LogAuthThread::handleXorg()
     if (!m_canRun) {
         return;
     }
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (xList.count() >= 0) {
         // qCDebug(logApp) << "Emitting xorg data, count:" << xList.count();
+        PERF_ADD(PerfParseRows, xList.size());
+        m_batchSender.commit();
         emit xorgData(m_threadCount, xList);
     }
     emit xorgFinished(m_threadCount);
 }
 
+/**
+ * @brief LogAuthThread::loadXorgCached 通过解析缓存获取Xorg日志
+ * 按文件顺序解析，不以[开头的行是上一条记录的续行，文件增长时续行同样追加到已缓存的最后一条记录
+ * @return 服务无法按偏移读取该文件时返回false，由调用方完整读取
+ */
+bool LogAuthThread::loadXorgCached(const QString &filePath, const LogFileIdentity &identity, QList<LOG_MSG_XORG> &xList)
+{
+    LogCacheTable table;
+    auto parse = [](const QStringList &lines, LogCacheTable &table) {
+        const REG_EXP colorRe("\\x1B\\[\\d+(;\\d+){0,2}m");
+        for (QString str : lines) {
+            //清除颜色格式字符
+            str.replace(colorRe, "");
+            if (str.startsWith("[")) {
+                QStringList list = str.split("]", SKIP_EMPTY_PARTS);
+                if (list.count() < 2)
+                    continue;
+                QString msgInfo = list.mid(1, list.length() - 1).join("]").trimmed();
+                // 仅显示时间偏移量（单位：秒
+                table.times.append(-1);
+                table.columns[XorgOffset].append(list[0].split("[", SKIP_EMPTY_PARTS)[0].trimmed());
+                table.columns[XorgMsg].append(msgInfo);
+            } else if (table.rowCount() > 0) {
+                table.columns[XorgMsg].last().append(" " + str);
+            }
+        }
+    };
+    auto read = [this, &filePath](qint64 offset, qint64 maxBytes) {
+        return DLDBusHandler::instance(this)->readLogFromOffset(filePath, offset, maxBytes);
+    };
+    if (!LogParseCache::instance()->update(XORG_CACHE_KIND, XORG_CACHE_VERSION, filePath, identity, XorgColumnCount,
+                                           table, read, parse, m_canRun))
+        return false;
+
+    for (int row = table.rowCount() - 1; row >= 0; --row) {
+        if (!m_canRun)
+            return true;
+
+        LOG_MSG_XORG msg;
+        msg.offset = table.columns[XorgOffset].at(row);
+        msg.msg = table.columns[XorgMsg].at(row);
+        xList.append(msg);
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(xList.count(), m_canRun)) {
+            PERF_ADD(PerfParseRows, xList.size());
+            emit xorgData(m_threadCount, xList);
+            xList.clear();
+        }
+    }
+    return true;
+}
+
 /**
  * @brief LogAuthThread::handleDkpg 获取dpkg逻辑
  */
@@ -663,6 +771,16 @@ void LogAuthThread::handleDkpg()
         }
         qCDebug(logApp) << "Processing DPKG file:" << m_FilePath.at(i);
 
+        // 服务支持按偏移读取时使用解析缓存，文件未变化时不再读取与解析，只追加时只解析新增部分
+        const LogFileIdentity identity = LogFileIdentity::fromList(DLDBusHandler::instance(this)->getFileIdentity(m_FilePath.at(i)));
+        if (identity.isValid() && loadDpkgCached(m_FilePath.at(i), identity, dList)) {
+            if (!m_canRun) {
+                qCDebug(logApp) << "Thread stopped before processing dpkg logs";
+                return;
+            }
+            continue;
+        }
+
         QString m_Log = DLDBusHandler::instance(this)->readLog(m_FilePath.at(i));
         // dbus鉴权失败，不再继续解析
         if (m_Log.endsWith("is not allowed to configrate firewall. checkAuthorization failed.")) {
@@ -708,9 +826,10 @@ void LogAuthThread::handleDkpg()
                 qCDebug(logApp) << "Thread stopped before processing dpkg logs";
                 return;
             }
-            //每获得500个数据就发出信号给控件加载
-            if (dList.count() % SINGLE_READ_CNT == 0) {
+            //累积满一帧的数据就发出信号给控件加载
+            if (m_batchSender.due(dList.count(), m_canRun)) {
                 // qCDebug(logApp) << "Emitting dpkg data, count:" << dList.count();
+                PERF_ADD(PerfParseRows, dList.size());
                 emit dpkgData(m_threadCount, dList);
                 dList.clear();
             }
@@ -721,14 +840,76 @@ void LogAuthThread::handleDkpg()
         }
     }
 
-    //最后可能有余下不足500的数据
+    //最后余下不足一批的数据
     if (dList.count() >= 0) {
         // qCDebug(logApp) << "Emitting dpkg data, count:" << dList.count();
+        PERF_ADD(PerfParseRows, dList.size());
+        m_batchSender.commit();
         emit dpkgData(m_threadCount, dList);
     }
     emit dpkgFinished(m_threadCount);
 }
 
+/**
+ * @brief LogAuthThread::loadDpkgCached 通过解析缓存获取dpkg日志，按时间筛选后从新到旧发出
+ * @return 服务无法按偏移读取该文件(如压缩日志)时返回false，由调用方完整读取
+ */
+bool LogAuthThread::loadDpkgCached(const QString &filePath, const LogFileIdentity &identity, QList<LOG_MSG_DPKG> &dList)
+{
+    LogCacheTable table;
+    auto parse = [](const QStringList &lines, LogCacheTable &table) {
+        const REG_EXP colorRe("\\x1B\\[\\d+(;\\d+){0,2}m");
+        for (QString str : lines) {
+            str.replace(colorRe, "");
+            QStringList m_strList = str.split(" ", SKIP_EMPTY_PARTS);
+            if (m_strList.size() < 3)
+                continue;
+
+            QString info;
+            for (auto k = 3; k < m_strList.size(); k++) {
+                info = info + m_strList[k] + " ";
+            }
+
+            const QString dateTime = m_strList[0] + " " + m_strList[1];
+            const QDateTime dt = QDateTime::fromString(dateTime, "yyyy-MM-dd hh:mm:ss");
+            table.times.append(dt.isValid() ? dt.toMSecsSinceEpoch() : -1);
+            table.columns[DpkgDateTime].append(dateTime);
+            table.columns[DpkgAction].append(m_strList[2]);
+            table.columns[DpkgMsg].append(info);
+        }
+    };
+    auto read = [this, &filePath](qint64 offset, qint64 maxBytes) {
+        return DLDBusHandler::instance(this)->readLogFromOffset(filePath, offset, maxBytes);
+    };
+    if (!LogParseCache::instance()->update(DPKG_CACHE_KIND, DPKG_CACHE_VERSION, filePath, identity, DpkgColumnCount,
+                                           table, read, parse, m_canRun))
+        return false;
+
+    const bool timeFilter = m_dkpgFilters.timeFilterBegin > 0 && m_dkpgFilters.timeFilterEnd > 0;
+    for (int row = table.rowCount() - 1; row >= 0; --row) {
+        if (!m_canRun)
+            return true;
+
+        //筛选时间
+        const qint64 iTime = table.times.at(row);
+        if (timeFilter && (iTime < m_dkpgFilters.timeFilterBegin || iTime > m_dkpgFilters.timeFilterEnd))
+            continue;
+
+        LOG_MSG_DPKG dpkgLog;
+        dpkgLog.dateTime = table.columns[DpkgDateTime].at(row);
+        dpkgLog.action = table.columns[DpkgAction].at(row);
+        dpkgLog.msg = table.columns[DpkgMsg].at(row);
+        dList.append(dpkgLog);
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(dList.count(), m_canRun)) {
+            PERF_ADD(PerfParseRows, dList.size());
+            emit dpkgData(m_threadCount, dList);
+            dList.clear();
+        }
+    }
+    return true;
+}
+
 void LogAuthThread::handleNormal()
 {
     qCDebug(logApp) << "LogAuthThread::handleNormal started";
@@ -738,151 +919,60 @@ void LogAuthThread::handleNormal()
         return;
     }
 
-    struct utmp *utbufp;
-    if (wtmp_open(QString(WTMP_FILE).toLatin1().data()) == -1) {
+    WtmpReader reader;
+    if (!reader.open(WTMP_FILE)) {
         qCCritical(logApp) << "Failed to open WTMP_FILE:" << WTMP_FILE;
-        printf("open WTMP_FILE file error\n");
         return;  // exit(1) will exit this application
     }
 
-    NormalInfoTime();
-
+    // 按时间范围二分定位记录，并在一次遍历中完成登录/注销、开机/关机配对
+    QList<WTMP_EVENT> events = reader.events(m_normalFilters.timeFilterBegin, m_normalFilters.timeFilterEnd, &m_canRun);
     if (!m_canRun) {
         qCDebug(logApp) << "Thread stopped before processing normal logs";
         return;
     }
 
-    int count1 = 0;
-    QString a_name = "root";
     QLocale locale = QLocale::English;
     QList<LOG_MSG_NORMAL> nList;
-    while ((utbufp = wtmp_next()) != (static_cast<struct utmp *>(nullptr))) {
-        if (!m_canRun) {
-            qCDebug(logApp) << "Thread stopped before processing normal logs";
-            return;
-        }
-        if (utbufp->ut_type == RUN_LVL || utbufp->ut_type == BOOT_TIME || utbufp->ut_type == USER_PROCESS) {
-            QString strtmp = utbufp->ut_name;
-            if (strtmp.compare("runlevel") == 0 || (utbufp->ut_type == RUN_LVL && strtmp != "shutdown") || utbufp->ut_type == INIT_PROCESS || utbufp->ut_time <= 0) { // clear the runlevel
-                continue;
-            }
-
-            LOG_MSG_NORMAL Nmsg;
-            if (utbufp->ut_type == USER_PROCESS) {
-                Nmsg.eventType = "Login";
-                Nmsg.userName = utbufp->ut_name;
-                a_name = Nmsg.userName;
-            } else {
-                Nmsg.eventType = utbufp->ut_name;
-                if (strtmp.compare("reboot") == 0) {
-                    Nmsg.eventType = "Boot";
-                }
-                Nmsg.userName = a_name;
-            }
-            if (Nmsg.eventType.compare("Login", Qt::CaseInsensitive) == 0) {
-                Nmsg.eventType = "Login";
-            }
-
-            QString strFormat = "ddd MMM dd hh:mm";
-
-            //修改时间格式转换方法，采用QDateTime 转换
-            QString start_str = locale.toString(DATE_FOTIME(static_cast<uint>(utbufp->ut_time)), strFormat);
-            //截止时间解析
-            if (Nmsg.eventType == "Login" || Nmsg.eventType == "Boot") {
-                if (count1 <= TimeList.length() - 1) {
-                    Nmsg.msg = TimeList[count1];
-                    count1++;
-                }
-            } else {
-                Nmsg.msg = start_str + "  -  ";
+    for (const WTMP_EVENT &event : events) {
+        const struct utmp &ut = event.record;
+        LOG_MSG_NORMAL Nmsg;
+        if (ut.ut_type == USER_PROCESS) {
+            Nmsg.eventType = "Login";
+        } else {
+            Nmsg.eventType = QString::fromLocal8Bit(ut.ut_user, static_cast<int>(strnlen(ut.ut_user, sizeof(ut.ut_user))));
+            if (Nmsg.eventType.compare("reboot") == 0) {
+                Nmsg.eventType = "Boot";
             }
+        }
+        Nmsg.userName = event.userName;
 
-            QString n_time = DATE_FOTIME(static_cast<uint>(utbufp->ut_time)).toString("yyyy-MM-dd hh:mm:ss");
-            Nmsg.dateTime = n_time;
-            QDateTime nn_time = QDateTime::fromString(Nmsg.dateTime, "yyyy-MM-dd hh:mm:ss");
-            if (m_normalFilters.timeFilterEnd > 0 && m_normalFilters.timeFilterBegin > 0) {
-                if (nn_time.toMSecsSinceEpoch() < m_normalFilters.timeFilterBegin || nn_time.toMSecsSinceEpoch() > m_normalFilters.timeFilterEnd) { // add by Airy
-                    continue;
-                }
-            }
-            //last -f /var/log/wtmp
-            nList.insert(0, Nmsg);
+        QDateTime dt = DATE_FOTIME(static_cast<uint>(ut.ut_tv.tv_sec));
+        //截止时间解析
+        if (Nmsg.eventType == "Login" || Nmsg.eventType == "Boot") {
+            Nmsg.msg = event.span;
+        } else {
+            Nmsg.msg = locale.toString(dt, "ddd MMM dd hh:mm") + "  -  ";
         }
+        Nmsg.dateTime = dt.toString("yyyy-MM-dd hh:mm:ss");
+        nList.append(Nmsg);
     }
-    wtmp_close();
 
     if (nList.count() >= 0) {
         // qCDebug(logApp) << "Emitting normal data, count:" << nList.count();
+        PERF_ADD(PerfParseRows, nList.size());
+        m_batchSender.commit();
         emit normalData(m_threadCount, nList);
     }
     emit normalFinished(m_threadCount);
 }
 
-void LogAuthThread::NormalInfoTime()
-{
-    qCDebug(logApp) << "LogAuthThread::NormalInfoTime started";
-    if (!m_canRun) {
-        qCDebug(logApp) << "Thread stopped before processing normal logs";
-        return;
-    }
-    initProccess();
-
-    if (!m_canRun) {
-        qCDebug(logApp) << "Thread stopped before processing normal logs";
-        return;
-    }
-    //共享内存对应变量置true，允许进程内部逻辑运行
-    ShareMemoryInfo shareInfo;
-    shareInfo.isStart = true;
-    SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-    m_process->setProcessChannelMode(QProcess::MergedChannels);
-    m_process->start("last", {"-f", "/var/log/wtmp"});
-    m_process->waitForFinished(-1);
-    QByteArray outByte = m_process->readAllStandardOutput();
-    QByteArray byte = Utils::replaceEmptyByteArray(outByte);
-    QTextStream stream(&byte);
-    #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-    QByteArray encode;
-    stream.setCodec(encode);
-    #endif
-    stream.readAll();
-    QStringList l = QString(byte).split('\n');
-    m_process->close();
-    TimeList.clear();
-    if (!m_canRun) {
-        qCDebug(logApp) << "Thread stopped before processing normal logs";
-        return;
-    }
-    for (QString str : l) {
-        if (!m_canRun) {
-            qCDebug(logApp) << "Thread stopped before processing normal logs";
-            return;
-        }
-        if (str == "") continue;
-        QString list = str.simplified();
-        if (list == "") continue;
-        int spacepos = list.indexOf(" ");
-        QString name = list.left(spacepos);
-        int spacepos2 = list.indexOf(" ", spacepos + 1);
-        int spacepos3 = list.indexOf(" ", spacepos2 + 1);
-        QString time1 = list.mid(spacepos3 + 1);
-        int spacepos4 = list.indexOf(" ", spacepos3 + 1);
-        QString time2 = list.mid(spacepos4 + 1);
-
-        if (name == "wtmp") continue;
-        if (name != "reboot" && name != "wtmp") {
-            TimeList << time1;
-        } else  if (name == "reboot") {
-            TimeList << time2;
-        }
-    }
-    std::reverse(TimeList.begin(), TimeList.end());
-}
-
 void LogAuthThread::handleDnf()
 {
     qCDebug(logApp) << "LogAuthThread::handleDnf started, processing" << m_FilePath.count() << "files";
     QList<LOG_MSG_DNF> dList;
+    // 已解析出的记录数，分批发出时dList会被清空
+    int dnfCount = 0;
     for (int i = 0; i < m_FilePath.count(); i++) {
         if (!m_FilePath.at(i).contains("txt")) {
             QFile file(m_FilePath.at(i)); // if not,maybe crash
@@ -900,6 +990,10 @@ void LogAuthThread::handleDnf()
         // dbus鉴权失败，不再继续解析
         if (outByte.endsWith("is not allowed to configrate firewall. checkAuthorization failed.")) {
             qCDebug(logApp) << "DNF log file is not allowed to configrate firewall";
+            if (m_streamData) {
+                emit dnfData(m_threadCount, dList);
+                dList.clear();
+            }
             emit dnfFinished(dList);
             return;
         }
@@ -933,10 +1027,17 @@ void LogAuthThread::handleDnf()
                 dnfLog.dateTime = localdt.toString("yyyy-MM-dd hh:mm:ss");
                 dnfLog.msg = match.captured(4) + multiLine;
                 dList.append(dnfLog);
+                ++dnfCount;
                 multiLine.clear();
+                //累积满一帧的数据就发出信号
+                if (m_streamData && m_batchSender.due(dList.count(), m_canRun)) {
+                    PERF_ADD(PerfParseRows, dList.size());
+                    emit dnfData(m_threadCount, dList);
+                    dList.clear();
+                }
             } else {
                 //如果不匹配，认为是多条信息，添加换行符，在前一条信息后添加信息。
-                if (!str.trimmed().isEmpty() && !dList.isEmpty()) {
+                if (!str.trimmed().isEmpty() && dnfCount > 0) {
                     multiLine.push_front("\n" + str);
                 }
             }
@@ -946,6 +1047,12 @@ void LogAuthThread::handleDnf()
             }
         }
     }
+    PERF_ADD(PerfParseRows, dList.size());
+    if (m_streamData) {
+        m_batchSender.commit();
+        emit dnfData(m_threadCount, dList);
+        dList.clear();
+    }
     emit dnfFinished(dList);
 }
 
@@ -962,7 +1069,7 @@ void LogAuthThread::handleDmesg()
 
     if (startStr.isEmpty()) {
         qCWarning(logApp) << "Failed to get system start time";
-        emit dmesgFinished(dmesgList);
+        emit dmesgFinished(dmesgList, m_dmesgFilters.sinceSeq);
         return;
     }
     if (!m_canRun) {
@@ -971,99 +1078,79 @@ void LogAuthThread::handleDmesg()
     }
     qCDebug(logApp) << "System start time:" << startStr;
 
-    initProccess();
-    //共享内存对应变量置true，允许进程内部逻辑运行
-    ShareMemoryInfo shareInfo;
-    shareInfo.isStart = true;
-    SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-    m_process->setProcessChannelMode(QProcess::MergedChannels);
-    m_process->start("pkexec", QStringList() << "logViewerAuth"
-                                             << "dmesg" << SharedMemoryManager::instance()->getRunnableKey());
-    m_process->waitForFinished(-1);
-    QString errorStr(m_process->readAllStandardError());
-    Utils::CommandErrorType commandErrorType = Utils::isErroCommand(errorStr);
-    if (!m_canRun) {
-        qCDebug(logApp) << "Thread stopped before processing dmesg logs";
-        return;
-    }
-    if (commandErrorType != Utils::NoError) {
-        if (commandErrorType == Utils::PermissionError) {
-            emit proccessError(errorStr + "\n" + "Please use 'sudo' run this application");
-        } else if (commandErrorType == Utils::RetryError) {
-            emit proccessError("The password is incorrect,please try again");
-        }
-        m_process->close();
-        return;
-    }
-    if (!m_canRun) {
-        qCDebug(logApp) << "Thread stopped before processing dmesg logs";
+    //dmesg需要提权获取，复用已鉴权的读取会话
+    if (!Utils::runInCmd && !DLDBusHandler::instance(this)->ensureSession()) {
+        qCWarning(logApp) << "Reader session authorization failed";
+        emit dmesgFinished(dmesgList, m_dmesgFilters.sinceSeq);
         return;
     }
-    QByteArray outByte = m_process->readAllStandardOutput();
-    QByteArray byte = Utils::replaceEmptyByteArray(outByte);
-    QTextStream stream(&byte);
-    #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-    QByteArray encode;
-    stream.setCodec(encode);
-    #endif
-    stream.readAll();
-    QStringList l = QString(byte).split('\n');
-    m_process->close();
-    if (!m_canRun) {
-        return;
-    }
-    qint64 curDtSecond = curDt.toMSecsSinceEpoch() - static_cast<int>(startStr.toDouble() * 1000);
-    for (QString str : l) {
-        if (!m_canRun) {
-            qCDebug(logApp) << "Thread stopped before processing dmesg logs";
-            return;
-        }
-        str.replace(REG_EXP("\\x1B\\[\\d+(;\\d+){0,2}m"), "");
-        REG_EXP dmesgExp("^\\<([0-7])\\>\\[\\s*[+-]?(0|([1-9]\\d*))(\\.\\d+)?\\](.*)");
-        //启用贪婪匹配
-        #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-        dmesgExp.setMinimal(false);
-        int pos = dmesgExp.indexIn(str);
-        #else
-        dmesgExp.setPatternOptions(QRegularExpression::UseUnicodePropertiesOption);
-        int pos = dmesgExp.match(str).capturedStart();
-        #endif
-        if (pos >= 0) {
-            #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-            QStringList list = dmesgExp.capturedTexts();
-            #else
-            QStringList list = dmesgExp.match(str).capturedTexts();
-            #endif
-            if (list.count() < 6)
+
+    // 开机时刻(ms)，内核日志时间戳为开机后经过的微秒数
+    const qint64 bootMsecs = curDt.toMSecsSinceEpoch() - static_cast<qint64>(startStr.toDouble() * 1000);
+    quint64 lastSeq = m_dmesgFilters.sinceSeq;
+    // 服务端按"级别,序号,时间戳(us);消息"逐行返回，按分隔符直接解码
+    auto readNumber = [](const QString &str, int &pos) {
+        quint64 value = 0;
+        while (pos < str.size() && str.at(pos).isDigit())
+            value = value * 10 + static_cast<quint64>(str.at(pos++).digitValue());
+        return value;
+    };
+    while (m_canRun) {
+        QString batch = DLDBusHandler::instance(this)->readKernelMessages(lastSeq, KMSG_READ_CNT);
+        if (batch.isEmpty())
+            break;
+
+        int lineStart = 0;
+        while (lineStart < batch.size()) {
+            int lineEnd = batch.indexOf('\n', lineStart);
+            if (lineEnd < 0)
+                lineEnd = batch.size();
+            int pos = lineStart;
+            lineStart = lineEnd + 1;
+
+            const int levelOrigin = static_cast<int>(readNumber(batch, pos));
+            if (pos >= lineEnd || batch.at(pos++) != ',')
                 continue;
-            QString timeStr = list[3] + list[4];
-            QString msgInfo = list[5].simplified();
-            int levelOrigin = list[1].toInt();
-            QString tStr = timeStr.split("[", SKIP_EMPTY_PARTS)[0].trimmed();
-            qint64 realT = curDtSecond + qint64(tStr.toDouble() * 1000);
-            QDateTime realDt = QDateTime::fromMSecsSinceEpoch(realT);
-            if (realDt.toMSecsSinceEpoch() < m_dmesgFilters.timeFilter) // add by Airy
+            const quint64 seq = readNumber(batch, pos);
+            if (pos >= lineEnd || batch.at(pos++) != ',')
                 continue;
-            if (m_dmesgFilters.levelFilter != LVALL) {
-                if (levelOrigin != m_dmesgFilters.levelFilter)
-                    continue;
-            }
+            const quint64 usec = readNumber(batch, pos);
+            if (pos >= lineEnd || batch.at(pos++) != ';')
+                continue;
+
+            lastSeq = seq;
+            const qint64 realT = bootMsecs + static_cast<qint64>(usec / 1000);
+            if (realT < m_dmesgFilters.timeFilter) // add by Airy
+                continue;
+            if (m_dmesgFilters.levelFilter != LVALL && levelOrigin != m_dmesgFilters.levelFilter)
+                continue;
+
             LOG_MSG_DMESG msg;
-            msg.dateTime = realDt.toString("yyyy-MM-dd hh:mm:ss.zzz");
-            msg.msg = msgInfo;
+            msg.dateTime = QDateTime::fromMSecsSinceEpoch(realT).toString("yyyy-MM-dd hh:mm:ss.zzz");
+            msg.msg = batch.mid(pos, lineEnd - pos).simplified();
             msg.level = m_levelMap.value(levelOrigin);
-            dmesgList.insert(0, msg);
-        } else {
-            if (dmesgList.length() > 0) {
-                dmesgList[0].msg += str;
+            dmesgList.append(msg);
+            if (m_streamData && m_batchSender.due(dmesgList.count(), m_canRun)) {
+                PERF_ADD(PerfParseRows, dmesgList.size());
+                emit dmesgData(m_threadCount, dmesgList);
+                dmesgList.clear();
             }
         }
-        if (!m_canRun) {
-            qCDebug(logApp) << "Thread stopped before processing dmesg logs";
-            return;
-        }
     }
-    emit dmesgFinished(dmesgList);
+    if (!m_canRun) {
+        qCDebug(logApp) << "Thread stopped before processing dmesg logs";
+        return;
+    }
+
+    PERF_ADD(PerfParseRows, dmesgList.size());
+    if (m_streamData) {
+        m_batchSender.commit();
+        emit dmesgData(m_threadCount, dmesgList);
+        dmesgList.clear();
+    }
+    //内核日志按时间先后读取，界面按最新在前显示
+    std::reverse(dmesgList.begin(), dmesgList.end());
+    emit dmesgFinished(dmesgList, lastSeq);
 }
 
 void LogAuthThread::handleAudit()
@@ -1084,17 +1171,6 @@ void LogAuthThread::handleAudit()
         }
 
         if (!Utils::runInCmd) {
-            initProccess();
-            if (!m_canRun) {
-                qCDebug(logApp) << "Thread stopped before processing audit logs";
-                return;
-            }
-            m_process->setProcessChannelMode(QProcess::MergedChannels);
-            if (!m_canRun) {
-                qCDebug(logApp) << "Thread stopped before processing audit logs";
-                return;
-            }
-
             if (DBusManager::isSEOpen()) {
                 if (DBusManager::isAuditAdmin()) {
                     // 是审计管理员，需要鉴权，有错则传出空数据
@@ -1111,14 +1187,7 @@ void LogAuthThread::handleAudit()
                 }
             } else {
                 // 未开启等保四，鉴权逻辑同内核日志
-                ShareMemoryInfo shareInfo;
-                shareInfo.isStart = true;
-                SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-                //启动日志需要提权获取，运行的时候把对应共享内存的名称传进去，方便获取进程拿标记量判断是否继续运行
-                m_process->start("pkexec", QStringList() << "logViewerAuth"
-                                 << m_FilePath.at(i) << SharedMemoryManager::instance()->getRunnableKey());
-                m_process->waitForFinished(-1);
-                if (m_process->exitCode() != 0) {
+                if (!DLDBusHandler::instance(this)->ensureSession()) {
                     qCDebug(logApp) << "Thread stopped before processing audit logs";
                     emit auditFinished(m_threadCount);
                     return;
@@ -1131,18 +1200,23 @@ void LogAuthThread::handleAudit()
             return;
         }
 
+        // 服务支持按偏移读取时使用解析缓存，文件未变化时不再读取与解析，只追加时只解析新增部分
+        const LogFileIdentity identity = LogFileIdentity::fromList(DLDBusHandler::instance(this)->getFileIdentity(m_FilePath.at(i)));
+        if (identity.isValid() && loadAuditCached(m_FilePath.at(i), identity, aList)) {
+            if (!m_canRun) {
+                qCDebug(logApp) << "Thread stopped before processing audit logs";
+                return;
+            }
+            continue;
+        }
+
         QString byte;
         if (Utils::convertToMB(DLDBusHandler::instance(this)->getFileSize(m_FilePath.at(i))) > DBUS_THRESHOLD_MAX) {
             // 日志文件超过100MB，使用文本流读取日志数据，避免DBUS接口被数据流量撑爆
-            auto token = DLDBusHandler::instance(this)->openLogStream(m_FilePath.at(i));
-            while(1) {
-                auto temp = DLDBusHandler::instance(this)->readLogInStream(token);
-
-                if(temp.isEmpty()) {
-                    break;
-                }
-
-                byte += temp;
+            byte = readLogStream(m_FilePath.at(i));
+            if (!m_canRun) {
+                qCDebug(logApp) << "Thread stopped before processing audit logs";
+                return;
             }
         } else {
             byte = DLDBusHandler::instance(this)->readLog(m_FilePath.at(i));
@@ -1151,164 +1225,153 @@ void LogAuthThread::handleAudit()
         byte.replace('\u0000', "").replace("\x01", "");
         QStringList strList = byte.split('\n', SKIP_EMPTY_PARTS);
 
-        QRegularExpression re;
-        QRegularExpressionMatch match;
+        // 从新到旧解析，同一事件的多条记录合并为一条
+        LogAuditParser parser(true);
+        QList<LogAuditParser::Event> events;
         for (int j = strList.size() - 1; j >= 0; --j) {
             if (!m_canRun) {
                 qCDebug(logApp) << "Thread stopped before processing audit logs";
                 return;
             }
-            QString str = strList.at(j);
-            if (str.isEmpty() || str.indexOf("type=") == -1)
-                continue;
-
-            LOG_MSG_AUDIT msg;
-            //删除颜色格式字符
-            str.replace(REG_EXP("\\#033\\[\\d+(;\\d+){0,2}m"), "");
-            // remove Useless characters
-            str.replace(REG_EXP("\\x1B\\[\\d+(;\\d+){0,2}m"), "");
-            QStringList list = str.split(" ", SKIP_EMPTY_PARTS);
-            if (list.size() < 2)
-                continue;
-
-            // 事件类型
-            QString eventType = list[0].split("=").last();
-            msg.eventType = eventType;
-
-            // 审计类型
-            QString auditType = "";
-            // 根据事件类型识别审计类型
-            if (auditType.isEmpty())
-                auditType = Utils::auditType(msg.eventType);
-
-            // 根据事件类型未识别出审计类型
-            if (auditType.isEmpty()) {
-                // 判断是否为远程连接审计日志
-                re.setPattern("(?<=addr=)([^= \"]+|(\"(\\\\\"|[^\"])*\"))");
-                match = re.match(str);
-                if (match.hasMatch()) {
-                    QString addr = match.captured(0);
-                    REG_EXP ipExp("\\b(?:(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\\.){3}(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\\b");
-                    #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-                    if (ipExp.exactMatch(addr))
-                    #else
-                    if (ipExp.match(addr).hasMatch())
-                    #endif
-                        auditType = Audit_Remote;
-                }
-
-                if (auditType.isEmpty()) {
-                     // 获取key值，识别出一些特殊的审计类型(主要为自定义的审计类型)
-                    re.setPattern("(?<=key=)([^= \"]+|(\"(\\\\\"|[^\"])*\"))");
-                    match = re.match(str);
-                    if (match.hasMatch()) {
-                        QString key = match.captured(0);
-                        key.replace("\"","");
-                        if (!key.isEmpty())
-                            auditType = Utils::auditType(key);
-                    }
-                }
-            }
-
-            // 审计类型依然为空，归为其他类型
-            if (auditType.isEmpty())
-                auditType = Audit_Other;
-
-            msg.auditType = auditType;
-
-            // 时间"(?<=msg=audit\()[^\.]*(?=\.)"
-            re.setPattern("(?<=msg=audit\\()[^\\.]*(?=\\.)");
-            match = re.match(str);
-            if (match.hasMatch()) {
-                QDateTime dateTime = DATE_FOTIME(match.captured(0).toUInt());
-                qint64 iTime = dateTime.toMSecsSinceEpoch();
-                //对时间筛选
-                if (m_auditFilters.timeFilterBegin > 0 && m_auditFilters.timeFilterEnd > 0) {
-                    if (iTime < m_auditFilters.timeFilterBegin || iTime > m_auditFilters.timeFilterEnd)
-                        continue;
-                }
-                msg.dateTime = dateTime.toString("yyyy-MM-dd hh:mm:ss");
-            }
-
-            // 进程名
-            QString processName = "";
-            re.setPattern("(?<=comm=\\\")([^= \"]+|(\"(\\\\\"|[^\"])*\"))");
-            match = re.match(str);
-            if (match.hasMatch()) {
-                processName = match.captured(0);
-                processName.replace("\"","");
-            }
-
-            if (processName.isEmpty()) {
-                re.setPattern("(?<=exe=\\\")([^= \"]+|(\"(\\\\\"|[^\"])*\"))");
-                match = re.match(str);
-                if (match.hasMatch()) {
-                    processName = match.captured(0);
-                    processName.replace("\"","");
-                    processName = processName.split("/").last();
-                }
-            }
 
-            if (processName.isEmpty())
-                processName = "N/A";
-            msg.processName = processName;
-
-            // 状态
-            QString status = "";
-            re.setPattern("(?<=success=)([^= \"]+|(\"(\\\\\"|[^\"])*\"))");
-            match = re.match(str);
-            if (match.hasMatch()) {
-                status = match.captured(0);
-                if (status == "yes")
-                    status = "OK";
-                else
-                    status = "Failed";
-            }
-
-            if (status.isEmpty()) {
-                re.setPattern("(?<=res=)([^= ']+|('(\\\\'|[^'])*'))");
-                match = re.match(str);
-                if (match.hasMatch()) {
-                    status = match.captured(0);
-                    if (status == "success")
-                        status = "OK";
-                    else
-                        status = "Failed";
-                }
+            parser.addLine(strList.at(j), events);
+            for (const LogAuditParser::Event &event : events)
+                appendAuditEvent(event.msg, event.time, aList);
+            events.clear();
+        }
+        parser.flush(events);
+        for (const LogAuditParser::Event &event : events)
+            appendAuditEvent(event.msg, event.time, aList);
+    }
+    //最后余下不足一批的数据
+    if (aList.count() >= 0) {
+        PERF_ADD(PerfParseRows, aList.size());
+        m_batchSender.commit();
+        emit auditData(m_threadCount, aList);
+    }
+    emit auditFinished(m_threadCount);
+}
 
-                if (status.isEmpty())
-                    status = "OK";
-            }
+/**
+ * @brief LogAuthThread::appendAuditEvent 按时间筛选后加入一条审计日志，累积满一帧时发出一次
+ * @param time 日志的毫秒时间戳，没有时间时为-1
+ */
+void LogAuthThread::appendAuditEvent(const LOG_MSG_AUDIT &msg, qint64 time, QList<LOG_MSG_AUDIT> &aList)
+{
+    //对时间筛选
+    if (time >= 0 && m_auditFilters.timeFilterBegin > 0 && m_auditFilters.timeFilterEnd > 0) {
+        if (time < m_auditFilters.timeFilterBegin || time > m_auditFilters.timeFilterEnd)
+            return;
+    }
 
-            msg.status = status;
+    aList.append(msg);
+    //累积满一帧的数据就发出信号给控件加载
+    if (m_batchSender.due(aList.count(), m_canRun)) {
+        PERF_ADD(PerfParseRows, aList.size());
+        emit auditData(m_threadCount, aList);
+        aList.clear();
+    }
+}
 
-            // 信息，将“msg=audit(1688526389.214:61):”之后的内容作为详细信息
-            msg.msg = str.right(str.length() - str.indexOf("):") - 3);
+/**
+ * @brief LogAuthThread::loadAuditCached 通过解析缓存获取审计日志
+ * 缓存未命中时按偏移分块读取并解析整个文件，命中时只解析文件新增的部分，解析结果写回缓存后按时间从新到旧发出
+ * @return 服务无法按偏移读取该文件(如压缩日志)时返回false，由调用方完整读取
+ */
+bool LogAuthThread::loadAuditCached(const QString &filePath, const LogFileIdentity &identity, QList<LOG_MSG_AUDIT> &aList)
+{
+    LogCacheTable table;
+    // 审计日志需要提权读取，解析结果只缓存在内存中，不写入用户目录
+    LogParseCache::State state = LogParseCache::instance()->load(AUDIT_CACHE_KIND, AUDIT_CACHE_VERSION, filePath, identity,
+                                                                 AuditColumnCount, table, LogParseCache::MemoryStorage);
+    const qint64 startOffset = table.offset;
+    qCDebug(logApp) << "Audit parse cache state:" << state << "cached rows:" << table.rowCount();
+
+    // 各块之间共用一个解析器，跨块的事件同样能合并；文件增长时已缓存的最后一个事件不再与新增的记录合并
+    LogAuditParser parser;
+    QList<LogAuditParser::Event> events;
+    auto appendRows = [&table, &events]() {
+        for (const LogAuditParser::Event &event : events) {
+            table.times.append(event.time);
+            table.columns[AuditEventType].append(event.msg.eventType);
+            table.columns[AuditAuditType].append(event.msg.auditType);
+            table.columns[AuditProcessName].append(event.msg.processName);
+            table.columns[AuditProcessId].append(event.msg.processId);
+            table.columns[AuditStatus].append(event.msg.status);
+            table.columns[AuditMsgOffset].append(QString::number(event.msgPos));
+            table.columns[AuditOrigin].append(event.msg.origin);
+        }
+        events.clear();
+    };
+
+    // 只读取到获取标识时的文件大小，保证缓存的偏移与标识一致
+    while (m_canRun && table.offset < identity.size) {
+        const qint64 maxBytes = qMin(AUDIT_CACHE_READ_SIZE, identity.size - table.offset);
+        const QByteArray byte = DLDBusHandler::instance(this)->readLogFromOffset(filePath, table.offset, maxBytes);
+        if (byte.isEmpty())
+            break;
+
+        QString text = QString::fromUtf8(byte);
+        text.replace("\x01", "");
+        const QStringList strList = text.split('\n', SKIP_EMPTY_PARTS);
+        for (const QString &str : strList)
+            parser.addLine(str, events);
+        appendRows();
+        table.offset += byte.size();
+    }
+    parser.flush(events);
+    appendRows();
+
+    if (0 == table.offset && identity.size > 0)
+        return false;
+    // 中途停止时已解析的整块同样有效，下次从停止处继续
+    if (table.offset != startOffset)
+        LogParseCache::instance()->save(AUDIT_CACHE_KIND, AUDIT_CACHE_VERSION, filePath, identity, table,
+                                        LogParseCache::MemoryStorage);
+    if (!m_canRun)
+        return true;
+
+    // 详细信息与时间文本由原文和时间戳还原，同一秒内的事件共用时间文本
+    qint64 lastTime = -1;
+    QString lastDateTime;
+    for (int row = table.rowCount() - 1; row >= 0; --row) {
+        if (!m_canRun)
+            return true;
+
+        const qint64 iTime = table.times.at(row);
+        if (iTime >= 0 && m_auditFilters.timeFilterBegin > 0 && m_auditFilters.timeFilterEnd > 0) {
+            if (iTime < m_auditFilters.timeFilterBegin || iTime > m_auditFilters.timeFilterEnd)
+                continue;
+        }
 
-            // 原文
-            msg.origin = str;
+        LOG_MSG_AUDIT msg;
+        msg.eventType = table.columns[AuditEventType].at(row);
+        msg.auditType = table.columns[AuditAuditType].at(row);
+        msg.processName = table.columns[AuditProcessName].at(row);
+        msg.processId = table.columns[AuditProcessId].at(row);
+        msg.status = table.columns[AuditStatus].at(row);
+        msg.origin = table.columns[AuditOrigin].at(row);
+        // 详细信息为主记录所在行中偏移之后的内容
+        const int msgPos = qBound(0, table.columns[AuditMsgOffset].at(row).toInt(), msg.origin.size());
+        const int lineEnd = msg.origin.indexOf('\n', msgPos);
+        msg.msg = msg.origin.mid(msgPos, lineEnd < 0 ? -1 : lineEnd - msgPos);
+        if (iTime >= 0) {
+            if (iTime != lastTime) {
+                lastTime = iTime;
+                lastDateTime = QDateTime::fromMSecsSinceEpoch(iTime).toString("yyyy-MM-dd hh:mm:ss");
+            }
+            msg.dateTime = lastDateTime;
+        }
 
-            aList.append(msg);
-            if (!m_canRun) {
-                qCDebug(logApp) << "Thread stopped before processing audit logs";
-                return;
-            }
-            //每获得500个数据就发出信号给控件加载
-            if (aList.count() % SINGLE_READ_CNT == 0) {
-                emit auditData(m_threadCount, aList);
-                aList.clear();
-            }
-            if (!m_canRun) {
-                qCDebug(logApp) << "Thread stopped before processing audit logs";
-                return;
-            }
+        aList.append(msg);
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(aList.count(), m_canRun)) {
+            PERF_ADD(PerfParseRows, aList.size());
+            emit auditData(m_threadCount, aList);
+            aList.clear();
         }
     }
-    //最后可能有余下不足500的数据
-    if (aList.count() >= 0) {
-        emit auditData(m_threadCount, aList);
-    }
-    emit auditFinished(m_threadCount);
+    return true;
 }
 
 /**
@@ -1346,18 +1409,9 @@ void LogAuthThread::handleAuth()
         QFlags<QFileDevice::Permission> power = QFile::permissions(filePath);
         if (!power.testFlag(QFile::ReadUser)) {
             qCDebug(logApp) << "User does not have read permission for:" << filePath << ", requesting elevation";
-            // Show privilege elevation dialog
-            ShareMemoryInfo shareInfo;
-            shareInfo.isStart = true;
-            SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-            
-            initProccess();
-            m_process->start("pkexec", QStringList() << "logViewerAuth"
-                             << filePath << SharedMemoryManager::instance()->getRunnableKey());
-            m_process->waitForFinished(-1);
-            
-            if (m_process->exitCode() != 0) {
-                qCWarning(logApp) << "pkexec authentication failed for:" << filePath;
+            // Authorize once, the reader session is shared by the following files
+            if (!DLDBusHandler::instance(this)->ensureSession()) {
+                qCWarning(logApp) << "Reader session authorization failed for:" << filePath;
                 emit authFinished(m_threadCount);
                 return;
             }
@@ -1444,8 +1498,9 @@ void LogAuthThread::handleAuth()
             
             aList.append(msg);
             
-            // Send data in batches
-            if (aList.count() % SINGLE_READ_CNT == 0) {
+            // Send data in frame-sized batches
+            if (m_batchSender.due(aList.count(), m_canRun)) {
+                PERF_ADD(PerfParseRows, aList.size());
                 emit authData(m_threadCount, aList);
                 aList.clear();
             }
@@ -1459,6 +1514,8 @@ void LogAuthThread::handleAuth()
     
     // Send remaining data
     if (aList.count() > 0) {
+        PERF_ADD(PerfParseRows, aList.size());
+        m_batchSender.commit();
         emit authData(m_threadCount, aList);
     }
     
@@ -1475,19 +1532,15 @@ void LogAuthThread::handleCoredump()
     }
     QList<LOG_MSG_COREDUMP> coredumpList;
 
-    QString byte;
-    initProccess();
-    if (Utils::runInCmd) {
-        byte = DLDBusHandler::instance()->executeCmd("coredumpctl-list");
-        byte = byte.replace('\u0000', "").replace("\x01", "");
-    } else {
-        m_process->start("pkexec", QStringList() << "logViewerAuth" <<
-                         QStringList() << "coredumpctl-list" << SharedMemoryManager::instance()->getRunnableKey());
-        m_process->waitForFinished(-1);
-        QByteArray outByte = m_process->readAllStandardOutput();
-        byte = Utils::replaceEmptyByteArray(outByte);
+    if (!Utils::runInCmd && !DLDBusHandler::instance()->ensureSession()) {
+        qCWarning(logApp) << "Reader session authorization failed";
+        emit coredumpFinished(m_threadCount);
+        return;
     }
 
+    QString byte = DLDBusHandler::instance()->executeCmd("coredumpctl-list");
+    byte = byte.replace('\u0000', "").replace("\x01", "");
+
     QStringList strList =  QString(byte).split('\n', SKIP_EMPTY_PARTS);
 
     REG_EXP re("(Storage: )\\S+");
@@ -1559,8 +1612,9 @@ void LogAuthThread::handleCoredump()
         }
 
         coredumpList.append(coredumpMsg);
-        //每获得600个数据就发出信号给控件加载
-        if (coredumpList.count() % SINGLE_READ_CNT_COREDUMP == 0) {
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(coredumpList.count(), m_canRun)) {
+            PERF_ADD(PerfParseRows, coredumpList.size());
             emit coredumpData(m_threadCount, coredumpList);
             coredumpList.clear();
         }
@@ -1571,8 +1625,10 @@ void LogAuthThread::handleCoredump()
         return;
     }
 
-    //最后可能有余下不足600的数据
+    //最后余下不足一批的数据
     if (coredumpList.count() >= 0) {
+        PERF_ADD(PerfParseRows, coredumpList.size());
+        m_batchSender.commit();
         emit coredumpData(m_threadCount, coredumpList);
     }
     emit coredumpFinished(m_threadCount);
@@ -5,10 +5,13 @@
 #ifndef LOGAUTHTHREAD_H
 #define LOGAUTHTHREAD_H
 #include "structdef.h"
+#include "logparsecache.h"
+#include "logbatchchannel.h"
 
 #include <QProcess>
 #include <QRunnable>
 #include <QMap>
+#include <QMutex>
 
 /**
  * @brief The LogAuthThread class 启动日志 内核日志 kwin日志 xorg日志 dpkg日志获取线程
@@ -36,6 +39,10 @@ public:
     void setFileterParam(const COREDUMP_FILTERS &iFIlters) { m_coredumpFilters = iFIlters; }
     void stopProccess();
     void setFilePath(const QStringList &filePath);
+    // 设置与接收端共享的批次计数，接收端处理不及时时解析线程合并批次或等待
+    void setBatchChannel(const QSharedPointer<LogBatchChannel> &channel) { m_batchSender.setChannel(channel); }
+    // dnf、dmesg日志默认在结束信号中一次性给出，设置后改为通过数据信号分批发出，结束信号不再携带数据
+    void setStreamData(bool stream) { m_streamData = stream; }
     int getIndex();
     QString startTime();
     /**
@@ -49,18 +56,19 @@ protected:
     void handleKern();
     void handleKwin();
     void handleXorg();
+    bool loadXorgCached(const QString &filePath, const LogFileIdentity &identity, QList<LOG_MSG_XORG> &xList);
     void handleDkpg();
+    bool loadDpkgCached(const QString &filePath, const LogFileIdentity &identity, QList<LOG_MSG_DPKG> &dList);
     void handleNormal();
-    /**
-     * @brief NormalInfoTime 开关机事件信息段解析
-     */
-    void NormalInfoTime();
     void handleDnf();
     void handleDmesg();
     void handleAudit();
+    bool loadAuditCached(const QString &filePath, const LogFileIdentity &identity, QList<LOG_MSG_AUDIT> &aList);
     void handleAuth();
     void handleCoredump();
     void initProccess();
+    // 通过服务端流式通道读取整个日志文件，线程停止时取消该读取请求
+    QString readLogStream(const QString &filePath);
     qint64 formatDateTime(QString m, QString d, QString t);
     qint64 formatDateTime(QString y, QString t);
 
@@ -88,7 +96,11 @@ signals:
     void normalFinished(int index);
     void normalData(int index, QList<LOG_MSG_NORMAL> iDataList);
     void dnfFinished(QList<LOG_MSG_DNF> iKwinList);
-    void dmesgFinished(QList<LOG_MSG_DMESG> iKwinList);
+    void dnfData(int index, QList<LOG_MSG_DNF> iDataList);
+    // lastSeq为本次读取到的最新内核日志序号，用于下次增量刷新
+    void dmesgFinished(QList<LOG_MSG_DMESG> iKwinList, quint64 lastSeq);
+    // 分批发出时按读取顺序由旧到新
+    void dmesgData(int index, QList<LOG_MSG_DMESG> iDataList);
     void auditFinished(int index, bool bShowTip = false);
     void auditData(int index, QList<LOG_MSG_AUDIT> iDataList);
     void authFinished(int index);
@@ -101,6 +113,7 @@ public slots:
     //    void kernDataRecived();
 private:
     QString readAppLogFromLastLines(const QString& filePath, const int& count);
+    void appendAuditEvent(const LOG_MSG_AUDIT &msg, qint64 time, QList<LOG_MSG_AUDIT> &aList);
 
 private:
 
@@ -142,17 +155,25 @@ private:
     COREDUMP_FILTERS m_coredumpFilters;
     //获取数据用的cat命令的process
     QScopedPointer<QProcess> m_process;
+    //正在进行的流式读取请求token，停止线程时用于取消服务端读取
+    QMutex m_streamMutex;
+    QString m_streamToken;
     /**
      * @brief m_canRun 是否可以继续运行的标记量，用于停止运行线程
      */
     std::atomic_bool m_canRun = false;
+    /**
+     * @brief m_batchSender 按耗时划分发送批次
+     */
+    LogBatchSender m_batchSender;
     /**
      * @brief m_threadIndex 当前线程标号
      */
     bool m_parseMap = false; // 崩溃信息是否要解析map信息，即stackinfo
+    bool m_streamData = false; // dnf、dmesg日志是否分批发出
     int m_threadCount;
-    //正在执行停止进程的变量，防止重复执行停止逻辑
-    bool m_isStopProccess = false;
+    //正在执行停止进程的变量，防止重复执行停止逻辑，排队中的任务开始执行时据此直接返回
+    std::atomic_bool m_isStopProccess = false;
     //日志显示时间(毫秒)
     qint64 iTime;
     //所有日志文件路径
@@ -160,7 +181,6 @@ private:
     QMap<int, QString> m_levelMap;
     QMap<QString, int> m_dnfLevelDict;
     QMap<QString, QString> m_transDnfDict;
-    QStringList TimeList;
 };
 
 #endif  // LOGAUTHTHREAD_H
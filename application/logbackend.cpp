@@ -11,9 +11,11 @@
 #include "dbusmanager.h"
 #include "dbusproxy/dldbushandler.h"
 #include "logapplicationhelper.h"
+#include "coredumpstatistics.h"
 #include "DebugTimeManager.h"
 #include "eventlogutils.h"
 #include "logsegementexportthread.h"
+#include "loghistogram.h"
 #include "parsethread/parsethreadbase.h"
 
 #include <sys/utsname.h>
@@ -22,16 +24,21 @@
 #include <DSysInfo>
 
 #include <QDateTime>
+#include <QDBusPendingCallWatcher>
+#include <QSharedPointer>
 #include <QStandardPaths>
 #include <QThreadPool>
 #include <QLoggingCategory>
 #include <QCoreApplication>
 #include <QTemporaryDir>
+#include <QTimer>
 
 Q_DECLARE_LOGGING_CATEGORY(logApp)
 
 // 获取窗管崩溃时，其日志最后100行
 #define KWIN_LASTLINE_NUM 100
+// 跟随模式下合并内核日志新记录通知的时间间隔(ms)
+#define DMESG_FOLLOW_INTERVAL 1000
 // 窗管二进制可执行文件所在路径
 const QString KWAYLAND_EXE_PATH = "/usr/bin/kwin_wayland";
 const QString XWAYLAND_EXE_PATH = "/usr/bin/Xwayland";
@@ -58,7 +65,7 @@ LogBackend::~LogBackend()
 LogBackend::LogBackend(QObject *parent) : QObject(parent)
 {
     qCDebug(logApp) << "LogBackend constructor called";
-    getLogTypes();
+    // 日志种类只用于命令行导出全部日志，需等待应用日志发现，在使用时再获取，不阻塞界面首帧
 
     m_cmdWorkDir = QDir::currentPath();
     qCInfo(logApp) << "Set command working directory to:" << m_cmdWorkDir;
@@ -66,6 +73,9 @@ LogBackend::LogBackend(QObject *parent) : QObject(parent)
     Utils::m_mapAuditType2EventType = LogSettings::instance()->loadAuditMap();
     qCDebug(logApp) << "Loaded audit type mapping";
 
+    m_histogram = new LogHistogram(this);
+    m_memoryGovernor.setBudget(LogSettings::instance()->getMemoryBudget());
+
     initConnections();
 }
 
@@ -76,6 +86,8 @@ void LogBackend::initConnections()
             Qt::QueuedConnection);
     connect(&m_logFileParser, &LogFileParser::logData, this, &LogBackend::slot_logData,
             Qt::QueuedConnection);
+    connect(&m_logFileParser, &LogFileParser::logRecords, this, &LogBackend::slot_logRecords,
+            Qt::QueuedConnection);
 
     connect(&m_logFileParser, &LogFileParser::dpkgFinished, this, &LogBackend::slot_dpkgFinished,
             Qt::QueuedConnection);
@@ -183,7 +195,7 @@ int LogBackend::exportAllLogs(const QString &outDir)
     }
 
     QThread *exportThread = new QThread;
-    LogAllExportThread *worker = new LogAllExportThread(m_logTypes, fileFullPath);
+    LogAllExportThread *worker = new LogAllExportThread(getLogTypes(), fileFullPath);
     worker->moveToThread(exportThread);
 
     connect(exportThread, &QThread::started, worker, &LogAllExportThread::run);
@@ -621,6 +633,7 @@ bool LogBackend::exportAppLogsByCondition(const QString &outDir, const QString &
 QStringList LogBackend::getLogTypes()
 {
     qCDebug(logApp) << "LogBackend::getLogTypes called";
+    m_logTypes.clear();
     Dtk::Core::DSysInfo::UosEdition edition = Dtk::Core::DSysInfo::uosEditionType();
     //等于服务器行业版或欧拉版(centos)
     bool isCentos = Dtk::Core::DSysInfo::UosEuler == edition || Dtk::Core::DSysInfo::UosEnterpriseC == edition || Dtk::Core::DSysInfo::UosMilitaryS == edition;
@@ -701,11 +714,21 @@ QStringList LogBackend::getLogTypes()
 void LogBackend::slot_parseFinished(int index, LOG_FLAG type, int status)
 {
     qCDebug(logApp) << "LogBackend::slot_parseFinished called with index:" << index << "type:" << type << "status:" << status;
+    if (index == m_prefetchIndex) {
+        // 预取完成，存入分段缓存
+        if (status == ParseThreadBase::Normal) {
+            qCDebug(logApp) << "Segment prefetch finished, rows:" << m_prefetchData.size();
+            m_memoryGovernor.insert(m_prefetchKey, m_prefetchData);
+        }
+        resetPrefetch();
+        return;
+    }
     if (m_flag != type || index != m_type2ThreadIndex[type]) {
         qCDebug(logApp) << "Parse finished signal ignored - type or index mismatch";
         return;
     }
     m_isDataLoadComplete = true;
+    m_bSegementParsing = false;
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting parseFinished signal for view session";
@@ -739,17 +762,43 @@ void LogBackend::slot_parseFinished(int index, LOG_FLAG type, int status)
     }
 }
 
+void LogBackend::slot_logRecords(int index, const QList<LOG_MSG_BASE> &list, LOG_FLAG type)
+{
+    qCDebug(logApp) << "LogBackend::slot_logRecords called with index:" << index << "type:" << type << "list size:" << list.size();
+    if (m_flag != type || index != m_type2ThreadIndex[type]) {
+        qCDebug(logApp) << "Log records signal ignored - type or index mismatch";
+        return;
+    }
+
+    m_segementRecords.append(filterLog(m_currentSearchStr, list));
+}
+
 void LogBackend::slot_logData(int index, const QList<QString> &list, LOG_FLAG type)
 {
     qCDebug(logApp) << "LogBackend::slot_logData called with index:" << index << "type:" << type << "list size:" << list.size();
+    // 预取的数据先暂存，不经批次计数
+    if (index == m_prefetchIndex) {
+        m_prefetchData.append(list);
+        return;
+    }
+    // 每个批次都要释放，包括下面被忽略的过期批次，解析线程据此继续发送
+    if (index != m_adoptedPrefetchIndex)
+        m_logFileParser.releaseBatch();
     if (m_flag != type || index != m_type2ThreadIndex[type]) {
         qCDebug(logApp) << "Log data signal ignored - type or index mismatch";
         return;
     }
 
+    appendLogData(type, list);
+}
+
+void LogBackend::appendLogData(LOG_FLAG type, const QList<QString> &list)
+{
     m_type2LogDataOrigin[type].append(list);
     QList<QString> filterData = filterLog(m_currentSearchStr, list);
     m_type2LogData[type].append(filterData);
+    // 未经筛选时两份列表共享字符串数据，只计一份
+    m_memoryGovernor.addResidentBytes(LogMemoryGovernor::estimateBytes(list));
     qCDebug(logApp) << "Filtered data size:" << filterData.size();
 
     if (View == m_sessionType) {
@@ -779,16 +828,18 @@ void LogBackend::slot_dpkgFinished(int index)
 void LogBackend::slot_dpkgData(int index, QList<LOG_MSG_DPKG> list)
 {
     qCDebug(logApp) << "LogBackend::slot_dpkgData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != DPKG || index != m_dpkgCurrentIndex) {
         qCDebug(logApp) << "DPKG data signal ignored - flag or index mismatch";
         return;
     }
 
     dListOrigin.append(list);
-    dList.append(filterDpkg(m_currentSearchStr, list));
+    dList.append(narrowByTime(filterDpkg(m_currentSearchStr, list)));
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting dpkgData signal for view session";
+        m_histogram->addRecords(list);
         emit dpkgData(dList);
     }
 }
@@ -814,6 +865,7 @@ void LogBackend::slot_XorgFinished(int index)
 void LogBackend::slot_xorgData(int index, QList<LOG_MSG_XORG> list)
 {
     qCDebug(logApp) << "LogBackend::slot_xorgData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != XORG || index != m_xorgCurrentIndex) {
         qCDebug(logApp) << "XORG data signal ignored - flag or index mismatch";
         return;
@@ -849,6 +901,7 @@ void LogBackend::slot_bootFinished(int index)
 void LogBackend::slot_bootData(int index, QList<LOG_MSG_BOOT> list)
 {
     qCDebug(logApp) << "LogBackend::slot_bootData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != BOOT || index != m_bootCurrentIndex) {
         qCDebug(logApp) << "BOOT data signal ignored - flag or index mismatch";
         return;
@@ -884,6 +937,7 @@ void LogBackend::slot_kernFinished(int index)
 void LogBackend::slot_kernData(int index, QList<LOG_MSG_JOURNAL> list)
 {
     qCDebug(logApp) << "LogBackend::slot_kernData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != KERN || index != m_kernCurrentIndex) {
         qCDebug(logApp) << "KERN data signal ignored - flag or index mismatch";
         return;
@@ -919,6 +973,7 @@ void LogBackend::slot_kwinFinished(int index)
 void LogBackend::slot_kwinData(int index, QList<LOG_MSG_KWIN> list)
 {
     qCDebug(logApp) << "LogBackend::slot_kwinData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != Kwin || index != m_kwinCurrentIndex) {
         qCDebug(logApp) << "Kwin data signal ignored - flag or index mismatch";
         return;
@@ -939,13 +994,14 @@ void LogBackend::slot_dnfFinished(const QList<LOG_MSG_DNF> &list)
         qCDebug(logApp) << "Dnf finished signal ignored - flag mismatch";
         return;
     }
-    dnfList = filterDnf(m_currentSearchStr, list);
+    dnfList = narrowByTime(filterDnf(m_currentSearchStr, list));
     dnfListOrigin = list;
 
     m_isDataLoadComplete = true;
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting dnfFinished signal for view session";
+        m_histogram->addRecords(list);
         emit dnfFinished(dnfListOrigin);
     } else if (Export == m_sessionType) {
         qCDebug(logApp) << "Executing CLI export for dnf";
@@ -953,7 +1009,7 @@ void LogBackend::slot_dnfFinished(const QList<LOG_MSG_DNF> &list)
     }
 }
 
-void LogBackend::slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list)
+void LogBackend::slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list, quint64 lastSeq)
 {
     qCDebug(logApp) << "LogBackend::slot_dmesgFinished called with list size:" << list.size();
     if (m_flag != Dmesg) {
@@ -961,13 +1017,42 @@ void LogBackend::slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list)
         return;
     }
 
-    dmesgList = filterDmesg(m_currentSearchStr,list);
-    dmesgListOrigin = list;
+    // 跟随模式的新记录直接追加到已有数据头部，界面只插入新行，保留滚动位置与选中项
+    if (m_dmesgAppending) {
+        m_dmesgAppending = false;
+        dmesgListOrigin = list + dmesgListOrigin;
+        m_dmesgLastSeq = lastSeq;
+        const QList<LOG_MSG_DMESG> appended = narrowByTime(filterDmesg(m_currentSearchStr, list));
+        dmesgList = appended + dmesgList;
+        if (View == m_sessionType) {
+            m_histogram->addRecords(list);
+            if (!appended.isEmpty())
+                emit dmesgAppended(appended);
+        }
+        return;
+    }
+
+    // 增量读取的新记录均晚于已有记录，按最新在前放到列表头部
+    if (m_dmesgFilter.sinceSeq > 0)
+        dmesgListOrigin = list + dmesgListOrigin;
+    else
+        dmesgListOrigin = list;
+    m_dmesgLastSeq = lastSeq;
+    dmesgList = narrowByTime(filterDmesg(m_currentSearchStr, dmesgListOrigin));
 
     m_isDataLoadComplete = true;
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting dmesgFinished signal for view session";
+        // 重新加载前clearAllDatalist已清空统计，增量读取时list只含新记录，按完整数据重新统计
+        m_histogram->reset();
+        m_histogram->addRecords(dmesgListOrigin);
+        if (!m_dmesgFollowing) {
+            m_dmesgFollowing = DLDBusHandler::instance(this)->followKernelMessages(true);
+            if (m_dmesgFollowing)
+                connect(DLDBusHandler::instance(this), &DLDBusHandler::kernelMessagesAvailable, this,
+                        &LogBackend::slot_kernelMessagesAvailable, Qt::UniqueConnection);
+        }
         emit dmesgFinished(dmesgListOrigin);
     } else if (Export == m_sessionType) {
         qCDebug(logApp) << "Executing CLI export for dmesg";
@@ -975,6 +1060,28 @@ void LogBackend::slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list)
     }
 }
 
+void LogBackend::slot_kernelMessagesAvailable(quint64 lastSeq)
+{
+    qCDebug(logApp) << "LogBackend::slot_kernelMessagesAvailable called with lastSeq:" << lastSeq;
+    if (m_flag != Dmesg || View != m_sessionType) {
+        // 已切换到其他日志，关闭跟随
+        DLDBusHandler::instance(this)->followKernelMessages(false);
+        m_dmesgFollowing = false;
+        return;
+    }
+
+    if (lastSeq <= m_dmesgLastSeq || m_dmesgUpdatePending)
+        return;
+
+    // 合并短时间内的多次通知，避免频繁刷新界面
+    m_dmesgUpdatePending = true;
+    QTimer::singleShot(DMESG_FOLLOW_INTERVAL, this, [this]() {
+        m_dmesgUpdatePending = false;
+        if (m_flag == Dmesg)
+            refreshDmesg();
+    });
+}
+
 void LogBackend::slot_journalFinished(int index)
 {
     qCDebug(logApp) << "LogBackend::slot_journalFinished called with index:" << index;
@@ -1014,6 +1121,7 @@ void LogBackend::slot_journalBootFinished(int index)
 void LogBackend::slot_journalBootData(int index, QList<LOG_MSG_JOURNAL> list)
 {
     qCDebug(logApp) << "LogBackend::slot_journalBootData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != BOOT_KLU || index != m_journalBootCurrentIndex) {
         qCDebug(logApp) << "Journal boot data signal ignored - flag or index mismatch";
         return;
@@ -1031,6 +1139,7 @@ void LogBackend::slot_journalBootData(int index, QList<LOG_MSG_JOURNAL> list)
 void LogBackend::slot_journalData(int index, QList<LOG_MSG_JOURNAL> list)
 {
     qCDebug(logApp) << "LogBackend::slot_journalData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     //判断最近一次获取数据线程的标记量,和信号曹发来的sender的标记量作对比,如果相同才可以刷新,因为会出现上次的获取线程就算停下信号也发出来了
     if (m_flag != JOURNAL || index != m_journalCurrentIndex) {
         qCDebug(logApp) << "Journal data signal ignored - flag or index mismatch";
@@ -1038,10 +1147,11 @@ void LogBackend::slot_journalData(int index, QList<LOG_MSG_JOURNAL> list)
     }
 
     jListOrigin.append(list);
-    jList.append(filterJournal(m_currentSearchStr, list));
+    jList.append(narrowByTime(filterJournal(m_currentSearchStr, list)));
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting journalData signal for view session";
+        m_histogram->addRecords(list);
         emit journalData(jList);
     }
 }
@@ -1067,16 +1177,18 @@ void LogBackend::slot_applicationFinished(int index)
 void LogBackend::slot_applicationData(int index, QList<LOG_MSG_APPLICATOIN> list)
 {
     qCDebug(logApp) << "LogBackend::slot_applicationData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != APP || index != m_appCurrentIndex) {
         qCDebug(logApp) << "Application data signal ignored - flag or index mismatch";
         return;
     }
 
     appListOrigin.append(list);
-    appList.append(filterApp(m_appFilter, list));
+    appList.append(narrowByTime(filterApp(m_appFilter, list)));
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting appData signal for view session";
+        m_histogram->addRecords(list);
         emit appData(appList);
     }
 }
@@ -1102,15 +1214,17 @@ void LogBackend::slot_normalFinished(int index)
 void LogBackend::slot_normalData(int index, QList<LOG_MSG_NORMAL> list)
 {
     qCDebug(logApp) << "LogBackend::slot_normalData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != Normal || index != m_normalCurrentIndex) {
         qCDebug(logApp) << "Normal data signal ignored - flag or index mismatch";
         return;
     }
     norList.append(list);
-    nortempList.append(filterNomal(m_normalFilter, list));
+    nortempList.append(narrowByTime(filterNomal(m_normalFilter, list)));
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting normalData signal for view session";
+        m_histogram->addRecords(list);
         emit normalData(nortempList);
     }
 }
@@ -1167,16 +1281,18 @@ void LogBackend::slot_auditFinished(int index, bool bShowTip)
 void LogBackend::slot_auditData(int index, QList<LOG_MSG_AUDIT> list)
 {
     qCDebug(logApp) << "LogBackend::slot_auditData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != Audit || index != m_auditCurrentIndex) {
         qCDebug(logApp) << "Audit data signal ignored - flag or index mismatch";
         return;
     }
 
     aListOrigin.append(list);
-    aList.append(filterAudit(m_auditFilter, list));
+    aList.append(narrowByTime(filterAudit(m_auditFilter, list)));
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting auditData signal for view session";
+        m_histogram->addRecords(list);
         emit auditData(aList);
     }
 }
@@ -1203,6 +1319,7 @@ void LogBackend::slot_authFinished(int index)
 void LogBackend::slot_authData(int index, QList<LOG_MSG_AUTH> list)
 {
     qCDebug(logApp) << "LogBackend::slot_authData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != Auth || index != m_authCurrentIndex) {
         qCDebug(logApp) << "Auth data signal ignored - flag or index mismatch";
         return;
@@ -1244,32 +1361,34 @@ void LogBackend::slot_coredumpFinished(int index)
             // 此处退出码不能为-1，否则systemctl --failed服务会将其判为失败的systemd服务
             qApp->exit(0);
         } else {
+            // 增量同步崩溃统计数据，仅拉取上次统计之后新产生的崩溃记录
+            CoredumpStatistics *statistics = CoredumpStatistics::instance();
+            statistics->sync();
+
             // 统计所有崩溃重复次数
             QJsonObject repeatObj;
-            QList<LOG_REPEAT_COREDUMP_INFO> repeatInfos = Utils::countRepeatCoredumps();
+            QList<LOG_REPEAT_COREDUMP_INFO> repeatInfos = statistics->countRepeat();
             for (auto i : repeatInfos) {
                 repeatObj.insert(i.exePath, i.times);
             }
 
-            // 更新高频崩溃应用exe路径名单（更新范围为上次上报到当前时间新产生的崩溃信息），并同步到配置文件中
-            QList<LOG_REPEAT_COREDUMP_INFO> repeatInfoInTimeRange = Utils::countRepeatCoredumps(lastTime.toMSecsSinceEpoch(), curTime.toMSecsSinceEpoch());
-            Utils::updateRepeatCoredumpExePaths(repeatInfoInTimeRange);
-            QStringList repeatCoredumpExePaths = Utils::getRepeatCoredumpExePaths();
+            // 更新高频崩溃应用exe路径名单（更新范围为上次上报到当前时间新产生的崩溃信息），并同步到统计文件中
+            QList<LOG_REPEAT_COREDUMP_INFO> repeatInfoInTimeRange = statistics->countRepeat(lastTime.toMSecsSinceEpoch(), curTime.toMSecsSinceEpoch());
+            statistics->updateRepeatExePaths(repeatInfoInTimeRange);
+            const QSet<QString> repeatCoredumpExePaths = statistics->repeatExePaths();
 
             // 获取最大上报条数
             const int nMaxCoredumpReport = LogApplicationHelper::instance()->getMaxReportCoredump();
 
             // 数据清洗，去重
             QList<LOG_MSG_COREDUMP> afterCleanData;
+            QSet<QString> cleanedRepeatExePaths;
             for (const auto &data : m_currentCoredumpList) {
-                if (repeatCoredumpExePaths.indexOf(data.exe) != -1) {
-                    auto it = std::find_if(afterCleanData.begin(), afterCleanData.end(),[&](const LOG_MSG_COREDUMP &item) {
-                        return item.exe == data.exe;
-                    });
-
+                if (repeatCoredumpExePaths.contains(data.exe)) {
                     // 清洗时，只保留最近的一条重复数据
-                    if (it != afterCleanData.end())
+                    if (cleanedRepeatExePaths.contains(data.exe))
                         continue;
+                    cleanedRepeatExePaths.insert(data.exe);
                 }
 
                 afterCleanData.push_back(data);
@@ -1322,17 +1441,19 @@ void LogBackend::slot_coredumpFinished(int index)
 void LogBackend::slot_coredumpData(int index, QList<LOG_MSG_COREDUMP> list)
 {
     qCDebug(logApp) << "LogBackend::slot_coredumpData called with index:" << index << "list size:" << list.size();
+    m_logFileParser.releaseBatch();
     if (m_flag != COREDUMP || index != m_coredumpCurrentIndex) {
         qCDebug(logApp) << "Coredump data signal ignored - flag or index mismatch";
         return;
     }
 
     m_coredumpList.append(list);
-    QList<LOG_MSG_COREDUMP> filterList = filterCoredump(m_currentSearchStr, list);
+    QList<LOG_MSG_COREDUMP> filterList = narrowByTime(filterCoredump(m_currentSearchStr, list));
     m_currentCoredumpList.append(filterList);
 
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting coredumpData signal for view session";
+        m_histogram->addRecords(list);
         emit coredumpData(m_currentCoredumpList, !filterList.isEmpty());
     }
 }
@@ -1380,6 +1501,21 @@ void LogBackend::onExportProgress(int nCur, int nTotal)
 void LogBackend::onExportResult(bool isSuccess)
 {
     qCDebug(logApp) << "LogBackend::onExportResult called with isSuccess:" << isSuccess;
+    // 分段导出某段写入失败，结束导出线程，不再解析后续分段
+    if (!isSuccess && m_pSegementExportThread && sender() == m_pSegementExportThread) {
+        qCWarning(logApp) << "Segement export failed, stop exporting";
+        m_pSegementExportThread->stop();
+        m_pSegementExportThread = nullptr;
+        m_bSegementExporting = false;
+        m_bSegementWaiting = false;
+        if (Export == m_sessionType && View == m_lastSessionType) {
+            m_sessionType = View;
+            // 重置回第一分段页
+            emit clearTable();
+            loadSegementPage(0);
+        }
+    }
+
     if (View == m_sessionType) {
         qCDebug(logApp) << "Emitting sigResult signal for view session";
         emit sigResult(isSuccess);
@@ -1408,6 +1544,16 @@ void LogBackend::onExportFakeCloseDlg()
     }
 }
 
+void LogBackend::onSegementDone()
+{
+    // 导出线程腾出空位，继续解析等待中的下一段
+    if (!m_bSegementWaiting || Export != m_sessionType || sender() != m_pSegementExportThread) {
+        return;
+    }
+    qCDebug(logApp) << "LogBackend::onSegementDone resume segement export";
+    segementExport();
+}
+
 QList<LOG_MSG_BOOT> LogBackend::filterBoot(BOOT_FILTERS ibootFilter, const QList<LOG_MSG_BOOT> &iList)
 {
     qCDebug(logApp) << "LogBackend::filterBoot called with iList size:" << iList.size();
@@ -1841,6 +1987,7 @@ bool LogBackend::parseData(const LOG_FLAG &flag, const QString &period, const QS
         if (periodId == ALL)
             dmesgfilter.timeFilter = 0;
 
+        m_dmesgFilter = dmesgfilter;
         m_logFileParser.parseByDmesg(dmesgfilter);
     }
     break;
@@ -2267,6 +2414,7 @@ void LogBackend::clearAllDatalist()
     // qCDebug(logApp) << "LogBackend::clearAllDatalist called";
     m_type2LogData.clear();
     m_type2LogDataOrigin.clear();
+    m_segementRecords.clear();
 
     jList.clear();
     jListOrigin.clear();
@@ -2298,14 +2446,30 @@ void LogBackend::clearAllDatalist()
     authListOrigin.clear();
     m_coredumpList.clear();
     m_currentCoredumpList.clear();
+
+    m_memoryGovernor.setResidentBytes(0);
+    m_histogram->reset();
+    m_timeNarrow = TIME_RANGE();
     malloc_trim(0);
 }
 
+void LogBackend::setTimeNarrow(qint64 begin, qint64 end)
+{
+    qCDebug(logApp) << "LogBackend::setTimeNarrow called with begin:" << begin << "end:" << end;
+    m_timeNarrow.begin = begin;
+    m_timeNarrow.end = end;
+}
+
 void LogBackend::parse(LOG_FILTER_BASE &filter)
 {
     // qCDebug(logApp) << "LogBackend::parse called with filter:" << filter.type;
+    // 分段导出时解析结果直接交给导出线程，不经过json序列化
+    filter.exportRecords = Export == m_sessionType;
+    // 开始解析前停止所有线程，进行中的预取随之结束
+    resetPrefetch();
     m_type2ThreadIndex[filter.type] = m_logFileParser.parse(filter);
     m_type2Filter[filter.type] = filter;
+    m_bSegementParsing = true;
 }
 
 void LogBackend::parseByJournal(const QStringList &arg)
@@ -2359,9 +2523,36 @@ void LogBackend::parseByDnf(DNF_FILTERS iDnfFilter)
 void LogBackend::parseByDmesg(DMESG_FILTERS iDmesgFilter)
 {
     // qCDebug(logApp) << "LogBackend::parseByDmesg called with iDmesgFilter:" << iDmesgFilter;
+    // 级别相同且时间范围未扩大时，只读取上次之后产生的新记录
+    if (m_dmesgLastSeq > 0 && iDmesgFilter.levelFilter == m_dmesgFilter.levelFilter
+            && iDmesgFilter.timeFilter >= m_dmesgFilter.timeFilter) {
+        iDmesgFilter.sinceSeq = m_dmesgLastSeq;
+        if (iDmesgFilter.timeFilter > m_dmesgFilter.timeFilter) {
+            const QString begin = QDateTime::fromMSecsSinceEpoch(iDmesgFilter.timeFilter).toString("yyyy-MM-dd hh:mm:ss.zzz");
+            while (!dmesgListOrigin.isEmpty() && dmesgListOrigin.last().dateTime < begin)
+                dmesgListOrigin.removeLast();
+        }
+    } else {
+        iDmesgFilter.sinceSeq = 0;
+        m_dmesgLastSeq = 0;
+    }
+
+    m_dmesgFilter = iDmesgFilter;
+    m_dmesgAppending = false;
     m_logFileParser.parseByDmesg(iDmesgFilter);
 }
 
+void LogBackend::refreshDmesg()
+{
+    qCDebug(logApp) << "LogBackend::refreshDmesg called, last seq:" << m_dmesgLastSeq;
+    if (m_flag != Dmesg || m_dmesgLastSeq == 0)
+        return;
+
+    m_dmesgFilter.sinceSeq = m_dmesgLastSeq;
+    m_dmesgAppending = true;
+    m_logFileParser.parseByDmesg(m_dmesgFilter);
+}
+
 void LogBackend::parseByNormal(const NORMAL_FILTERS &iNormalFiler)
 {
     // qCDebug(logApp) << "LogBackend::parseByNormal called with iNormalFiler:" << iNormalFiler;
@@ -2416,10 +2607,12 @@ int LogBackend::loadSegementPage(int nSegementIndex, bool bReset/* = true*/)
             m_type2LogDataOrigin[m_flag].clear();
         if (m_type2LogData[m_flag].size() > SEGEMENT_SIZE)
             m_type2LogData[m_flag].clear();
+        m_memoryGovernor.setResidentBytes(LogMemoryGovernor::estimateBytes(m_type2LogDataOrigin[m_flag]));
     }
 
     m_type2Filter[m_flag].segementIndex = nSegementIndex;
-    parse(m_type2Filter[m_flag]);
+    if (!loadCachedSegement(m_flag))
+        parse(m_type2Filter[m_flag]);
 
     qCDebug(logApp) << QString("load seagement index: %1").arg(nSegementIndex);
     return nSegementIndex;
@@ -2428,21 +2621,13 @@ int LogBackend::loadSegementPage(int nSegementIndex, bool bReset/* = true*/)
 int LogBackend::getNextSegementIndex(LOG_FLAG type, bool bNext/* = true*/)
 {
     // qCDebug(logApp) << "LogBackend::getNextSegementIndex called with type:" << type;
-    qint64 totalLineCount = 0;
     int nSegementIndex = -1;
-    if (type == KERN) {
-        QStringList filePaths = DLDBusHandler::instance(this)->getFileInfo("kern");
-        for (auto file: filePaths) {
-            totalLineCount += DLDBusHandler::instance(this)->getLineCount(file);
-        }
-    } else if (type == Kwin) {
-        qCDebug(logApp) << "LogBackend::getNextSegementIndex Kwin";
-        totalLineCount = DLDBusHandler::instance(this)->getLineCount(KWIN_TREE_DATA);
+    if (!isSegementCountReady(type)) {
+        qCWarning(logApp) << "LogBackend::getNextSegementIndex line count not ready for type:" << type;
+        return nSegementIndex;
     }
 
-    // 计算分段段数
-    m_segementCount = static_cast<int>(totalLineCount / SEGEMENT_SIZE) + 1;
-    
+    const qint64 totalLineCount = m_segementLineCount;
     qint64 currentLineCount = (m_type2Filter[type].segementIndex + (bNext ? 1 : 0)) * SEGEMENT_SIZE;
 
     if (totalLineCount > currentLineCount) {
@@ -2458,6 +2643,154 @@ int LogBackend::getNextSegementIndex(LOG_FLAG type, bool bNext/* = true*/)
     return nSegementIndex;
 }
 
+void LogBackend::requestSegementCount(LOG_FLAG type, const std::function<void()> &done)
+{
+    qCDebug(logApp) << "LogBackend::requestSegementCount type:" << type;
+    m_segementCountType = NONE;
+    m_segementCountDone = done;
+    const int serial = ++m_segementCountSerial;
+
+    if (type == Kwin) {
+        QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(DLDBusHandler::instance(this)->getLineCountAsync(KWIN_TREE_DATA), this);
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, serial, type](QDBusPendingCallWatcher *self) {
+            QDBusPendingReply<qint64> reply = *self;
+            self->deleteLater();
+            if (reply.isError())
+                qCWarning(logApp) << "getLineCount failed:" << KWIN_TREE_DATA << reply.error().message();
+            finishSegementCount(serial, type, reply.isError() ? 0 : reply.value());
+        });
+        return;
+    }
+
+    // 内核日志先取轮转文件列表，再同时发出各文件的行数请求
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(DLDBusHandler::instance(this)->getFileInfoAsync("kern"), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, serial, type](QDBusPendingCallWatcher *self) {
+        QDBusPendingReply<QStringList> reply = *self;
+        self->deleteLater();
+        if (serial != m_segementCountSerial)
+            return;
+        if (reply.isError())
+            qCWarning(logApp) << "getFileInfo failed for kern:" << reply.error().message();
+        const QStringList filePaths = reply.isError() ? QStringList() : reply.value();
+        if (filePaths.isEmpty()) {
+            finishSegementCount(serial, type, 0);
+            return;
+        }
+
+        // 未到达的应答数与已累加的行数
+        QSharedPointer<QPair<int, qint64>> pending(new QPair<int, qint64>(filePaths.size(), 0));
+        for (const QString &filePath : filePaths) {
+            QDBusPendingCallWatcher *countWatcher = new QDBusPendingCallWatcher(DLDBusHandler::instance(this)->getLineCountAsync(filePath), this);
+            connect(countWatcher, &QDBusPendingCallWatcher::finished, this, [this, serial, type, pending, filePath](QDBusPendingCallWatcher *countSelf) {
+                QDBusPendingReply<qint64> countReply = *countSelf;
+                countSelf->deleteLater();
+                if (countReply.isError())
+                    qCWarning(logApp) << "getLineCount failed:" << filePath << countReply.error().message();
+                else
+                    pending->second += countReply.value();
+                if (--pending->first == 0)
+                    finishSegementCount(serial, type, pending->second);
+            });
+        }
+    });
+}
+
+void LogBackend::finishSegementCount(int serial, LOG_FLAG type, qint64 totalLineCount)
+{
+    if (serial != m_segementCountSerial)
+        return;
+
+    // 计算分段段数
+    m_segementCount = static_cast<int>(totalLineCount / SEGEMENT_SIZE) + 1;
+    m_segementLineCount = totalLineCount;
+    m_segementCountType = type;
+    qCDebug(logApp) << "LogBackend::finishSegementCount type:" << type << "lines:" << totalLineCount;
+
+    std::function<void()> done;
+    done.swap(m_segementCountDone);
+    if (done)
+        done();
+}
+
+void LogBackend::resetSegementCount()
+{
+    m_segementCountType = NONE;
+    m_segementCountDone = nullptr;
+    ++m_segementCountSerial;
+}
+
+void LogBackend::prefetchSegement(LOG_FLAG type, bool bNext/* = true*/)
+{
+    if (View != m_sessionType || m_flag != type || (type != KERN && type != Kwin) || m_bSegementParsing
+            || !isSegementCountReady(type))
+        return;
+
+    LOG_FILTER_BASE filter = m_type2Filter[type];
+    filter.segementIndex += bNext ? 1 : -1;
+    if (filter.segementIndex < 0 || static_cast<qint64>(filter.segementIndex) * SEGEMENT_SIZE >= m_segementLineCount)
+        return;
+
+    const QString key = segementKey(filter);
+    if (key == m_prefetchKey || m_memoryGovernor.contains(key))
+        return;
+
+    qCDebug(logApp) << "LogBackend::prefetchSegement type:" << type << "segment:" << filter.segementIndex;
+    filter.exportRecords = false;
+    m_prefetchData.clear();
+    m_prefetchKey = key;
+    m_prefetchIndex = m_logFileParser.prefetch(filter);
+}
+
+QString LogBackend::segementKey(const LOG_FILTER_BASE &filter) const
+{
+    return QString("%1|%2|%3|%4|%5|%6").arg(filter.type).arg(filter.filePath)
+           .arg(filter.timeFilterBegin).arg(filter.timeFilterEnd)
+           .arg(filter.segementIndex).arg(m_segementLineCount);
+}
+
+bool LogBackend::loadCachedSegement(LOG_FLAG type)
+{
+    if (View != m_sessionType || (type != KERN && type != Kwin))
+        return false;
+
+    const QString key = segementKey(m_type2Filter[type]);
+    if (m_prefetchIndex != -1 && key == m_prefetchKey) {
+        // 预取仍在进行，直接作为当前分段的解析线程，已收到的数据立即显示
+        qCDebug(logApp) << "LogBackend::loadCachedSegement adopt running prefetch, rows:" << m_prefetchData.size();
+        m_type2ThreadIndex[type] = m_prefetchIndex;
+        m_adoptedPrefetchIndex = m_prefetchIndex;
+        QList<QString> data;
+        data.swap(m_prefetchData);
+        resetPrefetch();
+        m_bSegementParsing = true;
+        appendLogData(type, data);
+        return true;
+    }
+
+    QList<QString> cached;
+    if (!m_memoryGovernor.take(key, cached))
+        return false;
+
+    qCDebug(logApp) << "LogBackend::loadCachedSegement cache hit, rows:" << cached.size();
+    // 上一段未解析完的数据不再显示
+    const int index = --m_cacheLoadIndex;
+    m_type2ThreadIndex[type] = index;
+    m_bSegementParsing = true;
+    appendLogData(type, cached);
+    // 与解析线程一样异步通知解析完成，界面先完成本次翻页的处理
+    QTimer::singleShot(0, this, [this, index, type]() {
+        slot_parseFinished(index, type, ParseThreadBase::Normal);
+    });
+    return true;
+}
+
+void LogBackend::resetPrefetch()
+{
+    m_prefetchIndex = -1;
+    m_prefetchKey.clear();
+    m_prefetchData.clear();
+}
+
 void LogBackend::exportLogData(const QString &filePath, const QStringList &strLabels)
 {
     // qCDebug(logApp) << "LogBackend::exportLogData called with filePath:" << filePath;
@@ -2519,19 +2852,22 @@ void LogBackend::exportLogData(const QString &filePath, const QStringList &strLa
         if (!m_pSegementExportThread) {
             m_pSegementExportThread = new LogSegementExportThread(this);
             m_pSegementExportThread->enableAppendWrite();
-            // 导出到doc，最后一步写入文件耗时较长，总进度条需要额外+1
-            if (filePath.endsWith(".doc"))
-                m_pSegementExportThread->setTotalProcess(m_segementCount + 1);
-            else
-                m_pSegementExportThread->setTotalProcess(m_segementCount);
+            m_pSegementExportThread->setTotalProcess(m_segementCount);
             connect(m_pSegementExportThread, &LogSegementExportThread::sigResult, this, &LogBackend::onExportResult);
             connect(m_pSegementExportThread, &LogSegementExportThread::sigProgress, this, &LogBackend::onExportProgress);
             connect(m_pSegementExportThread, &LogSegementExportThread::sigProcessFull, this, &LogBackend::onExportFakeCloseDlg);
+            connect(m_pSegementExportThread, &LogSegementExportThread::sigSegementDone, this, &LogBackend::onSegementDone);
             connect(this, &LogBackend::stopExport, m_pSegementExportThread, &LogSegementExportThread::stopImmediately);
             QThreadPool::globalInstance()->start(m_pSegementExportThread);
         }
 
-        m_pSegementExportThread->setParameter(filePath, m_type2LogData[m_flag], labels, m_flag);
+        // 导出线程写入当前段的同时，解析线程即可开始解析下一段
+        if (!m_segementRecords.isEmpty()) {
+            m_pSegementExportThread->setParameter(filePath, m_segementRecords, labels, m_flag);
+            m_segementRecords.clear();
+        } else {
+            m_pSegementExportThread->setParameter(filePath, m_type2LogData[m_flag], labels, m_flag);
+        }
     } else {
         qCDebug(logApp) << "LogBackend::exportLogData else";
         LogExportThread *exportThread = new LogExportThread(this);
@@ -2780,6 +3116,24 @@ void LogBackend::segementExport()
         return;
     }
 
+    // 导出线程待写入的分段已达上限，写完一段后再解析下一段，避免解析过快占用过多内存
+    if (m_pSegementExportThread && m_pSegementExportThread->isQueueFull()) {
+        qCDebug(logApp) << "LogBackend::segementExport export queue is full, waiting";
+        m_bSegementWaiting = true;
+        return;
+    }
+    m_bSegementWaiting = false;
+
+    // 总行数的应答到达后再继续
+    if (!isSegementCountReady(m_flag)) {
+        const LOG_FLAG flag = m_flag;
+        requestSegementCount(flag, [this, flag]() {
+            if (m_flag == flag)
+                segementExport();
+        });
+        return;
+    }
+
     // 判断是否需要分段导出
     int nSegementIndex = getNextSegementIndex(m_flag);
     m_bSegementExporting = nSegementIndex != -1;
@@ -2829,6 +3183,7 @@ void LogBackend::stopExportFromUI()
             emit sigProgress(0, 0);
 
             m_bSegementExporting = false;
+            m_bSegementWaiting = false;
             Utils::checkAndDeleteDir(m_exportFilePath);
 
             // 重置回第一分段页
@@ -2864,6 +3219,27 @@ QList<QString> LogBackend::filterLog(const QString &iSearchStr, const QList<QStr
     return rsList;
 }
 
+QList<LOG_MSG_BASE> LogBackend::filterLog(const QString &iSearchStr, const QList<LOG_MSG_BASE> &iList)
+{
+    if (iSearchStr.isEmpty()) {
+        return iList;
+    }
+
+    QList<LOG_MSG_BASE> rsList;
+    for (const LOG_MSG_BASE &msg : iList) {
+        if (msg.dateTime.contains(iSearchStr, Qt::CaseInsensitive)
+                || msg.msg.contains(iSearchStr, Qt::CaseInsensitive)
+                || msg.hostName.contains(iSearchStr, Qt::CaseInsensitive)
+                || msg.daemonName.contains(iSearchStr, Qt::CaseInsensitive)
+                || msg.daemonId.contains(iSearchStr, Qt::CaseInsensitive)
+                || msg.level.contains(iSearchStr, Qt::CaseInsensitive)) {
+            rsList.append(msg);
+        }
+    }
+
+    return rsList;
+}
+
 BUTTONID LogBackend::period2Enum(const QString &period)
 {
     // qCDebug(logApp) << "LogBackend::period2Enum called with period:" << period;
@@ -3172,7 +3548,7 @@ bool LogBackend::hasMatchedData(const LOG_FLAG &flag)
     break;
     case Kwin:
     case KERN: {
-        if (!m_type2LogData[flag].isEmpty()) {
+        if (!m_type2LogData[flag].isEmpty() || !m_segementRecords.isEmpty()) {
             bMatchedData = true;
         }
     }
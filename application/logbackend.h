@@ -7,10 +7,15 @@
 
 #include "structdef.h"
 #include "logfileparser.h"
+#include "logtimeline.h"
+#include "logmemorygovernor.h"
 
 #include <QObject>
 
+#include <functional>
+
 class LogFileParser;
+class LogHistogram;
 class LogExportThread;
 class LogSegementExportThread;
 class LogBackend : public QObject
@@ -55,6 +60,11 @@ public:
     QString getOutDirPath() const;
 
     static LOG_FLAG type2Flag(const QString &type, QString &error);
+    // 命令行筛选参数转换，无效参数时level2Id返回-2，dnfLevel2Id返回DNFINVALID，其余返回-1
+    static int level2Id(const QString &level);
+    static DNFPRIORITY dnfLevel2Id(const QString &level);
+    static int normal2eventType(const QString &eventType);
+    static int audit2eventType(const QString &eventType);
 
     bool reportCoredumpInfo();
 
@@ -69,6 +79,14 @@ public:
     // 清理日志数据缓存
     void clearAllDatalist();
 
+    // 当前日志的分时段统计，界面会话中随每批数据更新
+    LogHistogram *histogram() const { return m_histogram; }
+    // 按时间段缩小显示范围，毫秒时间戳，-1表示不限制，在已加载的数据上筛选，不重新解析
+    void setTimeNarrow(qint64 begin, qint64 end);
+    TIME_RANGE timeNarrow() const { return m_timeNarrow; }
+    template<typename T>
+    QList<T> narrowByTime(const QList<T> &iList) const;
+
     // 解析日志通用新接口，便于后续扩展和维护
     void parse(LOG_FILTER_BASE& filter);
 
@@ -84,6 +102,8 @@ public:
     void parseByApp(const APP_FILTERS &iAPPFilter);
     void parseByDnf(DNF_FILTERS iDnfFilter);
     void parseByDmesg(DMESG_FILTERS iDmesgFilter);
+    // 跟随模式下按当前条件只读取新记录，结果通过dmesgAppended追加，不清空已有数据
+    void refreshDmesg();
     void parseByNormal(const NORMAL_FILTERS &iNormalFiler);
 
     void parseByKwin(const KWIN_FILTERS &iKwinfilter);
@@ -96,8 +116,16 @@ public:
     void parseByCoredump(const COREDUMP_FILTERS &iCoredumpFilter, bool parseMap = false);
 
     int loadSegementPage(int nSegementIndex, bool bReset = true);
-    // 分段加载，向上/向下滚动，计算分段索引 bNext为true，计算向下滚动后的分段索引
+    // 分段加载，向上/向下滚动，计算分段索引 bNext为true，计算向下滚动后的分段索引；须先取得总行数
     int getNextSegementIndex(LOG_FLAG type, bool bNext = true);
+    // 分段日志的总行数是否已取得
+    bool isSegementCountReady(LOG_FLAG type) const { return m_segementCountType == type; }
+    // 异步获取分段日志的总行数，应答全部到达后计算分段数再执行done，重复请求时只执行最后一次的done
+    void requestSegementCount(LOG_FLAG type, const std::function<void()> &done);
+    // 从头加载前使总行数失效，文件可能已增长
+    void resetSegementCount();
+    // 当前分段解析完成后，在后台预取相邻分段，翻页时直接使用预取结果 bNext为true，预取下一段
+    void prefetchSegement(LOG_FLAG type, bool bNext = true);
 
     void exportLogData(const QString &filePath, const QStringList &strLabels = QStringList());
     void segementExport();
@@ -105,6 +133,7 @@ public:
 
     // 日志过滤相关接口
     static QList<QString> filterLog(const QString &iSearchStr, const QList<QString> &iList);
+    static QList<LOG_MSG_BASE> filterLog(const QString &iSearchStr, const QList<LOG_MSG_BASE> &iList);
     static QList<LOG_MSG_BOOT> filterBoot(BOOT_FILTERS ibootFilter, const QList<LOG_MSG_BOOT> &iList);
     static QList<LOG_MSG_NORMAL> filterNomal(NORMAL_FILTERS inormalFilter, const QList<LOG_MSG_NORMAL> &iList);
     static QList<LOG_MSG_DPKG> filterDpkg(const QString &iSearchStr, const QList<LOG_MSG_DPKG> &iList);
@@ -143,6 +172,8 @@ signals:
     void kernData(const QList<LOG_MSG_JOURNAL>&);
     void dnfFinished(const QList<LOG_MSG_DNF>&);
     void dmesgFinished(const QList<LOG_MSG_DMESG>&);
+    // 跟随模式下读取到的新记录（已按当前条件筛选，最新在前），界面应插入到表格头部
+    void dmesgAppended(const QList<LOG_MSG_DMESG>&);
     void journalFinished();
     void journalBootFinished();
     void journalData(const QList<LOG_MSG_JOURNAL>&);
@@ -194,6 +225,7 @@ signals:
 private slots:
     void slot_parseFinished(int index, LOG_FLAG type, int status);
     void slot_logData(int index, const QList<QString> &list, LOG_FLAG type);
+    void slot_logRecords(int index, const QList<LOG_MSG_BASE> &list, LOG_FLAG type);
     void slot_dpkgFinished(int index);
     void slot_dpkgData(int index, QList<LOG_MSG_DPKG> list);
     void slot_XorgFinished(int index);
@@ -205,7 +237,8 @@ private slots:
     void slot_kwinFinished(int index);
     void slot_kwinData(int index, QList<LOG_MSG_KWIN> list);
     void slot_dnfFinished(const QList<LOG_MSG_DNF> &list);
-    void slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list);
+    void slot_dmesgFinished(const QList<LOG_MSG_DMESG> &list, quint64 lastSeq = 0);
+    void slot_kernelMessagesAvailable(quint64 lastSeq);
     void slot_journalFinished(int index);
     void slot_journalBootFinished(int index);
     void slot_journalBootData(int index, QList<LOG_MSG_JOURNAL> list);
@@ -228,10 +261,19 @@ private slots:
     void onExportProgress(int nCur, int nTotal);
     void onExportResult(bool isSuccess);
     void onExportFakeCloseDlg();
+    void onSegementDone();
 
 private:
     void initConnections();
 
+    // 追加一批json日志数据，按关键字筛选后中转到界面
+    void appendLogData(LOG_FLAG type, const QList<QString> &list);
+    // 分段在缓存中的键，包含筛选条件和文件总行数，文件变化后不再命中
+    QString segementKey(const LOG_FILTER_BASE &filter) const;
+    // 从缓存或正在进行的预取中加载当前分段，成功时不需要重新解析
+    bool loadCachedSegement(LOG_FLAG type);
+    void resetPrefetch();
+
     // cli导出功能相关接口
     bool parseData(const LOG_FLAG &flag, const QString &period, const QString &condition);
 
@@ -240,10 +282,6 @@ private:
     void resetCategoryOutputPath(const QString & path);
     bool getOutDirPath(const QString &path);
     BUTTONID period2Enum(const QString &period);
-    int level2Id(const QString &level);
-    DNFPRIORITY dnfLevel2Id(const QString &level);
-    int normal2eventType(const QString &eventType);
-    int audit2eventType(const QString &eventType);
     TIME_RANGE getTimeRange(const BUTTONID& periodId);
     QString getApplogPath(const QString &appName);
     QStringList getLabels(const LOG_FLAG &flag);
@@ -401,10 +439,37 @@ private:
     int m_lastSegementIndex { -1 };
     bool m_bSegementExporting {false};
     int m_segementCount { 0 };
+    // 分段导出时当前段解析出的结构体数据
+    QList<LOG_MSG_BASE> m_segementRecords;
+    // 导出线程待写入队列已满，等待写完一段后再解析下一段
+    bool m_bSegementWaiting {false};
+    // 已解析分段的缓存，键为segementKey，超出内存预算时写入磁盘
+    LogMemoryGovernor m_memoryGovernor;
+    // 分段日志文件的总行数
+    qint64 m_segementLineCount {0};
+    // 总行数所属的日志种类，尚未取得或已失效时为NONE
+    LOG_FLAG m_segementCountType {NONE};
+    // 总行数请求的序号，重新请求后旧请求的应答被丢弃
+    int m_segementCountSerial {0};
+    std::function<void()> m_segementCountDone;
+    void finishSegementCount(int serial, LOG_FLAG type, qint64 totalLineCount);
+    // 当前分段是否仍在解析，解析完成后才开始预取
+    bool m_bSegementParsing {false};
+    // 预取线程index、预取分段的键及已收到的数据
+    int m_prefetchIndex {-1};
+    QString m_prefetchKey;
+    QList<QString> m_prefetchData;
+    // 被采用为当前分段的预取线程index，预取不经批次计数，其批次无需释放
+    int m_adoptedPrefetchIndex {-1};
+    // 从缓存加载分段时代替线程index，取负数，与解析线程的index不重复
+    int m_cacheLoadIndex {-1};
     
     //当前解析的日志类型
     LOG_FLAG m_flag {NONE};
 
+    LogHistogram *m_histogram {nullptr};
+    TIME_RANGE m_timeNarrow;
+
     // 分段导出线程，用来导出doc、xls格式的日志
     LogSegementExportThread *m_pSegementExportThread { nullptr };
     // 日志解析器
@@ -427,7 +492,33 @@ private:
     int m_authCurrentIndex {-1};
     int m_coredumpCurrentIndex {-1};
 
+    // 内核日志最近一次读取条件及读取到的最新记录序号，条件不变时刷新只读取新记录
+    DMESG_FILTERS m_dmesgFilter {};
+    quint64 m_dmesgLastSeq {0};
+    bool m_dmesgFollowing {false};
+    bool m_dmesgUpdatePending {false};
+    // 当前读取由跟随模式发起，结果追加到已有数据
+    bool m_dmesgAppending {false};
+
     bool m_isDataLoadComplete {false};
 };
 
+template<typename T>
+QList<T> LogBackend::narrowByTime(const QList<T> &iList) const
+{
+    if (m_timeNarrow.begin < 0 && m_timeNarrow.end < 0)
+        return iList;
+
+    QList<T> rsList;
+    QHash<qint64, qint64> hourCache;
+    for (const T &msg : iList) {
+        const qint64 time = LogTimeline::toEpoch(msg.dateTime, &hourCache);
+        if (time < 0)
+            continue;
+        if ((m_timeNarrow.begin < 0 || time >= m_timeNarrow.begin) && (m_timeNarrow.end < 0 || time < m_timeNarrow.end))
+            rsList.append(msg);
+    }
+    return rsList;
+}
+
 #endif // LOGBACKEND_H
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logbatchchannel.h"
+
+#include <QLoggingCategory>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 一帧的时间，解析线程最多每帧发送一批数据
+const qint64 LOG_BATCH_FRAME_MS = 16;
+// 单批累积的条数上限，达到后等待界面线程取走数据
+const int LOG_BATCH_MAX_ROWS = 20000;
+// 等待界面线程时每次等待的毫秒数，期间检查线程是否被停止
+const int LOG_BATCH_WAIT_MS = 50;
+// 界面线程长时间没有释放时不再等待，避免计数异常时解析线程卡住
+const qint64 LOG_BATCH_MAX_STALL_MS = 2000;
+
+LogBatchChannel::LogBatchChannel(int capacity)
+    : m_capacity(qMax(1, capacity))
+{
+}
+
+bool LogBatchChannel::tryAcquire(int timeoutMs)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_pending >= m_capacity && timeoutMs > 0)
+        m_released.wait(&m_mutex, static_cast<unsigned long>(timeoutMs));
+    if (m_pending >= m_capacity)
+        return false;
+    ++m_pending;
+    return true;
+}
+
+void LogBatchChannel::acquire()
+{
+    QMutexLocker locker(&m_mutex);
+    ++m_pending;
+}
+
+void LogBatchChannel::release()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_pending > 0)
+        --m_pending;
+    m_released.wakeAll();
+}
+
+void LogBatchChannel::reset()
+{
+    QMutexLocker locker(&m_mutex);
+    m_pending = 0;
+    m_released.wakeAll();
+}
+
+int LogBatchChannel::pending() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_pending;
+}
+
+bool LogBatchSender::due(int count, const std::atomic_bool &canRun)
+{
+    if (count <= 0)
+        return false;
+    if (!m_timer.isValid())
+        m_timer.start();
+
+    if (count < LOG_BATCH_MAX_ROWS) {
+        // 不足一帧的时间继续累积
+        if (m_timer.elapsed() < LOG_BATCH_FRAME_MS)
+            return false;
+        // 界面线程积压时继续累积，合并为更大的批次
+        if (m_channel && !m_channel->tryAcquire())
+            return false;
+    } else if (m_channel) {
+        // 累积已达上限，等待界面线程取走数据，内存不再随解析继续增长
+        QElapsedTimer stall;
+        stall.start();
+        while (!m_channel->tryAcquire(LOG_BATCH_WAIT_MS)) {
+            // 线程已停止时直接发送，由调用方结束解析，过期的批次会被接收端丢弃
+            if (!canRun || stall.elapsed() >= LOG_BATCH_MAX_STALL_MS) {
+                if (canRun)
+                    qCWarning(logApp) << "LogBatchSender wait for consumer timeout, pending:" << m_channel->pending();
+                m_channel->acquire();
+                break;
+            }
+        }
+    }
+
+    m_timer.restart();
+    return true;
+}
+
+void LogBatchSender::commit()
+{
+    if (m_channel)
+        m_channel->acquire();
+    m_timer.restart();
+}
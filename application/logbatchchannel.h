@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGBATCHCHANNEL_H
+#define LOGBATCHCHANNEL_H
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QWaitCondition>
+
+#include <atomic>
+
+/**
+ * @brief The LogBatchChannel class 解析线程到界面线程的在途批次计数
+ * 解析线程发送一批数据前登记，界面线程处理完一批数据后释放，在途批次达到上限时解析线程需等待
+ */
+class LogBatchChannel
+{
+public:
+    explicit LogBatchChannel(int capacity);
+
+    /**
+     * @brief tryAcquire 登记一个在途批次
+     * @param timeoutMs 在途批次已满时最多等待的毫秒数，为0时不等待
+     * @return 是否登记成功
+     */
+    bool tryAcquire(int timeoutMs = 0);
+    // 不受上限限制直接登记，用于最后余下的数据等必须发送的批次
+    void acquire();
+    // 界面线程处理完一个批次后调用，过期的批次同样需要释放
+    void release();
+    // 开始新的加载时清空计数，旧线程迟到的释放不会使计数为负
+    void reset();
+
+    int pending() const;
+    int capacity() const { return m_capacity; }
+
+private:
+    mutable QMutex m_mutex;
+    QWaitCondition m_released;
+    const int m_capacity;
+    int m_pending {0};
+};
+
+/**
+ * @brief The LogBatchSender class 解析线程一侧的批次划分
+ * 按耗时而不是固定条数划分批次：距上次发送超过一帧的时间才发送；
+ * 界面线程积压时继续累积，合并为更大的批次；累积条数达到上限后等待界面线程取走数据
+ */
+class LogBatchSender
+{
+public:
+    // 未设置时只按耗时划分批次，不等待接收端
+    void setChannel(const QSharedPointer<LogBatchChannel> &channel) { m_channel = channel; }
+
+    /**
+     * @brief due 判断当前累积的数据是否应作为一批发送
+     * @param count 当前累积的条数
+     * @param canRun 线程运行标记，等待接收端时线程被停止则不再等待
+     * @return 为true时已登记该批次，调用方须立即发送并清空列表
+     */
+    bool due(int count, const std::atomic_bool &canRun);
+    // 不经判断直接发送的批次（最后余下的数据）发送前调用
+    void commit();
+
+private:
+    QSharedPointer<LogBatchChannel> m_channel;
+    QElapsedTimer m_timer;
+};
+
+#endif // LOGBATCHCHANNEL_H
@@ -58,8 +58,11 @@ LogCollectorMain::LogCollectorMain(QWidget *parent)
 
     initShortCut();
     qCDebug(logApp) << "LogCollectorMain initialized successfully";
-    //日志类型选择器选第一个
-    m_logCatelogue->setDefaultSelect();
+    //日志类型选择器选第一个，日志种类列表在后台填充时，填充完成后再选
+    if (m_logCatelogue->isLogTypesReady())
+        m_logCatelogue->setDefaultSelect();
+    else
+        connect(m_logCatelogue, &LogListView::logTypesReady, m_logCatelogue, &LogListView::setDefaultSelect);
     //设置最小窗口尺寸
     setMinimumSize(MAINWINDOW_WIDTH, MAINWINDOW_HEIGHT);
     //恢复上次关闭时记录的窗口大小
@@ -315,6 +318,11 @@ void LogCollectorMain::initSettings()
 void LogCollectorMain::exportAllLogs()
 {
     qCDebug(logApp) << "Starting export all logs...";
+    // 日志种类列表尚未填充完成，导出的种类不完整
+    if (!m_logCatelogue->isLogTypesReady()) {
+        qCWarning(logApp) << "Log types are not ready, ignore export all logs";
+        return;
+    }
     static bool authorization = false;
     if (false == authorization) {
         QString policyActionId = "";
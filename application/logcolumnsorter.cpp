@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logcolumnsorter.h"
+#include "logparsescheduler.h"
+#include "logtimeline.h"
+#include "DebugTimeManager.h"
+
+#include <QCoreApplication>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QLoggingCategory>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 每块的最少行数，数据量小于两块时单线程排序
+const int LOG_SORT_CHUNK_MIN = 50000;
+
+// 各日志使用的等级文本，按严重程度从高到低排列，系统日志为0~7级，dnf日志另有超级严重和跟踪
+static const char *const LOG_SORT_LEVELS[] = {
+    "Emergency", "Alert", "Super critical", "Critical", "Error", "Warning", "Notice", "Info", "Debug", "Trace"
+};
+
+// 在线程池中执行count个任务，第0个任务在当前线程执行，全部完成后返回
+static void runParallel(QThreadPool *pool, int count, const std::function<void(int)> &task)
+{
+    QList<QFuture<void>> futures;
+    for (int i = 1; i < count; ++i)
+        futures.append(QtConcurrent::run(pool, [&task, i]() { task(i); }));
+    if (count > 0)
+        task(0);
+    for (QFuture<void> &future : futures)
+        future.waitForFinished();
+}
+
+LogColumnSorter::LogColumnSorter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+void LogColumnSorter::sort(const QStringList &texts, KeyType keyType, Qt::SortOrder order)
+{
+    qCDebug(logApp) << "LogColumnSorter sort rows:" << texts.size() << "keyType:" << keyType << "order:" << order;
+    const int generation = ++m_generation;
+    QThreadPool *pool = LogParseScheduler::instance()->pool(LogParseScheduler::CpuLane);
+    const QHash<QString, int> ranks = keyType == LevelKey ? levelRanks() : QHash<QString, int>();
+
+    auto *watcher = new QFutureWatcher<QVector<int>>(this);
+    connect(watcher, &QFutureWatcher<QVector<int>>::finished, this, [this, watcher, generation]() {
+        watcher->deleteLater();
+        if (generation != m_generation) {
+            qCDebug(logApp) << "LogColumnSorter drop outdated result";
+            return;
+        }
+        emit sorted(watcher->result());
+    });
+    // 外层任务在全局线程池执行，分块任务在解析计算线程池中执行，等待分块时不会占满同一个线程池
+    watcher->setFuture(QtConcurrent::run([texts, keyType, ranks, order, pool]() {
+        PERF_SCOPE(sortScope, PerfSortRows, "LogColumnSorter::sort");
+        PERF_SCOPE_VALUE(sortScope, texts.size());
+        QVector<qint64> keys;
+        if (keyType == TimeKey)
+            keys = timeKeys(texts);
+        else if (keyType == LevelKey)
+            keys = levelKeys(texts, ranks);
+        else
+            keys = dictionaryKeys(texts);
+        return sortPermutation(keys, order, pool);
+    }));
+}
+
+void LogColumnSorter::cancel()
+{
+    ++m_generation;
+}
+
+QVector<qint64> LogColumnSorter::timeKeys(const QStringList &texts)
+{
+    QVector<qint64> keys(texts.size());
+    QHash<qint64, qint64> hourCache;
+    for (int i = 0; i < texts.size(); ++i)
+        keys[i] = LogTimeline::toEpoch(texts.at(i), &hourCache);
+    return keys;
+}
+
+QVector<qint64> LogColumnSorter::dictionaryKeys(const QStringList &texts)
+{
+    // 不重复的文本及每行文本在其中的下标，等级、进程等列的取值通常只有几十种
+    QHash<QString, int> dictIndex;
+    QStringList dict;
+    QVector<int> rowIndex(texts.size());
+    for (int i = 0; i < texts.size(); ++i) {
+        auto it = dictIndex.find(texts.at(i));
+        if (it == dictIndex.end()) {
+            it = dictIndex.insert(texts.at(i), dict.size());
+            dict.append(texts.at(i));
+        }
+        rowIndex[i] = it.value();
+    }
+
+    QVector<int> dictOrder(dict.size());
+    std::iota(dictOrder.begin(), dictOrder.end(), 0);
+    std::sort(dictOrder.begin(), dictOrder.end(), [&dict](int a, int b) {
+        return QString::compare(dict.at(a), dict.at(b), Qt::CaseInsensitive) < 0;
+    });
+    // 只有大小写不同的文本编码相同
+    QVector<qint64> codes(dict.size());
+    qint64 code = 0;
+    for (int i = 0; i < dictOrder.size(); ++i) {
+        if (i > 0 && QString::compare(dict.at(dictOrder.at(i - 1)), dict.at(dictOrder.at(i)), Qt::CaseInsensitive) != 0)
+            ++code;
+        codes[dictOrder.at(i)] = code;
+    }
+
+    QVector<qint64> keys(texts.size());
+    for (int i = 0; i < texts.size(); ++i)
+        keys[i] = codes.at(rowIndex.at(i));
+    return keys;
+}
+
+QHash<QString, int> LogColumnSorter::levelRanks()
+{
+    QHash<QString, int> ranks;
+    const int count = static_cast<int>(sizeof(LOG_SORT_LEVELS) / sizeof(LOG_SORT_LEVELS[0]));
+    for (int rank = 0; rank < count; ++rank) {
+        ranks.insert(QString(LOG_SORT_LEVELS[rank]).toLower(), rank);
+        ranks.insert(QCoreApplication::translate("Level", LOG_SORT_LEVELS[rank]).toLower(), rank);
+    }
+    return ranks;
+}
+
+QVector<qint64> LogColumnSorter::levelKeys(const QStringList &texts, const QHash<QString, int> &ranks)
+{
+    qint64 maxRank = -1;
+    for (int rank : ranks)
+        maxRank = qMax(maxRank, static_cast<qint64>(rank));
+
+    // 无法识别的文本只有几种，沿用字典编码排在已知等级之后
+    const QVector<qint64> codes = dictionaryKeys(texts);
+    QVector<qint64> keys(texts.size());
+    QHash<QString, qint64> rankCache;
+    for (int i = 0; i < texts.size(); ++i) {
+        auto it = rankCache.find(texts.at(i));
+        if (it == rankCache.end())
+            it = rankCache.insert(texts.at(i), ranks.value(texts.at(i).toLower(), -1));
+        keys[i] = it.value() >= 0 ? it.value() : maxRank + 1 + codes.at(i);
+    }
+    return keys;
+}
+
+QVector<int> LogColumnSorter::sortPermutation(const QVector<qint64> &keys, Qt::SortOrder order, QThreadPool *pool)
+{
+    const int count = keys.size();
+    QVector<int> permutation(count);
+    std::iota(permutation.begin(), permutation.end(), 0);
+
+    const qint64 *key = keys.constData();
+    auto less = [key, order](int a, int b) {
+        return order == Qt::AscendingOrder ? key[a] < key[b] : key[b] < key[a];
+    };
+
+    int chunks = 1;
+    if (pool && count >= LOG_SORT_CHUNK_MIN * 2)
+        chunks = qBound(1, count / LOG_SORT_CHUNK_MIN, qMax(1, pool->maxThreadCount()));
+    QVector<int> bounds(chunks + 1);
+    for (int i = 0; i <= chunks; ++i)
+        bounds[i] = static_cast<int>(static_cast<qint64>(count) * i / chunks);
+
+    int *rows = permutation.data();
+    runParallel(pool, chunks, [&](int c) {
+        std::stable_sort(rows + bounds[c], rows + bounds[c + 1], less);
+    });
+    // 相邻的有序块两两归并，每轮的归并互不重叠，可并行执行
+    for (int width = 1; width < chunks; width *= 2) {
+        const int merges = (chunks + width * 2 - 1) / (width * 2);
+        runParallel(pool, merges, [&](int m) {
+            const int lo = m * width * 2;
+            const int mid = qMin(lo + width, chunks);
+            const int hi = qMin(lo + width * 2, chunks);
+            if (mid < hi)
+                std::inplace_merge(rows + bounds[lo], rows + bounds[mid], rows + bounds[hi], less);
+        });
+    }
+
+    return permutation;
+}
+
+bool LogColumnSorter::isPermutation(const QVector<int> &permutation, int size)
+{
+    if (permutation.size() != size)
+        return false;
+
+    QVector<bool> seen(size, false);
+    for (int row : permutation) {
+        if (row < 0 || row >= size || seen.at(row))
+            return false;
+        seen[row] = true;
+    }
+    return true;
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGCOLUMNSORTER_H
+#define LOGCOLUMNSORTER_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+
+class QThreadPool;
+
+/**
+ * @brief The LogColumnSorter class 按列排序已加载的日志
+ * 在后台线程把排序列换算为整数键：时间列为毫秒时间戳，等级列为严重程度，文本列做字典编码(不重复的文本排序后以序号代替)，
+ * 再对行号做分块并行的稳定排序，得到的排列由界面线程一次性应用到数据列表
+ */
+class LogColumnSorter : public QObject
+{
+    Q_OBJECT
+public:
+    // 排序列的类型，决定文本换算为键的方式
+    enum KeyType {
+        TextKey,
+        TimeKey,
+        LevelKey
+    };
+
+    explicit LogColumnSorter(QObject *parent = nullptr);
+
+    /**
+     * @brief sort 在后台计算排列，完成后发出sorted信号，未完成的上一次排序的结果被丢弃
+     * @param texts 排序列每行的文本，由调用方在界面线程取出
+     * @param keyType 排序列的类型
+     */
+    void sort(const QStringList &texts, KeyType keyType, Qt::SortOrder order);
+    // 丢弃尚未完成的排序结果
+    void cancel();
+
+    static QVector<qint64> timeKeys(const QStringList &texts);
+    static QVector<qint64> dictionaryKeys(const QStringList &texts);
+    /**
+     * @brief levelRanks 等级显示文本(小写)到严重程度的映射，越严重值越小，与解析线程使用的等级文本一致
+     * 包括翻译后的文本及应用日志中未翻译的原文，需在界面线程调用
+     */
+    static QHash<QString, int> levelRanks();
+    /**
+     * @brief levelKeys 按严重程度换算等级列，无法识别的文本排在所有等级之后，彼此间按文本排序
+     */
+    static QVector<qint64> levelKeys(const QStringList &texts, const QHash<QString, int> &ranks);
+    /**
+     * @brief sortPermutation 稳定排序，键相同的行保持原有顺序
+     * @param pool 分块排序及归并使用的线程池，为空或数据量小时在当前线程完成
+     * @return 排列，排序后第i行为原来的第permutation[i]行
+     */
+    static QVector<int> sortPermutation(const QVector<qint64> &keys, Qt::SortOrder order, QThreadPool *pool = nullptr);
+
+    /**
+     * @brief isPermutation 是否为0到size-1的排列，即长度为size、每个行号都在范围内且不重复
+     */
+    static bool isPermutation(const QVector<int> &permutation, int size);
+
+    template<typename T>
+    static QList<T> permute(const QList<T> &list, const QVector<int> &permutation);
+
+signals:
+    void sorted(const QVector<int> &permutation);
+
+private:
+    // 每次排序或取消时递增，结果返回时不一致则丢弃
+    int m_generation {0};
+};
+
+template<typename T>
+QList<T> LogColumnSorter::permute(const QList<T> &list, const QVector<int> &permutation)
+{
+    QList<T> rsList;
+    rsList.reserve(permutation.size());
+    for (int row : permutation)
+        rsList.append(list.at(row));
+    return rsList;
+}
+
+#endif // LOGCOLUMNSORTER_H
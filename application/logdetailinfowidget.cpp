@@ -523,6 +523,13 @@ void logDetailInfoWidget::slot_DetailInfo(const QModelIndex &index, QStandardIte
                        index.siblingAtColumn(5).data().toString(),
                        index.siblingAtColumn(2).data().toString(), index,
                        index.siblingAtColumn(3).data().toString());
+    } else if (dataStr.contains(TIMELINE_TABLE_DATA)) {
+        qCDebug(logApp) << "Displaying timeline log details";
+        // 时间线各列依次为时间、来源、级别、进程、信息，没有进程名时以来源代替
+        const QString origin = index.siblingAtColumn(3).data().toString();
+        fillDetailInfo(origin.isEmpty() ? index.siblingAtColumn(1).data().toString() : origin,
+                       hostname, "", index.siblingAtColumn(0).data().toString(), QModelIndex(),
+                       index.siblingAtColumn(4).data().toString());
     } else if (dataStr.contains(DNF_TABLE_DATA)) {
         qCDebug(logApp) << "Displaying DNF log details";
         fillDetailInfo("dnf", hostname, "", index.siblingAtColumn(1).data().toString(), index,
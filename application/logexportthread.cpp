@@ -5,15 +5,16 @@
 #include "logexportthread.h"
 #include "utils.h"
 #include "xlsxwriter.h"
-#include "WordProcessingMerger.h"
-#include "WordProcessingCompiler.h"
+#include "docxstreamwriter.h"
 #include "dbusproxy/dldbushandler.h"
 #include "qtcompat.h"
+#include "DebugTimeManager.h"
 
 #include <DApplication>
 
 #include <QDebug>
 #include <QFile>
+#include <QFileInfo>
 // #include <QTextCodec>
 #include <QTextStream>
 #include <QTextDocument>
@@ -1588,34 +1589,18 @@ bool LogExportThread::exportToTxt(const QString &fileName, const QList<LOG_MSG_A
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<QString> &jList, const QStringList &labels, LOG_FLAG iFlag)
 {
     try {
-        QString tempdir ;
-        if (iFlag == JOURNAL) {
-            tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/6column.dfw";
-        } else if (iFlag == KERN) {
-            tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/4column.dfw";
-        } else if (iFlag == Kwin) {
-            tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/1column.dfw";
-        } else {
+        if (iFlag != JOURNAL && iFlag != KERN && iFlag != Kwin) {
             qCWarning(logApp) << "exportToDoc type is Wrong!";
             return false;
         }
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-
-
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, iFlag == JOURNAL ? 6 : (iFlag == KERN ? 4 : 1))) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
@@ -1625,33 +1610,30 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<QString>
             message.fromJson(jList.at(row));
             //把数据填入表格单元格中
             if (iFlag == JOURNAL) {
-                l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.level.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.daemonName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.dateTime.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column5").toStdString(), message.hostName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column6").toStdString(), message.daemonId.toStdString());
+                docWriter.appendCell(message.level);
+                docWriter.appendCell(message.daemonName);
+                docWriter.appendCell(message.dateTime);
+                docWriter.appendCell(message.msg);
+                docWriter.appendCell(message.hostName);
+                docWriter.appendCell(message.daemonId);
             } else if (iFlag == KERN) {
-                l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.dateTime.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.hostName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.daemonName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
+                docWriter.appendCell(message.dateTime);
+                docWriter.appendCell(message.hostName);
+                docWriter.appendCell(message.daemonName);
+                docWriter.appendCell(message.msg);
             } else if (iFlag == Kwin) {
-                l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.msg.toStdString());
+                docWriter.appendCell(message.msg);
+            }
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
             }
-            l_merger.paste("tableRow");
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
         qCWarning(logApp) << "Export Stop" << ErrorStr;
@@ -1690,32 +1672,18 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_J
                                   const QStringList &labels, LOG_FLAG iFlag)
 {
     try {
-        QString tempdir ;
-        if (iFlag == JOURNAL) {
-            tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/6column.dfw";
-        } else if (iFlag == KERN) {
-            tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/4column.dfw";
-        } else {
+        if (iFlag != JOURNAL && iFlag != KERN) {
             qCWarning(logApp) << "exportToDoc type is Wrong!";
             return false;
         }
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-
-
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, iFlag == JOURNAL ? 6 : 4)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
@@ -1724,31 +1692,28 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_J
             LOG_MSG_JOURNAL message = jList.at(row);
             //把数据填入表格单元格中
             if (iFlag == JOURNAL) {
-                l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.level.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.daemonName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.dateTime.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column5").toStdString(), message.hostName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column6").toStdString(), message.daemonId.toStdString());
+                docWriter.appendCell(message.level);
+                docWriter.appendCell(message.daemonName);
+                docWriter.appendCell(message.dateTime);
+                docWriter.appendCell(message.msg);
+                docWriter.appendCell(message.hostName);
+                docWriter.appendCell(message.daemonId);
             } else if (iFlag == KERN) {
-                l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.dateTime.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.hostName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.daemonName.toStdString());
-                l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
+                docWriter.appendCell(message.dateTime);
+                docWriter.appendCell(message.hostName);
+                docWriter.appendCell(message.daemonName);
+                docWriter.appendCell(message.msg);
+            }
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
             }
-            l_merger.paste("tableRow");
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
         qCWarning(logApp) << "Export Stop" << ErrorStr;
@@ -1789,46 +1754,35 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_J
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_APPLICATOIN> &jList, const QStringList &labels, QString &iAppName)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/4column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 4)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_APPLICATOIN message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), strTranslate(message.level).toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.dateTime.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), iAppName.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(strTranslate(message.level));
+            docWriter.appendCell(message.dateTime);
+            docWriter.appendCell(iAppName);
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
 
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -1867,45 +1821,34 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_A
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_DPKG> &jList, const QStringList &labels)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/3column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 3)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_DPKG message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.dateTime.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.msg.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.action.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.dateTime);
+            docWriter.appendCell(message.msg);
+            docWriter.appendCell(message.action);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
 
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -1944,43 +1887,32 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_D
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_BOOT> &jList, const QStringList &labels)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/2column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 2)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_BOOT message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.status.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.status);
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
         qCWarning(logApp) << "Export Stop" << ErrorStr;
@@ -2017,43 +1949,32 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_B
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_XORG> &jList, const QStringList &labels)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/2column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 2)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_XORG message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.offset.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.offset);
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -2093,45 +2014,34 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_N
 {
 
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/4column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 4)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_NORMAL message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.eventType.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.userName.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.dateTime.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.eventType);
+            docWriter.appendCell(message.userName);
+            docWriter.appendCell(message.dateTime);
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -2171,42 +2081,31 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_K
 {
 
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/1column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 1)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_KWIN message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -2238,41 +2137,31 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_K
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_DNF> &jList, const QStringList &labels)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/1column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 1)) {
+            emit sigError(openErroStr);
             return false;
         }
-
-        DocxFactory::WordProcessingMerger &l_merger = DocxFactory::WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-        }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw QString(stopStr);
             }
             LOG_MSG_DNF message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName);
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -2304,41 +2193,31 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_D
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_DMESG> &jList, const QStringList &labels)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/1column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 1)) {
+            emit sigError(openErroStr);
             return false;
         }
-
-        DocxFactory::WordProcessingMerger &l_merger = DocxFactory::WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-        }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw QString(stopStr);
             }
             LOG_MSG_DMESG message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName);
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -2370,46 +2249,35 @@ bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_D
 bool LogExportThread::exportToDoc(const QString &fileName, const QList<LOG_MSG_AUDIT> &jList, const QStringList &labels)
 {
     try {
-        QString tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/5column.dfw";
-        if (!QFile(tempdir).exists()) {
-            qCWarning(logApp) << "export docx template is not exisits";
-            return  false;
-        }
-
-        DocxFactory:: WordProcessingMerger &l_merger = DocxFactory:: WordProcessingMerger::getInstance();
-        l_merger.load(tempdir.toStdString());
-        //往表头中添加表头描述，表头为第一行，数据则在下面
-        for (int col = 0; col < labels.count(); ++col) {
-            l_merger.setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), labels.at(col).toStdString());
-
+        //表格行边生成边压缩写入文件，不在内存中保留整个文档
+        DocxStreamWriter docWriter;
+        if (!docWriter.open(fileName, 5)) {
+            emit sigError(openErroStr);
+            return false;
         }
-        l_merger.paste("tableRow");
-        //计算导出进度条最后一段的长度，因为最后写入文件那一段没有进度，所以预先留出一段进度
-        int end = static_cast<int>(jList.count() * 0.1 > 5 ? jList.count() * 0.1 : 5);
+        //表头为第一行，数据则在下面
+        docWriter.writeRow(labels, true);
         for (int row = 0; row < jList.count(); ++row) {
             //导出逻辑启动停止控制，外部把m_canRunning置false时停止运行，抛出异常处理
             if (!m_canRunning) {
                 throw  QString(stopStr);
             }
             LOG_MSG_AUDIT message = jList.at(row);
-            l_merger.setClipboardValue("tableRow", QString("column1").toStdString(), message.eventType.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column2").toStdString(), message.dateTime.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column3").toStdString(), message.processName.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column4").toStdString(), message.status.toStdString());
-            l_merger.setClipboardValue("tableRow", QString("column5").toStdString(), message.msg.toStdString());
-            l_merger.paste("tableRow");
+            docWriter.appendCell(message.eventType);
+            docWriter.appendCell(message.dateTime);
+            docWriter.appendCell(message.processName);
+            docWriter.appendCell(message.status);
+            docWriter.appendCell(message.msg);
+            if (!docWriter.endRow()) {
+                throw QString("write doc file failed");
+            }
             //导出进度信号
-            sigProgress(row + 1, jList.count() + end);
+            sigProgress(row + 1, jList.count());
         }
-        //保存，把拼好的xml写入文件中
-        QString fileNamex = fileName + "x";
-
-        QFile rsNameFile(fileName) ;
-        if (rsNameFile.exists()) {
-            rsNameFile.remove();
+        //写入文档结尾并关闭文件
+        if (!docWriter.close()) {
+            throw QString("write doc file failed");
         }
-        l_merger.save(fileNamex.toStdString());
-        QFile(fileNamex).rename(fileName);
 
     } catch (const QString &ErrorStr) {
         //捕获到异常，导出失败，发出失败信号
@@ -4040,6 +3908,7 @@ void LogExportThread::htmlEscapeCovert(QString &htmlMsg)
 void LogExportThread::run()
 {
     qCDebug(logApp) << "threadrun";
+    PERF_SCOPE(exportScope, PerfExportBytes, "LogExportThread");
     sigProgress(0, 100);
     switch (m_runMode) {
     case TxtModel: {
@@ -4235,6 +4104,8 @@ void LogExportThread::run()
     }
     if (!m_canRunning) {
         Utils::checkAndDeleteDir(m_fileName);
+    } else {
+        PERF_SCOPE_VALUE(exportScope, QFileInfo(m_fileName).size());
     }
 
     m_canRunning = false;
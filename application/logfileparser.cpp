@@ -11,6 +11,7 @@
 #include "utils.h"// add by Airy
 #include "wtmpparse.h"
 #include "logapplicationhelper.h"
+#include "logparsescheduler.h"
 
 #include "parsethread/parsethreadkern.h"
 #include "parsethread/parsethreadkwin.h"
@@ -37,12 +38,16 @@
 
 Q_DECLARE_LOGGING_CATEGORY(logApp)
 
+// 解析线程已发出、界面线程尚未处理的批次上限
+const int LOG_BATCH_CHANNEL_CAPACITY = 4;
+
 int journalWork::thread_index = 0;
 int JournalBootWork::thread_index = 0;
 DWIDGET_USE_NAMESPACE
 
 LogFileParser::LogFileParser(QWidget *parent)
     : QObject(parent)
+    , m_batchChannel(new LogBatchChannel(LOG_BATCH_CHANNEL_CAPACITY))
 {
     qCDebug(logApp) << "LogFileParser constructor called";
     qRegisterMetaType<QList<LOG_MSG_KWIN> > ("QList<LOG_MSG_KWIN>");
@@ -55,6 +60,7 @@ LogFileParser::LogFileParser(QWidget *parent)
     qRegisterMetaType<QList<LOG_MSG_AUDIT>>("QList<LOG_MSG_AUDIT>");
     qRegisterMetaType<QList<LOG_MSG_JOURNAL>>("QList<LOG_MSG_JOURNAL>");
     qRegisterMetaType<QList<LOG_MSG_COREDUMP>>("QList<LOG_MSG_COREDUMP>");
+    qRegisterMetaType<QList<LOG_MSG_BASE>>("QList<LOG_MSG_BASE>");
     qRegisterMetaType<LOG_FLAG> ("LOG_FLAG");
 
 }
@@ -67,18 +73,18 @@ LogFileParser::~LogFileParser()
     // Give threads more time to respond to stop signals
     QThread::msleep(200);
     
-    // Check if application is still valid before accessing QThreadPool
+    // Check if application is still valid before accessing the parse thread pools
     if (QCoreApplication::instance() && !QCoreApplication::closingDown()) {
         qCDebug(logApp) << "Checking thread pool status...";
         // Use non-blocking approach to avoid deadlock
-        QThreadPool *pool = QThreadPool::globalInstance();
-        if (pool && pool->activeThreadCount() > 0) {
-            qCWarning(logApp) << "Active threads detected:" << pool->activeThreadCount();
+        LogParseScheduler *scheduler = LogParseScheduler::instance();
+        if (scheduler->activeThreadCount() > 0) {
+            qCWarning(logApp) << "Active threads detected:" << scheduler->activeThreadCount();
             // Clear queued tasks immediately, but don't wait for running tasks
-            pool->clear();
+            scheduler->cancelPending();
             
             // Use shorter timeout, proceed with destruction if wait fails
-            if (!pool->waitForDone(100)) {
+            if (!scheduler->waitForDone(100)) {
                 qCWarning(logApp) << "Thread pool cleanup timeout, proceeding with destruction";
                 // Don't perform second wait to avoid deadlock
             }
@@ -100,6 +106,7 @@ int LogFileParser::parseByJournal(const QStringList &arg)
 
     emit stopJournal();
     journalWork *work = new journalWork(this);
+    work->setBatchChannel(m_batchChannel);
 
     qCDebug(logApp) << "Setting journal parser arguments";
     work->setArg(arg);
@@ -112,7 +119,7 @@ int LogFileParser::parseByJournal(const QStringList &arg)
 
     int index = work->getIndex();
     qCDebug(logApp) << "Starting journal parser thread with index:" << index;
-    QThreadPool::globalInstance()->start(work);
+    LogParseScheduler::instance()->start(work);
     return index;
 }
 
@@ -121,6 +128,7 @@ int LogFileParser::parseByJournalBoot(const QStringList &arg)
     qCDebug(logApp) << "Starting journal boot log parsing";
     stopAllLoad();
     JournalBootWork *work = new JournalBootWork(this);
+    work->setBatchChannel(m_batchChannel);
 
     work->setArg(arg);
     auto a = connect(work, &JournalBootWork::journalBootFinished, this, &LogFileParser::journalBootFinished,
@@ -131,7 +139,7 @@ int LogFileParser::parseByJournalBoot(const QStringList &arg)
     connect(this, &LogFileParser::stopJournalBoot, work, &JournalBootWork::stopWork);
 
     int index = work->getIndex();
-    QThreadPool::globalInstance()->start(work);
+    LogParseScheduler::instance()->start(work);
     return index;
 }
 
@@ -140,6 +148,7 @@ int LogFileParser::parseByDpkg(const DKPG_FILTERS &iDpkgFilter)
     qCDebug(logApp) << "Starting dpkg log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(DPKG);
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("dpkg");
     //    const QString&str="/var/log/kern";
@@ -153,7 +162,7 @@ int LogFileParser::parseByDpkg(const DKPG_FILTERS &iDpkgFilter)
             &LogFileParser::dpkgData, Qt::UniqueConnection);
     connect(this, &LogFileParser::stopDpkg, authThread, &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -162,6 +171,7 @@ int LogFileParser::parseByXlog(const XORG_FILTERS &iXorgFilter)    // modifed by
     qCDebug(logApp) << "Starting xorg log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(XORG);
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("Xorg");
     authThread->setFilePath(filePath);
@@ -174,7 +184,7 @@ int LogFileParser::parseByXlog(const XORG_FILTERS &iXorgFilter)    // modifed by
             &LogFileParser::xlogData, Qt::UniqueConnection);
     connect(this, &LogFileParser::stopXlog, authThread, &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->tryStart(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -183,6 +193,7 @@ int LogFileParser::parseByNormal(const NORMAL_FILTERS &iNormalFiler)
     qCDebug(logApp) << "Starting normal log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(Normal);
     authThread->setFileterParam(iNormalFiler);
     connect(authThread, &LogAuthThread::proccessError, this,
@@ -193,7 +204,7 @@ int LogFileParser::parseByNormal(const NORMAL_FILTERS &iNormalFiler)
             &LogFileParser::normalData, Qt::UniqueConnection);
     connect(this, &LogFileParser::stopNormal, authThread, &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->tryStart(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -202,6 +213,7 @@ int LogFileParser::parseByKwin(const KWIN_FILTERS &iKwinfilter)
     qCDebug(logApp) << "Starting kwin log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(Kwin);
     authThread->setFileterParam(iKwinfilter);
     connect(authThread, &LogAuthThread::kwinFinished, this,
@@ -211,7 +223,7 @@ int LogFileParser::parseByKwin(const KWIN_FILTERS &iKwinfilter)
     connect(this, &LogFileParser::stopKwin, authThread, &LogAuthThread::stopProccess);
 
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -220,6 +232,7 @@ int LogFileParser::parseByBoot()
     qCDebug(logApp) << "Starting boot log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(BOOT);
 
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("boot");
@@ -231,7 +244,7 @@ int LogFileParser::parseByBoot()
     connect(this, &LogFileParser::stopBoot, authThread,
             &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -251,19 +264,41 @@ int LogFileParser::parse(LOG_FILTER_BASE &filter)
     if (parseWork) {
         qCDebug(logApp) << "Setting filter for parse work";
         parseWork->setFilter(filter);
+        parseWork->setBatchChannel(m_batchChannel);
         int index = parseWork->getIndex();
-        QThreadPool::globalInstance()->start(parseWork);
+        LogParseScheduler::instance()->start(parseWork);
         return index;
     }
     qCDebug(logApp) << "No parse work found, returning -1";
     return -1;
 }
 
+int LogFileParser::prefetch(const LOG_FILTER_BASE &filter)
+{
+    qCDebug(logApp) << "Starting segment prefetch, type:" << filter.type << "segment:" << filter.segementIndex;
+    ParseThreadBase *parseWork = nullptr;
+    if (filter.type == KERN) {
+        parseWork = new ParseThreadKern(this);
+    } else if (filter.type == Kwin) {
+        parseWork = new ParseThreadKwin(this);
+    }
+    if (!parseWork)
+        return -1;
+
+    LOG_FILTER_BASE prefetchFilter = filter;
+    parseWork->setFilter(prefetchFilter);
+    int index = parseWork->getIndex();
+    // 不经批次计数，避免预取数据挤占当前分段的发送
+    LogParseScheduler::instance()->start(parseWork, LogParseScheduler::IoLane, LogParseScheduler::Background);
+    return index;
+}
+
 int LogFileParser::parseByKern(const KERN_FILTERS &iKernFilter)
 {
     qCDebug(logApp) << "Starting kern log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(KERN);
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("kern", false);
     authThread->setFileterParam(iKernFilter);
@@ -275,13 +310,17 @@ int LogFileParser::parseByKern(const KERN_FILTERS &iKernFilter)
     connect(this, &LogFileParser::stopKern, authThread,
             &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
-int LogFileParser::parseByApp(const APP_FILTERS &iAPPFilter)
+/**
+ * @brief LogFileParser::buildAppFilters 按应用日志配置将应用筛选条件展开为各子模块的筛选条件
+ * @param iAPPFilter 应用筛选条件，需设置应用名
+ * @return 各子模块的筛选条件，应用无日志配置时为空
+ */
+APP_FILTERSList LogFileParser::buildAppFilters(const APP_FILTERS &iAPPFilter)
 {
-    qCDebug(logApp) << "Starting app log parsing for:" << iAPPFilter.app;
     // 根据应用名获取应用日志配置信息
     QString appName = iAPPFilter.app;
     AppLogConfig appLogConfig = LogApplicationHelper::instance()->appLogConfig(appName);
@@ -314,11 +353,21 @@ int LogFileParser::parseByApp(const APP_FILTERS &iAPPFilter)
         }
     }
 
+    return appFilterList;
+}
+
+int LogFileParser::parseByApp(const APP_FILTERS &iAPPFilter)
+{
+    qCDebug(logApp) << "Starting app log parsing for:" << iAPPFilter.app;
+    APP_FILTERSList appFilterList = buildAppFilters(iAPPFilter);
+
     if (appFilterList.size() > 0) {
         qCDebug(logApp) << "App log config has submodules, starting parsing";
         stopAllLoad();
 
         m_appThread = new LogApplicationParseThread(this);
+        m_appThread->setBatchChannel(m_batchChannel);
+        m_appThread->setParsePool(LogParseScheduler::instance()->pool(LogParseScheduler::CpuLane));
         quitLogAuththread(m_appThread);
 
         disconnect(m_appThread, &LogApplicationParseThread::appFinished, this,
@@ -349,6 +398,7 @@ void LogFileParser::parseByDnf(DNF_FILTERS iDnfFilter)
     qCDebug(logApp) << "Starting dnf log parsing";
     stopAllLoad();
     LogAuthThread *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(Dnf);
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("dnf");
     authThread->setFilePath(filePath);
@@ -359,7 +409,7 @@ void LogFileParser::parseByDnf(DNF_FILTERS iDnfFilter)
             &LogFileParser::dnfFinished, Qt::UniqueConnection);
     connect(this, &LogFileParser::stopDnf, authThread,
             &LogAuthThread::stopProccess);
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
 }
 
 void LogFileParser::parseByDmesg(DMESG_FILTERS iDmesgFilter)
@@ -367,6 +417,7 @@ void LogFileParser::parseByDmesg(DMESG_FILTERS iDmesgFilter)
     qCDebug(logApp) << "Starting dmesg log parsing";
     stopAllLoad();
     LogAuthThread *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(Dmesg);
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("dmesg");
     authThread->setFilePath(filePath);
@@ -377,7 +428,7 @@ void LogFileParser::parseByDmesg(DMESG_FILTERS iDmesgFilter)
             &LogFileParser::dmesgFinished, Qt::UniqueConnection);
     connect(this, &LogFileParser::stopDmesg, authThread,
             &LogAuthThread::stopProccess);
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
 }
 
 int LogFileParser::parseByOOC(const QString &path)
@@ -405,6 +456,7 @@ int LogFileParser::parseByAudit(const AUDIT_FILTERS &iAuditFilter)
     qCDebug(logApp) << "Starting audit log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(Audit);
     QStringList filePath = DLDBusHandler::instance(this)->getFileInfo("audit", false);
     authThread->setFileterParam(iAuditFilter);
@@ -416,7 +468,7 @@ int LogFileParser::parseByAudit(const AUDIT_FILTERS &iAuditFilter)
     connect(this, &LogFileParser::stopKern, authThread,
             &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -430,6 +482,7 @@ int LogFileParser::parseByAuth(const AUTH_FILTERS &iAuthFilter)
     qCDebug(logApp) << "Starting Auth Log parsing";
     stopAllLoad();
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(Auth);
     QStringList filePath = LogApplicationHelper::instance()->getAuthLogList();
     qCDebug(logApp) << "Auth log files:" << filePath;
@@ -442,7 +495,7 @@ int LogFileParser::parseByAuth(const AUTH_FILTERS &iAuthFilter)
     connect(this, &LogFileParser::stopKern, authThread,
             &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    LogParseScheduler::instance()->start(authThread);
     return index;
 }
 
@@ -452,6 +505,7 @@ int LogFileParser::parseByCoredump(const COREDUMP_FILTERS &iCoredumpFilter, bool
     stopAllLoad();
     //qRegisterMetaType<QList<quint16>>("QList<LOG_MSG_COREDUMP>");
     LogAuthThread   *authThread = new LogAuthThread(this);
+    authThread->setBatchChannel(m_batchChannel);
     authThread->setType(COREDUMP);
     authThread->setParseMap(parseMap);
     authThread->setFileterParam(iCoredumpFilter);
@@ -461,7 +515,9 @@ int LogFileParser::parseByCoredump(const COREDUMP_FILTERS &iCoredumpFilter, bool
             &LogFileParser::coredumpData);
     connect(this, &LogFileParser::stopCoredump, authThread, &LogAuthThread::stopProccess);
     int index = authThread->getIndex();
-    QThreadPool::globalInstance()->start(authThread);
+    // 上报崩溃信息时界面不展示结果，让位于当前展示的日志
+    LogParseScheduler::instance()->start(authThread, LogParseScheduler::IoLane,
+                                         parseMap ? LogParseScheduler::Background : LogParseScheduler::Visible);
     return index;
 }
 
@@ -482,6 +538,10 @@ void LogFileParser::stopAllLoad()
     emit stopDmesg();
     emit stopOOC();
     emit stopCoredump();
+    // 尚未开始的旧任务直接丢弃，不再占用线程
+    LogParseScheduler::instance()->cancelPending();
+    // 旧线程的在途批次不再限制新的加载，等待中的线程随即检查停止标记退出
+    m_batchChannel->reset();
     
     // 给线程一些时间来响应停止信号
     qCDebug(logApp) << "Waiting for threads to respond to stop signals";
@@ -489,6 +549,11 @@ void LogFileParser::stopAllLoad()
     return;
 }
 
+void LogFileParser::releaseBatch()
+{
+    m_batchChannel->release();
+}
+
 void LogFileParser::quitLogAuththread(QThread *iThread)
 {
     // qCDebug(logApp) << "LogFileParser::quitLogAuththread called with iThread:" << iThread;
@@ -34,8 +34,11 @@ public:
     int parseByBoot();
     // 通用解析入口，传入筛选参数，解析线程根据筛选参数吐出日志数据
     int parse(LOG_FILTER_BASE &filter);
+    // 后台预取分段数据，不停止正在进行的解析，低优先级执行，返回线程index，不支持的类型返回-1
+    int prefetch(const LOG_FILTER_BASE &filter);
     int parseByKern(const KERN_FILTERS &iKernFilter);
     int parseByApp(const APP_FILTERS &iAPPFilter);
+    static APP_FILTERSList buildAppFilters(const APP_FILTERS &iAPPFilter);
     void parseByDnf(DNF_FILTERS iDnfFilter);
     void parseByDmesg(DMESG_FILTERS iDmesgFilter);
     int parseByNormal(const NORMAL_FILTERS &iNormalFiler);   // add by Airy
@@ -50,10 +53,13 @@ public:
     int parseByCoredump(const COREDUMP_FILTERS &iCoredumpFilter, bool parseMap = false);
 
     void stopAllLoad();
+    // 接收端处理完解析线程发出的一批数据后调用，解析线程据此合并批次或等待
+    void releaseBatch();
 
 signals:
     void parseFinished(int index, LOG_FLAG type, int status);
     void logData(int index, const QList<QString> &dataList, LOG_FLAG type);
+    void logRecords(int index, const QList<LOG_MSG_BASE> &recordList, LOG_FLAG type);
     void stop();
 
     void dpkgFinished(int index);
@@ -65,7 +71,7 @@ signals:
     void kernFinished(int index);
     void kernData(int index, QList<LOG_MSG_JOURNAL>);
     void dnfFinished(QList<LOG_MSG_DNF>);
-    void dmesgFinished(QList<LOG_MSG_DMESG>);
+    void dmesgFinished(QList<LOG_MSG_DMESG>, quint64 lastSeq);
     void journalFinished(int index);
     void journalBootFinished(int index);
     void journalData(int index, QList<LOG_MSG_JOURNAL>);
@@ -122,6 +128,8 @@ public slots:
 private:
     LogOOCFileParseThread *m_OOCThread {nullptr};
     LogApplicationParseThread *m_appThread {nullptr};
+    // 与各解析线程共享的在途批次计数
+    QSharedPointer<LogBatchChannel> m_batchChannel;
 };
 
 #endif  // LOGFILEPARSER_H
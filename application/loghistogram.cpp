@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "loghistogram.h"
+
+#include <QDateTime>
+#include <QLoggingCategory>
+#include <QRegularExpression>
+
+#include <algorithm>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+LogHistogram::LogHistogram(QObject *parent)
+    : QObject(parent)
+{
+    m_pool.setMaxThreadCount(1);
+}
+
+LogHistogram::~LogHistogram()
+{
+    m_generation.fetchAndAddOrdered(1);
+    m_pool.waitForDone();
+}
+
+void LogHistogram::setBucketSpan(qint64 span)
+{
+    if (span <= 0 || span == m_span)
+        return;
+    m_span = span;
+    reset();
+}
+
+void LogHistogram::reset()
+{
+    m_generation.fetchAndAddOrdered(1);
+    QMutexLocker locker(&m_mutex);
+    for (int group = 0; group < GroupCount; ++group)
+        m_buckets[group].clear();
+    m_total = 0;
+    m_untimed = 0;
+}
+
+void LogHistogram::waitForDone()
+{
+    m_pool.waitForDone();
+}
+
+void LogHistogram::merge(int generation, const Buckets *local, qint64 total, qint64 untimed)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        // reset之后到达的旧批次不再计入
+        if (generation != m_generation.loadAcquire())
+            return;
+
+        for (int group = 0; group < GroupCount; ++group) {
+            for (auto it = local[group].constBegin(); it != local[group].constEnd(); ++it) {
+                QHash<QString, qint64> &counts = m_buckets[group][it.key()];
+                for (auto countIt = it.value().constBegin(); countIt != it.value().constEnd(); ++countIt)
+                    counts[countIt.key()] += countIt.value();
+            }
+        }
+        m_total += total;
+        m_untimed += untimed;
+    }
+    emit updated();
+}
+
+LogHistogram::Buckets LogHistogram::buckets(GroupBy group) const
+{
+    QMutexLocker locker(&m_mutex);
+    if (group < 0 || group >= GroupCount)
+        return Buckets();
+    return m_buckets[group];
+}
+
+qint64 LogHistogram::total() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_total;
+}
+
+qint64 LogHistogram::untimedCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_untimed;
+}
+
+qint64 LogHistogram::alignTime(qint64 time, qint64 span)
+{
+    // 取启动时的本地时区偏移，跨夏令时切换的时间段会有一小时的偏差
+    static const qint64 localOffset = QDateTime::currentDateTime().offsetFromUtc() * 1000LL;
+    if (span <= 0)
+        return time;
+    const qint64 local = time + localOffset;
+    qint64 remainder = local % span;
+    if (remainder < 0)
+        remainder += span;
+    return time - remainder;
+}
+
+LogHistogram::Buckets LogHistogram::rebucket(const Buckets &buckets, qint64 span)
+{
+    Buckets result;
+    for (auto it = buckets.constBegin(); it != buckets.constEnd(); ++it) {
+        QHash<QString, qint64> &counts = result[alignTime(it.key(), span)];
+        for (auto countIt = it.value().constBegin(); countIt != it.value().constEnd(); ++countIt)
+            counts[countIt.key()] += countIt.value();
+    }
+    return result;
+}
+
+QList<QPair<QString, qint64>> LogHistogram::keyTotals(const Buckets &buckets)
+{
+    QHash<QString, qint64> totals;
+    for (auto it = buckets.constBegin(); it != buckets.constEnd(); ++it) {
+        for (auto countIt = it.value().constBegin(); countIt != it.value().constEnd(); ++countIt)
+            totals[countIt.key()] += countIt.value();
+    }
+
+    QList<QPair<QString, qint64>> result;
+    for (auto it = totals.constBegin(); it != totals.constEnd(); ++it)
+        result.append(qMakePair(it.key(), it.value()));
+    std::sort(result.begin(), result.end(), [](const QPair<QString, qint64> &a, const QPair<QString, qint64> &b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    return result;
+}
+
+qint64 LogHistogram::parseSpan(const QString &str)
+{
+    static const QRegularExpression spanExp("^(\\d+)([smhd])$");
+    QRegularExpressionMatch match = spanExp.match(str.trimmed());
+    if (!match.hasMatch())
+        return -1;
+
+    const qint64 count = match.captured(1).toLongLong();
+    const QChar unit = match.captured(2).at(0);
+    qint64 secs = count;
+    if (unit == 'm')
+        secs = count * 60;
+    else if (unit == 'h')
+        secs = count * 3600;
+    else if (unit == 'd')
+        secs = count * 86400;
+    return secs > 0 ? secs * 1000 : -1;
+}
+
+bool LogHistogram::parseGroupBy(const QString &str, GroupBy &group)
+{
+    for (int i = 0; i < GroupCount; ++i) {
+        if (str == groupName(static_cast<GroupBy>(i))) {
+            group = static_cast<GroupBy>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+QString LogHistogram::groupName(GroupBy group)
+{
+    switch (group) {
+    case GroupLevel:
+        return "level";
+    case GroupProcess:
+        return "process";
+    case GroupCategory:
+        return "category";
+    default:
+        return QString();
+    }
+}
+
+qint64 LogHistogram::sample(const LOG_MSG_TIMELINE &msg, QHash<qint64, qint64> *hourCache, QString *keys)
+{
+    Q_UNUSED(hourCache)
+    keys[GroupLevel] = keyOf(msg.level);
+    keys[GroupProcess] = keyOf(msg.origin);
+    // 合并时间线以来源日志种类作为分类
+    keys[GroupCategory] = keyOf(msg.source);
+    return msg.time;
+}
+
+qint64 LogHistogram::sample(const LOG_MSG_BOOT &msg, QHash<qint64, qint64> *hourCache, QString *keys)
+{
+    // 启动日志没有时间，只计入总数
+    Q_UNUSED(hourCache)
+    keys[GroupLevel] = keyOf(msg.status);
+    keys[GroupProcess] = keyOf(QString());
+    keys[GroupCategory] = keys[GroupLevel];
+    return -1;
+}
+
+qint64 LogHistogram::sample(const LOG_MSG_KWIN &msg, QHash<qint64, qint64> *hourCache, QString *keys)
+{
+    Q_UNUSED(msg)
+    Q_UNUSED(hourCache)
+    for (int group = 0; group < GroupCount; ++group)
+        keys[group] = keyOf(QString());
+    return -1;
+}
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGHISTOGRAM_H
+#define LOGHISTOGRAM_H
+
+#include "structdef.h"
+#include "logtimeline.h"
+
+#include <QAtomicInt>
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QObject>
+#include <QPair>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+/**
+ * @brief The LogHistogram class 已加载日志的分时段统计
+ * 按时间段统计各级别、进程或分类(审计类型、应用子模块等)的记录数，三种分组同时统计。
+ * 每批数据到达时交给内部的单线程池换算时间并局部汇总，再合并到结果中，不阻塞界面线程
+ */
+class LogHistogram : public QObject
+{
+    Q_OBJECT
+public:
+    enum GroupBy {
+        GroupLevel = 0, // 级别
+        GroupProcess, // 进程、守护进程或应用来源
+        GroupCategory, // 审计类型、应用子模块、dpkg动作等，无分类的日志同进程
+        GroupCount
+    };
+    // 时间段起点(ms) -> 分组键 -> 记录数
+    typedef QMap<qint64, QHash<QString, qint64>> Buckets;
+
+    explicit LogHistogram(QObject *parent = nullptr);
+    ~LogHistogram() override;
+
+    // 时间段宽度(ms)，修改后清空已有统计
+    void setBucketSpan(qint64 span);
+    qint64 bucketSpan() const { return m_span; }
+
+    // 清空统计，尚未处理的批次将被丢弃
+    void reset();
+    // 追加一批记录，统计在内部线程中完成，完成后发出updated信号
+    template<typename T>
+    void addRecords(const QList<T> &list);
+    void waitForDone();
+
+    Buckets buckets(GroupBy group) const;
+    qint64 total() const;
+    // 无法解析时间的记录数
+    qint64 untimedCount() const;
+
+    // 合并为更宽的时间段，span应为原宽度的整数倍
+    static Buckets rebucket(const Buckets &buckets, qint64 span);
+    // 各分组键的总数，按数量从多到少
+    static QList<QPair<QString, qint64>> keyTotals(const Buckets &buckets);
+    // 解析时间段宽度，如30s、15m、1h、1d，无法解析时返回-1
+    static qint64 parseSpan(const QString &str);
+    static bool parseGroupBy(const QString &str, GroupBy &group);
+    static QString groupName(GroupBy group);
+    // 时间所在时间段的起点，按本地时区对齐，整天的时间段从本地零点开始
+    static qint64 alignTime(qint64 time, qint64 span);
+
+    /**
+     * @brief sample 取一条记录的时间与各分组键
+     * @param keys 长度为GroupCount的数组
+     * @return 毫秒时间戳，没有时间时返回-1
+     */
+    template<typename T>
+    static qint64 sample(const T &msg, QHash<qint64, qint64> *hourCache, QString *keys);
+    static qint64 sample(const LOG_MSG_TIMELINE &msg, QHash<qint64, qint64> *hourCache, QString *keys);
+    static qint64 sample(const LOG_MSG_BOOT &msg, QHash<qint64, qint64> *hourCache, QString *keys);
+    static qint64 sample(const LOG_MSG_KWIN &msg, QHash<qint64, qint64> *hourCache, QString *keys);
+
+    template<typename T>
+    static QString category(const T &msg)
+    {
+        Q_UNUSED(msg)
+        return QString();
+    }
+    static QString category(const LOG_MSG_AUDIT &msg) { return msg.auditType; }
+    static QString category(const LOG_MSG_APPLICATOIN &msg) { return msg.subModule; }
+    static QString category(const LOG_MSG_DPKG &msg) { return msg.action; }
+    static QString category(const LOG_MSG_NORMAL &msg) { return msg.eventType; }
+    static QString category(const LOG_MSG_COREDUMP &msg) { return msg.sig; }
+
+signals:
+    void updated();
+
+private:
+    void merge(int generation, const Buckets *local, qint64 total, qint64 untimed);
+    static QString keyOf(const QString &value) { return value.isEmpty() ? QString("N/A") : value; }
+
+private:
+    mutable QMutex m_mutex;
+    Buckets m_buckets[GroupCount];
+    qint64 m_total {0};
+    qint64 m_untimed {0};
+    qint64 m_span {3600 * 1000};
+
+    // 单线程池，批次按到达顺序串行统计，整点缓存只在该线程内访问
+    QThreadPool m_pool;
+    QAtomicInt m_generation {0};
+    QHash<qint64, qint64> m_hourCache;
+};
+
+template<typename T>
+qint64 LogHistogram::sample(const T &msg, QHash<qint64, qint64> *hourCache, QString *keys)
+{
+    const LOG_MSG_TIMELINE entry = LogTimeline::toEntry(msg);
+    const QString cat = category(msg);
+    keys[GroupLevel] = keyOf(entry.level);
+    keys[GroupProcess] = keyOf(entry.origin);
+    keys[GroupCategory] = cat.isEmpty() ? keys[GroupProcess] : cat;
+    return LogTimeline::toEpoch(entry.dateTime, hourCache);
+}
+
+template<typename T>
+void LogHistogram::addRecords(const QList<T> &list)
+{
+    if (list.isEmpty())
+        return;
+
+    const int generation = m_generation.loadAcquire();
+    const qint64 span = m_span;
+    QtConcurrent::run(&m_pool, [this, list, generation, span]() {
+        if (generation != m_generation.loadAcquire())
+            return;
+
+        // 先在本批内汇总，合并时只需对每个时间段加锁累加一次
+        Buckets local[GroupCount];
+        qint64 untimed = 0;
+        QString keys[GroupCount];
+        for (const T &msg : list) {
+            const qint64 time = sample(msg, &m_hourCache, keys);
+            if (time < 0) {
+                ++untimed;
+                continue;
+            }
+            const qint64 begin = alignTime(time, span);
+            for (int group = 0; group < GroupCount; ++group)
+                ++local[group][begin][keys[group]];
+        }
+        merge(generation, local, list.size(), untimed);
+    });
+}
+
+#endif // LOGHISTOGRAM_H
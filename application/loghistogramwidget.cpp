@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "loghistogramwidget.h"
+
+#include <DPaletteHelper>
+
+#include <QDateTime>
+#include <QLoggingCategory>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QToolTip>
+
+DWIDGET_USE_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 统计条高度
+const int HISTOGRAM_HEIGHT = 48;
+// 每根柱子最少占用的像素宽度，时间段过多时合并为更宽的时间段
+const int HISTOGRAM_MIN_BAR_WIDTH = 4;
+// 单独堆叠显示的分组键个数
+const int HISTOGRAM_STACK_KEYS = 4;
+// 统计更新后的重绘间隔
+const int HISTOGRAM_REFRESH_INTERVAL = 200;
+
+LogHistogramWidget::LogHistogramWidget(QWidget *parent)
+    : DWidget(parent)
+{
+    setFixedHeight(HISTOGRAM_HEIGHT);
+    setMouseTracking(true);
+    setVisible(false);
+
+    m_refreshTimer.setSingleShot(true);
+    m_refreshTimer.setInterval(HISTOGRAM_REFRESH_INTERVAL);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &LogHistogramWidget::rebuild);
+}
+
+void LogHistogramWidget::setHistogram(LogHistogram *histogram)
+{
+    if (m_histogram)
+        disconnect(m_histogram, nullptr, this, nullptr);
+    m_histogram = histogram;
+    if (m_histogram)
+        connect(m_histogram, &LogHistogram::updated, this, &LogHistogramWidget::slot_histogramUpdated);
+    rebuild();
+}
+
+void LogHistogramWidget::setLogFlag(LOG_FLAG flag)
+{
+    qCDebug(logApp) << "LogHistogramWidget::setLogFlag called with flag:" << flag;
+    switch (flag) {
+    case JOURNAL:
+    case APP:
+    case Dnf:
+    case Dmesg:
+        m_supported = true;
+        m_group = LogHistogram::GroupLevel;
+        break;
+    case DPKG:
+    case Normal:
+    case Audit:
+    case COREDUMP:
+        m_supported = true;
+        m_group = LogHistogram::GroupCategory;
+        break;
+    default:
+        m_supported = false;
+        break;
+    }
+
+    m_selectedBegin = -1;
+    m_selectedEnd = -1;
+    rebuild();
+}
+
+void LogHistogramWidget::slot_histogramUpdated()
+{
+    if (!m_refreshTimer.isActive())
+        m_refreshTimer.start();
+}
+
+void LogHistogramWidget::rebuild()
+{
+    m_keys.clear();
+    m_counts.clear();
+    m_maxCount = 0;
+
+    LogHistogram::Buckets buckets;
+    if (m_supported && m_histogram)
+        buckets = m_histogram->buckets(m_group);
+    if (buckets.isEmpty()) {
+        setVisible(false);
+        update();
+        return;
+    }
+
+    // 时间段数超过可显示的柱子数时成倍放宽
+    const qint64 maxBars = qMax(1, width() / HISTOGRAM_MIN_BAR_WIDTH);
+    qint64 span = m_histogram->bucketSpan();
+    while ((buckets.lastKey() - buckets.firstKey()) / span + 1 > maxBars)
+        span *= 2;
+    if (span != m_histogram->bucketSpan())
+        buckets = LogHistogram::rebucket(buckets, span);
+
+    m_first = buckets.firstKey();
+    m_viewSpan = span;
+    const QList<QPair<QString, qint64>> totals = LogHistogram::keyTotals(buckets);
+    for (int i = 0; i < totals.size() && i < HISTOGRAM_STACK_KEYS; ++i)
+        m_keys.append(totals.at(i).first);
+
+    const int barCount = static_cast<int>((buckets.lastKey() - m_first) / span + 1);
+    m_counts = QVector<QVector<qint64>>(barCount, QVector<qint64>(m_keys.size() + 1, 0));
+    for (auto it = buckets.constBegin(); it != buckets.constEnd(); ++it) {
+        QVector<qint64> &counts = m_counts[static_cast<int>((it.key() - m_first) / span)];
+        qint64 sum = 0;
+        for (auto countIt = it.value().constBegin(); countIt != it.value().constEnd(); ++countIt) {
+            const int keyIndex = m_keys.indexOf(countIt.key());
+            counts[keyIndex < 0 ? m_keys.size() : keyIndex] += countIt.value();
+            sum += countIt.value();
+        }
+        m_maxCount = qMax(m_maxCount, sum);
+    }
+
+    setVisible(true);
+    update();
+}
+
+QRectF LogHistogramWidget::barRect(int index) const
+{
+    const qreal barWidth = static_cast<qreal>(width()) / qMax(1, m_counts.size());
+    return QRectF(index * barWidth, 0, barWidth, height());
+}
+
+int LogHistogramWidget::barAt(const QPoint &pos) const
+{
+    if (m_counts.isEmpty() || width() <= 0)
+        return -1;
+    const int index = pos.x() * m_counts.size() / width();
+    return index >= 0 && index < m_counts.size() ? index : -1;
+}
+
+void LogHistogramWidget::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+    if (m_counts.isEmpty() || m_maxCount <= 0)
+        return;
+
+    QPainter painter(this);
+    const DPalette pa = DPaletteHelper::instance()->palette(this);
+    const QColor base = pa.color(DPalette::Highlight);
+    QColor otherColor = pa.color(DPalette::PlaceholderText);
+
+    for (int i = 0; i < m_counts.size(); ++i) {
+        const QRectF rect = barRect(i);
+        const qint64 begin = m_first + i * m_viewSpan;
+        if (m_selectedBegin >= 0 && m_selectedBegin >= begin && m_selectedBegin < begin + m_viewSpan) {
+            QColor selectColor = base;
+            selectColor.setAlpha(40);
+            painter.fillRect(rect, selectColor);
+        }
+
+        // 自下而上堆叠，数量多的键颜色更深
+        qreal bottom = rect.bottom();
+        const QVector<qint64> &counts = m_counts.at(i);
+        for (int k = 0; k < counts.size(); ++k) {
+            if (counts.at(k) <= 0)
+                continue;
+            const qreal h = rect.height() * counts.at(k) / m_maxCount;
+            QColor color = base;
+            if (k < m_keys.size())
+                color.setAlpha(255 - k * 40);
+            else
+                color = otherColor;
+            painter.fillRect(QRectF(rect.left() + 0.5, bottom - h, qMax<qreal>(1.0, rect.width() - 1.0), h), color);
+            bottom -= h;
+        }
+    }
+}
+
+void LogHistogramWidget::mousePressEvent(QMouseEvent *event)
+{
+    const int index = barAt(event->pos());
+    if (event->button() != Qt::LeftButton || index < 0) {
+        DWidget::mousePressEvent(event);
+        return;
+    }
+
+    const qint64 begin = m_first + index * m_viewSpan;
+    const qint64 end = begin + m_viewSpan;
+    if (begin == m_selectedBegin && end == m_selectedEnd) {
+        m_selectedBegin = -1;
+        m_selectedEnd = -1;
+    } else {
+        m_selectedBegin = begin;
+        m_selectedEnd = end;
+    }
+    qCDebug(logApp) << "Histogram range selected:" << m_selectedBegin << m_selectedEnd;
+    update();
+    emit rangeSelected(m_selectedBegin, m_selectedEnd);
+}
+
+void LogHistogramWidget::mouseMoveEvent(QMouseEvent *event)
+{
+    const int index = barAt(event->pos());
+    if (index < 0) {
+        QToolTip::hideText();
+        return;
+    }
+
+    const qint64 begin = m_first + index * m_viewSpan;
+    QString tip = QString("%1 - %2")
+                      .arg(QDateTime::fromMSecsSinceEpoch(begin).toString("yyyy-MM-dd HH:mm"))
+                      .arg(QDateTime::fromMSecsSinceEpoch(begin + m_viewSpan).toString("yyyy-MM-dd HH:mm"));
+    const QVector<qint64> &counts = m_counts.at(index);
+    for (int k = 0; k < counts.size(); ++k) {
+        if (counts.at(k) > 0)
+            tip += QString("\n%1: %2").arg(k < m_keys.size() ? m_keys.at(k) : QString("...")).arg(counts.at(k));
+    }
+    QToolTip::showText(mapToGlobal(event->pos()), tip, this);
+}
+
+void LogHistogramWidget::resizeEvent(QResizeEvent *event)
+{
+    DWidget::resizeEvent(event);
+    // 宽度变化会改变合并后的时间段
+    if (m_supported)
+        slot_histogramUpdated();
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGHISTOGRAMWIDGET_H
+#define LOGHISTOGRAMWIDGET_H
+
+#include "loghistogram.h"
+#include "structdef.h"
+
+#include <DWidget>
+
+#include <QTimer>
+#include <QVector>
+
+/**
+ * @brief The LogHistogramWidget class 日志列表上方的分时段统计条
+ * 每个时间段一根柱，按数量最多的几个分组键堆叠显示，其余合并为一段；
+ * 点击柱子只显示该时间段的日志，再次点击取消
+ */
+class LogHistogramWidget : public Dtk::Widget::DWidget
+{
+    Q_OBJECT
+public:
+    explicit LogHistogramWidget(QWidget *parent = nullptr);
+
+    void setHistogram(LogHistogram *histogram);
+    // 切换日志种类，选择对应的分组并清除已选时间段，无时间的日志种类不显示
+    void setLogFlag(LOG_FLAG flag);
+
+signals:
+    // 选中的时间段，毫秒时间戳，取消选择时均为-1
+    void rangeSelected(qint64 begin, qint64 end);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+
+private slots:
+    void slot_histogramUpdated();
+
+private:
+    void rebuild();
+    int barAt(const QPoint &pos) const;
+    QRectF barRect(int index) const;
+
+private:
+    LogHistogram *m_histogram {nullptr};
+    LogHistogram::GroupBy m_group {LogHistogram::GroupLevel};
+    bool m_supported {false};
+    // 统计更新频繁，合并后再重绘
+    QTimer m_refreshTimer;
+
+    // 按控件宽度合并后的显示数据
+    qint64 m_first {0};
+    qint64 m_viewSpan {0};
+    QStringList m_keys;
+    // 每个时间段各堆叠键的数量，最后一项为其余键之和
+    QVector<QVector<qint64>> m_counts;
+    qint64 m_maxCount {0};
+
+    qint64 m_selectedBegin {-1};
+    qint64 m_selectedEnd {-1};
+};
+
+#endif // LOGHISTOGRAMWIDGET_H
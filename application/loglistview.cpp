@@ -34,6 +34,8 @@
 #include <QShortcut>
 #include <QAbstractButton>
 #include <QLoggingCategory>
+#include <QFutureWatcher>
+#include <QtConcurrent>
 
 #define ITEM_HEIGHT 40
 #define ITEM_HEIGHT_COMPACT 24
@@ -174,10 +176,51 @@ void LogListView::initUI()
     this->setViewportMargins(10, 10, 10, 0);
     Dtk::Core::DSysInfo::UosEdition edition = Dtk::Core::DSysInfo::uosEditionType();
     //等于服务器行业版或欧拉版(centos)
-    bool isCentos = Dtk::Core::DSysInfo::UosEuler == edition || Dtk::Core::DSysInfo::UosEnterpriseC == edition || Dtk::Core::DSysInfo::UosMilitaryS == edition;
+    m_isCentos = Dtk::Core::DSysInfo::UosEuler == edition || Dtk::Core::DSysInfo::UosEnterpriseC == edition || Dtk::Core::DSysInfo::UosMilitaryS == edition;
     m_pModel = new QStandardItemModel(this);
+    this->setModel(m_pModel);
+    m_logTypesReady = false;
+
+    PERF_PRINT_BEGIN("STARTUP-CATEGORIES", Utils::lazyStartup ? "lazy" : "");
+    if (Utils::lazyStartup) {
+        // 文件探测及等待应用日志发现放到后台，窗口先显示，探测完成后再填充列表
+        auto *watcher = new QFutureWatcher<LogTypeProbe>(this);
+        connect(watcher, &QFutureWatcher<LogTypeProbe>::finished, this, [this, watcher]() {
+            initLogTypes(watcher->result());
+            watcher->deleteLater();
+        });
+        watcher->setFuture(QtConcurrent::run(&LogListView::probeLogTypes));
+    } else {
+        initLogTypes(probeLogTypes());
+    }
+}
+
+/**
+ * @brief LogListView::probeLogTypes 探测各日志种类依赖的文件是否存在，可在后台线程执行
+ */
+LogListView::LogTypeProbe LogListView::probeLogTypes()
+{
+    LogTypeProbe probe;
+    probe.journal = isFileExist("/var/log/journal");
+    probe.kern = isFileExist("/var/log/kern.log");
+    probe.kwinBoot = QFile::exists(KWIN_TREE_DATA);
+    probe.dpkg = isFileExist("/var/log/dpkg.log");
+    probe.wtmp = isFileExist("/var/log/wtmp");
+    // 应用日志发现在后台进行，此处等待其完成
+    probe.app = !LogApplicationHelper::instance()->getMap().isEmpty();
+    return probe;
+}
+
+/**
+ * @brief LogListView::initLogTypes 根据探测结果填充日志种类列表，并默认选中第一项
+ */
+void LogListView::initLogTypes(const LogTypeProbe &probe)
+{
+    qCDebug(logApp) << "LogListView::initLogTypes called";
     QStandardItem *item = nullptr;
-    if (isFileExist("/var/log/journal") || isCentos) {
+    const bool isCentos = m_isCentos;
+    m_logTypes.clear();
+    if (probe.journal || isCentos) {
         item = new QStandardItem(QIcon::fromTheme("dp_system"), DApplication::translate("Tree", "System Log"));
         setIconSize(QSize(ICON_SIZE, ICON_SIZE));
         item->setToolTip(DApplication::translate("Tree", "System Log")); // add by Airy for bug 16245
@@ -198,7 +241,7 @@ void LogListView::initUI()
         m_pModel->appendRow(item);
         m_logTypes.push_back(DMESG_TREE_DATA);
     } else {
-        if (isFileExist("/var/log/kern.log")) {
+        if (probe.kern) {
             item = new QStandardItem(QIcon::fromTheme("dp_core"), DApplication::translate("Tree", "Kernel Log"));
             setIconSize(QSize(ICON_SIZE, ICON_SIZE));
             item->setToolTip(DApplication::translate("Tree", "Kernel Log")); // add by Airy for bug 16245
@@ -209,7 +252,7 @@ void LogListView::initUI()
             m_logTypes.push_back(KERN_TREE_DATA);
         }
     }
-    if (Utils::isWayland() && QFile::exists(KWIN_TREE_DATA)) {
+    if (Utils::isWayland() && probe.kwinBoot) {
         item = new QStandardItem(QIcon::fromTheme("dp_start"), DApplication::translate("Tree", "Boot Log"));
         setIconSize(QSize(ICON_SIZE, ICON_SIZE));
         item->setToolTip(DApplication::translate("Tree", "Boot Log")); // add by Airy for bug 16245
@@ -239,7 +282,7 @@ void LogListView::initUI()
         m_pModel->appendRow(item);
         m_logTypes.push_back(DNF_TREE_DATA);
     } else {
-        if (isFileExist("/var/log/dpkg.log")) {
+        if (probe.dpkg) {
             item = new QStandardItem(QIcon::fromTheme("dp_d"), DApplication::translate("Tree", "dpkg Log"));
             setIconSize(QSize(ICON_SIZE, ICON_SIZE));
             item->setToolTip(DApplication::translate("Tree", "dpkg Log")); // add by Airy for bug 16245
@@ -270,9 +313,7 @@ void LogListView::initUI()
         m_pModel->appendRow(item);
         m_logTypes.push_back(XORG_TREE_DATA);
     }
-    auto *appHelper = LogApplicationHelper::instance();
-    QMap<QString, QString> appMap = appHelper->getMap();
-    if (!appMap.isEmpty()) {
+    if (probe.app) {
         item = new QStandardItem(QIcon::fromTheme("dp_application"), DApplication::translate("Tree", "Application Log"));
         setIconSize(QSize(ICON_SIZE, ICON_SIZE));
         item->setToolTip(
@@ -281,7 +322,6 @@ void LogListView::initUI()
         item->setSizeHint(QSize(ITEM_WIDTH, ITEM_HEIGHT));
         item->setData(VListViewItemMargin, Dtk::MarginsRole);
         m_pModel->appendRow(item);
-        this->setModel(m_pModel);
         m_logTypes.push_back(APP_TREE_DATA);  
     }
 
@@ -297,7 +337,7 @@ void LogListView::initUI()
 
 
     // add by Airy
-    if (isFileExist("/var/log/wtmp")) {
+    if (probe.wtmp) {
         item = new QStandardItem(QIcon::fromTheme("dp_onoff"), DApplication::translate("Tree", "Boot-Shutdown Event"));
         setIconSize(QSize(ICON_SIZE, ICON_SIZE));
         item->setData(LAST_TREE_DATA, ITEM_DATE_ROLE);
@@ -306,7 +346,6 @@ void LogListView::initUI()
         item->setSizeHint(QSize(ITEM_WIDTH, ITEM_HEIGHT));
         item->setData(VListViewItemMargin, Dtk::MarginsRole);
         m_pModel->appendRow(item);
-        this->setModel(m_pModel);
         m_logTypes.push_back(LAST_TREE_DATA);
     }
 
@@ -330,6 +369,15 @@ void LogListView::initUI()
     m_pModel->appendRow(item);
     m_logTypes.push_back(AUDIT_TREE_DATA);
 
+    // 多来源合并时间线，不是单独的日志种类，不参与全部导出
+    item = new QStandardItem(QIcon::fromTheme("dp_customlog"), DApplication::translate("Tree", "Timeline"));
+    setIconSize(QSize(ICON_SIZE, ICON_SIZE));
+    item->setToolTip(DApplication::translate("Tree", "Timeline"));
+    item->setData(TIMELINE_TREE_DATA, ITEM_DATE_ROLE);
+    item->setSizeHint(QSize(ITEM_WIDTH, ITEM_HEIGHT));
+    item->setData(VListViewItemMargin, Dtk::MarginsRole);
+    m_pModel->appendRow(item);
+
     //other
     item = new QStandardItem(QIcon::fromTheme("dp_customlog", QIcon(":/customlog.svg")), DApplication::translate("Tree", "Other Log"));
     setIconSize(QSize(ICON_SIZE, ICON_SIZE));
@@ -352,7 +400,11 @@ void LogListView::initUI()
     // set first item is select when app start
     if (m_pModel->rowCount() > 0) {
         this->setCurrentIndex(m_pModel->index(0, 0));
-    }  
+    }
+
+    PERF_PRINT_END("STARTUP-CATEGORIES", QString("count=%1").arg(m_logTypes.size()));
+    m_logTypesReady = true;
+    emit logTypesReady();
 }
 
 void LogListView::initCustomLogItem()
@@ -539,7 +591,7 @@ void LogListView::showRightMenu(const QPoint &pos, bool isUsePoint)
 
         if (pathData == JOUR_TREE_DATA || pathData == LAST_TREE_DATA || pathData == BOOT_KLU_TREE_DATA
                 || pathData == OTHER_TREE_DATA || pathData == CUSTOM_TREE_DATA || pathData == AUDIT_TREE_DATA
-                || pathData == COREDUMP_TREE_DATA) {
+                || pathData == COREDUMP_TREE_DATA || pathData == TIMELINE_TREE_DATA) {
             g_clear->setEnabled(false);
             g_openForder->setEnabled(false);
         }
@@ -36,9 +36,25 @@ public:
     void setDefaultSelect();
     void truncateFile(QString path_); //add by Airy for truncate file
     QStringList getLogTypes() { return m_logTypes; }
+    // 日志种类列表是否已填充
+    bool isLogTypesReady() const { return m_logTypesReady; }
 
 private:
-    bool isFileExist(const QString &iFile);
+    /**
+     * @brief The LogTypeProbe struct 日志种类列表依赖的文件探测结果
+     */
+    struct LogTypeProbe {
+        bool journal = false;
+        bool kern = false;
+        bool kwinBoot = false;
+        bool dpkg = false;
+        bool wtmp = false;
+        bool app = false;
+    };
+    static LogTypeProbe probeLogTypes();
+    void initLogTypes(const LogTypeProbe &probe);
+
+    static bool isFileExist(const QString &iFile);
     void initCustomLogItem();
 
     QStringList getAllFiles(const QString &file);
@@ -65,6 +81,8 @@ protected:
 signals:
     void itemChanged(const QModelIndex &index);
     void sigRefresh(const QModelIndex &index); // add refresh
+    // 日志种类列表填充完成
+    void logTypesReady();
 
 private:
     QStandardItemModel *m_pModel {nullptr};
@@ -80,6 +98,9 @@ private:
     Qt::FocusReason m_reson = Qt::MouseFocusReason;
     QStringList m_logTypes;
     QStandardItem *m_customLogItem = nullptr;
+    //是否为服务器行业版或欧拉版(centos)
+    bool m_isCentos = false;
+    bool m_logTypesReady = false;
 };
 
 #endif // LOGLISTVIEW_H
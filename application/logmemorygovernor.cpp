@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logmemorygovernor.h"
+#include "DebugTimeManager.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QLoggingCategory>
+#include <QTemporaryDir>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 每个字符串除字符数据外的固定开销，包括QString本身及共享数据头
+const qint64 LOG_STRING_OVERHEAD = 32;
+// 写入磁盘的压缩数据上限，超出后最久未使用的数据直接丢弃
+const qint64 LOG_SPILL_MAX_BYTES = 512ll * 1024 * 1024;
+// 压缩级别，日志文本压缩率高，优先保证速度
+const int LOG_SPILL_COMPRESS_LEVEL = 1;
+
+LogMemoryGovernor::LogMemoryGovernor(qint64 budgetBytes)
+    : m_budget(budgetBytes)
+{
+}
+
+LogMemoryGovernor::~LogMemoryGovernor()
+{
+    clear();
+    setResidentBytes(0);
+}
+
+void LogMemoryGovernor::setBudget(qint64 budgetBytes)
+{
+    qCDebug(logApp) << "LogMemoryGovernor budget:" << budgetBytes;
+    m_budget = budgetBytes;
+    trim();
+}
+
+void LogMemoryGovernor::setResidentBytes(qint64 bytes)
+{
+    bytes = qMax(0ll, bytes);
+    PERF_ADD(PerfMemoryBytes, bytes - m_residentBytes);
+    m_residentBytes = bytes;
+    trim();
+}
+
+void LogMemoryGovernor::addResidentBytes(qint64 bytes)
+{
+    setResidentBytes(m_residentBytes + bytes);
+}
+
+void LogMemoryGovernor::insert(const QString &key, const QList<QString> &data)
+{
+    remove(key);
+
+    Entry entry;
+    entry.data = data;
+    entry.bytes = estimateBytes(data);
+    m_entries.insert(key, entry);
+    m_lru.prepend(key);
+    setMemoryBytes(m_memoryBytes + entry.bytes);
+    trim(key);
+    // 单段数据超出全部预算时也不保留在内存中
+    if (m_budget > 0 && m_residentBytes + m_memoryBytes > m_budget)
+        trim();
+}
+
+bool LogMemoryGovernor::contains(const QString &key) const
+{
+    return m_entries.contains(key);
+}
+
+bool LogMemoryGovernor::isSpilled(const QString &key) const
+{
+    auto it = m_entries.constFind(key);
+    return it != m_entries.constEnd() && !it->spillFile.isEmpty();
+}
+
+bool LogMemoryGovernor::take(const QString &key, QList<QString> &data)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return false;
+
+    if (!it->spillFile.isEmpty()) {
+        if (!rehydrate(*it)) {
+            remove(key);
+            return false;
+        }
+        setMemoryBytes(m_memoryBytes + it->bytes);
+    }
+
+    data = it->data;
+    // 数据转为当前展示的数据，不再计入缓存
+    remove(key);
+    return true;
+}
+
+void LogMemoryGovernor::clear()
+{
+    const QStringList keys = m_lru;
+    for (const QString &key : keys)
+        remove(key);
+}
+
+qint64 LogMemoryGovernor::estimateBytes(const QList<QString> &data)
+{
+    qint64 bytes = 0;
+    for (const QString &str : data)
+        bytes += LOG_STRING_OVERHEAD + static_cast<qint64>(str.capacity()) * static_cast<qint64>(sizeof(QChar));
+    return bytes;
+}
+
+void LogMemoryGovernor::remove(const QString &key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+
+    if (it->spillFile.isEmpty()) {
+        setMemoryBytes(m_memoryBytes - it->bytes);
+    } else {
+        QFile::remove(it->spillFile);
+        m_diskBytes -= it->diskBytes;
+    }
+    m_entries.erase(it);
+    m_lru.removeOne(key);
+}
+
+void LogMemoryGovernor::trim(const QString &keep)
+{
+    if (m_budget <= 0)
+        return;
+
+    // 从最久未使用的数据开始写入磁盘
+    for (int i = m_lru.size() - 1; i >= 0 && m_residentBytes + m_memoryBytes > m_budget; --i) {
+        const QString key = m_lru.at(i);
+        if (key == keep)
+            continue;
+        Entry &entry = m_entries[key];
+        if (!entry.spillFile.isEmpty())
+            continue;
+
+        const qint64 bytes = entry.bytes;
+        if (spill(key, entry)) {
+            setMemoryBytes(m_memoryBytes - bytes);
+        } else {
+            // 无法写入磁盘时直接丢弃
+            remove(key);
+        }
+    }
+    trimDisk();
+}
+
+void LogMemoryGovernor::trimDisk()
+{
+    for (int i = m_lru.size() - 1; i >= 0 && m_diskBytes > LOG_SPILL_MAX_BYTES; --i) {
+        const QString key = m_lru.at(i);
+        if (isSpilled(key)) {
+            qCDebug(logApp) << "LogMemoryGovernor drop spilled data:" << key;
+            remove(key);
+        }
+    }
+}
+
+bool LogMemoryGovernor::spill(const QString &key, Entry &entry)
+{
+    PERF_SCOPE(spillScope, PerfSpillBytes, "LogMemoryGovernor::spill");
+    if (!m_spillDir) {
+        m_spillDir.reset(new QTemporaryDir(QDir::tempPath() + "/deepin-log-viewer-XXXXXX"));
+        if (!m_spillDir->isValid()) {
+            qCWarning(logApp) << "LogMemoryGovernor failed to create spill dir:" << m_spillDir->errorString();
+            m_spillDir.reset();
+            return false;
+        }
+    }
+
+    QByteArray raw;
+    {
+        QDataStream out(&raw, QIODevice::WriteOnly);
+        out << entry.data;
+    }
+    const QByteArray compressed = qCompress(raw, LOG_SPILL_COMPRESS_LEVEL);
+
+    const QString filePath = m_spillDir->filePath(QString::number(++m_spillSerial));
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(compressed) != compressed.size()) {
+        qCWarning(logApp) << "LogMemoryGovernor failed to spill:" << key << file.errorString();
+        file.close();
+        QFile::remove(filePath);
+        return false;
+    }
+    file.close();
+
+    qCDebug(logApp) << "LogMemoryGovernor spill:" << key << "memory:" << entry.bytes << "disk:" << compressed.size();
+    PERF_SCOPE_VALUE(spillScope, compressed.size());
+    entry.data.clear();
+    entry.spillFile = filePath;
+    entry.diskBytes = compressed.size();
+    m_diskBytes += entry.diskBytes;
+    return true;
+}
+
+bool LogMemoryGovernor::rehydrate(Entry &entry)
+{
+    PERF_SCOPE(rehydrateScope, PerfSpillBytes, "LogMemoryGovernor::rehydrate");
+    QFile file(entry.spillFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(logApp) << "LogMemoryGovernor failed to open spill file:" << entry.spillFile << file.errorString();
+        return false;
+    }
+    const QByteArray raw = qUncompress(file.readAll());
+    file.close();
+
+    QList<QString> data;
+    QDataStream in(raw);
+    in >> data;
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(logApp) << "LogMemoryGovernor corrupted spill file:" << entry.spillFile;
+        return false;
+    }
+
+    PERF_SCOPE_VALUE(rehydrateScope, entry.diskBytes);
+    QFile::remove(entry.spillFile);
+    m_diskBytes -= entry.diskBytes;
+    entry.data = data;
+    entry.spillFile.clear();
+    entry.diskBytes = 0;
+    return true;
+}
+
+void LogMemoryGovernor::setMemoryBytes(qint64 bytes)
+{
+    PERF_ADD(PerfMemoryBytes, bytes - m_memoryBytes);
+    m_memoryBytes = bytes;
+}
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGMEMORYGOVERNOR_H
+#define LOGMEMORYGOVERNOR_H
+
+#include <QHash>
+#include <QList>
+#include <QScopedPointer>
+#include <QString>
+#include <QStringList>
+
+class QTemporaryDir;
+
+/**
+ * @brief The LogMemoryGovernor class 已解析日志数据的内存预算管理
+ * 内核、窗管等类型的分段数据共用一个预算，超出预算时按最近最少使用的顺序压缩写入临时目录，
+ * 再次访问时从磁盘恢复；当前展示的数据计入预算但不会被淘汰。只在界面线程使用
+ */
+class LogMemoryGovernor
+{
+public:
+    explicit LogMemoryGovernor(qint64 budgetBytes = 0);
+    ~LogMemoryGovernor();
+
+    /**
+     * @brief setBudget 设置内存预算，小于等于0时不限制
+     */
+    void setBudget(qint64 budgetBytes);
+    qint64 budget() const { return m_budget; }
+    /**
+     * @brief setResidentBytes 当前展示数据的占用，不可淘汰，只挤占缓存的预算
+     */
+    void setResidentBytes(qint64 bytes);
+    void addResidentBytes(qint64 bytes);
+
+    /**
+     * @brief insert 缓存一段数据，键已存在时替换
+     */
+    void insert(const QString &key, const QList<QString> &data);
+    bool contains(const QString &key) const;
+    /**
+     * @brief take 取出缓存的数据并从缓存中移除，已写入磁盘的数据先恢复到内存
+     * 取出的数据即将展示，由调用方计入当前展示数据的占用，避免重复计算
+     * @return 没有缓存或磁盘文件读取失败时返回false
+     */
+    bool take(const QString &key, QList<QString> &data);
+    void clear();
+
+    // 缓存在内存中的数据占用，不含当前展示的数据
+    qint64 memoryBytes() const { return m_memoryBytes; }
+    qint64 residentBytes() const { return m_residentBytes; }
+    // 已写入磁盘的压缩数据大小
+    qint64 diskBytes() const { return m_diskBytes; }
+    bool isSpilled(const QString &key) const;
+
+    /**
+     * @brief estimateBytes 估算字符串列表占用的内存
+     */
+    static qint64 estimateBytes(const QList<QString> &data);
+
+private:
+    struct Entry {
+        QList<QString> data;
+        qint64 bytes {0};
+        QString spillFile;
+        qint64 diskBytes {0};
+    };
+
+    void remove(const QString &key);
+    // 淘汰内存中最久未使用的数据，直到满足预算
+    void trim(const QString &keep = QString());
+    // 磁盘数据超出上限时删除最久未使用的
+    void trimDisk();
+    bool spill(const QString &key, Entry &entry);
+    bool rehydrate(Entry &entry);
+    void setMemoryBytes(qint64 bytes);
+
+private:
+    qint64 m_budget {0};
+    qint64 m_residentBytes {0};
+    qint64 m_memoryBytes {0};
+    qint64 m_diskBytes {0};
+    // 溢出文件的序号
+    quint64 m_spillSerial {0};
+    QHash<QString, Entry> m_entries;
+    // 使用顺序，最近使用的在前
+    QStringList m_lru;
+    QScopedPointer<QTemporaryDir> m_spillDir;
+};
+
+#endif // LOGMEMORYGOVERNOR_H
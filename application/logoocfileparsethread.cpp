@@ -5,7 +5,6 @@
 #include "logoocfileparsethread.h"
 #include "utils.h"
 #include "dbusproxy/dldbushandler.h"
-#include "sharedmemorymanager.h"
 
 #include <DMessageBox>
 
@@ -117,19 +116,9 @@ bool LogOOCFileParseThread::checkAuthentication(const QString &path)
     QFlags <QFileDevice::Permission> power = QFile::permissions(path);
     if (!power.testFlag(QFile::ReadUser)) {
         qCDebug(logApp) << "User does not have read permission, requesting elevation";
-        //若当前用户不具备读取权限，则显示提权对话框
-        //共享内存对应变量置true，允许进程内部逻辑运行
-        ShareMemoryInfo shareInfo;
-        shareInfo.isStart = true;
-        SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-        //启动日志需要提权获取，运行的时候把对应共享内存的名称传进去，方便获取进程拿标记量判断是否继续运行
-        initProccess();
-        m_process->start("pkexec", QStringList() << "logViewerAuth"
-                         << path << SharedMemoryManager::instance()->getRunnableKey());
-        m_process->waitForFinished(-1);
-        //有错则传出空数据
-        if (m_process->exitCode() != 0) {
-            qCWarning(logApp) << "Process exited with error code:" << m_process->exitCode();
+        //若当前用户不具备读取权限，则向服务端鉴权建立读取会话，会话有效期内不再重复鉴权
+        if (!DLDBusHandler::instance(this)->ensureSession()) {
+            qCWarning(logApp) << "Reader session authorization failed";
             return false;
         }
     }
@@ -193,12 +182,6 @@ void LogOOCFileParseThread::stopProccess()
     m_isStopProccess = true;
     //停止获取线程执行，标记量置false
     m_canRun = false;
-    //共享内存数据结构，用于和获取进程共享内存，数据为是否可执行进程，用于控制数据获取进程停止，因为这里会出现需要提权执行的进程，主进程没有权限停止提权进程，所以使用共享内存变量标记量控制提权进程停止
-    ShareMemoryInfo   shareInfo ;
-    //设置进程为不可执行
-    shareInfo.isStart = false;
-    //把数据付给共享内存中对应的变量
-    SharedMemoryManager::instance()->setRunnableTag(shareInfo);
     if (m_process) {
         m_process->kill();
     }
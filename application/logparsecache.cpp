@@ -0,0 +1,384 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logparsecache.h"
+#include "utils.h"
+#include "qtcompat.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QLoggingCategory>
+#include <QSaveFile>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+const quint32 LOG_PARSE_CACHE_MAGIC = 0x4c504331;
+// 缓存文件格式版本，与各解析器版本无关
+const qint32 LOG_PARSE_CACHE_FORMAT = 2;
+// 磁盘上保留的缓存文件个数
+const int LOG_PARSE_CACHE_MAX = 32;
+// 内存中保留的缓存个数
+const int LOG_PARSE_CACHE_MEMORY_MAX = 8;
+// 按偏移分块读取日志的块大小
+const qint64 LOG_PARSE_CACHE_READ_SIZE = 32 * 1024 * 1024;
+
+// 列编码方式
+enum ColumnEncoding : quint8 {
+    ColumnPlain = 0, // UTF-8拼接的数据块加每行的结束偏移
+    ColumnDict = 1 // 去重后的字典加每行的字典下标
+};
+
+LogFileIdentity LogFileIdentity::fromList(const QStringList &list)
+{
+    LogFileIdentity identity;
+    if (list.size() < 4)
+        return identity;
+
+    bool ok[4] = {false, false, false, false};
+    identity.device = list.at(0).toULongLong(&ok[0]);
+    identity.inode = list.at(1).toULongLong(&ok[1]);
+    identity.mtime = list.at(2).toLongLong(&ok[2]);
+    identity.size = list.at(3).toLongLong(&ok[3]);
+    if (!ok[0] || !ok[1] || !ok[2] || !ok[3])
+        return LogFileIdentity();
+    if (list.size() > 4)
+        identity.head = list.at(4);
+    return identity;
+}
+
+void LogCacheTable::reset(int columnCount)
+{
+    offset = 0;
+    times.clear();
+    columns = QVector<QStringList>(columnCount);
+}
+
+namespace {
+
+// 定长数值数组按本机字节序整块读写，缓存只在本机使用
+template<typename T>
+QByteArray packArray(const QVector<T> &values)
+{
+    return QByteArray(reinterpret_cast<const char *>(values.constData()), values.size() * static_cast<int>(sizeof(T)));
+}
+
+template<typename T>
+bool unpackArray(const QByteArray &data, int count, QVector<T> &values)
+{
+    if (data.size() != count * static_cast<int>(sizeof(T)))
+        return false;
+    values.resize(count);
+    if (count > 0)
+        memcpy(values.data(), data.constData(), static_cast<size_t>(data.size()));
+    return true;
+}
+
+void writeColumn(QDataStream &out, const QStringList &column)
+{
+    // 不同值不超过行数的1/4时使用字典编码，审计类型、进程名、状态等列通常只有几十个不同值
+    QHash<QString, quint32> dictIndex;
+    QList<QByteArray> dict;
+    QVector<quint32> indexes;
+    indexes.reserve(column.size());
+    const int dictLimit = column.size() / 4;
+    for (const QString &value : column) {
+        auto it = dictIndex.constFind(value);
+        if (it == dictIndex.constEnd()) {
+            if (dict.size() >= dictLimit)
+                break;
+            it = dictIndex.insert(value, static_cast<quint32>(dict.size()));
+            dict.append(value.toUtf8());
+        }
+        indexes.append(it.value());
+    }
+
+    if (indexes.size() == column.size()) {
+        out << static_cast<quint8>(ColumnDict) << dict << packArray(indexes);
+        return;
+    }
+
+    QByteArray blob;
+    QVector<quint32> ends;
+    ends.reserve(column.size());
+    for (const QString &value : column) {
+        blob.append(value.toUtf8());
+        ends.append(static_cast<quint32>(blob.size()));
+    }
+    out << static_cast<quint8>(ColumnPlain) << blob << packArray(ends);
+}
+
+bool readColumn(QDataStream &in, int rows, QStringList &column)
+{
+    quint8 encoding = 0;
+    in >> encoding;
+    column.clear();
+    column.reserve(rows);
+
+    if (ColumnDict == encoding) {
+        QList<QByteArray> dict;
+        QByteArray packed;
+        QVector<quint32> indexes;
+        in >> dict >> packed;
+        if (in.status() != QDataStream::Ok || !unpackArray(packed, rows, indexes))
+            return false;
+
+        QStringList values;
+        for (const QByteArray &value : dict)
+            values.append(QString::fromUtf8(value));
+        for (quint32 index : indexes) {
+            if (index >= static_cast<quint32>(values.size()))
+                return false;
+            column.append(values.at(static_cast<int>(index)));
+        }
+        return true;
+    }
+
+    if (ColumnPlain == encoding) {
+        QByteArray blob;
+        QByteArray packed;
+        QVector<quint32> ends;
+        in >> blob >> packed;
+        if (in.status() != QDataStream::Ok || !unpackArray(packed, rows, ends))
+            return false;
+
+        quint32 begin = 0;
+        for (quint32 end : ends) {
+            if (end < begin || end > static_cast<quint32>(blob.size()))
+                return false;
+            column.append(QString::fromUtf8(blob.constData() + begin, static_cast<int>(end - begin)));
+            begin = end;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+}
+
+LogParseCache *LogParseCache::instance()
+{
+    static LogParseCache cache;
+    return &cache;
+}
+
+LogParseCache::LogParseCache()
+    : m_cacheDir(Utils::getAppDataPath() + "/parse-cache")
+{
+}
+
+LogParseCache::Storage LogParseCache::storageFor(const QString &filePath)
+{
+    // 解析结果与原文等价，本人没有读权限的日志写入用户目录会泄露给本人
+    return QFileInfo(filePath).isReadable() ? DiskStorage : MemoryStorage;
+}
+
+void LogParseCache::setCacheDir(const QString &dir)
+{
+    QMutexLocker locker(&m_mutex);
+    m_cacheDir = dir;
+    m_memory.clear();
+    m_memoryOrder.clear();
+}
+
+LogParseCache::State LogParseCache::compare(const LogFileIdentity &cached, const LogFileIdentity &current)
+{
+    // 轮转后同名文件是新inode，原地改写的文件大小不增长，copytruncate后重新写入的文件开头不同，都需要完整解析
+    if (cached.device != current.device || cached.inode != current.inode || cached.head != current.head)
+        return Miss;
+    if (cached.mtime == current.mtime && cached.size == current.size)
+        return Hit;
+    if (current.size > cached.size && current.mtime >= cached.mtime)
+        return Grown;
+    return Miss;
+}
+
+QString LogParseCache::fileName(const QString &kind, const QString &filePath) const
+{
+    return QString("%1/%2-%3.cache").arg(m_cacheDir).arg(kind)
+        .arg(QString(QCryptographicHash::hash(filePath.toUtf8(), QCryptographicHash::Md5).toHex()));
+}
+
+LogParseCache::State LogParseCache::load(const QString &kind, int version, const QString &filePath,
+                                         const LogFileIdentity &identity, int columnCount, LogCacheTable &table,
+                                         Storage storage)
+{
+    table.reset(columnCount);
+    if (!identity.isValid())
+        return Miss;
+
+    if (MemoryStorage == storage) {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_memory.constFind(fileName(kind, filePath));
+        if (it == m_memory.constEnd() || it->version != version || it->table.columns.size() != columnCount)
+            return Miss;
+        const State state = compare(it->identity, identity);
+        if (Miss == state) {
+            qCDebug(logApp) << "Parse cache outdated:" << filePath;
+            return Miss;
+        }
+        table = it->table;
+        qCDebug(logApp) << "Parse cache" << (Hit == state ? "hit:" : "grown:") << filePath << "rows:" << table.rowCount();
+        return state;
+    }
+
+    QFile file;
+    {
+        QMutexLocker locker(&m_mutex);
+        file.setFileName(fileName(kind, filePath));
+    }
+    if (!file.open(QIODevice::ReadOnly))
+        return Miss;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_11);
+    quint32 magic = 0;
+    qint32 format = 0;
+    QString cachedKind;
+    QString cachedPath;
+    qint32 cachedVersion = 0;
+    LogFileIdentity cached;
+    qint64 offset = 0;
+    qint32 rows = 0;
+    qint32 cachedColumns = 0;
+    in >> magic >> format;
+    if (magic != LOG_PARSE_CACHE_MAGIC || format != LOG_PARSE_CACHE_FORMAT)
+        return Miss;
+    in >> cachedKind >> cachedVersion >> cachedPath >> cached.device >> cached.inode >> cached.mtime >> cached.size
+       >> cached.head >> offset >> rows >> cachedColumns;
+    if (in.status() != QDataStream::Ok || cachedKind != kind || cachedVersion != version || cachedPath != filePath
+            || cachedColumns != columnCount || rows < 0 || offset > cached.size) {
+        qCDebug(logApp) << "Parse cache header mismatch, reparsing:" << filePath;
+        return Miss;
+    }
+
+    const State state = compare(cached, identity);
+    if (Miss == state) {
+        qCDebug(logApp) << "Parse cache outdated:" << filePath;
+        return Miss;
+    }
+
+    QByteArray packedTimes;
+    in >> packedTimes;
+    bool ok = in.status() == QDataStream::Ok && unpackArray(packedTimes, rows, table.times);
+    for (int i = 0; ok && i < columnCount; ++i)
+        ok = readColumn(in, rows, table.columns[i]);
+    if (!ok) {
+        qCWarning(logApp) << "Parse cache corrupted, reparsing:" << file.fileName();
+        table.reset(columnCount);
+        return Miss;
+    }
+
+    table.offset = offset;
+    qCDebug(logApp) << "Parse cache" << (Hit == state ? "hit:" : "grown:") << filePath << "rows:" << rows << "offset:" << offset;
+    return state;
+}
+
+bool LogParseCache::save(const QString &kind, int version, const QString &filePath, const LogFileIdentity &identity,
+                         const LogCacheTable &table, Storage storage)
+{
+    if (!identity.isValid())
+        return false;
+
+    if (MemoryStorage == storage) {
+        QMutexLocker locker(&m_mutex);
+        const QString key = fileName(kind, filePath);
+        MemoryEntry entry;
+        entry.version = version;
+        entry.identity = identity;
+        entry.table = table;
+        m_memory.insert(key, entry);
+        m_memoryOrder.removeOne(key);
+        m_memoryOrder.append(key);
+        while (m_memoryOrder.size() > LOG_PARSE_CACHE_MEMORY_MAX)
+            m_memory.remove(m_memoryOrder.takeFirst());
+        return true;
+    }
+
+    QString name;
+    {
+        QMutexLocker locker(&m_mutex);
+        QDir dir;
+        if (!dir.exists(m_cacheDir) && !dir.mkpath(m_cacheDir)) {
+            qCWarning(logApp) << "Failed to create parse cache dir:" << m_cacheDir;
+            return false;
+        }
+        // 目录可能由其他途径创建，每次保存时都确保只允许本人访问
+        QFile::setPermissions(m_cacheDir, QFileDevice::ReadOwner | QFileDevice::WriteOwner | QFileDevice::ExeOwner);
+        name = fileName(kind, filePath);
+    }
+
+    QSaveFile file(name);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logApp) << "Failed to open parse cache file:" << name;
+        return false;
+    }
+    file.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner);
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_11);
+    out << LOG_PARSE_CACHE_MAGIC << LOG_PARSE_CACHE_FORMAT;
+    out << kind << static_cast<qint32>(version) << filePath << identity.device << identity.inode << identity.mtime
+        << identity.size << identity.head << table.offset << static_cast<qint32>(table.rowCount())
+        << static_cast<qint32>(table.columns.size());
+    out << packArray(table.times);
+    for (const QStringList &column : table.columns)
+        writeColumn(out, column);
+
+    if (out.status() != QDataStream::Ok || !file.commit()) {
+        qCWarning(logApp) << "Failed to write parse cache file:" << name;
+        return false;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    prune();
+    return true;
+}
+
+bool LogParseCache::update(const QString &kind, int version, const QString &filePath, const LogFileIdentity &identity,
+                           int columnCount, LogCacheTable &table, const ChunkReader &read, const LineParser &parse,
+                           const std::atomic<bool> &canRun)
+{
+    const Storage storage = storageFor(filePath);
+    load(kind, version, filePath, identity, columnCount, table, storage);
+    const qint64 startOffset = table.offset;
+
+    // 只读取到获取标识时的文件大小，保证缓存的偏移与标识一致
+    while (canRun && table.offset < identity.size) {
+        const QByteArray byte = read(table.offset, qMin(LOG_PARSE_CACHE_READ_SIZE, identity.size - table.offset));
+        if (byte.isEmpty())
+            break;
+
+        parse(QString::fromUtf8(byte).split('\n', SKIP_EMPTY_PARTS), table);
+        table.offset += byte.size();
+    }
+
+    if (0 == table.offset && identity.size > 0)
+        return false;
+    // 中途停止时已解析的整块同样有效，下次从停止处继续
+    if (table.offset != startOffset)
+        save(kind, version, filePath, identity, table, storage);
+    return true;
+}
+
+void LogParseCache::remove(const QString &kind, const QString &filePath)
+{
+    QMutexLocker locker(&m_mutex);
+    const QString key = fileName(kind, filePath);
+    m_memory.remove(key);
+    m_memoryOrder.removeOne(key);
+    QFile::remove(key);
+}
+
+void LogParseCache::prune()
+{
+    QDir dir(m_cacheDir);
+    const QFileInfoList files = dir.entryInfoList(QStringList() << "*.cache", QDir::Files, QDir::Time);
+    for (int i = LOG_PARSE_CACHE_MAX; i < files.size(); ++i)
+        QFile::remove(files.at(i).absoluteFilePath());
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGPARSECACHE_H
+#define LOGPARSECACHE_H
+
+#include <QHash>
+#include <QMutex>
+#include <QStringList>
+#include <QVector>
+
+#include <atomic>
+#include <functional>
+
+/**
+ * @brief The LogFileIdentity struct 日志文件标识，由服务端stat得到
+ */
+struct LogFileIdentity {
+    quint64 device {0};
+    quint64 inode {0};
+    qint64 mtime {-1}; // 最后修改时间，毫秒
+    qint64 size {-1};
+    // 文件开头最多4K内容的摘要，copytruncate后重新写入的文件inode不变，靠它识别；旧版本服务为空
+    QString head;
+
+    bool isValid() const { return size >= 0; }
+    // 服务端getFileIdentity返回的[设备号, inode, 修改时间, 大小, 开头摘要]
+    static LogFileIdentity fromList(const QStringList &list);
+};
+
+/**
+ * @brief The LogCacheTable struct 按列存放的解析结果，行按日志文件中的顺序排列
+ */
+struct LogCacheTable {
+    // 文件中已解析到的字节偏移，文件只追加时从这里继续解析
+    qint64 offset {0};
+    // 每行的毫秒时间戳，没有时间的记录为-1
+    QVector<qint64> times;
+    // 各字符串列，每列行数与times一致
+    QVector<QStringList> columns;
+
+    int rowCount() const { return times.size(); }
+    void reset(int columnCount);
+};
+
+/**
+ * @brief The LogParseCache class 文件类日志解析结果的磁盘缓存
+ * 以日志种类与路径区分缓存，记录设备号、inode、修改时间、大小、开头摘要与解析器版本，
+ * 全部一致时直接使用缓存；inode与开头摘要不变且文件只增长时只解析新增部分。
+ * 磁盘缓存为按列的二进制格式，重复值多的列以字典编码存放，保存在Utils::getAppDataPath()下仅本人可读的目录中；
+ * 需要提权才能读取的日志只缓存在内存中，不写入用户目录，见storageFor
+ */
+class LogParseCache
+{
+public:
+    enum State {
+        Miss = 0, // 无可用缓存，需要完整解析
+        Hit, // 文件未变化
+        Grown // 文件只追加了内容，需要从offset继续解析
+    };
+
+    enum Storage {
+        DiskStorage = 0, // 写入缓存目录，程序重启后仍可使用
+        MemoryStorage // 只保存在本进程内存中
+    };
+
+    // 按偏移读取文件中的完整行，返回空表示读取结束或不支持按偏移读取
+    typedef std::function<QByteArray(qint64 offset, qint64 maxBytes)> ChunkReader;
+    // 解析一块内容中的各行，结果按文件中的顺序追加到table
+    typedef std::function<void(const QStringList &lines, LogCacheTable &table)> LineParser;
+
+    static LogParseCache *instance();
+
+    // 本人可直接读取的日志写入磁盘缓存，需要提权读取的只保存在内存中
+    static Storage storageFor(const QString &filePath);
+
+    /**
+     * @brief load 读取缓存
+     * @param kind 日志种类
+     * @param version 解析器版本，解析逻辑或列定义变化时递增
+     * @param columnCount 字符串列数
+     * @param table 命中或增长时为缓存内容，未命中时为空表
+     */
+    State load(const QString &kind, int version, const QString &filePath, const LogFileIdentity &identity,
+               int columnCount, LogCacheTable &table, Storage storage = DiskStorage);
+    // 保存缓存，磁盘缓存先写临时文件再替换
+    bool save(const QString &kind, int version, const QString &filePath, const LogFileIdentity &identity,
+              const LogCacheTable &table, Storage storage = DiskStorage);
+    void remove(const QString &kind, const QString &filePath);
+
+    /**
+     * @brief update 读取缓存，只解析缓存之后新增的部分并写回缓存，存放位置由storageFor决定
+     * @param table 返回文件全部的解析结果，中途停止时为已解析的部分
+     * @return 没有可用缓存且服务无法按偏移读取该文件(如压缩日志)时返回false，由调用方完整读取
+     */
+    bool update(const QString &kind, int version, const QString &filePath, const LogFileIdentity &identity,
+                int columnCount, LogCacheTable &table, const ChunkReader &read, const LineParser &parse,
+                const std::atomic<bool> &canRun);
+
+    // 按缓存时与当前的文件标识判断缓存状态
+    static State compare(const LogFileIdentity &cached, const LogFileIdentity &current);
+
+    QString cacheDir() const { return m_cacheDir; }
+    void setCacheDir(const QString &dir);
+
+protected:
+    LogParseCache();
+
+private:
+    QString fileName(const QString &kind, const QString &filePath) const;
+    void prune();
+
+    struct MemoryEntry {
+        int version {0};
+        LogFileIdentity identity;
+        LogCacheTable table;
+    };
+
+    QMutex m_mutex;
+    QString m_cacheDir;
+    // 内存缓存，key与磁盘缓存文件名相同
+    QHash<QString, MemoryEntry> m_memory;
+    QStringList m_memoryOrder; // 加入顺序，超出上限时淘汰最早的
+};
+
+#endif // LOGPARSECACHE_H
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logparsescheduler.h"
+
+#include <QElapsedTimer>
+#include <QLoggingCategory>
+#include <QThread>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 读取线程数，已停止但仍在等待dbus返回的旧任务不会阻塞新任务
+const int LOG_PARSE_IO_THREADS = 4;
+// 空闲线程的保留时间，毫秒
+const int LOG_PARSE_THREAD_EXPIRY = 30000;
+
+LogParseScheduler *LogParseScheduler::instance()
+{
+    static LogParseScheduler scheduler;
+    return &scheduler;
+}
+
+LogParseScheduler::LogParseScheduler()
+{
+    m_ioPool.setMaxThreadCount(LOG_PARSE_IO_THREADS);
+    m_ioPool.setExpiryTimeout(LOG_PARSE_THREAD_EXPIRY);
+    m_cpuPool.setMaxThreadCount(qMax(2, QThread::idealThreadCount()));
+    m_cpuPool.setExpiryTimeout(LOG_PARSE_THREAD_EXPIRY);
+}
+
+void LogParseScheduler::start(QRunnable *job, Lane lane, Priority priority)
+{
+    if (!job)
+        return;
+    qCDebug(logApp) << "LogParseScheduler start job, lane:" << lane << "priority:" << priority;
+    pool(lane)->start(job, priority);
+}
+
+void LogParseScheduler::cancelPending()
+{
+    // 计算任务的结果由提交者通过QFuture等待，丢弃后永远不会完成，只能随停止标记提前返回
+    m_ioPool.clear();
+}
+
+bool LogParseScheduler::waitForDone(int msecs)
+{
+    QElapsedTimer timer;
+    timer.start();
+    if (!m_ioPool.waitForDone(msecs))
+        return false;
+    // msecs为负数时一直等待
+    return m_cpuPool.waitForDone(msecs < 0 ? -1 : qMax(0, msecs - static_cast<int>(timer.elapsed())));
+}
+
+int LogParseScheduler::activeThreadCount() const
+{
+    return m_ioPool.activeThreadCount() + m_cpuPool.activeThreadCount();
+}
+
+QThreadPool *LogParseScheduler::pool(Lane lane)
+{
+    return lane == CpuLane ? &m_cpuPool : &m_ioPool;
+}
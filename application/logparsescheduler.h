@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGPARSESCHEDULER_H
+#define LOGPARSESCHEDULER_H
+
+#include <QThreadPool>
+
+class QRunnable;
+
+/**
+ * @brief The LogParseScheduler class 日志解析任务调度
+ * 读取任务与解析计算任务分别在独立的线程池中执行，不与导出等其他任务争用全局线程池；
+ * 切换日志类型或筛选条件时直接丢弃尚未开始的任务，正在执行的任务由各自的停止标记结束
+ */
+class LogParseScheduler
+{
+public:
+    enum Lane {
+        IoLane = 0, // 读取日志的任务，大部分时间等待dbus或journal
+        CpuLane     // 解析日志内容的计算任务
+    };
+
+    enum Priority {
+        Background = 0, // 界面不展示结果的任务，如崩溃信息上报
+        Visible = 10    // 当前展示的日志类型，优先执行
+    };
+
+    static LogParseScheduler *instance();
+
+    /**
+     * @brief start 提交任务，线程池已满时排队，不会丢弃任务
+     * @param job 任务，执行完毕后按autoDelete释放
+     */
+    void start(QRunnable *job, Lane lane = IoLane, Priority priority = Visible);
+    // 丢弃读取线程池中尚未开始的任务，autoDelete的任务被直接释放
+    void cancelPending();
+    // 等待正在执行的任务结束，超时返回false
+    bool waitForDone(int msecs);
+    int activeThreadCount() const;
+
+    QThreadPool *pool(Lane lane);
+
+private:
+    LogParseScheduler();
+    Q_DISABLE_COPY(LogParseScheduler)
+
+private:
+    QThreadPool m_ioPool;
+    QThreadPool m_cpuPool;
+};
+
+#endif // LOGPARSESCHEDULER_H
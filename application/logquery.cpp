@@ -0,0 +1,754 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logquery.h"
+#include "logauththread.h"
+#include "journalwork.h"
+#include "logapplicationparsethread.h"
+#include "logapplicationhelper.h"
+#include "logbackend.h"
+#include "logfileparser.h"
+#include "logtimeline.h"
+#include "dbusproxy/dldbushandler.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QRegularExpression>
+#include <QThreadPool>
+
+#include <stdio.h>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+// 只指定一端时间时另一端的取值，解析线程的时间筛选要求起止时间都大于0
+const qint64 QUERY_TIME_MIN = 1;
+// 9999-12-31 23:59:59.999 UTC，换算为journal的微秒时间戳也不会溢出
+const qint64 QUERY_TIME_MAX = Q_INT64_C(253402300799999);
+
+LogQuery::LogQuery(QObject *parent)
+    : QObject(parent)
+{
+}
+
+LogQuery::~LogQuery()
+{
+    // 达到记录上限后解析线程可能仍在退出中，等待其结束再释放
+    if (m_authThread || m_journalWork)
+        QThreadPool::globalInstance()->waitForDone();
+    if (m_appThread)
+        m_appThread->wait();
+
+    delete m_authThread;
+    delete m_journalWork;
+    delete m_appThread;
+}
+
+void LogQuery::setTimeRange(qint64 since, qint64 until)
+{
+    m_since = since > 0 ? since : -1;
+    m_until = until > 0 ? until : -1;
+}
+
+bool LogQuery::start(const QString &type, const QString &appName, const QString &level, const QString &status,
+                     const QString &event, const QString &submodule, const QString &keyword)
+{
+    qCDebug(logApp) << "LogQuery::start called with type:" << type << "app:" << appName;
+    if (TYPE_TIMELINE == type) {
+        m_keyword = keyword;
+        return startTimeline(level, status, event, submodule);
+    }
+
+    QString error;
+    m_flag = LogBackend::type2Flag(type, error);
+    if (NONE == m_flag) {
+        qCWarning(logApp) << error;
+        return false;
+    }
+
+    if (!checkCondition(type, level, status, event))
+        return false;
+
+    if (APP == m_flag && appName.isEmpty()) {
+        qCWarning(logApp) << "Query app logs, please specify the application with '-d'.";
+        return false;
+    }
+    if (APP != m_flag && !submodule.isEmpty()) {
+        qCWarning(logApp) << QString("Query logs by %1, cannot be filtered using 'submodule' parameter.").arg(type);
+        return false;
+    }
+
+    if (m_since > 0 && m_until > 0 && m_since > m_until) {
+        qCWarning(logApp) << "invalid time range, '--since' is later than '--until'.";
+        return false;
+    }
+
+    // 解析线程的时间筛选要求两端都有效，只指定一端时补齐另一端
+    qint64 timeBegin = -1;
+    qint64 timeEnd = -1;
+    if (m_since > 0 || m_until > 0) {
+        timeBegin = m_since > 0 ? m_since : QUERY_TIME_MIN;
+        timeEnd = m_until > 0 ? m_until : QUERY_TIME_MAX;
+    }
+
+    m_keyword = keyword;
+    m_fieldNames = fieldNames(m_flag);
+    // 解析线程通过该单例读取日志，须先在主线程创建
+    DLDBusHandler::instance(this);
+
+    writeHeader();
+    if (0 == m_limit) {
+        QMetaObject::invokeMethod(this, [this]() { finish(0); }, Qt::QueuedConnection);
+        return true;
+    }
+
+    qCInfo(logApp) << "querying ..." << "type:" << type << "since:" << timeBegin << "until:" << timeEnd << "keyword:" << keyword;
+
+    switch (m_flag) {
+    case JOURNAL:
+        startJournal(timeBegin, timeEnd);
+        break;
+    case KERN: {
+        KERN_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(KERN);
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::kernData, this, [this](int, QList<LOG_MSG_JOURNAL> list) {
+            writeRecords(LogBackend::filterKern(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::kernFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("kern", false));
+    }
+    break;
+    case Dmesg: {
+        DMESG_FILTERS filter;
+        filter.levelFilter = static_cast<PRIORITY>(m_level);
+        filter.timeFilter = m_since > 0 ? m_since : 0;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(Dmesg);
+        thread->setFileterParam(filter);
+        // 内核环形缓冲区的数据按读取顺序由旧到新分批写出
+        thread->setStreamData(true);
+        connect(thread, &LogAuthThread::dmesgData, this, [this](int, QList<LOG_MSG_DMESG> list) {
+            writeRecords(LogBackend::filterDmesg(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::dmesgFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("dmesg"));
+    }
+    break;
+    case BOOT: {
+        m_bootFilter.searchstr = m_keyword;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(BOOT);
+        connect(thread, &LogAuthThread::bootData, this, [this](int, QList<LOG_MSG_BOOT> list) {
+            writeRecords(LogBackend::filterBoot(m_bootFilter, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::bootFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("boot"));
+    }
+    break;
+    case DPKG: {
+        DKPG_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(DPKG);
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::dpkgData, this, [this](int, QList<LOG_MSG_DPKG> list) {
+            writeRecords(LogBackend::filterDpkg(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::dpkgFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("dpkg"));
+    }
+    break;
+    case Dnf: {
+        DNF_FILTERS filter;
+        filter.levelfilter = m_dnfLevel;
+        filter.timeFilter = m_since > 0 ? m_since : 0;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(Dnf);
+        thread->setFileterParam(filter);
+        thread->setStreamData(true);
+        connect(thread, &LogAuthThread::dnfData, this, [this](int, QList<LOG_MSG_DNF> list) {
+            writeRecords(LogBackend::filterDnf(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::dnfFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("dnf"));
+    }
+    break;
+    case Kwin: {
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(Kwin);
+        connect(thread, &LogAuthThread::kwinData, this, [this](int, QList<LOG_MSG_KWIN> list) {
+            writeRecords(LogBackend::filterKwin(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::kwinFinished, this, [this]() { finish(0); });
+        startAuthThread(thread);
+    }
+    break;
+    case XORG: {
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(XORG);
+        connect(thread, &LogAuthThread::xorgData, this, [this](int, QList<LOG_MSG_XORG> list) {
+            writeRecords(LogBackend::filterXorg(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::xorgFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("Xorg"));
+    }
+    break;
+    case Normal: {
+        m_normalFilter.searchstr = m_keyword;
+        m_normalFilter.timeFilterBegin = timeBegin;
+        m_normalFilter.timeFilterEnd = timeEnd;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(Normal);
+        thread->setFileterParam(m_normalFilter);
+        connect(thread, &LogAuthThread::normalData, this, [this](int, QList<LOG_MSG_NORMAL> list) {
+            writeRecords(LogBackend::filterNomal(m_normalFilter, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::normalFinished, this, [this]() { finish(0); });
+        startAuthThread(thread);
+    }
+    break;
+    case Audit: {
+        m_auditFilter.searchstr = m_keyword;
+        m_auditFilter.timeFilterBegin = timeBegin;
+        m_auditFilter.timeFilterEnd = timeEnd;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(Audit);
+        thread->setFileterParam(m_auditFilter);
+        connect(thread, &LogAuthThread::auditData, this, [this](int, QList<LOG_MSG_AUDIT> list) {
+            writeRecords(LogBackend::filterAudit(m_auditFilter, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::auditFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, DLDBusHandler::instance(this)->getFileInfo("audit", false));
+    }
+    break;
+    case Auth: {
+        // 认证日志的关键字在解析线程内筛选
+        AUTH_FILTERS filter;
+        filter.searchstr = m_keyword;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(Auth);
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::authData, this, [this](int, QList<LOG_MSG_AUTH> list) {
+            writeRecords(list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::authFinished, this, [this]() { finish(0); });
+        startAuthThread(thread, LogApplicationHelper::instance()->getAuthLogList());
+    }
+    break;
+    case COREDUMP: {
+        COREDUMP_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        LogAuthThread *thread = new LogAuthThread;
+        thread->setType(COREDUMP);
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::coredumpData, this, [this](int, QList<LOG_MSG_COREDUMP> list) {
+            writeRecords(LogBackend::filterCoredump(m_keyword, list));
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::coredumpFinished, this, [this]() { finish(0); });
+        startAuthThread(thread);
+    }
+    break;
+    case APP:
+        m_appFilter.clear();
+        m_appFilter.app = appName;
+        m_appFilter.submodule = submodule;
+        m_appFilter.lvlFilter = m_level;
+        m_appFilter.timeFilterBegin = timeBegin;
+        m_appFilter.timeFilterEnd = timeEnd;
+        m_appFilter.searchstr = m_keyword;
+        if (!startApp(appName))
+            return false;
+        break;
+    default:
+        qCWarning(logApp) << QString("Query logs of %1 is not supported.").arg(type);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LogQuery::checkCondition 校验级别、状态、事件参数是否适用于当前日志种类，并转换为筛选值
+ */
+bool LogQuery::checkCondition(const QString &type, const QString &level, const QString &status, const QString &event)
+{
+    const bool levelType = (JOURNAL == m_flag || Dmesg == m_flag || Dnf == m_flag || APP == m_flag);
+    if (!level.isEmpty() && !levelType) {
+        qCWarning(logApp) << QString("Query logs by %1, cannot be filtered using 'level' parameter.").arg(type);
+        return false;
+    }
+    if (!status.isEmpty() && BOOT != m_flag) {
+        qCWarning(logApp) << QString("Query logs by %1, cannot be filtered using 'status' parameter.").arg(type);
+        return false;
+    }
+    if (!event.isEmpty() && Normal != m_flag && Audit != m_flag) {
+        qCWarning(logApp) << QString("Query logs by %1, cannot be filtered using 'event' parameter.").arg(type);
+        return false;
+    }
+
+    // 启动日志、kwin日志、Xorg日志没有可筛选的时间
+    if ((m_since > 0 || m_until > 0) && (BOOT == m_flag || Kwin == m_flag || XORG == m_flag)) {
+        qCWarning(logApp) << QString("Query logs by %1, cannot be filtered using '--since' or '--until' parameters.").arg(type);
+        return false;
+    }
+    // dmesg、dnf只支持起始时间筛选
+    if (m_until > 0 && (Dmesg == m_flag || Dnf == m_flag)) {
+        qCWarning(logApp) << QString("Query logs by %1, cannot be filtered using '--until' parameter.").arg(type);
+        return false;
+    }
+
+    if (Dnf == m_flag) {
+        m_dnfLevel = LogBackend::dnfLevel2Id(level);
+        if (DNFINVALID == m_dnfLevel) {
+            qCWarning(logApp) << "invalid 'level' parameter: " << level << "\nUSEAGE: 0(supercrit), 1(crit), 2(error), 3(warning), 4(info), 5(debug), 6(trace)";
+            return false;
+        }
+    } else if (levelType) {
+        m_level = LogBackend::level2Id(level);
+        if (-2 == m_level) {
+            qCWarning(logApp) << "invalid 'level' parameter: " << level << "\nUSEAGE: 0(emerg), 1(alert), 2(crit), 3(error), 4(warning), 5(notice), 6(info), 7(debug)";
+            return false;
+        }
+    }
+
+    if (BOOT == m_flag) {
+        m_bootFilter.statusFilter = "";
+        if (status == "ok" || status == "1") {
+            m_bootFilter.statusFilter = "OK";
+        } else if (status == "failed" || status == "2") {
+            m_bootFilter.statusFilter = "Failed";
+        } else if (!status.isEmpty() && status != "0") {
+            qCWarning(logApp) << "invalid 'status' parameter: " << status << "\nUSEAGE: 0(all), 1(ok), 2(failed)";
+            return false;
+        }
+    }
+
+    if (Normal == m_flag && !event.isEmpty()) {
+        m_normalFilter.eventTypeFilter = LogBackend::normal2eventType(event);
+        if (-1 == m_normalFilter.eventTypeFilter) {
+            qCWarning(logApp) << "invalid 'event' parameter: " << event << "\nUSEAGE: 0(all), 1(login), 2(boot), 3(shutdown)";
+            return false;
+        }
+    }
+
+    if (Audit == m_flag && !event.isEmpty()) {
+        m_auditFilter.auditTypeFilter = LogBackend::audit2eventType(event);
+        if (-1 == m_auditFilter.auditTypeFilter) {
+            qCWarning(logApp) << "invalid 'event' parameter: " << event << "\nUSEAGE: 0(all), 1(ident auth), 2(discretionary access Contro), 3(mandatory access control), 4(remote), 5(doc audit), 6(other)";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief LogQuery::startAuthThread 启动解析线程，线程对象由本类释放
+ */
+void LogQuery::startAuthThread(LogAuthThread *thread, const QStringList &filePath)
+{
+    m_authThread = thread;
+    m_authThread->setAutoDelete(false);
+    if (!filePath.isEmpty())
+        m_authThread->setFilePath(filePath);
+    connect(m_authThread, &LogAuthThread::proccessError, this, [](const QString &iError) {
+        qCWarning(logApp) << iError;
+    });
+    QThreadPool::globalInstance()->start(m_authThread);
+}
+
+void LogQuery::startJournal(qint64 timeBegin, qint64 timeEnd)
+{
+    QStringList arg;
+    if (m_level != LVALL)
+        arg.append(QString("PRIORITY=%1").arg(m_level));
+    else
+        arg.append("all");
+    // journal按微秒筛选
+    if (timeBegin > 0 && timeEnd > 0)
+        arg << QString::number(timeBegin * 1000) << QString::number(timeEnd * 1000);
+
+    m_journalWork = new journalWork;
+    m_journalWork->setAutoDelete(false);
+    m_journalWork->setArg(arg);
+    connect(m_journalWork, &journalWork::journalData, this, [this](int, QList<LOG_MSG_JOURNAL> list) {
+        writeRecords(LogBackend::filterJournal(m_keyword, list));
+    }, Qt::DirectConnection);
+    connect(m_journalWork, &journalWork::journalFinished, this, [this]() { finish(0); });
+    QThreadPool::globalInstance()->start(m_journalWork);
+}
+
+bool LogQuery::startApp(const QString &appName)
+{
+    if (!LogApplicationHelper::instance()->isAppLogConfigExist(appName)) {
+        qCWarning(logApp) << QString("unknown app:%1 is invalid.").arg(appName);
+        return false;
+    }
+
+    APP_FILTERSList filters = LogFileParser::buildAppFilters(m_appFilter);
+    if (filters.isEmpty()) {
+        qCWarning(logApp) << QString("app:%1 has no log submodule.").arg(appName);
+        return false;
+    }
+
+    m_appThread = new LogApplicationParseThread;
+    m_appThread->setFilters(filters);
+    connect(m_appThread, &LogApplicationParseThread::appData, this, [this](int, QList<LOG_MSG_APPLICATOIN> list) {
+        writeRecords(LogBackend::filterApp(m_appFilter, list));
+    }, Qt::DirectConnection);
+    // 子模块日志路径为空时解析线程也会发出appFinished，以线程退出作为查询结束
+    connect(m_appThread, &QThread::finished, this, [this]() { finish(0); });
+    m_appThread->start();
+    return true;
+}
+
+/**
+ * @brief LogQuery::startTimeline 启动多来源合并时间线，全部来源解析完成后按页归并写出
+ */
+bool LogQuery::startTimeline(const QString &level, const QString &status, const QString &event, const QString &submodule)
+{
+    if (!level.isEmpty() || !status.isEmpty() || !event.isEmpty() || !submodule.isEmpty()) {
+        qCWarning(logApp) << "Query timeline, can only be filtered using '--since' or '--until' or 'keyword' parameters.";
+        return false;
+    }
+    if (m_since > 0 && m_until > 0 && m_since > m_until) {
+        qCWarning(logApp) << "invalid time range, '--since' is later than '--until'.";
+        return false;
+    }
+
+    m_timeline = new LogTimeline(this);
+    QString error;
+    if (!m_timeline->setSources(m_sources, error)) {
+        qCWarning(logApp) << error << "\nUSEAGE: --sources system,kernel,auth,audit,dpkg,xorg,app:APPNAME";
+        return false;
+    }
+    m_timeline->setTimeRange(m_since, m_until);
+    m_timeline->setKeyword(m_keyword);
+    connect(m_timeline, &LogTimeline::sourceFinished, this, [](const QString &source, qint64 count) {
+        qCInfo(logApp) << "timeline source finished:" << source << "records:" << count;
+    });
+    connect(m_timeline, &LogTimeline::ready, this, &LogQuery::writeTimeline);
+
+    m_fieldNames = QStringList({"time", "dateTime", "source", "level", "origin", "msg"});
+    writeHeader();
+    if (0 == m_limit) {
+        QMetaObject::invokeMethod(this, [this]() { finish(0); }, Qt::QueuedConnection);
+        return true;
+    }
+
+    DLDBusHandler::instance(this);
+    m_timeline->start();
+    return true;
+}
+
+/**
+ * @brief LogQuery::writeTimeline 按页从时间线取出归并结果写出，达到记录上限时不再继续归并
+ */
+void LogQuery::writeTimeline()
+{
+    qCInfo(logApp) << "timeline ready, records:" << m_timeline->totalCount();
+    while (!m_stopped && !m_timeline->atEnd())
+        writeRecords(m_timeline->fetch(SINGLE_READ_CNT));
+    finish(0);
+}
+
+/**
+ * @brief LogQuery::writeRecords 在解析线程内格式化并写出一批记录
+ * 写出阻塞时解析线程随之阻塞，达到记录上限或写出失败时停止解析
+ */
+template<typename T>
+void LogQuery::writeRecords(const QList<T> &list)
+{
+    QMutexLocker locker(&m_writeMutex);
+    if (m_stopped || list.isEmpty())
+        return;
+
+    // 汇总模式只统计，等待本批统计完成后再继续解析，内存中同样只保留一批数据
+    if (m_histogram) {
+        m_histogram->addRecords(list);
+        m_histogram->waitForDone();
+        m_written += list.size();
+        return;
+    }
+
+    QByteArray block;
+    for (const T &msg : list) {
+        if (m_limit >= 0 && m_written >= m_limit)
+            break;
+        block += formatRecord(m_format, m_fieldNames, recordFields(msg));
+        ++m_written;
+    }
+
+    if (fwrite(block.constData(), 1, static_cast<size_t>(block.size()), stdout) != static_cast<size_t>(block.size())
+            || fflush(stdout) != 0) {
+        qCWarning(logApp) << "Failed to write query result to stdout";
+        m_writeError = true;
+    }
+
+    if (m_writeError || (m_limit >= 0 && m_written >= m_limit)) {
+        m_stopped = true;
+        stopWorker();
+        QMetaObject::invokeMethod(this, [this]() { finish(0); }, Qt::QueuedConnection);
+    }
+}
+
+void LogQuery::writeHeader()
+{
+    if (Tsv != m_format)
+        return;
+
+    QStringList names;
+    for (const QString &name : m_histogram ? m_summaryFieldNames : m_fieldNames)
+        names << escapeTsv(name);
+    const QByteArray header = names.join('\t').toUtf8() + '\n';
+    if (fwrite(header.constData(), 1, static_cast<size_t>(header.size()), stdout) != static_cast<size_t>(header.size()))
+        m_writeError = true;
+}
+
+/**
+ * @brief LogQuery::writeSummary 汇总模式结束时按时间段从早到晚输出统计，同一时间段内按数量从多到少
+ */
+void LogQuery::writeSummary()
+{
+    m_histogram->waitForDone();
+    const LogHistogram::Buckets buckets = m_histogram->buckets(m_summaryGroup);
+    QByteArray block;
+    for (auto it = buckets.constBegin(); it != buckets.constEnd(); ++it) {
+        const QString bucket = QDateTime::fromMSecsSinceEpoch(it.key()).toString("yyyy-MM-dd HH:mm:ss");
+        LogHistogram::Buckets single;
+        single.insert(it.key(), it.value());
+        for (const QPair<QString, qint64> &count : LogHistogram::keyTotals(single))
+            block += formatRecord(m_format, m_summaryFieldNames, QStringList({bucket, count.first, QString::number(count.second)}));
+    }
+    if (m_histogram->untimedCount() > 0)
+        qCInfo(logApp) << "records without time not counted in summary:" << m_histogram->untimedCount();
+
+    if (fwrite(block.constData(), 1, static_cast<size_t>(block.size()), stdout) != static_cast<size_t>(block.size())) {
+        qCWarning(logApp) << "Failed to write query summary to stdout";
+        m_writeError = true;
+    }
+}
+
+void LogQuery::stopWorker()
+{
+    if (m_timeline)
+        m_timeline->stop();
+    if (m_authThread)
+        m_authThread->stopProccess();
+    if (m_journalWork)
+        m_journalWork->stopWork();
+    if (m_appThread)
+        m_appThread->stopProccess();
+}
+
+void LogQuery::setSummary(LogHistogram::GroupBy group, qint64 span)
+{
+    if (!m_histogram)
+        m_histogram = new LogHistogram(this);
+    m_histogram->setBucketSpan(span);
+    m_summaryGroup = group;
+    m_summaryFieldNames = QStringList({"bucket", LogHistogram::groupName(group), "count"});
+}
+
+void LogQuery::finish(int exitCode)
+{
+    if (m_finished)
+        return;
+    m_finished = true;
+
+    {
+        QMutexLocker locker(&m_writeMutex);
+        m_stopped = true;
+        if (m_histogram && !m_writeError)
+            writeSummary();
+        fflush(stdout);
+    }
+    qCInfo(logApp) << "query finished, records:" << m_written;
+    emit finished(m_writeError ? 1 : exitCode);
+}
+
+qint64 LogQuery::parseTime(const QString &str, const QDateTime &now)
+{
+    const QString value = str.trimmed();
+    if (value.isEmpty())
+        return -1;
+
+    // 相对时间，表示当前时间之前的时长
+    static const QRegularExpression relativeExp("^(\\d+)([smhdw])$");
+    QRegularExpressionMatch match = relativeExp.match(value);
+    if (match.hasMatch()) {
+        const qint64 count = match.captured(1).toLongLong();
+        const QChar unit = match.captured(2).at(0);
+        qint64 secs = count;
+        if (unit == 'm')
+            secs = count * 60;
+        else if (unit == 'h')
+            secs = count * 3600;
+        else if (unit == 'd')
+            secs = count * 86400;
+        else if (unit == 'w')
+            secs = count * 7 * 86400;
+        return now.toMSecsSinceEpoch() - secs * 1000;
+    }
+
+    // 秒级时间戳
+    static const QRegularExpression epochExp("^\\d+$");
+    if (epochExp.match(value).hasMatch())
+        return value.toLongLong() * 1000;
+
+    for (const QString &format : {QString("yyyy-MM-dd HH:mm:ss"), QString("yyyy-MM-dd HH:mm")}) {
+        QDateTime dt = QDateTime::fromString(value, format);
+        if (dt.isValid())
+            return dt.toMSecsSinceEpoch();
+    }
+
+    QDate date = QDate::fromString(value, "yyyy-MM-dd");
+    if (date.isValid())
+        return QDateTime(date, QTime(0, 0)).toMSecsSinceEpoch();
+
+    QDateTime dt = QDateTime::fromString(value, Qt::ISODate);
+    if (dt.isValid())
+        return dt.toMSecsSinceEpoch();
+
+    return -1;
+}
+
+QString LogQuery::escapeTsv(const QString &field)
+{
+    QString result;
+    result.reserve(field.size());
+    for (const QChar &ch : field) {
+        if (ch == '\\')
+            result += "\\\\";
+        else if (ch == '\t')
+            result += "\\t";
+        else if (ch == '\n')
+            result += "\\n";
+        else if (ch == '\r')
+            result += "\\r";
+        else
+            result += ch;
+    }
+    return result;
+}
+
+QStringList LogQuery::fieldNames(LOG_FLAG flag)
+{
+    switch (flag) {
+    case JOURNAL:
+    case KERN:
+        return {"dateTime", "hostName", "daemonName", "daemonId", "level", "msg"};
+    case DPKG:
+        return {"dateTime", "action", "msg"};
+    case Dnf:
+    case Dmesg:
+        return {"dateTime", "level", "msg"};
+    case BOOT:
+        return {"status", "msg"};
+    case APP:
+        return {"dateTime", "subModule", "level", "src", "msg"};
+    case XORG:
+        return {"offset", "msg"};
+    case Normal:
+        return {"dateTime", "eventType", "userName", "msg"};
+    case Kwin:
+        return {"msg"};
+    case Audit:
+        return {"dateTime", "auditType", "eventType", "processName", "processId", "status", "msg"};
+    case Auth:
+        return {"dateTime", "hostName", "processName", "msg"};
+    case COREDUMP:
+        return {"dateTime", "sig", "exe", "pid", "userName", "coreFile"};
+    default:
+        return {};
+    }
+}
+
+QByteArray LogQuery::formatRecord(Format format, const QStringList &names, const QStringList &values)
+{
+    if (Tsv == format) {
+        QStringList fields;
+        for (const QString &value : values)
+            fields << escapeTsv(value);
+        return fields.join('\t').toUtf8() + '\n';
+    }
+
+    QJsonObject obj;
+    for (int i = 0; i < names.size() && i < values.size(); ++i)
+        obj.insert(names.at(i), values.at(i));
+    return QJsonDocument(obj).toJson(QJsonDocument::Compact) + '\n';
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_JOURNAL &msg)
+{
+    return {msg.dateTime, msg.hostName, msg.daemonName, msg.daemonId, msg.level, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_DPKG &msg)
+{
+    return {msg.dateTime, msg.action, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_DNF &msg)
+{
+    return {msg.dateTime, msg.level, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_DMESG &msg)
+{
+    return {msg.dateTime, msg.level, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_BOOT &msg)
+{
+    return {msg.status, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_APPLICATOIN &msg)
+{
+    return {msg.dateTime, msg.subModule, msg.level, msg.src, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_XORG &msg)
+{
+    return {msg.offset, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_NORMAL &msg)
+{
+    return {msg.dateTime, msg.eventType, msg.userName, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_KWIN &msg)
+{
+    return {msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_AUDIT &msg)
+{
+    return {msg.dateTime, msg.auditType, msg.eventType, msg.processName, msg.processId, msg.status, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_AUTH &msg)
+{
+    return {msg.dateTime, msg.hostName, msg.processName, msg.msg};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_COREDUMP &msg)
+{
+    return {msg.dateTime, msg.sig, msg.exe, msg.pid, msg.userName, msg.coreFile};
+}
+
+QStringList LogQuery::recordFields(const LOG_MSG_TIMELINE &msg)
+{
+    return {QString::number(msg.time), msg.dateTime, msg.source, msg.level, msg.origin, msg.msg};
+}
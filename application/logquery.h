@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGQUERY_H
+#define LOGQUERY_H
+
+#include "structdef.h"
+#include "loghistogram.h"
+
+#include <QDateTime>
+#include <QMutex>
+#include <QObject>
+
+class LogAuthThread;
+class journalWork;
+class LogApplicationParseThread;
+class LogTimeline;
+
+/**
+ * @brief The LogQuery class 命令行查询模式，解析指定种类的日志并将匹配记录流式写到标准输出
+ * 直接驱动各解析线程，数据信号以直连方式在解析线程内格式化并写出，不经过界面模型与主线程事件队列，
+ * 标准输出阻塞时解析线程随之等待，内存中最多只保留一批数据
+ */
+class LogQuery : public QObject
+{
+    Q_OBJECT
+public:
+    enum Format {
+        JsonLines = 0, // 每行一个JSON对象
+        Tsv // 制表符分隔，首行为字段名
+    };
+
+    explicit LogQuery(QObject *parent = nullptr);
+    ~LogQuery() override;
+
+    void setFormat(Format format) { m_format = format; }
+    // 最多输出的记录数，小于0不限制
+    void setLimit(qint64 limit) { m_limit = limit; }
+    // 时间范围，毫秒时间戳，小于等于0表示该端不限制
+    void setTimeRange(qint64 since, qint64 until);
+    // 合并时间线的来源，type为timeline时使用，格式见LogTimeline::setSources
+    void setSources(const QString &sources) { m_sources = sources; }
+    // 汇总模式，不输出记录，结束时按时间段输出各分组的记录数
+    void setSummary(LogHistogram::GroupBy group, qint64 span);
+
+    /**
+     * @brief start 校验查询条件并启动解析，解析结束或达到记录上限时发出finished信号
+     * @param type 日志种类，与导出的-t参数一致，timeline为多来源合并时间线
+     * @param appName 应用名，type为app时必须指定
+     * @param level 级别，适用于system、dmesg、dnf、app
+     * @param status 状态，适用于boot
+     * @param event 事件类型，适用于boot-shutdown-event、audit
+     * @param submodule 应用子模块，适用于app
+     * @param keyword 关键字
+     * @return 条件无效或该种类不支持查询时返回false
+     */
+    bool start(const QString &type, const QString &appName, const QString &level, const QString &status,
+               const QString &event, const QString &submodule, const QString &keyword);
+
+    qint64 recordCount() const { return m_written; }
+
+    /**
+     * @brief parseTime 解析--since/--until参数
+     * 支持相对时间(如30m、12h、3d、1w，表示距当前的时长)、秒级时间戳、yyyy-MM-dd [HH:mm[:ss]]与ISO 8601格式
+     * @return 毫秒时间戳，无法解析时返回-1
+     */
+    static qint64 parseTime(const QString &str, const QDateTime &now = QDateTime::currentDateTime());
+    // 转义TSV字段中的反斜杠、制表符与换行
+    static QString escapeTsv(const QString &field);
+    // 日志种类对应输出的字段名，与recordFields的字段顺序一致
+    static QStringList fieldNames(LOG_FLAG flag);
+    // 按输出格式将一条记录格式化为一行，包含结尾换行符
+    static QByteArray formatRecord(Format format, const QStringList &names, const QStringList &values);
+
+    static QStringList recordFields(const LOG_MSG_JOURNAL &msg);
+    static QStringList recordFields(const LOG_MSG_DPKG &msg);
+    static QStringList recordFields(const LOG_MSG_DNF &msg);
+    static QStringList recordFields(const LOG_MSG_DMESG &msg);
+    static QStringList recordFields(const LOG_MSG_BOOT &msg);
+    static QStringList recordFields(const LOG_MSG_APPLICATOIN &msg);
+    static QStringList recordFields(const LOG_MSG_XORG &msg);
+    static QStringList recordFields(const LOG_MSG_NORMAL &msg);
+    static QStringList recordFields(const LOG_MSG_KWIN &msg);
+    static QStringList recordFields(const LOG_MSG_AUDIT &msg);
+    static QStringList recordFields(const LOG_MSG_AUTH &msg);
+    static QStringList recordFields(const LOG_MSG_COREDUMP &msg);
+    static QStringList recordFields(const LOG_MSG_TIMELINE &msg);
+
+signals:
+    /**
+     * @brief finished 查询结束
+     * @param exitCode 0为正常结束(包括达到记录上限)，写标准输出失败时为1
+     */
+    void finished(int exitCode);
+
+private:
+    bool checkCondition(const QString &type, const QString &level, const QString &status, const QString &event);
+    void startAuthThread(LogAuthThread *thread, const QStringList &filePath = QStringList());
+    void startJournal(qint64 timeBegin, qint64 timeEnd);
+    bool startApp(const QString &appName);
+    bool startTimeline(const QString &level, const QString &status, const QString &event, const QString &submodule);
+    void writeTimeline();
+
+    template<typename T>
+    void writeRecords(const QList<T> &list);
+    void writeHeader();
+    void writeSummary();
+    void stopWorker();
+    void finish(int exitCode);
+
+private:
+    LOG_FLAG m_flag {NONE};
+    Format m_format {JsonLines};
+    qint64 m_limit {-1};
+    qint64 m_since {-1};
+    qint64 m_until {-1};
+    QStringList m_fieldNames;
+
+    QString m_keyword;
+    int m_level {LVALL};
+    DNFPRIORITY m_dnfLevel {DNFLVALL};
+    BOOT_FILTERS m_bootFilter;
+    NORMAL_FILTERS m_normalFilter;
+    AUDIT_FILTERS m_auditFilter;
+    APP_FILTERS m_appFilter;
+
+    // 各解析对象由本类持有，结束时等待线程退出后释放
+    LogAuthThread *m_authThread {nullptr};
+    journalWork *m_journalWork {nullptr};
+    LogApplicationParseThread *m_appThread {nullptr};
+    QString m_sources;
+    LogTimeline *m_timeline {nullptr};
+    // 汇总模式下的统计，为空时直接输出记录
+    LogHistogram *m_histogram {nullptr};
+    LogHistogram::GroupBy m_summaryGroup {LogHistogram::GroupLevel};
+    QStringList m_summaryFieldNames;
+
+    // 保护写出与计数，数据在解析线程内写出
+    QMutex m_writeMutex;
+    qint64 m_written {0};
+    bool m_stopped {false};
+    bool m_writeError {false};
+    bool m_finished {false};
+};
+
+#endif // LOGQUERY_H
@@ -5,8 +5,6 @@
 #include "logsegementexportthread.h"
 #include "utils.h"
 #include "xlsxwriter.h"
-#include "WordProcessingMerger.h"
-#include "WordProcessingCompiler.h"
 #include "dbusproxy/dldbushandler.h"
 
 #include <DApplication>
@@ -53,12 +51,42 @@ void LogSegementExportThread::setParameter(const QString &fileName, const QList<
 {
     qCDebug(logApp) << "Setting export parameters, file:" << fileName << "log count:" << jList.count() << "flag:" << flag;
 
+    Segement segement;
+    segement.jsonList = jList;
     QMutexLocker locker(&mutex);
+    setExportInfo(fileName, lables, flag);
+    enqueue(segement);
+}
+
+void LogSegementExportThread::setParameter(const QString &fileName, const QList<LOG_MSG_BASE> &records, const QStringList &lables, LOG_FLAG flag)
+{
+    qCDebug(logApp) << "Setting export parameters, file:" << fileName << "record count:" << records.count() << "flag:" << flag;
+
+    Segement segement;
+    segement.records = records;
+    QMutexLocker locker(&mutex);
+    setExportInfo(fileName, lables, flag);
+    enqueue(segement);
+}
+
+/**
+ * @brief LogSegementExportThread::setExportInfo 设置导出文件与导出类型，调用时需持有锁
+ * 仅在首段加入队列前设置一次，写入线程取到首段后只读，不会与写入并发修改
+ */
+void LogSegementExportThread::setExportInfo(const QString &fileName, const QStringList &lables, LOG_FLAG flag)
+{
+    if (m_bExportInfoSet) {
+        if (fileName != m_fileName || flag != m_flag || lables != m_labels)
+            qCWarning(logApp) << "Segement export info already set, ignore changes, file:" << fileName << "flag:" << flag;
+        return;
+    }
+    if (m_bForceStop)
+        return;
+
+    m_bExportInfoSet = true;
     m_fileName = fileName;
-    m_logDataList = jList;
     m_flag = flag;
     m_labels = lables;
-    m_bForceStop = false;
     if (m_fileName.endsWith(".txt")) {
         qCDebug(logApp) << "Export mode set to TXT";
         m_runMode = Txt;
@@ -68,7 +96,7 @@ void LogSegementExportThread::setParameter(const QString &fileName, const QList<
     } else if (fileName.endsWith(".doc")) {
         qCDebug(logApp) << "Export mode set to DOC";
         m_runMode = Doc;
-        if (!m_pDocMerger) {
+        if (!m_docWriter.isOpen()) {
             qCDebug(logApp) << "Initializing DOC merger";
             initDoc();
         }
@@ -80,26 +108,58 @@ void LogSegementExportThread::setParameter(const QString &fileName, const QList<
             initXls();
         }
     }
+}
+
+/**
+ * @brief LogSegementExportThread::enqueue 加入一段待写入数据，调用时需持有锁
+ * 调用方应先通过isQueueFull判断队列是否有空位，超出上限时仍会加入，避免丢失数据
+ */
+void LogSegementExportThread::enqueue(const Segement &segement)
+{
+    if (m_bForceStop || m_bFailed) {
+        qCDebug(logApp) << "Export stopped or failed, segement dropped";
+        return;
+    }
+    if (segement.jsonList.isEmpty() && segement.records.isEmpty())
+        return;
+
+    if (m_segementQueue.size() >= SEGEMENT_EXPORT_QUEUE_SIZE)
+        qCWarning(logApp) << "Segement export queue is full, size:" << m_segementQueue.size();
+    m_segementQueue.enqueue(segement);
     condition.wakeOne();
 }
 
+/**
+ * @brief LogSegementExportThread::isQueueFull 待写入的分段数是否已达上限
+ */
+bool LogSegementExportThread::isQueueFull()
+{
+    QMutexLocker locker(&mutex);
+    // 写入失败后不再接收数据，无需等待
+    if (m_bFailed)
+        return false;
+    return m_segementQueue.size() >= SEGEMENT_EXPORT_QUEUE_SIZE;
+}
+
 void LogSegementExportThread::initDoc()
 {
     qCDebug(logApp) << "Initializing DOC export";
-    QString tempdir = getDocTemplatePath();
-    if (tempdir.isEmpty()) {
-        qCWarning(logApp) << "DOC template path is empty, initialization failed";
+    int columnCount = 0;
+    if (m_flag == KERN) {
+        columnCount = 4;
+    } else if (m_flag == Kwin) {
+        columnCount = 1;
+    } else {
+        qCWarning(logApp) << "exportToDoc type is Wrong!";
         return;
     }
 
-    m_pDocMerger = &DocxFactory:: WordProcessingMerger::getInstance();
-    m_pDocMerger->load(tempdir.toStdString());
-    qCDebug(logApp) << "DOC template loaded from:" << tempdir;
-    //往表头中添加表头描述，表头为第一行，数据则在下面
-    for (int col = 0; col < m_labels.count(); ++col) {
-        m_pDocMerger->setClipboardValue("tableRow", QString("column%1").arg(col + 1).toStdString(), m_labels.at(col).toStdString());
+    if (!m_docWriter.open(m_fileName, columnCount)) {
+        qCWarning(logApp) << "DOC export file open failed:" << m_fileName;
+        return;
     }
-    m_pDocMerger->paste("tableRow");
+    //表头为第一行，数据则在下面
+    m_docWriter.writeRow(m_labels, true);
     qCDebug(logApp) << "DOC headers initialized with" << m_labels.count() << "columns";
 }
 
@@ -118,37 +178,14 @@ void LogSegementExportThread::initXls()
     qCDebug(logApp) << "XLS workbook initialized with" << m_labels.count() << "columns";
 }
 
-QString LogSegementExportThread::getDocTemplatePath()
-{
-    qCDebug(logApp) << "Getting DOC template path for flag:" << m_flag;
-    QString tempdir("");
-    if (m_flag == KERN) {
-        tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/4column.dfw";
-        qCDebug(logApp) << "Using KERN template path";
-    } else if (m_flag == Kwin) {
-        tempdir = "/usr/share/deepin-log-viewer/DocxTemplate/1column.dfw";
-        qCDebug(logApp) << "Using Kwin template path";
-    } else {
-        qCWarning(logApp) << "exportToDoc type is Wrong!";
-        return "";
-    }
-    if (!QFile(tempdir).exists()) {
-        qCWarning(logApp) << "export docx template is not exisits:" << tempdir;
-        return "";
-    }
-
-    qCDebug(logApp) << "DOC template path found:" << tempdir;
-    return tempdir;
-}
-
 /**
  * @brief LogSegementExportThread::isProcessing 返回当前线程获取数据逻辑启动停止控制的变量
  * @return 当前线程获取数据逻辑启动停止控制的变量
  */
 bool LogSegementExportThread::isProcessing()
 {
-    qCDebug(logApp) << "Checking processing status, force stop:" << m_bForceStop;
-    return !m_bForceStop;
+    qCDebug(logApp) << "Checking processing status, force stop:" << m_bForceStop << "failed:" << m_bFailed;
+    return !m_bForceStop && !m_bFailed;
 }
 
 /**
@@ -159,6 +196,7 @@ void LogSegementExportThread::stopImmediately()
     qCDebug(logApp) << "Stopping export thread immediately";
     QMutexLocker locker(&mutex);
     m_bForceStop = true;
+    m_segementQueue.clear();
     condition.wakeOne();
 }
 
@@ -180,46 +218,89 @@ void LogSegementExportThread::run()
 {
     qCDebug(logApp) << "threadrun";
 
-    QMutexLocker locker(&mutex);
-    while(!m_bForceStop && !m_bStop) {
-        if (m_logDataList.isEmpty()) {
-            condition.wait(&mutex);
-        } else {
-            try {
-                switch (m_runMode) {
-                case Txt: {
-                    exportTxt();
-                    break;
-                }
-                case Html:{
-                    exportHtml();
-                    break;
-                }
-                case Doc: {
-                    exportToDoc();
-                    break;
-                }
-                case Xls: {
-                    exportToXls();
-                    break;
-                }
-                default:
-                    break;
-                }
+    while (!m_bForceStop) {
+        // 队首的一段写完后才出队，写入期间不持有锁，解析线程可继续加入下一段
+        Segement segement;
+        {
+            QMutexLocker locker(&mutex);
+            while (m_segementQueue.isEmpty() && !m_bStop && !m_bForceStop)
+                condition.wait(&mutex);
+            // 正常停止时先写完队列中剩余的数据
+            if (m_bForceStop || m_segementQueue.isEmpty())
+                break;
+            segement = m_segementQueue.head();
+        }
+
+        // json格式数据在导出线程中解析，不占用界面线程
+        QList<LOG_MSG_BASE> records = segement.records;
+        for (const QString &data : segement.jsonList) {
+            LOG_MSG_BASE message;
+            message.fromJson(data);
+            records.append(message);
+        }
+
+        bool bOk = false;
+        try {
+            switch (m_runMode) {
+            case Txt: {
+                bOk = exportTxt(records);
+                break;
+            }
+            case Html:{
+                bOk = exportHtml(records);
+                break;
+            }
+            case Doc: {
+                bOk = exportToDoc(records);
+                break;
+            }
+            case Xls: {
+                bOk = exportToXls(records);
+                break;
+            }
+            default:
+                qCWarning(logApp) << "Unknown export mode:" << m_runMode;
+                emit sigError(m_openErroStr);
+                break;
+            }
+            if (bOk)
                 emit sigProgress(++m_nCurProcess, m_nTotalProcess);
-                m_logDataList.clear();
-            } catch (const QString &ErrorStr) {
-                // 捕获到异常，导出失败，发出失败信号
-                qCWarning(logApp) << "Export Stop" << ErrorStr;
-                emit sigResult(false);
-                if (ErrorStr != m_forceStopStr) {
-                    emit sigError(QString("export error: %1").arg(ErrorStr));
-                }
+        } catch (const QString &ErrorStr) {
+            // 捕获到异常，导出失败，失败信号在退出循环后统一发出
+            qCWarning(logApp) << "Export Stop" << ErrorStr;
+            if (ErrorStr != m_forceStopStr) {
+                emit sigError(QString("export error: %1").arg(ErrorStr));
             }
         }
+
+        {
+            QMutexLocker locker(&mutex);
+            if (!m_segementQueue.isEmpty())
+                m_segementQueue.dequeue();
+            // 写入失败后不再写入后续各段，丢弃已排队的数据
+            if (!bOk && !m_bForceStop) {
+                m_bFailed = true;
+                m_segementQueue.clear();
+            }
+        }
+        if (m_bFailed)
+            break;
+        emit sigSegementDone();
+    }
+
+    {
+        QMutexLocker locker(&mutex);
+        m_segementQueue.clear();
     }
 
-    if (!m_bForceStop) {
+    if (m_bFailed) {
+        qCWarning(logApp) << "Segement export failed, file:" << m_fileName;
+        emit sigResult(false);
+        // 调用方仍持有本对象指针，等待stop后再退出，避免线程自动析构后被访问
+        QMutexLocker locker(&mutex);
+        while (!m_bStop && !m_bForceStop)
+            condition.wait(&mutex);
+    } else if (!m_bForceStop) {
         // 保存数据
         switch (m_runMode) {
         case Doc: 
@@ -238,16 +319,24 @@ void LogSegementExportThread::run()
         Utils::sleep(200);
     }
 
-    emit sigResult(!m_bForceStop);
+    if (!m_bFailed)
+        emit sigResult(!m_bForceStop);
 
-    if (m_bForceStop) {
+    if (m_bForceStop || m_bFailed) {
+        if (m_docWriter.isOpen())
+            m_docWriter.abort();
+        if (m_pWorkbook) {
+            workbook_close(m_pWorkbook);
+            m_pWorkbook = nullptr;
+            m_pWorksheet = nullptr;
+        }
         Utils::checkAndDeleteDir(m_fileName);
     }
 
     m_bForceStop = false;
 }
 
-bool LogSegementExportThread::exportTxt()
+bool LogSegementExportThread::exportTxt(const QList<LOG_MSG_BASE> &records)
 {
     qCDebug(logApp) << "Starting text export to file:" << m_fileName;
 
@@ -260,7 +349,7 @@ bool LogSegementExportThread::exportTxt()
 
     QTextStream out(&fi);
 
-    for (int i = 0; i < m_logDataList.count(); i++) {
+    for (int i = 0; i < records.count(); i++) {
         //导出逻辑启动停止控制，外部把m_forceStopStr置true时停止运行，抛出异常处理
         if (m_bForceStop) {
             fi.close();
@@ -268,8 +357,7 @@ bool LogSegementExportThread::exportTxt()
         }
 
         int col = 0;
-        LOG_MSG_BASE jMsg;
-        jMsg.fromJson(m_logDataList[i]);
+        const LOG_MSG_BASE &jMsg = records.at(i);
         if (m_flag == KERN) {
             out << m_labels.value(col++, "") << ":" << jMsg.dateTime << " ";
             out << m_labels.value(col++, "") << ":" << jMsg.hostName << " ";
@@ -294,7 +382,7 @@ bool LogSegementExportThread::exportTxt()
     return true;
 }
 
-bool LogSegementExportThread::exportHtml()
+bool LogSegementExportThread::exportHtml(const QList<LOG_MSG_BASE> &records)
 {
     qCDebug(logApp) << "Starting HTML export to file:" << m_fileName;
 
@@ -321,13 +409,12 @@ bool LogSegementExportThread::exportHtml()
     //根据字段拼出每行的网页内容
     html.write("</tr>");
 
-    for (int row = 0; row < m_logDataList.count(); ++row) {
+    for (int row = 0; row < records.count(); ++row) {
         if (m_bForceStop) {
             html.close();
             throw  QString(m_forceStopStr);
         }
-        LOG_MSG_BASE jMsg;
-        jMsg.fromJson(m_logDataList.at(row));
+        LOG_MSG_BASE jMsg = records.at(row);
         htmlEscapeCovert(jMsg.msg);
         html.write("<tr>");
         if (m_flag == KERN) {
@@ -357,49 +444,53 @@ bool LogSegementExportThread::exportHtml()
     return true;
 }
 
-bool LogSegementExportThread::exportToDoc()
+bool LogSegementExportThread::exportToDoc(const QList<LOG_MSG_BASE> &records)
 {
     qCDebug(logApp) << "Starting DOC export to file:" << m_fileName;
 
-    if (!m_pDocMerger)
+    if (!m_docWriter.isOpen()) {
+        emit sigError(m_openErroStr);
         return false;
+    }
 
-    for (int row = 0; row < m_logDataList.count(); ++row) {
+    for (int row = 0; row < records.count(); ++row) {
         //导出逻辑启动停止控制，外部把m_forceStopStr置true时停止运行，抛出异常处理
         if (m_bForceStop) {
             throw  QString(m_forceStopStr);
         }
-        LOG_MSG_BASE message;
-        message.fromJson(m_logDataList.at(row));
+        const LOG_MSG_BASE &message = records.at(row);
         //把数据填入表格单元格中
         if (m_flag == KERN) {
-            m_pDocMerger->setClipboardValue("tableRow", QString("column1").toStdString(), message.dateTime.toStdString());
-            m_pDocMerger->setClipboardValue("tableRow", QString("column2").toStdString(), message.hostName.toStdString());
-            m_pDocMerger->setClipboardValue("tableRow", QString("column3").toStdString(), message.daemonName.toStdString());
-            m_pDocMerger->setClipboardValue("tableRow", QString("column4").toStdString(), message.msg.toStdString());
+            m_docWriter.appendCell(message.dateTime);
+            m_docWriter.appendCell(message.hostName);
+            m_docWriter.appendCell(message.daemonName);
+            m_docWriter.appendCell(message.msg);
         } else if (m_flag == Kwin) {
-            m_pDocMerger->setClipboardValue("tableRow", QString("column1").toStdString(), message.msg.toStdString());
+            m_docWriter.appendCell(message.msg);
+        }
+        if (!m_docWriter.endRow()) {
+            throw QString("write doc file failed");
         }
-        m_pDocMerger->paste("tableRow");
     }
 
     qCDebug(logApp) << "DOC export completed successfully";
     return true;
 }
 
-bool LogSegementExportThread::exportToXls()
+bool LogSegementExportThread::exportToXls(const QList<LOG_MSG_BASE> &records)
 {
     qCDebug(logApp) << "Starting XLS export to file:" << m_fileName;
 
-    if (!m_pWorksheet)
+    if (!m_pWorksheet) {
+        emit sigError(m_openErroStr);
         return false;
+    }
 
-    for (int row = 0; row < m_logDataList.count() ; ++row) {
+    for (int row = 0; row < records.count() ; ++row) {
         if (m_bForceStop) {
             throw  QString(m_forceStopStr);
         }
-        LOG_MSG_BASE message;
-        message.fromJson(m_logDataList.at(row));
+        const LOG_MSG_BASE &message = records.at(row);
         int col = 0;
 
         if (m_flag == KERN) {
@@ -432,15 +523,10 @@ void LogSegementExportThread::htmlEscapeCovert(QString &htmlMsg)
 void LogSegementExportThread::saveDoc()
 {
     qCDebug(logApp) << "Saving DOC export to file:" << m_fileName;
-    //保存，把拼好的xml写入文件中
-    QString fileNamex = m_fileName + "x";
-
-    QFile rsNameFile(m_fileName) ;
-    if (rsNameFile.exists()) {
-        rsNameFile.remove();
+    //表格各行已随导出写入，只需写入文档结尾
+    if (!m_docWriter.close()) {
+        emit sigError(QString("export error: %1").arg("write doc file failed"));
     }
-    m_pDocMerger->save(fileNamex.toStdString());
-    QFile(fileNamex).rename(m_fileName);
 }
 
 void LogSegementExportThread::closeXls()
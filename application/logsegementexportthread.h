@@ -5,14 +5,20 @@
 #ifndef LOGSEGEMENTEXPORTTHREAD_H
 #define LOGSEGEMENTEXPORTTHREAD_H
 #include "structdef.h"
-#include "WordProcessingMerger.h"
+#include "docxstreamwriter.h"
 #include "workbook.h"
 
 #include <QRunnable>
 #include <QObject>
 #include <QMutex>
+#include <QQueue>
 #include <QWaitCondition>
 
+#include <atomic>
+
+// 待写入的分段数上限，含正在写入的一段，解析下一段与写入当前段并行进行
+const int SEGEMENT_EXPORT_QUEUE_SIZE = 2;
+
 /**
  * @brief The LogSegementExportThread class 导出日志线程类
  */
@@ -34,8 +40,11 @@ public:
         Xls
     };
 
-    // 设置导出数据
+    // 设置导出数据，json格式数据在导出线程中解析
+    // 导出文件、表头与日志类型以首段为准，之后各段沿用，写入期间不再变化
     void setParameter(const QString &fileName, const QList<QString> &jList, const QStringList& lables, LOG_FLAG flag);
+    // 设置导出数据，解析线程直接产出的结构体数据，不经过json序列化
+    void setParameter(const QString &fileName, const QList<LOG_MSG_BASE> &records, const QStringList& lables, LOG_FLAG flag);
     // 设置是否追加写入QFile
     void enableAppendWrite(const bool &bEnable = true) { m_bAppendWrite = bEnable; }
     // 设置进度条总值
@@ -43,6 +52,8 @@ public:
 
     // 判断是否正在运行
     bool isProcessing();
+    // 待写入的分段数是否已达上限，已满时应暂停解析下一段，待sigSegementDone后继续
+    bool isQueueFull();
 
 public slots:
     // 正常停止，保存数据到文件
@@ -66,20 +77,34 @@ signals:
      */
     void sigResult(bool isSuccess);
     void sigProcessFull();
+    /**
+     * @brief sigSegementDone 一段数据写入完成，队列腾出空位
+     */
+    void sigSegementDone();
     /**
      * @brief sigError 导出失败
      * @param iError 失败信息
      */
     void sigError(QString iError);
 private:
+    /**
+     * @brief The Segement struct 一段待写入的数据，二者只有一个非空
+     */
+    struct Segement {
+        QList<QString> jsonList;
+        QList<LOG_MSG_BASE> records;
+    };
+
+    void setExportInfo(const QString &fileName, const QStringList &lables, LOG_FLAG flag);
+    void enqueue(const Segement &segement);
+
     void initDoc();
-    QString getDocTemplatePath();
     void initXls();
 
-    bool exportTxt();
-    bool exportHtml();
-    bool exportToDoc();
-    bool exportToXls();
+    bool exportTxt(const QList<LOG_MSG_BASE> &records);
+    bool exportHtml(const QList<LOG_MSG_BASE> &records);
+    bool exportToDoc(const QList<LOG_MSG_BASE> &records);
+    bool exportToXls(const QList<LOG_MSG_BASE> &records);
 
     void htmlEscapeCovert(QString &htmlMsg);
 
@@ -97,12 +122,13 @@ private:
     LOG_FLAG m_flag = NONE;
     //如果导出项文本标题
     QStringList m_labels;
-    // 通用json格式日志数据
-    QList<QString> m_logDataList;
+    // 待写入的分段数据，队首为正在写入的一段
+    QQueue<Segement> m_segementQueue;
     //当前线程执行的逻辑种类
     RUN_MODE m_runMode = UnKnown;
 
-    DocxFactory::WordProcessingMerger *m_pDocMerger { nullptr };
+    // doc格式逐段写入，各段共用一个文件
+    DocxStreamWriter m_docWriter;
     lxw_workbook  *m_pWorkbook { nullptr };
     lxw_worksheet *m_pWorksheet { nullptr };
     qint64 m_currentXlsRow { 0 };
@@ -115,8 +141,12 @@ private:
     QMutex mutex;
     QWaitCondition condition;
     bool m_bStop { false };
-    // 用来强制停止线程
-    bool m_bForceStop { false };
+    // 用来强制停止线程，写入时不持有锁，需原子访问
+    std::atomic_bool m_bForceStop { false };
+    // 某段写入失败，后续各段不再写入
+    std::atomic_bool m_bFailed { false };
+    // 导出文件、表头与日志类型已设置，之后只读
+    bool m_bExportInfoSet { false };
 
     int m_nCurProcess { 0 };
     int m_nTotalProcess { 0 };
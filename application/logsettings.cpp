@@ -17,6 +17,10 @@ Q_DECLARE_LOGGING_CATEGORY(logApp)
 
 #define MAINWINDOW_HEIGHT_NAME "logMainWindowHeightName"
 #define MAINWINDOW_WIDTH_NAME "logMainWindowWidthName"
+#define MEMORY_BUDGET_NAME "logMemoryBudgetMB"
+// 已解析日志缓存的默认内存预算及最小预算，MB
+#define MEMORY_BUDGET_DEFAULT 256
+#define MEMORY_BUDGET_MIN 16
 
 std::atomic<LogSettings *> LogSettings::m_instance;
 std::mutex LogSettings::m_mutex;
@@ -93,6 +97,25 @@ void LogSettings::saveConfigWinSize(int w, int h)
     m_winInfoConfig->sync();
 }
 
+/**
+ * @brief LogSettings::getMemoryBudget 通过配置文件获取已解析日志缓存的内存预算
+ * @return 内存预算，字节
+ */
+qint64 LogSettings::getMemoryBudget()
+{
+    int budgetMB = MEMORY_BUDGET_DEFAULT;
+    QVariant tempBudget = m_winInfoConfig->value(MEMORY_BUDGET_NAME);
+    if (tempBudget.isValid()) {
+        bool ok = false;
+        int value = tempBudget.toInt(&ok);
+        if (ok)
+            budgetMB = value > MEMORY_BUDGET_MIN ? value : MEMORY_BUDGET_MIN;
+    }
+
+    qCDebug(logApp) << "Memory budget (MB):" << budgetMB;
+    return static_cast<qint64>(budgetMB) * 1024 * 1024;
+}
+
 QMap<QString, QStringList> LogSettings::loadAuditMap()
 {
     qCDebug(logApp) << "Loading audit rules from:" << AUDIT_CONFIG_PATH;
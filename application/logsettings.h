@@ -58,6 +58,10 @@ public:
     void saveConfigWinSize(int w, int h);
     void saveLogDir(const QString &iKey, const QString &iDir);
     QString getLogDir(const QString &iKey);
+    /**
+     * @brief getMemoryBudget 已解析日志缓存的内存预算，单位字节，在窗口配置文件中按MB配置
+     */
+    qint64 getMemoryBudget();
 
     // 审计类型与事件类型映射表
     static QMap<QString, QStringList> loadAuditMap();
@@ -0,0 +1,634 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logtimeline.h"
+#include "logauththread.h"
+#include "journalwork.h"
+#include "logapplicationparsethread.h"
+#include "logapplicationhelper.h"
+#include "logbackend.h"
+#include "logfileparser.h"
+#include "qtcompat.h"
+#include "dbusproxy/dldbushandler.h"
+
+#include <QDateTime>
+#include <QDBusPendingCallWatcher>
+#include <QLocale>
+#include <QLoggingCategory>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <limits>
+
+#include <sys/sysinfo.h>
+
+Q_DECLARE_LOGGING_CATEGORY(logApp)
+
+LogTimeline::LogTimeline(QObject *parent)
+    : QObject(parent)
+{
+}
+
+LogTimeline::~LogTimeline()
+{
+    stop();
+    // 解析线程由本类持有，等待退出后释放
+    bool poolStarted = false;
+    for (Source *source : m_sources)
+        poolStarted = poolStarted || source->authThread || source->journal;
+    if (poolStarted)
+        QThreadPool::globalInstance()->waitForDone();
+
+    for (Source *source : m_sources) {
+        if (source->appThread)
+            source->appThread->wait();
+        delete source->authThread;
+        delete source->journal;
+        delete source->appThread;
+    }
+    qDeleteAll(m_sources);
+}
+
+bool LogTimeline::setSources(const QString &sources, QString &error)
+{
+    qDeleteAll(m_sources);
+    m_sources.clear();
+
+    for (const QString &item : sources.split(",", SKIP_EMPTY_PARTS)) {
+        const QString name = item.trimmed();
+        Source *source = new Source;
+        source->name = name;
+        if (name.startsWith(QString(TYPE_APP) + ":")) {
+            source->flag = APP;
+            source->app = name.mid(QString(TYPE_APP).size() + 1);
+            if (!LogApplicationHelper::instance()->isAppLogConfigExist(source->app)) {
+                error = QString("unknown app:%1 is invalid.").arg(source->app);
+                delete source;
+                return false;
+            }
+        } else {
+            source->flag = LogBackend::type2Flag(name, error);
+        }
+
+        // 启动日志与kwin日志没有时间，无法参与时间线合并
+        if (NONE == source->flag || BOOT == source->flag || BOOT_KLU == source->flag || Kwin == source->flag
+                || OtherLog == source->flag || CustomLog == source->flag || (APP == source->flag && source->app.isEmpty())) {
+            if (error.isEmpty())
+                error = QString("%1 logs cannot be merged into the timeline.").arg(name);
+            delete source;
+            return false;
+        }
+        m_sources.append(source);
+    }
+
+    if (m_sources.isEmpty()) {
+        error = "No timeline source specified.";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief LogTimeline::defaultSources 界面时间线默认合并的来源，只取本机支持的日志种类
+ * 审计日志需要审计管理员权限、应用日志需要指定应用，不默认合并
+ */
+QString LogTimeline::defaultSources()
+{
+    QStringList sources;
+    const QStringList types {TYPE_SYSTEM, TYPE_KERNEL, TYPE_DPKG, TYPE_DNF, TYPE_XORG, TYPE_AUTH, TYPE_COREDUMP, TYPE_BSE};
+    for (const QString &type : types) {
+        QString error;
+        if (LogBackend::type2Flag(type, error) != NONE)
+            sources << type;
+    }
+    return sources.join(",");
+}
+
+void LogTimeline::setTimeRange(qint64 begin, qint64 end)
+{
+    m_begin = begin > 0 ? begin : -1;
+    m_end = end > 0 ? end : -1;
+}
+
+void LogTimeline::start()
+{
+    if (m_started)
+        return;
+    m_started = true;
+
+    struct sysinfo info;
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    m_bootTime = (sysinfo(&info) == 0) ? now - static_cast<qint64>(info.uptime) * 1000 : 0;
+
+    // 解析线程通过该单例读取日志，须先在主线程创建
+    DLDBusHandler::instance(this);
+    for (int i = 0; i < m_sources.size(); ++i)
+        startSource(i);
+}
+
+void LogTimeline::stop()
+{
+    m_stopped = true;
+    for (Source *source : m_sources) {
+        if (source->finished)
+            continue;
+        if (source->authThread)
+            source->authThread->stopProccess();
+        if (source->journal)
+            source->journal->stopWork();
+        if (source->appThread)
+            source->appThread->stopProccess();
+    }
+}
+
+/**
+ * @brief LogTimeline::startSource 启动一个来源的解析
+ * 数据信号直连，在解析线程内换算、筛选并排序，完成后排队通知主线程
+ */
+void LogTimeline::startSource(int index)
+{
+    Source *source = m_sources[index];
+    // 解析线程的时间筛选要求两端都有效，只指定一端时补齐另一端
+    qint64 timeBegin = -1;
+    qint64 timeEnd = -1;
+    if (m_begin > 0 || m_end > 0) {
+        timeBegin = m_begin > 0 ? m_begin : 1;
+        timeEnd = m_end > 0 ? m_end : std::numeric_limits<qint64>::max() / 1000;
+    }
+
+    auto finished = [this, index]() {
+        finishSource(index);
+    };
+
+    LogAuthThread *thread = nullptr;
+    QStringList filePath;
+    // 需要由服务端列出的日志文件，异步获取后再启动解析，不阻塞主线程
+    QString fileFlag;
+    bool unzip = true;
+    switch (source->flag) {
+    case JOURNAL: {
+        QStringList arg("all");
+        if (timeBegin > 0 && timeEnd > 0)
+            arg << QString::number(timeBegin * 1000) << QString::number(timeEnd * 1000);
+        source->journal = new journalWork;
+        source->journal->setAutoDelete(false);
+        source->journal->setArg(arg);
+        connect(source->journal, &journalWork::journalData, this, [this, index](int, QList<LOG_MSG_JOURNAL> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(source->journal, &journalWork::journalFinished, this, finished, Qt::DirectConnection);
+        QThreadPool::globalInstance()->start(source->journal);
+        return;
+    }
+    case APP: {
+        APP_FILTERS filter;
+        filter.app = source->app;
+        filter.lvlFilter = LVALL;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        source->appThread = new LogApplicationParseThread;
+        source->appThread->setFilters(LogFileParser::buildAppFilters(filter));
+        connect(source->appThread, &LogApplicationParseThread::appData, this, [this, index](int, QList<LOG_MSG_APPLICATOIN> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        // 子模块日志路径为空或鉴权失败时appFinished会提前发出，此时解析线程仍在写入，以线程退出作为完成
+        connect(source->appThread, &QThread::finished, this, finished, Qt::DirectConnection);
+        source->appThread->start();
+        return;
+    }
+    case KERN: {
+        KERN_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::kernData, this, [this, index](int, QList<LOG_MSG_JOURNAL> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::kernFinished, this, finished, Qt::DirectConnection);
+        fileFlag = "kern";
+        unzip = false;
+    }
+    break;
+    case Dmesg: {
+        DMESG_FILTERS filter;
+        filter.levelFilter = LVALL;
+        filter.timeFilter = timeBegin > 0 ? timeBegin : 0;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::dmesgFinished, this, [this, index](QList<LOG_MSG_DMESG> list, quint64) {
+            appendRecords(index, list);
+            finishSource(index);
+        }, Qt::DirectConnection);
+        fileFlag = "dmesg";
+    }
+    break;
+    case DPKG: {
+        DKPG_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::dpkgData, this, [this, index](int, QList<LOG_MSG_DPKG> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::dpkgFinished, this, finished, Qt::DirectConnection);
+        fileFlag = "dpkg";
+    }
+    break;
+    case Dnf: {
+        DNF_FILTERS filter;
+        filter.levelfilter = DNFLVALL;
+        filter.timeFilter = timeBegin > 0 ? timeBegin : 0;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::dnfFinished, this, [this, index](QList<LOG_MSG_DNF> list) {
+            appendRecords(index, list);
+            finishSource(index);
+        }, Qt::DirectConnection);
+        fileFlag = "dnf";
+    }
+    break;
+    case XORG:
+        thread = new LogAuthThread;
+        connect(thread, &LogAuthThread::xorgData, this, [this, index](int, QList<LOG_MSG_XORG> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::xorgFinished, this, finished, Qt::DirectConnection);
+        // 只取本次开机的Xorg.0.log，历史文件的时间偏移无法换算，文件列表返回后截取
+        fileFlag = "Xorg";
+        break;
+    case Normal: {
+        NORMAL_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::normalData, this, [this, index](int, QList<LOG_MSG_NORMAL> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::normalFinished, this, finished, Qt::DirectConnection);
+    }
+    break;
+    case Audit: {
+        AUDIT_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::auditData, this, [this, index](int, QList<LOG_MSG_AUDIT> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::auditFinished, this, finished, Qt::DirectConnection);
+        fileFlag = "audit";
+        unzip = false;
+    }
+    break;
+    case Auth: {
+        AUTH_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::authData, this, [this, index](int, QList<LOG_MSG_AUTH> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::authFinished, this, finished, Qt::DirectConnection);
+        filePath = LogApplicationHelper::instance()->getAuthLogList();
+    }
+    break;
+    case COREDUMP: {
+        COREDUMP_FILTERS filter;
+        filter.timeFilterBegin = timeBegin;
+        filter.timeFilterEnd = timeEnd;
+        thread = new LogAuthThread;
+        thread->setFileterParam(filter);
+        connect(thread, &LogAuthThread::coredumpData, this, [this, index](int, QList<LOG_MSG_COREDUMP> list) {
+            appendRecords(index, list);
+        }, Qt::DirectConnection);
+        connect(thread, &LogAuthThread::coredumpFinished, this, finished, Qt::DirectConnection);
+    }
+    break;
+    default:
+        finishSource(index);
+        return;
+    }
+
+    thread->setType(source->flag);
+    thread->setAutoDelete(false);
+    connect(thread, &LogAuthThread::proccessError, this, [](const QString &iError) {
+        qCWarning(logApp) << iError;
+    });
+    source->authThread = thread;
+    if (fileFlag.isEmpty()) {
+        startAuthThread(index, filePath);
+        return;
+    }
+
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(DLDBusHandler::instance(this)->getFileInfoAsync(fileFlag, unzip), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, index, fileFlag](QDBusPendingCallWatcher *call) {
+        call->deleteLater();
+        QDBusPendingReply<QStringList> reply = *call;
+        QStringList files;
+        if (reply.isError())
+            qCWarning(logApp) << "timeline getFileInfo failed:" << fileFlag << reply.error().message();
+        else
+            files = reply.value();
+        if (XORG == m_sources[index]->flag)
+            files = files.mid(0, 1);
+        startAuthThread(index, files);
+    });
+}
+
+/**
+ * @brief LogTimeline::startAuthThread 设置文件列表并在线程池中启动来源的解析线程，已停止时不再启动
+ */
+void LogTimeline::startAuthThread(int index, const QStringList &filePath)
+{
+    Source *source = m_sources[index];
+    if (m_stopped) {
+        finishSource(index);
+        return;
+    }
+    if (!filePath.isEmpty())
+        source->authThread->setFilePath(filePath);
+    QThreadPool::globalInstance()->start(source->authThread);
+}
+
+/**
+ * @brief LogTimeline::appendRecords 在解析线程内将一批记录换算为时间线记录
+ * 关键字与时间范围在此统一筛选，不依赖各解析线程是否支持
+ */
+template<typename T>
+void LogTimeline::appendRecords(int index, const QList<T> &list)
+{
+    Source *source = m_sources[index];
+    source->entries.reserve(source->entries.size() + list.size());
+    for (const T &msg : list) {
+        LOG_MSG_TIMELINE entry = toEntry(msg);
+        if (XORG == source->flag) {
+            // toEntry给出的是相对开机的毫秒偏移，无法解析时为-1，需在加上开机时间前排除
+            if (entry.time < 0)
+                continue;
+            entry.time += m_bootTime;
+            entry.dateTime = QDateTime::fromMSecsSinceEpoch(entry.time).toString("yyyy-MM-dd hh:mm:ss.zzz");
+        } else {
+            entry.time = toEpoch(entry.dateTime, &source->hourCache);
+        }
+        if (entry.time < 0)
+            continue;
+        if ((m_begin > 0 && entry.time < m_begin) || (m_end > 0 && entry.time > m_end))
+            continue;
+        if (!m_keyword.isEmpty()
+                && !entry.msg.contains(m_keyword, Qt::CaseInsensitive)
+                && !entry.origin.contains(m_keyword, Qt::CaseInsensitive)
+                && !entry.level.contains(m_keyword, Qt::CaseInsensitive))
+            continue;
+        entry.source = source->name;
+        source->entries.append(entry);
+    }
+}
+
+/**
+ * @brief LogTimeline::finishSource 在解析线程内将来源的记录按时间从新到旧排序
+ * 各解析线程大多已按从新到旧给出数据，只在顺序不满足时才整体排序
+ */
+void LogTimeline::finishSource(int index)
+{
+    Source *source = m_sources[index];
+    auto newer = [](const LOG_MSG_TIMELINE &a, const LOG_MSG_TIMELINE &b) {
+        return a.time > b.time;
+    };
+    if (!std::is_sorted(source->entries.begin(), source->entries.end(), newer)) {
+        auto older = [](const LOG_MSG_TIMELINE &a, const LOG_MSG_TIMELINE &b) {
+            return a.time < b.time;
+        };
+        if (std::is_sorted(source->entries.begin(), source->entries.end(), older))
+            std::reverse(source->entries.begin(), source->entries.end());
+        else
+            std::stable_sort(source->entries.begin(), source->entries.end(), newer);
+    }
+    QMetaObject::invokeMethod(this, [this, index]() { onSourceFinished(index); }, Qt::QueuedConnection);
+}
+
+void LogTimeline::onSourceFinished(int index)
+{
+    Source *source = m_sources[index];
+    if (source->finished)
+        return;
+    source->finished = true;
+    qCDebug(logApp) << "timeline source finished:" << source->name << "records:" << source->entries.size();
+    emit sourceFinished(source->name, source->entries.size());
+
+    for (Source *item : m_sources) {
+        if (!item->finished)
+            return;
+    }
+
+    for (int i = 0; i < m_sources.size(); ++i) {
+        if (!m_sources[i]->entries.isEmpty())
+            m_heap.push({m_sources[i]->entries.first().time, -i});
+    }
+    m_ready = true;
+    emit ready();
+}
+
+QList<LOG_MSG_TIMELINE> LogTimeline::fetch(int count)
+{
+    QList<LOG_MSG_TIMELINE> page;
+    if (!m_ready)
+        return page;
+
+    // 堆顶为各来源当前记录中最新的一条，时间相同时来源序号小的在前
+    while (page.size() < count && !m_heap.empty()) {
+        const int index = -m_heap.top().second;
+        m_heap.pop();
+        Source *source = m_sources[index];
+        page.append(source->entries.at(source->pos++));
+        if (source->pos < source->entries.size())
+            m_heap.push({source->entries.at(source->pos).time, -index});
+    }
+    return page;
+}
+
+bool LogTimeline::atEnd() const
+{
+    return m_ready && m_heap.empty();
+}
+
+qint64 LogTimeline::totalCount() const
+{
+    qint64 count = 0;
+    for (Source *source : m_sources)
+        count += source->entries.size();
+    return count;
+}
+
+qint64 LogTimeline::toEpoch(const QString &dateTime, QHash<qint64, qint64> *hourCache)
+{
+    const int size = dateTime.size();
+    // 常见的yyyy-MM-dd hh:mm:ss[.zzz]按位解析，本地时间只换算到整点并缓存
+    if (size >= 19 && dateTime.at(4) == '-' && dateTime.at(7) == '-' && dateTime.at(13) == ':' && dateTime.at(16) == ':'
+            && (dateTime.at(10) == ' ' || dateTime.at(10) == 'T')) {
+        auto number = [&dateTime](int pos, int len) {
+            int value = 0;
+            for (int i = pos; i < pos + len; ++i) {
+                const QChar ch = dateTime.at(i);
+                if (!ch.isDigit())
+                    return -1;
+                value = value * 10 + ch.digitValue();
+            }
+            return value;
+        };
+        const int year = number(0, 4);
+        const int month = number(5, 2);
+        const int day = number(8, 2);
+        const int hour = number(11, 2);
+        const int minute = number(14, 2);
+        const int second = number(17, 2);
+
+        int pos = 19;
+        int msec = 0;
+        if (pos < size && (dateTime.at(pos) == '.' || dateTime.at(pos) == ',')) {
+            int digits = 0;
+            for (++pos; pos < size && dateTime.at(pos).isDigit(); ++pos) {
+                if (digits < 3) {
+                    msec = msec * 10 + dateTime.at(pos).digitValue();
+                    ++digits;
+                }
+            }
+            for (; digits > 0 && digits < 3; ++digits)
+                msec *= 10;
+        }
+
+        // 带时区后缀的交给Qt按ISO 8601解析
+        if (pos == size && year > 0 && month > 0 && day > 0 && hour >= 0 && minute >= 0 && second >= 0) {
+            const qint64 key = ((static_cast<qint64>(year) * 100 + month) * 100 + day) * 100 + hour;
+            qint64 hourStart = -1;
+            if (hourCache && hourCache->contains(key)) {
+                hourStart = hourCache->value(key);
+            } else {
+                QDateTime dt(QDate(year, month, day), QTime(hour, 0));
+                if (!dt.isValid())
+                    return -1;
+                hourStart = dt.toMSecsSinceEpoch();
+                if (hourCache)
+                    hourCache->insert(key, hourStart);
+            }
+            return hourStart + (minute * 60 + second) * 1000LL + msec;
+        }
+    }
+
+    // 无年份的syslog格式，取不晚于当前时间的最近一年
+    const QStringList parts = dateTime.split(" ", SKIP_EMPTY_PARTS);
+    if (parts.size() == 3 && parts[0].size() == 3 && parts[0].at(0).isLetter()) {
+        QLocale local(QLocale::English, QLocale::UnitedStates);
+        const QDateTime now = QDateTime::currentDateTime();
+        QDateTime dt = local.toDateTime(QString("%1 %2 %3 %4").arg(parts[0]).arg(parts[1]).arg(now.date().year()).arg(parts[2]),
+                                        "MMM d yyyy hh:mm:ss");
+        if (dt.isValid() && dt > now.addDays(1))
+            dt = dt.addYears(-1);
+        if (dt.isValid())
+            return dt.toMSecsSinceEpoch();
+    }
+
+    QDateTime dt = QDateTime::fromString(dateTime, Qt::ISODate);
+    return dt.isValid() ? dt.toMSecsSinceEpoch() : -1;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_JOURNAL &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.level = msg.level;
+    entry.origin = msg.daemonName;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_DPKG &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.origin = msg.action;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_DNF &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.level = msg.level;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_DMESG &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.level = msg.level;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_APPLICATOIN &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.level = msg.level;
+    entry.origin = msg.subModule.isEmpty() ? msg.src : msg.subModule;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_XORG &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    // 偏移单位为秒，换算为毫秒，由调用方加上开机时间
+    bool ok = false;
+    const double offset = msg.offset.toDouble(&ok);
+    entry.time = ok ? static_cast<qint64>(offset * 1000) : -1;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_NORMAL &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.origin = msg.userName;
+    entry.level = msg.eventType;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_AUDIT &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.level = msg.eventType;
+    entry.origin = msg.processName;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_AUTH &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.origin = msg.processName;
+    entry.msg = msg.msg;
+    return entry;
+}
+
+LOG_MSG_TIMELINE LogTimeline::toEntry(const LOG_MSG_COREDUMP &msg)
+{
+    LOG_MSG_TIMELINE entry;
+    entry.dateTime = msg.dateTime;
+    entry.origin = msg.exe;
+    entry.msg = QString("signal %1, pid %2, %3").arg(msg.sig).arg(msg.pid).arg(msg.coreFile);
+    return entry;
+}
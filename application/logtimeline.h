@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGTIMELINE_H
+#define LOGTIMELINE_H
+
+#include "structdef.h"
+
+#include <QHash>
+#include <QObject>
+#include <QVector>
+
+#include <queue>
+
+class LogAuthThread;
+class journalWork;
+class LogApplicationParseThread;
+
+/**
+ * @brief The LogTimeline class 多来源日志合并时间线
+ * 各来源的解析线程并行运行，记录在解析线程内换算为毫秒时间戳并按时间从新到旧排序，
+ * 全部来源完成后按页做k路归并，只归并到当前页需要的位置
+ */
+class LogTimeline : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LogTimeline(QObject *parent = nullptr);
+    ~LogTimeline() override;
+
+    /**
+     * @brief setSources 设置来源
+     * @param sources 逗号分隔的日志种类，与导出的-t参数一致，应用日志写作app:应用名
+     * @param error 来源无效时的错误信息
+     */
+    bool setSources(const QString &sources, QString &error);
+    static QString defaultSources();
+    // 时间范围，毫秒时间戳，小于等于0表示该端不限制
+    void setTimeRange(qint64 begin, qint64 end);
+    void setKeyword(const QString &keyword) { m_keyword = keyword; }
+
+    // 启动所有来源的解析，全部完成后发出ready信号
+    void start();
+    void stop();
+
+    bool isReady() const { return m_ready; }
+    // 取下一页记录，按时间从新到旧，ready之前返回空
+    QList<LOG_MSG_TIMELINE> fetch(int count);
+    bool atEnd() const;
+    qint64 totalCount() const;
+
+    /**
+     * @brief toEpoch 将各日志种类的时间文本换算为毫秒时间戳
+     * 支持yyyy-MM-dd hh:mm:ss[.zzz]、ISO 8601与无年份的syslog格式(Sep 29 15:53:34，取最近的一年)
+     * @param hourCache 本地时间整点到时间戳的缓存，同一来源的记录时间集中，可省去大部分时区换算
+     * @return 无法解析时返回-1
+     */
+    static qint64 toEpoch(const QString &dateTime, QHash<qint64, qint64> *hourCache = nullptr);
+
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_JOURNAL &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_DPKG &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_DNF &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_DMESG &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_APPLICATOIN &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_XORG &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_NORMAL &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_AUDIT &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_AUTH &msg);
+    static LOG_MSG_TIMELINE toEntry(const LOG_MSG_COREDUMP &msg);
+
+signals:
+    void sourceFinished(const QString &source, qint64 count);
+    void ready();
+
+private:
+    struct Source {
+        LOG_FLAG flag {NONE};
+        QString name;
+        QString app;
+        // 以下数据在解析线程内写入，完成信号之后只在主线程读取
+        QVector<LOG_MSG_TIMELINE> entries;
+        QHash<qint64, qint64> hourCache;
+        int pos {0};
+        bool finished {false};
+
+        LogAuthThread *authThread {nullptr};
+        journalWork *journal {nullptr};
+        LogApplicationParseThread *appThread {nullptr};
+    };
+
+    void startSource(int index);
+    void startAuthThread(int index, const QStringList &filePath);
+    template<typename T>
+    void appendRecords(int index, const QList<T> &list);
+    void finishSource(int index);
+    void onSourceFinished(int index);
+
+private:
+    QList<Source *> m_sources;
+    QString m_keyword;
+    qint64 m_begin {-1};
+    qint64 m_end {-1};
+    // 本次开机时间，Xorg日志只有相对开机的时间偏移
+    qint64 m_bootTime {0};
+    bool m_started {false};
+    bool m_stopped {false};
+    bool m_ready {false};
+
+    // 归并堆，元素为各来源当前记录的(时间, 负的来源序号)，时间相同时序号小的来源先出
+    std::priority_queue<std::pair<qint64, int>> m_heap;
+};
+
+#endif // LOGTIMELINE_H
@@ -11,6 +11,9 @@
 #include "eventlogutils.h"
 #include "DebugTimeManager.h"
 #include "logbackend.h"
+#include "logquery.h"
+#include "loghistogram.h"
+#include "logparsescheduler.h"
 #include "cliapplicationhelper.h"
 #include "accessible.h"
 
@@ -23,6 +26,7 @@
 #include <QDateTime>
 #include <QSurfaceFormat>
 #include <QDebug>
+#include <QTimer>
 #include <QLoggingCategory>
 
 DWIDGET_USE_NAMESPACE
@@ -34,6 +38,12 @@ Q_LOGGING_CATEGORY(logApp, "org.deepin.log.viewer.main")
 Q_LOGGING_CATEGORY(logApp, "org.deepin.log.viewer.main", QtInfoMsg)
 #endif
 
+// 性能计数在QCoreApplication析构时写入一次，覆盖事件循环退出及未进入事件循环直接返回的情况
+static void dumpPerfCounters()
+{
+    DebugTimeManager::getInstance()->dump();
+}
+
 int main(int argc, char *argv[])
 {
     //在root下或者非deepin/uos环境下运行不会发生异常，需要加上XDG_CURRENT_DESKTOP=Deepin环境变量；
@@ -75,6 +85,16 @@ int main(int argc, char *argv[])
         QCommandLineOption keywordOption(QStringList() << "k" << "keyword", DApplication::translate("main", "Export logs based on keywords search results"), DApplication::translate("main", "KEY WORD"));
         QCommandLineOption submoduleOption(QStringList() << "m" << "submodule", DApplication::translate("main", "Export logs based on app submodel"), DApplication::translate("main", "SUBMODULE"));
         QCommandLineOption reportCoredumpOption(QStringList() << "reportcoredump", DApplication::translate("main", "Report coredump informations."));
+        QCommandLineOption perfDumpOption(QStringList() << "perf-dump", DApplication::translate("main", "Write performance counters as JSON to the specified file on exit"), DApplication::translate("main", "FILE"));
+        QCommandLineOption perfTraceOption(QStringList() << "perf-trace", DApplication::translate("main", "Write a Chrome trace of timed operations to the specified file on exit"), DApplication::translate("main", "FILE"));
+        QCommandLineOption queryOption(QStringList() << "query", DApplication::translate("main", "Write logs of the specified type matching the filters to standard output"), DApplication::translate("main", "TYPE"));
+        QCommandLineOption formatOption(QStringList() << "format", DApplication::translate("main", "Output format of the query, jsonl(default) or tsv"), DApplication::translate("main", "FORMAT"));
+        QCommandLineOption limitOption(QStringList() << "limit", DApplication::translate("main", "Stop the query after the specified number of records"), DApplication::translate("main", "COUNT"));
+        QCommandLineOption sinceOption(QStringList() << "since", DApplication::translate("main", "Query logs not older than the specified time, e.g. 2024-01-01 08:00:00, 1704067200, 12h, 3d"), DApplication::translate("main", "TIME"));
+        QCommandLineOption untilOption(QStringList() << "until", DApplication::translate("main", "Query logs not newer than the specified time"), DApplication::translate("main", "TIME"));
+        QCommandLineOption sourcesOption(QStringList() << "sources", DApplication::translate("main", "Comma separated log types merged by '--query timeline', application logs as app:NAME"), DApplication::translate("main", "SOURCES"));
+        QCommandLineOption summaryOption(QStringList() << "summary", DApplication::translate("main", "Output record counts per time bucket grouped by level, process or category instead of the records"), DApplication::translate("main", "GROUP"));
+        QCommandLineOption bucketOption(QStringList() << "bucket", DApplication::translate("main", "Time bucket of '--summary', e.g. 30m, 1h(default), 1d"), DApplication::translate("main", "SPAN"));
 
         QCommandLineParser cmdParser;
         cmdParser.setApplicationDescription("deepin-log-viewer");
@@ -90,6 +110,16 @@ int main(int argc, char *argv[])
         cmdParser.addOption(keywordOption);
         cmdParser.addOption(submoduleOption);
         cmdParser.addOption(reportCoredumpOption);
+        cmdParser.addOption(perfDumpOption);
+        cmdParser.addOption(perfTraceOption);
+        cmdParser.addOption(queryOption);
+        cmdParser.addOption(formatOption);
+        cmdParser.addOption(limitOption);
+        cmdParser.addOption(sinceOption);
+        cmdParser.addOption(untilOption);
+        cmdParser.addOption(sourcesOption);
+        cmdParser.addOption(summaryOption);
+        cmdParser.addOption(bucketOption);
 
         qCDebug(logApp) << "Parsing command line arguments";
         if (!cmdParser.parse(qApp->arguments())) {
@@ -99,6 +129,12 @@ int main(int argc, char *argv[])
 
         cmdParser.process(a);
 
+        // 性能计数在程序退出时写入文件，用于现场分析加载、导出慢的问题
+        if (cmdParser.isSet(perfDumpOption) || cmdParser.isSet(perfTraceOption)) {
+            DebugTimeManager::getInstance()->setDumpFiles(cmdParser.value(perfDumpOption), cmdParser.value(perfTraceOption));
+            qAddPostRoutine(dumpPerfCounters);
+        }
+
         // cli命令处理
         QStringList args = cmdParser.positionalArguments();
         QString type = "";
@@ -168,6 +204,91 @@ int main(int argc, char *argv[])
                 return -1;
             }
 
+            return a.exec();
+        } else if (cmdParser.isSet(queryOption)) {
+            // 查询模式：匹配的记录边解析边写到标准输出，不生成导出文件
+            if (cmdParser.isSet(exportOption) || cmdParser.isSet(typeOption)) {
+                qCWarning(logApp) << "Option --query cannot be used with -e or -t.";
+                return -1;
+            }
+            if (!period.isEmpty()) {
+                qCWarning(logApp) << "Option --query filters time by '--since' and '--until', not 'period'.";
+                return -1;
+            }
+
+            LogQuery::Format format = LogQuery::JsonLines;
+            const QString formatValue = cmdParser.value(formatOption);
+            if (formatValue == "tsv") {
+                format = LogQuery::Tsv;
+            } else if (!formatValue.isEmpty() && formatValue != "jsonl") {
+                qCWarning(logApp) << "invalid 'format' parameter: " << formatValue << "\nUSEAGE: jsonl, tsv";
+                return -1;
+            }
+
+            qint64 limit = -1;
+            if (cmdParser.isSet(limitOption)) {
+                bool ok = false;
+                limit = cmdParser.value(limitOption).toLongLong(&ok);
+                if (!ok || limit < 0) {
+                    qCWarning(logApp) << "invalid 'limit' parameter: " << cmdParser.value(limitOption);
+                    return -1;
+                }
+            }
+
+            qint64 since = -1;
+            qint64 until = -1;
+            if (cmdParser.isSet(sinceOption)) {
+                since = LogQuery::parseTime(cmdParser.value(sinceOption));
+                if (since < 0) {
+                    qCWarning(logApp) << "invalid 'since' parameter: " << cmdParser.value(sinceOption);
+                    return -1;
+                }
+            }
+            if (cmdParser.isSet(untilOption)) {
+                until = LogQuery::parseTime(cmdParser.value(untilOption));
+                if (until < 0) {
+                    qCWarning(logApp) << "invalid 'until' parameter: " << cmdParser.value(untilOption);
+                    return -1;
+                }
+            }
+
+            LogHistogram::GroupBy summaryGroup = LogHistogram::GroupLevel;
+            if (cmdParser.isSet(summaryOption) && !LogHistogram::parseGroupBy(cmdParser.value(summaryOption), summaryGroup)) {
+                qCWarning(logApp) << "invalid 'summary' parameter: " << cmdParser.value(summaryOption) << "\nUSEAGE: level, process, category";
+                return -1;
+            }
+            if (cmdParser.isSet(summaryOption) && cmdParser.isSet(limitOption)) {
+                qCWarning(logApp) << "Option --limit cannot be used with --summary.";
+                return -1;
+            }
+            qint64 bucketSpan = 3600 * 1000;
+            if (cmdParser.isSet(bucketOption)) {
+                if (!cmdParser.isSet(summaryOption)) {
+                    qCWarning(logApp) << "Option --bucket is only used with --summary.";
+                    return -1;
+                }
+                bucketSpan = LogHistogram::parseSpan(cmdParser.value(bucketOption));
+                if (bucketSpan <= 0) {
+                    qCWarning(logApp) << "invalid 'bucket' parameter: " << cmdParser.value(bucketOption) << "\nUSEAGE: 30s, 15m, 1h, 1d";
+                    return -1;
+                }
+            }
+
+            Utils::runInCmd = true;
+
+            LogQuery query;
+            query.setFormat(format);
+            query.setLimit(limit);
+            query.setTimeRange(since, until);
+            query.setSources(cmdParser.value(sourcesOption));
+            if (cmdParser.isSet(summaryOption))
+                query.setSummary(summaryGroup, bucketSpan);
+            QObject::connect(&query, &LogQuery::finished, &a, [](int exitCode) {
+                QCoreApplication::exit(exitCode);
+            });
+            if (!query.start(cmdParser.value(queryOption), appName, level, status, event, submodule, keyword))
+                return -1;
+
             return a.exec();
         } else if (cmdParser.isSet(exportOption)) {
             qCDebug(logApp) << "Setting single instance for application:" << a.applicationName();
@@ -312,12 +433,34 @@ int main(int argc, char *argv[])
 
             return a.exec();
         } else {
-            qCWarning(logApp) <<"Missing export path, please enter the '-e' parameter.";
+            qCWarning(logApp) <<"Missing export path, please enter the '-e' parameter, or query logs with '--query'.";
             return -1;
         }
     } else {
         // qCDebug(logApp) << "No command line arguments, starting GUI application";
+        // 启动打点记录：DEEPIN_LOG_VIEWER_STARTUP_TRACE指定记录文件，首个日志种类数据显示(POINT-03结束)时写入；
+        // DEEPIN_LOG_VIEWER_EXIT_AFTER_STARTUP=1时写入后退出，用于自动测量冷、热启动耗时
+        const QString startupTrace = qEnvironmentVariable("DEEPIN_LOG_VIEWER_STARTUP_TRACE");
+        if (!startupTrace.isEmpty()) {
+            const bool exitAfterStartup = qEnvironmentVariableIntValue("DEEPIN_LOG_VIEWER_EXIT_AFTER_STARTUP") == 1;
+            DebugTimeManager::getInstance()->setTraceFile(startupTrace, "POINT-03", [exitAfterStartup]() {
+                if (exitAfterStartup)
+                    QTimer::singleShot(0, qApp, &QCoreApplication::quit);
+            });
+        }
+        // 性能计数：DEEPIN_LOG_VIEWER_PERF_DUMP指定计数文件，DEEPIN_LOG_VIEWER_PERF_TRACE指定Chrome trace文件，退出时写入
+        const QString perfDump = qEnvironmentVariable("DEEPIN_LOG_VIEWER_PERF_DUMP");
+        const QString perfTrace = qEnvironmentVariable("DEEPIN_LOG_VIEWER_PERF_TRACE");
+        if (!perfDump.isEmpty() || !perfTrace.isEmpty()) {
+            DebugTimeManager::getInstance()->setDumpFiles(perfDump, perfTrace);
+            qAddPostRoutine(dumpPerfCounters);
+        }
+        // 默认先显示窗口再在后台填充日志种类，DEEPIN_LOG_VIEWER_SYNC_STARTUP=1时按原方式同步初始化
+        Utils::lazyStartup = qEnvironmentVariableIntValue("DEEPIN_LOG_VIEWER_SYNC_STARTUP") != 1;
+
         PERF_PRINT_BEGIN("POINT-01", "");
+        PERF_PRINT_BEGIN("STARTUP-FIRSTFRAME", Utils::lazyStartup ? "lazy" : "sync");
+        PERF_PRINT_BEGIN("STARTUP-APPINIT", "");
 
         //klu下不使用opengl 使用OpenGLES,因为opengl基于x11 现在全面换wayland了
         QCoreApplication::setAttribute(Qt::AA_UseOpenGLES);
@@ -360,7 +503,10 @@ int main(int argc, char *argv[])
     LoggerRules logRules;
     logRules.initLoggerRules();
 #endif
+        PERF_PRINT_END("STARTUP-APPINIT", "");
+        PERF_PRINT_BEGIN("STARTUP-HELPER", "");
         LogApplicationHelper::instance();
+        PERF_PRINT_END("STARTUP-HELPER", "");
 
         qCDebug(logApp) << "Checking single instance for application:" << a.applicationName();
         if (!DGuiApplicationHelper::instance()->setSingleInstance(a.applicationName(),
@@ -371,9 +517,14 @@ int main(int argc, char *argv[])
             return 0;
         }
 
+        // 等保、用户信息查询提前发出，构造界面期间等待应答
+        DBusManager::prefetch();
+
         // 显示GUI
         qCInfo(logApp) << "Initializing main window";
+        PERF_PRINT_BEGIN("STARTUP-MAINWINDOW", "");
         LogCollectorMain w;
+        PERF_PRINT_END("STARTUP-MAINWINDOW", "");
         a.setMainWindow(&w);
         qCDebug(logApp) << "Main window initialized and set";
 
@@ -393,8 +544,14 @@ int main(int argc, char *argv[])
         });
 
         qCDebug(logApp) << "Showing main window and moving to center";
+        PERF_PRINT_BEGIN("STARTUP-SHOW", "");
         w.show();
         Dtk::Widget::moveToCenter(&w);
+        PERF_PRINT_END("STARTUP-SHOW", "");
+        // 窗口显示后事件循环开始运行
+        QTimer::singleShot(0, &a, []() {
+            PERF_PRINT_END("STARTUP-FIRSTFRAME", "");
+        });
         qCInfo(logApp) << "Main window displayed successfully";
         
         QObject::connect(&a, &QCoreApplication::aboutToQuit, [&]() {
@@ -408,6 +565,11 @@ int main(int argc, char *argv[])
                     qCDebug(logApp) << "Thread pool cleaned up successfully";
                 }
             }
+            // 日志解析任务在独立的线程池中执行
+            LogParseScheduler::instance()->cancelPending();
+            if (!LogParseScheduler::instance()->waitForDone(300)) {
+                qCWarning(logApp) << "Parse thread pool cleanup timeout during application quit";
+            }
         });
         
         bool result = a.exec();
@@ -50,6 +50,7 @@ void ParseThreadBase::initConnect()
         qCDebug(logApp) << "Parser found, connecting signals";
         connect(this, &ParseThreadBase::parseFinished, m_pParser, &LogFileParser::parseFinished);
         connect(this, &ParseThreadBase::logData, m_pParser, &LogFileParser::logData);
+        connect(this, &ParseThreadBase::logRecords, m_pParser, &LogFileParser::logRecords);
         connect(m_pParser, &LogFileParser::stop, this, &ParseThreadBase::stopProccess);
     } else {
         qCWarning(logApp) << "Parser not found, connections not established";
@@ -84,15 +85,6 @@ void ParseThreadBase::stopProccess()
     m_isStopProccess = true;
     //停止获取线程执行，标记量置false
     m_canRun = false;
-    if (!Utils::runInCmd) {
-        qCDebug(logApp) << "Setting shared memory stop flag";
-        //共享内存数据结构，用于和获取进程共享内存，数据为是否可执行进程，用于控制数据获取进程停止，因为这里会出现需要提权执行的进程，主进程没有权限停止提权进程，所以使用共享内存变量标记量控制提权进程停止
-        ShareMemoryInfo   shareInfo ;
-        //设置进程为不可执行
-        shareInfo.isStart = false;
-        //把数据付给共享内存中对应的变量
-        SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-    }
     if (m_process) {
         qCDebug(logApp) << "Killing process";
         m_process->kill();
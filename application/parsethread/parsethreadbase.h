@@ -8,6 +8,7 @@
 #include "../application/dbusproxy/dldbushandler.h"
 #include "../application/sharedmemorymanager.h"
 #include "../application/logfileparser.h"
+#include "../application/logbatchchannel.h"
 
 #include <QProcess>
 #include <QRunnable>
@@ -30,6 +31,8 @@ public:
 
     // 设置筛选条件
     virtual void setFilter(LOG_FILTER_BASE &filter);
+    // 设置与接收端共享的批次计数，接收端处理不及时时解析线程合并批次或等待
+    void setBatchChannel(const QSharedPointer<LogBatchChannel> &channel) { m_batchSender.setChannel(channel); }
 
     void stopProccess();
     int getIndex();
@@ -53,6 +56,13 @@ signals:
      * @param type 日志种类
      */
     void logData(int index, const QList<QString> &iDataList, LOG_FLAG type);
+    /**
+     * @brief logRecords 分段导出时的日志数据发送信号
+     * @param index 当前线程的数字标号
+     * @param iRecordList 结构体日志数据list
+     * @param type 日志种类
+     */
+    void logRecords(int index, const QList<LOG_MSG_BASE> &iRecordList, LOG_FLAG type);
 
     void proccessError(const QString &iError);
 
@@ -82,12 +92,16 @@ protected:
      * @brief m_canRun 是否可以继续运行的标记量，用于停止运行线程
      */
     std::atomic_bool m_canRun = false;
+    /**
+     * @brief m_batchSender 按耗时划分发送批次
+     */
+    LogBatchSender m_batchSender;
     /**
      * @brief m_threadIndex 当前线程标号
      */
     int m_threadCount;
-    //正在执行停止进程的变量，防止重复执行停止逻辑
-    bool m_isStopProccess = false;
+    //正在执行停止进程的变量，防止重复执行停止逻辑，排队中的任务开始执行时据此直接返回
+    std::atomic_bool m_isStopProccess = false;
 };
 
 Q_DECLARE_METATYPE(ParseThreadBase::Status)
@@ -38,6 +38,12 @@ void ParseThreadKern::run()
     qCDebug(logApp) << "ParseThreadKern run started";
     //此线程刚开始把可以继续变量置true，不然下面没法跑
     m_canRun = true;
+    //排队期间已收到停止请求时不再执行，先置位再检查，不会覆盖并发的停止请求
+    if (m_isStopProccess) {
+        qCDebug(logApp) << "ParseThreadKern stopped before start";
+        m_canRun = false;
+        return;
+    }
 
     handleKern();
 }
@@ -49,10 +55,13 @@ void ParseThreadKern::handleKern()
 {
     qCDebug(logApp) << "Starting kernel log handling";
     QList<QString> dataList;
+    QList<LOG_MSG_BASE> recordList;
     qint64 gStartLine = m_filter.segementIndex * SEGEMENT_SIZE;
     qCDebug(logApp) << "Global start line:" << gStartLine;
     m_FilePath = DLDBusHandler::instance(this)->getFileInfo(m_filter.filePath, false);
     qCDebug(logApp) << "Found" << m_FilePath.count() << "files to process";
+    // 各文件的行数请求在首次鉴权后一次性发出，逐个文件等待结果
+    QList<QDBusPendingReply<qint64>> lineCountReplies;
     for (int i = 0; i < m_FilePath.count(); i++) {
         qCDebug(logApp) << "Processing file" << i << ":" << m_FilePath.at(i);
         if (!m_FilePath.at(i).contains("txt")) {
@@ -68,50 +77,37 @@ void ParseThreadKern::handleKern()
             return;
         }
 
-        if (!Utils::runInCmd) {
-            qCDebug(logApp) << "Running with authentication";
-            initProccess();
-            if (!m_canRun) {
-                return;
-            }
-            m_process->setProcessChannelMode(QProcess::MergedChannels);
-            if (!m_canRun) {
-                return;
-            }
-            //共享内存对应变量置true，允许进程内部逻辑运行
-            ShareMemoryInfo shareInfo;
-            shareInfo.isStart = true;
-            SharedMemoryManager::instance()->setRunnableTag(shareInfo);
-            //启动日志需要提权获取，运行的时候把对应共享内存的名称传进去，方便获取进程拿标记量判断是否继续运行
-            qCDebug(logApp) << "Starting pkexec process for file:" << m_FilePath.at(i);
-            m_process->start("pkexec", QStringList() << "logViewerAuth"
-                             << m_FilePath.at(i) << SharedMemoryManager::instance()->getRunnableKey());
-            m_process->waitForFinished(-1);
-            //有错则传出空数据
-            if (m_process->exitCode() != 0) {
-                qCWarning(logApp) << "Process failed with exit code:" << m_process->exitCode();
-                emit parseFinished(m_threadCount, m_type, CancelAuth);
-                return;
-            }
-            qCDebug(logApp) << "Process completed successfully";
+        //内核日志需要提权获取，会话有效期内多个文件只需鉴权一次，有错则传出空数据
+        if (!Utils::runInCmd && !DLDBusHandler::instance(this)->ensureSession()) {
+            qCWarning(logApp) << "Reader session authorization failed";
+            emit parseFinished(m_threadCount, m_type, CancelAuth);
+            return;
         }
 
         if (!m_canRun) {
             return;
         }
 
-        //如果是压缩文件，对其解压缩
+        //压缩文件由服务端流式解压
         QString filePath = m_FilePath.at(i);
-        if(QString::compare(QFileInfo(filePath).suffix(), "gz", Qt::CaseInsensitive) == 0){
-            QStringList filePathList = DLDBusHandler::instance(this)->getFileInfo(filePath);
-            if(filePathList.size()){
-                filePath = filePathList.at(0);
-            }else {
-                filePath = "";
-            }
+
+        if (lineCountReplies.isEmpty()) {
+            for (const QString &path : m_FilePath)
+                lineCountReplies.append(DLDBusHandler::instance(this)->getLineCountAsync(path));
         }
+        // 起始行为0时当前文件必然从头读取，读取请求与行数请求同时在途
+        QDBusPendingReply<QStringList> rangeReply;
+        const bool rangeRequested = (gStartLine == 0);
+        if (rangeRequested)
+            rangeReply = DLDBusHandler::instance(this)->readLogLinesInRangeAsync(filePath, 0, SEGEMENT_SIZE);
 
-        qint64 lineCount = DLDBusHandler::instance(this)->getLineCount(filePath);
+        QDBusPendingReply<qint64> lineCountReply = lineCountReplies.at(i);
+        lineCountReply.waitForFinished();
+        qint64 lineCount = 0;
+        if (lineCountReply.isError())
+            qCWarning(logApp) << "getLineCount failed:" << filePath << lineCountReply.error().message();
+        else
+            lineCount = lineCountReply.value();
         qCDebug(logApp) << "File line count:" << lineCount;
 
         // 获取全局起始行在当前文件的相对起始行位置
@@ -124,7 +120,16 @@ void ParseThreadKern::handleKern()
         qint64 startLine = gStartLine;
         qCDebug(logApp) << "Reading lines from" << startLine << "count:" << SEGEMENT_SIZE;
 
-        QStringList strList = DLDBusHandler::instance(this)->readLogLinesInRange(filePath, startLine, SEGEMENT_SIZE);
+        QStringList strList;
+        if (rangeRequested) {
+            rangeReply.waitForFinished();
+            if (rangeReply.isError())
+                qCWarning(logApp) << "readLogLinesInRange failed:" << filePath << rangeReply.error().message();
+            else
+                strList = rangeReply.value();
+        } else {
+            strList = DLDBusHandler::instance(this)->readLogLinesInRange(filePath, startLine, SEGEMENT_SIZE);
+        }
         for (int j = strList.size() - 1; j >= 0; --j) {
             if (!m_canRun) {
                 return;
@@ -184,12 +189,18 @@ void ParseThreadKern::handleKern()
             msg.daemonId = "0";
             msg.msg = msgContent.trimmed();
 
+            // 分段导出时整段一次性传出，不序列化为json
+            if (m_filter.exportRecords) {
+                recordList.append(msg);
+                continue;
+            }
+
             dataList.append(QJsonDocument(msg.toJson()).toJson(QJsonDocument::Compact));
             if (!m_canRun) {
                 return;
             }
-            //每获得500个数据就发出信号给控件加载
-            if (dataList.count() % SINGLE_READ_CNT == 0) {
+            //累积满一帧的数据就发出信号给控件加载
+            if (m_batchSender.due(dataList.count(), m_canRun)) {
                 qCDebug(logApp) << "Emitting" << dataList.count() << "log entries";
                 emit logData(m_threadCount, dataList, m_type);
                 dataList.clear();
@@ -199,9 +210,13 @@ void ParseThreadKern::handleKern()
             }
         }
     }
-    //最后可能有余下不足500的数据
-    if (dataList.count() >= 0) {
+    if (m_filter.exportRecords) {
+        qCDebug(logApp) << "Emitting" << recordList.count() << "log records";
+        emit logRecords(m_threadCount, recordList, m_type);
+    } else if (dataList.count() >= 0) {
+        //最后余下不足一批的数据
         qCDebug(logApp) << "Emitting final" << dataList.count() << "log entries";
+        m_batchSender.commit();
         emit logData(m_threadCount, dataList, m_type);
     }
     qCDebug(logApp) << "Kernel log parsing finished";
@@ -37,6 +37,12 @@ void ParseThreadKwin::run()
     qCDebug(logApp) << "ParseThreadKwin run started";
     //此线程刚开始把可以继续变量置true，不然下面没法跑
     m_canRun = true;
+    //排队期间已收到停止请求时不再执行，先置位再检查，不会覆盖并发的停止请求
+    if (m_isStopProccess) {
+        qCDebug(logApp) << "ParseThreadKwin stopped before start";
+        m_canRun = false;
+        return;
+    }
 
     handleKwin();
 }
@@ -53,6 +59,7 @@ void ParseThreadKwin::handleKwin()
         return;
     }
     QList<QString> dataList;
+    QList<LOG_MSG_BASE> recordList;
     if (!file.exists()) {
         qCWarning(logApp) << "Kwin data file does not exist:" << KWIN_TREE_DATA;
         emit parseFinished(m_threadCount, m_type);
@@ -64,7 +71,14 @@ void ParseThreadKwin::handleKwin()
 
     qint64 gStartLine = m_filter.segementIndex * SEGEMENT_SIZE;
     qCDebug(logApp) << "Global start line:" << gStartLine;
-    qint64 lineCount = DLDBusHandler::instance(this)->getLineCount(KWIN_TREE_DATA);
+    // 行数与分段内容同时请求，起始行超出行数时丢弃读取的结果
+    qint64 startLine = gStartLine;
+    qCDebug(logApp) << "Reading lines from" << startLine << "count:" << SEGEMENT_SIZE;
+    QDBusPendingReply<qint64> lineCountReply = DLDBusHandler::instance(this)->getLineCountAsync(KWIN_TREE_DATA);
+    QDBusPendingReply<QStringList> rangeReply = DLDBusHandler::instance(this)->readLogLinesInRangeAsync(KWIN_TREE_DATA, startLine, SEGEMENT_SIZE);
+
+    lineCountReply.waitForFinished();
+    qint64 lineCount = lineCountReply.isError() ? 0 : lineCountReply.value();
     qCDebug(logApp) << "File line count:" << lineCount;
 
     // 获取全局起始行在当前文件的相对起始行位置
@@ -73,9 +87,10 @@ void ParseThreadKwin::handleKwin()
         return;
     }
 
-    qint64 startLine = gStartLine;
-    qCDebug(logApp) << "Reading lines from" << startLine << "count:" << SEGEMENT_SIZE;
-    QStringList strList = DLDBusHandler::instance(this)->readLogLinesInRange(KWIN_TREE_DATA, startLine, SEGEMENT_SIZE);
+    rangeReply.waitForFinished();
+    if (rangeReply.isError())
+        qCWarning(logApp) << "readLogLinesInRange failed:" << rangeReply.error().message();
+    QStringList strList = rangeReply.isError() ? QStringList() : rangeReply.value();
     if (!m_canRun) {
         return;
     }
@@ -91,9 +106,14 @@ void ParseThreadKwin::handleKwin()
         }
         LOG_MSG_BASE msg;
         msg.msg = str;
+        // 分段导出时整段一次性传出，不序列化为json
+        if (m_filter.exportRecords) {
+            recordList.append(msg);
+            continue;
+        }
         dataList.append(QJsonDocument(msg.toJson()).toJson(QJsonDocument::Compact));
-        //每获得500个数据就发出信号给控件加载
-        if (dataList.count() % SINGLE_READ_CNT == 0) {
+        //累积满一帧的数据就发出信号给控件加载
+        if (m_batchSender.due(dataList.count(), m_canRun)) {
             qCDebug(logApp) << "Emitting" << dataList.count() << "log entries";
             emit logData(m_threadCount, dataList, m_type);
             dataList.clear();
@@ -103,9 +123,13 @@ void ParseThreadKwin::handleKwin()
     if (!m_canRun) {
         return;
     }
-    //最后可能有余下不足500的数据
-    if (dataList.count() >= 0) {
+    if (m_filter.exportRecords) {
+        qCDebug(logApp) << "Emitting" << recordList.count() << "log records";
+        emit logRecords(m_threadCount, recordList, m_type);
+    } else if (dataList.count() >= 0) {
+        //最后余下不足一批的数据
         qCDebug(logApp) << "Emitting final" << dataList.count() << "log entries";
+        m_batchSender.commit();
         emit logData(m_threadCount, dataList, m_type);
     }
     qCDebug(logApp) << "Kwin log parsing finished";
@@ -26,6 +26,7 @@
 #define AUDIT_TABLE_DATA "auditItemData"
 #define COREDUMP_TABLE_DATA "coredumpItemData"
 #define AUTH_TABLE_DATA "authItemData"
+#define TIMELINE_TABLE_DATA "timelineItemData"
 
 #define JOUR_TREE_DATA "journalctl"
 #define BOOT_KLU_TREE_DATA "bootklu"
@@ -43,6 +44,7 @@
 #define AUDIT_TREE_DATA "/var/log/audit/audit.log"
 #define COREDUMP_TREE_DATA "coredump log"
 #define AUTH_TREE_DATA "/var/log/auth.log"
+#define TIMELINE_TREE_DATA "timeline"
 
 #define ITEM_DATE_ROLE (Qt::UserRole + 66)
 #define ICONPREFIX "://images/"
@@ -64,6 +66,7 @@
 #define TYPE_CUSTOM "custom"
 #define TYPE_AUDIT "audit"
 #define TYPE_AUTH "auth"
+#define TYPE_TIMELINE "timeline"
 
 #define AUDIT_ORIGIN_DATAROLE Qt::UserRole + 3
 
@@ -279,6 +282,18 @@ struct LOG_MSG_AUTH {
     }
 };
 
+/**
+ * @brief The LOG_MSG_TIMELINE struct 多来源合并时间线中的一条记录
+ */
+struct LOG_MSG_TIMELINE {
+    qint64 time = 0; // 毫秒时间戳，用于归并排序
+    QString source; // 来源日志种类，如system、kernel、app:deepin-editor
+    QString dateTime;
+    QString level;
+    QString origin; // 进程、模块等产生日志的对象
+    QString msg;
+};
+
 struct TIME_RANGE {
     qint64 begin = -1;
     qint64 end = -1;
@@ -329,6 +344,7 @@ struct JOURNAL_FILTERS {
 struct DMESG_FILTERS {
     qint64 timeFilter;
     PRIORITY levelFilter;
+    quint64 sinceSeq = 0; // 只读取内核日志序号大于该值的记录，用于增量刷新
 };
 struct DNF_FILTERS {
     qint64 timeFilter;
@@ -446,6 +462,7 @@ enum LOG_FLAG {
     Audit,
     COREDUMP,
     Auth,
+    TIMELINE,   // 多来源合并时间线
     NONE = 9999
 }; // modified by
 Q_DECLARE_METATYPE(LOG_FLAG)
@@ -500,6 +517,8 @@ struct LOG_MSG_BASE {
 Q_DECLARE_METATYPE(LOG_MSG_BASE)
 
 #define SEGEMENT_SIZE 60000
+// 浏览位置距分段边缘不足该行数时，后台预取相邻分段
+#define SEGEMENT_PREFETCH_DISTANCE 20000
 
 struct LOG_FILTER_BASE {
     LOG_FLAG type = NONE;
@@ -507,6 +526,8 @@ struct LOG_FILTER_BASE {
     qint64 timeFilterEnd = -1;
     QString filePath;
     int segementIndex;
+    // 分段导出时解析结果直接以结构体传递，不序列化为json
+    bool exportRecords = false;
 };
 
 Q_DECLARE_METATYPE(LOG_FILTER_BASE)
@@ -5,7 +5,6 @@
 #ifndef UTILS_H
 #define UTILS_H
 #define SINGLE_READ_CNT 500
-#define SINGLE_READ_CNT_COREDUMP 600
 
 #include "dtkcore_config.h"
 #ifdef DTKCORE_CLASS_DConfig
@@ -91,6 +90,8 @@ public:
     static int specialComType;
     static QString homePath;
     static bool runInCmd;
+    // 窗口先显示，日志种类列表在后台探测后再填充
+    static bool lazyStartup;
 };
 
 #ifdef DTKCORE_CLASS_DConfigFile
@@ -4,8 +4,17 @@
 
 #include "wtmpparse.h"
 #include <QDebug>
+#include <QDateTime>
+#include <QHash>
+#include <QLocale>
 #include <QLoggingCategory>
 
+#include <algorithm>
+#include <pwd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+
 Q_DECLARE_LOGGING_CATEGORY(logApp)
 
 int wtmp_open(char *filename)
@@ -56,7 +65,6 @@ int wtmp_reload(void)
 
 struct utmp *wtmp_next(void)
 {
-    qCDebug(logApp) << "Getting next wtmp record";
     struct utmp *recp;
 
     if (fdWtmp == -1) {
@@ -95,7 +103,6 @@ int wtmp_reload_back(void)
 }
 struct utmp *wtmp_back(void)
 {
-    qCDebug(logApp) << "Getting previous wtmp record";
     struct utmp *recp;
 
     if (fdWtmp == -1) {
@@ -242,3 +249,300 @@ void show_base_info(struct utmp *uBuf)
     printf("%-17.16s", uBuf->ut_host);
 }
 
+
+WtmpReader::WtmpReader()
+{
+}
+
+WtmpReader::~WtmpReader()
+{
+    close();
+}
+
+bool WtmpReader::open(const QString &filePath)
+{
+    close();
+    qCDebug(logApp) << "WtmpReader opening:" << filePath;
+    int fd = ::open(filePath.toLocal8Bit().constData(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        qCWarning(logApp) << "Failed to open wtmp file:" << filePath << "error:" << strerror(errno);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        qCWarning(logApp) << "Failed to stat wtmp file:" << filePath << "error:" << strerror(errno);
+        ::close(fd);
+        return false;
+    }
+
+    // 末尾不完整的记录直接忽略
+    m_count = st.st_size / static_cast<qint64>(UTSIZE);
+    if (m_count > 0) {
+        m_mapSize = static_cast<size_t>(m_count) * UTSIZE;
+        m_map = mmap(nullptr, m_mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m_map == MAP_FAILED) {
+            qCWarning(logApp) << "Failed to mmap wtmp file:" << filePath << "error:" << strerror(errno);
+            m_map = nullptr;
+            m_mapSize = 0;
+            m_count = 0;
+            ::close(fd);
+            return false;
+        }
+        m_records = static_cast<const struct utmp *>(m_map);
+    }
+    // 映射建立后即可关闭文件描述符
+    ::close(fd);
+    m_isOpen = true;
+    qCDebug(logApp) << "WtmpReader mapped" << m_count << "records";
+    return true;
+}
+
+void WtmpReader::close()
+{
+    if (m_map)
+        munmap(m_map, m_mapSize);
+    m_map = nullptr;
+    m_mapSize = 0;
+    m_records = nullptr;
+    m_count = 0;
+    m_isOpen = false;
+}
+
+qint64 WtmpReader::lowerBound(qint64 secs) const
+{
+    qint64 lo = 0;
+    qint64 hi = m_count;
+    while (lo < hi) {
+        qint64 mid = lo + (hi - lo) / 2;
+        if (static_cast<qint64>(m_records[mid].ut_tv.tv_sec) < secs)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+namespace {
+// wtmp中关机记录为RUN_LVL类型，修正类型后使用该值区分，与last命令一致
+const short SHUTDOWN_TIME = 254;
+
+enum WtmpLogoutReason {
+    R_CRASH = 1,    // 未正常关机
+    R_DOWN,         // 正常关机
+    R_NOW,          // 仍然在线
+    R_NORMAL,       // 正常注销
+    R_REBOOT,       // 开机记录
+    R_PHANTOM       // 无注销记录且会话已不存在
+};
+
+/**
+ * @brief isPhantom 判断仍在线的登录会话是否实际已不存在，与last命令的判断逻辑一致
+ */
+bool isPhantom(const struct utmp &ut, qint64 bootTime)
+{
+    if (static_cast<qint64>(ut.ut_tv.tv_sec) < bootTime)
+        return true;
+
+    char user[sizeof(ut.ut_user) + 1] = {0};
+    memcpy(user, ut.ut_user, sizeof(ut.ut_user));
+    struct passwd *pw = getpwnam(user);
+    if (!pw)
+        return true;
+
+    char path[sizeof(ut.ut_line) + 16] = {0};
+    snprintf(path, sizeof(path), "/proc/%u/loginuid", static_cast<unsigned>(ut.ut_pid));
+    if (access(path, R_OK) == 0) {
+        FILE *f = fopen(path, "r");
+        if (!f)
+            return true;
+        unsigned int loginuid = 0;
+        bool ret = (fscanf(f, "%u", &loginuid) != 1);
+        fclose(f);
+        return ret || pw->pw_uid != loginuid;
+    }
+
+    char line[sizeof(ut.ut_line) + 1] = {0};
+    memcpy(line, ut.ut_line, sizeof(ut.ut_line));
+    snprintf(path, sizeof(path), "/dev/%s", line);
+    struct stat st;
+    if (stat(path, &st))
+        return true;
+    return pw->pw_uid != st.st_uid;
+}
+
+/**
+ * @brief formatSpan 按last命令的格式生成时间段描述
+ */
+QString formatSpan(qint64 loginTime, qint64 logoutTime, WtmpLogoutReason reason, qint64 currentTime)
+{
+    QLocale locale = QLocale::English;
+    QString loginStr = locale.toString(QDateTime::fromMSecsSinceEpoch(loginTime * 1000), "ddd MMM d hh:mm");
+    QString logoutStr = "- " + QDateTime::fromMSecsSinceEpoch(logoutTime * 1000).toString("hh:mm");
+
+    qint64 secs = logoutTime - loginTime;
+    qint64 mins = (secs / 60) % 60;
+    qint64 hours = (secs / 3600) % 24;
+    qint64 days = secs / 86400;
+    QString length;
+    if (logoutTime == currentTime) {
+        logoutStr = "still running";
+    } else if (days) {
+        length = QString("(%1+%2:%3)").arg(days).arg(qAbs(hours), 2, 10, QChar('0')).arg(qAbs(mins), 2, 10, QChar('0'));
+    } else if (hours || secs >= 0) {
+        length = QString("(%1:%2)").arg(qAbs(hours), 2, 10, QChar('0')).arg(qAbs(mins), 2, 10, QChar('0'));
+    } else {
+        length = QString("(-00:%1)").arg(qAbs(mins), 2, 10, QChar('0'));
+    }
+
+    switch (reason) {
+    case R_CRASH:
+        logoutStr = "- crash";
+        break;
+    case R_DOWN:
+        logoutStr = "- down";
+        break;
+    case R_NOW:
+        logoutStr = "still logged in";
+        length.clear();
+        break;
+    case R_PHANTOM:
+        logoutStr = "gone";
+        length = "- no logout";
+        break;
+    default:
+        break;
+    }
+
+    return QString("%1 %2 %3").arg(loginStr, logoutStr, length).trimmed();
+}
+}
+
+QList<WTMP_EVENT> WtmpReader::events(qint64 timeBegin, qint64 timeEnd, const std::atomic_bool *canRun) const
+{
+    QList<WTMP_EVENT> result;
+    if (m_count == 0)
+        return result;
+
+    const bool hasRange = timeBegin > 0 && timeEnd > 0;
+    // 早于时间范围的记录不影响范围内事件的配对，只需从范围起点逆序遍历到文件末尾
+    const qint64 startIndex = hasRange ? lowerBound(timeBegin / 1000) : 0;
+    qCDebug(logApp) << "WtmpReader parsing records from index:" << startIndex << "total:" << m_count;
+
+    const qint64 currentTime = time(nullptr);
+    struct sysinfo info;
+    const qint64 bootTime = (sysinfo(&info) == 0) ? currentTime - info.uptime : 0;
+
+    // 以下配对逻辑与last命令一致：逆序遍历，记录每个终端最早的注销时间，遇到开关机时清空
+    QHash<QByteArray, qint64> logoutTimes;
+    qint64 lastBoot = 0;
+    qint64 lastDown = currentTime;
+    WtmpLogoutReason whyDown = R_CRASH;
+
+    for (qint64 i = m_count - 1; i >= startIndex; --i) {
+        if (canRun && ((i & 0xfff) == 0) && !(*canRun))
+            return QList<WTMP_EVENT>();
+
+        const struct utmp &origin = m_records[i];
+        struct utmp ut = origin;
+        const qint64 utTime = ut.ut_tv.tv_sec;
+        const QByteArray user(ut.ut_user, static_cast<int>(strnlen(ut.ut_user, sizeof(ut.ut_user))));
+        const QByteArray line(ut.ut_line, static_cast<int>(strnlen(ut.ut_line, sizeof(ut.ut_line))));
+
+        // 修正ut_type
+        if (line.startsWith('~')) {
+            if (user.startsWith("shutdown"))
+                ut.ut_type = SHUTDOWN_TIME;
+            else if (user.startsWith("reboot"))
+                ut.ut_type = BOOT_TIME;
+            else if (user.startsWith("runlevel"))
+                ut.ut_type = RUN_LVL;
+        } else {
+            if (ut.ut_type != DEAD_PROCESS && !user.isEmpty() && !line.isEmpty() && user != "LOGIN")
+                ut.ut_type = USER_PROCESS;
+            if (user.isEmpty())
+                ut.ut_type = DEAD_PROCESS;
+        }
+
+        QString span;
+        bool down = false;
+        bool isShutdown = false;
+        switch (ut.ut_type) {
+        case SHUTDOWN_TIME:
+            lastDown = utTime;
+            down = true;
+            isShutdown = true;
+            break;
+        case BOOT_TIME:
+            span = formatSpan(utTime, lastDown, R_REBOOT, currentTime);
+            lastBoot = utTime;
+            down = true;
+            break;
+        case RUN_LVL: {
+            int x = ut.ut_pid & 255;
+            if (x == '0' || x == '6') {
+                lastDown = utTime;
+                down = true;
+                isShutdown = true;
+            }
+            break;
+        }
+        case USER_PROCESS: {
+            auto it = logoutTimes.find(line);
+            if (it != logoutTimes.end()) {
+                span = formatSpan(utTime, it.value(), R_NORMAL, currentTime);
+                logoutTimes.erase(it);
+            } else if (!lastBoot) {
+                span = formatSpan(utTime, lastBoot, isPhantom(ut, bootTime) ? R_PHANTOM : R_NOW, currentTime);
+            } else {
+                span = formatSpan(utTime, lastBoot, whyDown, currentTime);
+            }
+        }
+        Q_FALLTHROUGH();
+        case DEAD_PROCESS:
+            if (!line.isEmpty())
+                logoutTimes.insert(line, utTime);
+            break;
+        default:
+            break;
+        }
+
+        if (down) {
+            lastBoot = utTime;
+            whyDown = isShutdown ? R_DOWN : R_CRASH;
+            logoutTimes.clear();
+        }
+
+        // 以下筛选条件与原开关机事件解析逻辑一致
+        if (origin.ut_type != RUN_LVL && origin.ut_type != BOOT_TIME && origin.ut_type != USER_PROCESS)
+            continue;
+        if (user == "runlevel" || (origin.ut_type == RUN_LVL && user != "shutdown") || utTime <= 0)
+            continue;
+        if (hasRange && (utTime * 1000 < timeBegin || utTime * 1000 > timeEnd))
+            continue;
+
+        WTMP_EVENT event;
+        event.record = origin;
+        event.userName = QString::fromLocal8Bit(user);
+        event.span = span;
+        result.append(event);
+    }
+
+    // 开关机事件的用户名为此前最近一次登录的用户，需从范围起点之前找到最近的登录记录
+    QString loginName = "root";
+    for (qint64 i = startIndex - 1; i >= 0; --i) {
+        const struct utmp &ut = m_records[i];
+        if (ut.ut_type == USER_PROCESS && ut.ut_tv.tv_sec > 0) {
+            loginName = QString::fromLocal8Bit(ut.ut_user, static_cast<int>(strnlen(ut.ut_user, sizeof(ut.ut_user))));
+            break;
+        }
+    }
+    for (auto it = result.rbegin(); it != result.rend(); ++it) {
+        if (it->record.ut_type == USER_PROCESS)
+            loginName = it->userName;
+        else
+            it->userName = loginName;
+    }
+
+    return result;
+}
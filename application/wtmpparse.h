@@ -14,6 +14,10 @@
 #include <unistd.h>
 #include <utmp.h>
 #include <QDebug>
+#include <QList>
+#include <QString>
+
+#include <atomic>
 #define NRECS 16
 #define NULLUT ((struct utmp *)NULL)
 #define UTSIZE (sizeof(struct utmp))
@@ -54,4 +58,52 @@ char *show_start_time(time_t timeval);
 
 void show_base_info(struct utmp *uBuf);
 
+/**
+ * @brief The WTMP_EVENT struct 开关机/登录事件，由WtmpReader一次遍历配对得到
+ */
+struct WTMP_EVENT {
+    struct utmp record;     // 原始记录
+    QString userName;       // 登录用户名，开关机事件为此前最近一次登录的用户
+    QString span;           // 登录/开机时间段描述，格式与last命令输出一致，如"Mon Oct 19 10:00 - 10:30 (00:30)"
+};
+
+/**
+ * @brief The WtmpReader class 可重入的wtmp文件读取器
+ * 通过mmap将wtmp文件映射为定长struct utmp数组，按ut_tv二分定位时间范围，
+ * 并在一次逆序遍历中完成登录/注销、开机/关机配对，无需再调用last命令
+ */
+class WtmpReader
+{
+public:
+    WtmpReader();
+    ~WtmpReader();
+
+    bool open(const QString &filePath);
+    void close();
+    bool isOpen() const { return m_isOpen; }
+
+    qint64 count() const { return m_count; }
+    const struct utmp *at(qint64 index) const { return m_records + index; }
+
+    /**
+     * @brief lowerBound 二分查找第一条记录时间不早于secs的下标
+     */
+    qint64 lowerBound(qint64 secs) const;
+
+    /**
+     * @brief events 解析时间范围内的开关机/登录事件，按时间倒序返回
+     * @param timeBegin 开始时间(ms)，<=0表示不限制
+     * @param timeEnd 结束时间(ms)，<=0表示不限制
+     * @param canRun 运行标记，置false时中断解析
+     */
+    QList<WTMP_EVENT> events(qint64 timeBegin = -1, qint64 timeEnd = -1, const std::atomic_bool *canRun = nullptr) const;
+
+private:
+    bool m_isOpen = false;
+    void *m_map = nullptr;
+    size_t m_mapSize = 0;
+    const struct utmp *m_records = nullptr;
+    qint64 m_count = 0;
+};
+
 #endif  // WTMPPARSE_H
@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * 日志解析、筛选与导出基准测试
+ * 在合成语料上测量LogAuthThread各handle*解析、WtmpReader、应用日志解析的行吞吐量，
+ * LogBackend::filter*筛选吞吐量，以及LogExportThread对各日志类型各导出格式的耗时。
+ * 读取日志的DBus接口通过桩函数改为直接读取本地文件，测量结果不包含DBus传输开销。
+ * 用法：bench-parsers [--corpus 语料目录] [--size 语料大小MB] [--seed 种子] [--runs 重复次数]
+ *                    [--cases 用例名前缀,逗号分隔] [--export-rows 导出行数]
+ * 每项结果输出一行JSON。
+ */
+
+#include "benchreport.h"
+#include "corpusgenerator.h"
+
+#include "dldbushandler.h"
+#include "logapplicationparsethread.h"
+#include "logauththread.h"
+#include "logbackend.h"
+#include "logexportthread.h"
+#include "qtcompat.h"
+#include "utils.h"
+#include "wtmpparse.h"
+
+#include "stub.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QTemporaryDir>
+
+#include <atomic>
+#include <functional>
+
+Q_LOGGING_CATEGORY(logApp, "org.deepin.log.viewer.main", QtWarningMsg)
+
+static QString readLocalFile(const QString &filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return QString();
+    return QString::fromUtf8(file.readAll());
+}
+
+// 以下桩函数替换成员函数，第一个参数为this
+static QString stub_readLog(void *, const QString &filePath)
+{
+    return readLocalFile(filePath);
+}
+
+static QString stub_readLogStream(void *, const QString &filePath)
+{
+    return readLocalFile(filePath);
+}
+
+static bool stub_isFileExist(void *, const QString &filePath)
+{
+    return QFile::exists(filePath);
+}
+
+static quint64 stub_getFileSize(void *, const QString &filePath)
+{
+    return static_cast<quint64>(QFileInfo(filePath).size());
+}
+
+static bool stub_ensureSession(void *)
+{
+    return true;
+}
+
+static void stub_noop(void *)
+{
+}
+
+class ParserBench
+{
+public:
+    ParserBench(const QString &corpusDir, int runs, const QStringList &cases)
+        : m_corpusDir(corpusDir)
+        , m_runs(runs)
+        , m_cases(cases)
+    {
+    }
+
+    QString corpusFile(CorpusGenerator::Type type) const
+    {
+        return QDir(m_corpusDir).absoluteFilePath(CorpusGenerator::fileName(type));
+    }
+
+    bool enabled(const QString &name) const
+    {
+        if (m_cases.isEmpty())
+            return true;
+        for (const QString &prefix : m_cases) {
+            if (name.startsWith(prefix))
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief run 重复执行用例并逐次输出结果
+     * @param fn 执行一次用例，返回处理的行数
+     * @param bytes 用例输入的数据量，导出用例在fn中通过setOutputBytes改为输出文件大小
+     */
+    template<typename Fn>
+    void run(const QString &name, qint64 bytes, Fn fn)
+    {
+        if (!enabled(name))
+            return;
+
+        QElapsedTimer timer;
+        for (int i = 0; i < m_runs; ++i) {
+            m_outputBytes = -1;
+            timer.start();
+            const qint64 rows = fn();
+            const qint64 nsecs = timer.nsecsElapsed();
+            if (rows < 0) {
+                printResult({{"benchmark", "parsers"}, {"case", name}, {"run", i}, {"ok", false}});
+                continue;
+            }
+
+            const qint64 size = m_outputBytes >= 0 ? m_outputBytes : bytes;
+            printResult({
+                {"benchmark", "parsers"},
+                {"case", name},
+                {"run", i},
+                {"rows", rows},
+                {"bytes", size},
+                {"seconds", nsecs / 1e9},
+                {"rows_per_sec", throughput(rows, nsecs)},
+                {"mbps", throughput(size / 1048576.0, nsecs)}
+            });
+        }
+    }
+
+    // 导出用例的数据量为输出文件大小
+    void setOutputBytes(qint64 bytes) { m_outputBytes = bytes; }
+
+private:
+    QString m_corpusDir;
+    int m_runs;
+    QStringList m_cases;
+    qint64 m_outputBytes = -1;
+};
+
+/**
+ * @brief parseWith 同步执行一次LogAuthThread解析，数据信号直连收集结果
+ */
+template<typename T, typename Filter>
+static qint64 parseWith(LOG_FLAG flag, const QString &filePath, const Filter &filter,
+                        void (LogAuthThread::*dataSignal)(int, QList<T>), QList<T> *result)
+{
+    LogAuthThread *thread = new LogAuthThread;
+    thread->setAutoDelete(false);
+    thread->setType(flag);
+    thread->setFileterParam(filter);
+    thread->setFilePath(QStringList() << filePath);
+
+    qint64 rows = 0;
+    if (result)
+        result->clear();
+    QObject::connect(thread, dataSignal, thread, [&rows, result](int, QList<T> list) {
+        rows += list.size();
+        if (result)
+            result->append(list);
+    }, Qt::DirectConnection);
+
+    thread->run();
+    delete thread;
+    return rows;
+}
+
+int main(int argc, char *argv[])
+{
+    // 桩需晚于DLDBusHandler析构时恢复，避免退出时调用真实的DBus接口
+    Stub stub;
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption corpusOption("corpus", "Corpus directory, generated when empty.", "dir");
+    QCommandLineOption sizeOption("size", "Size of each generated corpus file in MB.", "mb", "32");
+    QCommandLineOption seedOption("seed", "Random seed of the generated corpus.", "n", "1");
+    QCommandLineOption runsOption("runs", "Repetitions of each case.", "n", "3");
+    QCommandLineOption casesOption("cases", "Comma separated case name prefixes.", "list");
+    QCommandLineOption exportRowsOption("export-rows", "Rows used by the export cases.", "n", "100000");
+    parser.addOptions({corpusOption, sizeOption, seedOption, runsOption, casesOption, exportRowsOption});
+    parser.process(app);
+
+    QTemporaryDir workDir(QDir(QDir::tempPath()).filePath("bench-parsers-XXXXXX"));
+    if (!workDir.isValid()) {
+        fprintf(stderr, "failed to create work dir in %s\n", qPrintable(QDir::tempPath()));
+        return 1;
+    }
+
+    QString corpusDir = parser.value(corpusOption);
+    if (corpusDir.isEmpty()) {
+        corpusDir = workDir.filePath("corpus");
+        QDir().mkpath(corpusDir);
+        CorpusGenerator generator(parser.value(seedOption).toULongLong());
+        const qint64 size = static_cast<qint64>(parser.value(sizeOption).toDouble() * 1024 * 1024);
+        for (int i = 0; i < CorpusGenerator::TypeCount; ++i) {
+            const auto type = static_cast<CorpusGenerator::Type>(i);
+            if (generator.generate(type, QDir(corpusDir).filePath(CorpusGenerator::fileName(type)), size) < 0) {
+                fprintf(stderr, "failed to generate corpus in %s\n", qPrintable(corpusDir));
+                return 1;
+            }
+        }
+    }
+
+    // 读取接口改为读取本地文件，鉴权与会话直接通过
+    Utils::runInCmd = true;
+    DLDBusHandler::instance(&app);
+    stub.set(ADDR(DLDBusHandler, readLog), stub_readLog);
+    stub.set(ADDR(DLDBusHandler, isFileExist), stub_isFileExist);
+    stub.set(ADDR(DLDBusHandler, getFileSize), stub_getFileSize);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
+    stub.set(ADDR(DLDBusHandler, closeSession), stub_noop);
+    stub.set(ADDR(DLDBusHandler, quit), stub_noop);
+    stub.set(ADDR(LogAuthThread, readLogStream), stub_readLogStream);
+
+    ParserBench bench(corpusDir, qMax(1, parser.value(runsOption).toInt()),
+                      parser.value(casesOption).split(",", SKIP_EMPTY_PARTS));
+    auto fileSize = [&bench](CorpusGenerator::Type type) {
+        return QFileInfo(bench.corpusFile(type)).size();
+    };
+
+    // 解析：各用例最后一次的结果保留下来供筛选与导出用例使用
+    QList<LOG_MSG_JOURNAL> kernList;
+    QList<LOG_MSG_AUTH> authList;
+    QList<LOG_MSG_DPKG> dpkgList;
+    QList<LOG_MSG_XORG> xorgList;
+    QList<LOG_MSG_AUDIT> auditList;
+    QList<LOG_MSG_APPLICATOIN> appList;
+
+    bench.run("parse_kern", fileSize(CorpusGenerator::Kern), [&] {
+        return parseWith(KERN, bench.corpusFile(CorpusGenerator::Kern), KERN_FILTERS(), &LogAuthThread::kernData, &kernList);
+    });
+    bench.run("parse_auth", fileSize(CorpusGenerator::Auth), [&] {
+        return parseWith(Auth, bench.corpusFile(CorpusGenerator::Auth), AUTH_FILTERS(), &LogAuthThread::authData, &authList);
+    });
+    bench.run("parse_dpkg", fileSize(CorpusGenerator::Dpkg), [&] {
+        return parseWith(DPKG, bench.corpusFile(CorpusGenerator::Dpkg), DKPG_FILTERS(), &LogAuthThread::dpkgData, &dpkgList);
+    });
+    bench.run("parse_xorg", fileSize(CorpusGenerator::Xorg), [&] {
+        return parseWith(XORG, bench.corpusFile(CorpusGenerator::Xorg), XORG_FILTERS(), &LogAuthThread::xorgData, &xorgList);
+    });
+    bench.run("parse_audit", fileSize(CorpusGenerator::Audit), [&] {
+        return parseWith(Audit, bench.corpusFile(CorpusGenerator::Audit), AUDIT_FILTERS(), &LogAuthThread::auditData, &auditList);
+    });
+    bench.run("parse_wtmp", fileSize(CorpusGenerator::Wtmp), [&]() -> qint64 {
+        WtmpReader reader;
+        if (!reader.open(bench.corpusFile(CorpusGenerator::Wtmp)))
+            return -1;
+        return reader.events().size();
+    });
+    bench.run("parse_app", fileSize(CorpusGenerator::App), [&]() -> qint64 {
+        APP_FILTERS filter;
+        filter.lvlFilter = LVALL;
+        filter.submodule = "bench";
+        std::atomic<bool> canRun(true);
+        auto result = LogApplicationParseThread::parseFileContent(filter, readLocalFile(bench.corpusFile(CorpusGenerator::App)),
+                                                                  QMap<QString, int>(), canRun);
+        appList = result.msgs;
+        return appList.size();
+    });
+
+    // 筛选：关键字在语料中约有一半的行命中，行数为命中的行数
+    bench.run("filter_kern", 0, [&] {
+        return LogBackend::filterKern("usb", kernList).size();
+    });
+    bench.run("filter_dpkg", 0, [&] {
+        return LogBackend::filterDpkg("systemd", dpkgList).size();
+    });
+    bench.run("filter_xorg", 0, [&] {
+        return LogBackend::filterXorg("error", xorgList).size();
+    });
+    bench.run("filter_audit", 0, [&] {
+        AUDIT_FILTERS filter;
+        filter.searchstr = "sshd";
+        return LogBackend::filterAudit(filter, auditList).size();
+    });
+    bench.run("filter_app", 0, [&] {
+        APP_FILTERS filter;
+        filter.searchstr = "timeout";
+        return LogBackend::filterApp(filter, appList).size();
+    });
+
+    // 导出：各日志类型的四种格式，用例名为export_类型_格式
+    const int exportRows = parser.value(exportRowsOption).toInt();
+    LogExportThread exporter;
+    exporter.m_canRunning = true;
+    auto exportCase = [&](const QString &name, const QString &suffix, qint64 rows, const std::function<bool(const QString &)> &fn) {
+        const QString path = workDir.filePath("export." + suffix);
+        bench.run(name, 0, [&]() -> qint64 {
+            QFile::remove(path);
+            if (!fn(path))
+                return -1;
+            bench.setOutputBytes(QFileInfo(path).size());
+            return rows;
+        });
+    };
+
+    const QList<LOG_MSG_JOURNAL> kernExport = kernList.mid(0, exportRows);
+    const QStringList kernLabels {"Time", "Host", "Process", "Info"};
+    exportCase("export_kern_txt", "txt", kernExport.size(), [&](const QString &path) { return exporter.exportToTxt(path, kernExport, kernLabels, KERN); });
+    exportCase("export_kern_html", "html", kernExport.size(), [&](const QString &path) { return exporter.exportToHtml(path, kernExport, kernLabels, KERN); });
+    exportCase("export_kern_doc", "docx", kernExport.size(), [&](const QString &path) { return exporter.exportToDoc(path, kernExport, kernLabels, KERN); });
+    exportCase("export_kern_xls", "xlsx", kernExport.size(), [&](const QString &path) { return exporter.exportToXls(path, kernExport, kernLabels, KERN); });
+
+    const QList<LOG_MSG_DPKG> dpkgExport = dpkgList.mid(0, exportRows);
+    const QStringList dpkgLabels {"Time", "Info", "Action"};
+    exportCase("export_dpkg_txt", "txt", dpkgExport.size(), [&](const QString &path) { return exporter.exportToTxt(path, dpkgExport, dpkgLabels); });
+    exportCase("export_dpkg_html", "html", dpkgExport.size(), [&](const QString &path) { return exporter.exportToHtml(path, dpkgExport, dpkgLabels); });
+    exportCase("export_dpkg_doc", "docx", dpkgExport.size(), [&](const QString &path) { return exporter.exportToDoc(path, dpkgExport, dpkgLabels); });
+    exportCase("export_dpkg_xls", "xlsx", dpkgExport.size(), [&](const QString &path) { return exporter.exportToXls(path, dpkgExport, dpkgLabels); });
+
+    const QList<LOG_MSG_XORG> xorgExport = xorgList.mid(0, exportRows);
+    const QStringList xorgLabels {"Time", "Info"};
+    exportCase("export_xorg_txt", "txt", xorgExport.size(), [&](const QString &path) { return exporter.exportToTxt(path, xorgExport, xorgLabels); });
+    exportCase("export_xorg_html", "html", xorgExport.size(), [&](const QString &path) { return exporter.exportToHtml(path, xorgExport, xorgLabels); });
+    exportCase("export_xorg_doc", "docx", xorgExport.size(), [&](const QString &path) { return exporter.exportToDoc(path, xorgExport, xorgLabels); });
+    exportCase("export_xorg_xls", "xlsx", xorgExport.size(), [&](const QString &path) { return exporter.exportToXls(path, xorgExport, xorgLabels); });
+
+    const QList<LOG_MSG_AUDIT> auditExport = auditList.mid(0, exportRows);
+    const QStringList auditLabels {"Event Type", "Time", "Process", "Status", "Info"};
+    exportCase("export_audit_txt", "txt", auditExport.size(), [&](const QString &path) { return exporter.exportToTxt(path, auditExport, auditLabels); });
+    exportCase("export_audit_html", "html", auditExport.size(), [&](const QString &path) { return exporter.exportToHtml(path, auditExport, auditLabels); });
+    exportCase("export_audit_doc", "docx", auditExport.size(), [&](const QString &path) { return exporter.exportToDoc(path, auditExport, auditLabels); });
+    exportCase("export_audit_xls", "xlsx", auditExport.size(), [&](const QString &path) { return exporter.exportToXls(path, auditExport, auditLabels); });
+
+    const QList<LOG_MSG_APPLICATOIN> appExport = appList.mid(0, exportRows);
+    const QStringList appLabels {"Level", "Time", "Source", "Info"};
+    QString appName = "bench";
+    exportCase("export_app_txt", "txt", appExport.size(), [&](const QString &path) { return exporter.exportToTxt(path, appExport, appLabels, appName); });
+    exportCase("export_app_html", "html", appExport.size(), [&](const QString &path) { return exporter.exportToHtml(path, appExport, appLabels, appName); });
+    exportCase("export_app_doc", "docx", appExport.size(), [&](const QString &path) { return exporter.exportToDoc(path, appExport, appLabels, appName); });
+    exportCase("export_app_xls", "xlsx", appExport.size(), [&](const QString &path) { return exporter.exportToXls(path, appExport, appLabels, appName); });
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * 服务端读取接口基准测试
+ * 直接调用LogViewerService的readLog、openLogStream/readLogInStream、readLogLinesInRange与getLineCount，
+ * 分别测量普通文件与gzip轮转归档的读取吞吐量。polkit鉴权通过桩函数跳过，测量结果不包含DBus传输开销。
+ * 用法：bench-serviceread [--dir 测试目录] [--size 语料大小MB] [--seed 种子] [--runs 重复次数] [--pages 分页读取页数]
+ * 测试目录须位于服务允许读取的路径下(/tmp、/home等)。每项结果输出一行JSON。
+ * 首次运行的gzip用例包含建立归档索引的耗时，之后的运行使用内存中的索引。
+ */
+
+#include "benchreport.h"
+#include "corpusgenerator.h"
+
+#include "logarchivecache.h"
+#include "logviewerservice.h"
+
+#include "stub.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+#include <zlib.h>
+
+// 分页读取的每页行数，与前端分段加载一致
+const qint64 BENCH_PAGE_LINES = 500;
+
+static bool stub_checkAuth(void *, const QString &, bool)
+{
+    return true;
+}
+
+static bool gzipFile(const QString &src, const QString &dst)
+{
+    QFile in(src);
+    if (!in.open(QIODevice::ReadOnly))
+        return false;
+    gzFile out = gzopen(QFile::encodeName(dst).constData(), "wb6");
+    if (!out)
+        return false;
+
+    bool ok = true;
+    while (ok && !in.atEnd()) {
+        const QByteArray block = in.read(1024 * 1024);
+        ok = gzwrite(out, block.constData(), static_cast<unsigned>(block.size())) == block.size();
+    }
+    return gzclose(out) == Z_OK && ok;
+}
+
+static void report(const QString &name, const QString &file, int run, qint64 rows, qint64 bytes, qint64 nsecs)
+{
+    printResult({
+        {"benchmark", "serviceread"},
+        {"case", name},
+        {"file", file},
+        {"run", run},
+        {"rows", rows},
+        {"bytes", bytes},
+        {"seconds", nsecs / 1e9},
+        {"rows_per_sec", throughput(rows, nsecs)},
+        {"mbps", throughput(bytes / 1048576.0, nsecs)}
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption dirOption("dir", "Directory for test files, must be readable by the service.", "dir", "/tmp");
+    QCommandLineOption sizeOption("size", "Size of the generated log in MB.", "mb", "64");
+    QCommandLineOption seedOption("seed", "Random seed of the generated log.", "n", "1");
+    QCommandLineOption runsOption("runs", "Repetitions of each case.", "n", "3");
+    QCommandLineOption pagesOption("pages", "Pages read by the range case.", "n", "200");
+    parser.addOptions({dirOption, sizeOption, seedOption, runsOption, pagesOption});
+    parser.process(app);
+
+    QTemporaryDir workDir(QDir(parser.value(dirOption)).filePath("bench-serviceread-XXXXXX"));
+    if (!workDir.isValid()) {
+        fprintf(stderr, "failed to create work dir in %s\n", qPrintable(parser.value(dirOption)));
+        return 1;
+    }
+
+    const QString plainFile = workDir.filePath("kern.log");
+    const QString archiveFile = workDir.filePath("kern.log.1.gz");
+    CorpusGenerator generator(parser.value(seedOption).toULongLong());
+    const qint64 size = static_cast<qint64>(parser.value(sizeOption).toDouble() * 1024 * 1024);
+    if (generator.generate(CorpusGenerator::Kern, plainFile, size) < 0 || !gzipFile(plainFile, archiveFile)) {
+        fprintf(stderr, "failed to generate test files in %s\n", qPrintable(workDir.path()));
+        return 1;
+    }
+
+    Stub stub;
+    stub.set(ADDR(LogViewerService, checkAuth), stub_checkAuth);
+    // 归档索引写到测试目录，非root用户也可运行
+    LogArchiveCache::instance()->setCacheDir(workDir.filePath("archive-index"));
+
+    LogViewerService service;
+    const int runs = qMax(1, parser.value(runsOption).toInt());
+    const qint64 pages = qMax(1, parser.value(pagesOption).toInt());
+    const qint64 plainSize = QFileInfo(plainFile).size();
+    QElapsedTimer timer;
+
+    for (const QString &file : {plainFile, archiveFile}) {
+        const QString fileName = QFileInfo(file).fileName();
+        for (int run = 0; run < runs; ++run) {
+            timer.start();
+            const QString content = service.readLog(file);
+            report("readlog", fileName, run, content.count('\n'), plainSize, timer.nsecsElapsed());
+
+            timer.start();
+            qint64 rows = 0;
+            const QString token = service.openLogStream(file);
+            for (QString block = service.readLogInStream(token); !block.isEmpty(); block = service.readLogInStream(token))
+                rows += block.count('\n');
+            report("stream", fileName, run, rows, plainSize, timer.nsecsElapsed());
+
+            timer.start();
+            rows = service.getLineCount(file);
+            report("linecount", fileName, run, rows, plainSize, timer.nsecsElapsed());
+
+            // 从文件头开始顺序分页读取
+            timer.start();
+            qint64 bytes = 0;
+            rows = 0;
+            for (qint64 page = 0; page < pages; ++page) {
+                const QStringList lines = service.readLogLinesInRange(file, page * BENCH_PAGE_LINES, BENCH_PAGE_LINES, false);
+                if (lines.isEmpty())
+                    break;
+                rows += lines.size();
+                for (const QString &line : lines)
+                    bytes += line.size() + 1;
+            }
+            report("range_forward", fileName, run, rows, bytes, timer.nsecsElapsed());
+
+            // 倒序读取最后一页，对应打开日志时首屏的读取
+            timer.start();
+            const QStringList tail = service.readLogLinesInRange(file, 0, BENCH_PAGE_LINES, true);
+            bytes = 0;
+            for (const QString &line : tail)
+                bytes += line.size() + 1;
+            report("range_tail", fileName, run, tail.size(), bytes, timer.nsecsElapsed());
+        }
+    }
+
+    return 0;
+}
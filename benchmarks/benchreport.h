@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BENCHREPORT_H
+#define BENCHREPORT_H
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <stdio.h>
+
+/**
+ * @brief printResult 各基准测试程序的结果统一输出为一行紧凑JSON，便于脚本汇总对比
+ */
+inline void printResult(const QJsonObject &obj)
+{
+    printf("%s\n", QJsonDocument(obj).toJson(QJsonDocument::Compact).constData());
+    fflush(stdout);
+}
+
+/**
+ * @brief throughput 每秒处理量，耗时为0时返回0
+ */
+inline double throughput(double amount, qint64 nsecs)
+{
+    return nsecs > 0 ? amount * 1e9 / nsecs : 0.0;
+}
+
+#endif // BENCHREPORT_H
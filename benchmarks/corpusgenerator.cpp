@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "corpusgenerator.h"
+
+#include <QDateTime>
+#include <QFile>
+
+#include <string.h>
+#include <utmp.h>
+
+// 语料起始时间 2024-01-01 00:00:00 UTC，所有时间戳均按UTC格式化，与运行环境时区无关
+const qint64 CORPUS_BASE_TIME = 1704067200;
+// 每次写入文件的缓冲大小
+const int CORPUS_WRITE_CHUNK = 4 * 1024 * 1024;
+
+static const char *const s_typeNames[] = {"kern", "auth", "dpkg", "xorg", "audit", "app", "wtmp"};
+static const char *const s_fileNames[] = {"kern.log", "auth.log", "dpkg.log", "Xorg.0.log", "audit.log", "app.log", "wtmp"};
+static const char *const s_months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                       "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+static const char *const s_words[] = {
+    "device", "link", "is", "up", "down", "connected", "started", "stopped", "failed", "reached",
+    "target", "session", "user", "opened", "closed", "for", "new", "mount", "unit", "service",
+    "usb", "eth0", "wlan0", "memory", "cpu", "timeout", "request", "cache", "loaded", "module",
+    "firmware", "error", "warning", "ok", "scan", "disk", "sda1", "ext4", "filesystem", "read-only"
+};
+static const char *const s_daemons[] = {"kernel", "systemd", "NetworkManager", "dbus-daemon", "lightdm", "udisksd"};
+static const char *const s_authDaemons[] = {"sshd", "sudo", "login", "polkitd", "lightdm", "su"};
+static const char *const s_dpkgActions[] = {"install", "upgrade", "remove", "status", "configure", "trigproc"};
+static const char *const s_packages[] = {"libc6", "bash", "coreutils", "systemd", "dde-dock", "deepin-log-viewer",
+                                         "openssl", "libqt5core5a", "xserver-xorg", "linux-image-amd64"};
+static const char *const s_xorgTags[] = {"(II)", "(==)", "(--)", "(**)", "(WW)", "(EE)"};
+static const char *const s_auditTypes[] = {"SYSCALL", "USER_LOGIN", "USER_AUTH", "PATH", "EXECVE", "AVC", "CRED_ACQ"};
+static const char *const s_appLevels[] = {"Debug", "Info", "Info", "Info", "Warning", "Error"};
+static const char *const s_appSources[] = {"main.cpp", "window.cpp", "dbusadaptor.cpp", "settings.cpp", "worker.cpp"};
+
+template<typename T, size_t N>
+static constexpr int countOf(T (&)[N])
+{
+    return static_cast<int>(N);
+}
+
+CorpusGenerator::CorpusGenerator(quint64 seed)
+    : m_seed(seed)
+{
+}
+
+QString CorpusGenerator::typeName(Type type)
+{
+    return type < TypeCount ? QString(s_typeNames[type]) : QString();
+}
+
+bool CorpusGenerator::typeFromName(const QString &name, Type &type)
+{
+    for (int i = 0; i < TypeCount; ++i) {
+        if (name.compare(s_typeNames[i], Qt::CaseInsensitive) == 0) {
+            type = static_cast<Type>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+QString CorpusGenerator::fileName(Type type)
+{
+    return type < TypeCount ? QString(s_fileNames[type]) : QString();
+}
+
+// xorshift64*，结果只取决于种子，不依赖标准库实现
+quint64 CorpusGenerator::next()
+{
+    m_state ^= m_state >> 12;
+    m_state ^= m_state << 25;
+    m_state ^= m_state >> 27;
+    return m_state * 0x2545F4914F6CDD1DULL;
+}
+
+int CorpusGenerator::bounded(int n)
+{
+    return n > 0 ? static_cast<int>((next() >> 33) % static_cast<quint64>(n)) : 0;
+}
+
+QByteArray CorpusGenerator::words(int minCount, int maxCount)
+{
+    const int count = minCount + bounded(maxCount - minCount + 1);
+    QByteArray text;
+    for (int i = 0; i < count; ++i) {
+        if (i > 0)
+            text += ' ';
+        text += s_words[bounded(countOf(s_words))];
+    }
+    return text;
+}
+
+QByteArray CorpusGenerator::textLine(Type type, qint64 index, qint64 secs)
+{
+    const QDateTime dt = QDateTime::fromSecsSinceEpoch(secs, Qt::UTC);
+    const QDate date = dt.date();
+    const QTime time = dt.time();
+    const int usec = bounded(1000000);
+    char head[128];
+
+    switch (type) {
+    case Kern: {
+        // Jan  1 00:00:00 host daemon[pid]: msg，内核自身无pid
+        const int daemon = bounded(countOf(s_daemons));
+        if (daemon == 0) {
+            snprintf(head, sizeof(head), "%s %2d %02d:%02d:%02d bench-host kernel: [%6lld.%06d] ",
+                     s_months[date.month() - 1], date.day(), time.hour(), time.minute(), time.second(),
+                     static_cast<long long>(secs - CORPUS_BASE_TIME), usec);
+        } else {
+            snprintf(head, sizeof(head), "%s %2d %02d:%02d:%02d bench-host %s[%d]: ",
+                     s_months[date.month() - 1], date.day(), time.hour(), time.minute(), time.second(),
+                     s_daemons[daemon], 100 + bounded(30000));
+        }
+        return head + words(3, 16) + '\n';
+    }
+    case Auth:
+        snprintf(head, sizeof(head), "%04d-%02d-%02dT%02d:%02d:%02d.%06d+00:00 bench-host %s[%d]: ",
+                 date.year(), date.month(), date.day(), time.hour(), time.minute(), time.second(), usec,
+                 s_authDaemons[bounded(countOf(s_authDaemons))], 100 + bounded(30000));
+        return head + words(4, 14) + '\n';
+    case Dpkg: {
+        const char *package = s_packages[bounded(countOf(s_packages))];
+        snprintf(head, sizeof(head), "%04d-%02d-%02d %02d:%02d:%02d %s %s:amd64 %d.%d-%d %d.%d-%d\n",
+                 date.year(), date.month(), date.day(), time.hour(), time.minute(), time.second(),
+                 s_dpkgActions[bounded(countOf(s_dpkgActions))], package,
+                 bounded(10), bounded(30), bounded(9), bounded(10), bounded(30), 1 + bounded(9));
+        return head;
+    }
+    case Xorg:
+        // 约十分之一为无时间偏移的续行，解析时拼接到上一条
+        if (index % 10 == 9)
+            return "\t" + words(2, 10) + '\n';
+        snprintf(head, sizeof(head), "[%8lld.%03d] %s ",
+                 static_cast<long long>(secs - CORPUS_BASE_TIME), usec / 1000, s_xorgTags[bounded(countOf(s_xorgTags))]);
+        return head + words(3, 12) + '\n';
+    case Audit: {
+        const char *auditType = s_auditTypes[bounded(countOf(s_auditTypes))];
+        snprintf(head, sizeof(head), "type=%s msg=audit(%lld.%03d:%lld): ",
+                 auditType, static_cast<long long>(secs), usec / 1000, static_cast<long long>(index + 1));
+        QByteArray line(head);
+        if (qstrcmp(auditType, "USER_LOGIN") == 0 || qstrcmp(auditType, "USER_AUTH") == 0 || qstrcmp(auditType, "CRED_ACQ") == 0) {
+            line += QString("pid=%1 uid=0 auid=1000 ses=%2 msg='op=login acct=\"user%3\" exe=\"/usr/sbin/sshd\" "
+                            "hostname=? addr=10.0.%4.%5 terminal=ssh res=%6'\n")
+                    .arg(100 + bounded(30000)).arg(1 + bounded(50)).arg(bounded(8))
+                    .arg(bounded(256)).arg(bounded(256)).arg(bounded(8) ? "success" : "failed").toLatin1();
+        } else {
+            line += QString("arch=c000003e syscall=%1 success=%2 exit=0 pid=%3 uid=0 comm=\"%4\" exe=\"/usr/bin/%4\" key=\"%5\"\n")
+                    .arg(bounded(330)).arg(bounded(10) ? "yes" : "no").arg(100 + bounded(30000))
+                    .arg(s_words[bounded(countOf(s_words))]).arg(bounded(2) ? "bench" : "identity").toLatin1();
+        }
+        return line;
+    }
+    case App:
+        snprintf(head, sizeof(head), "%04d-%02d-%02d %02d:%02d:%02d.%03d [%s] [%s:%d] ",
+                 date.year(), date.month(), date.day(), time.hour(), time.minute(), time.second(), usec / 1000,
+                 s_appLevels[bounded(countOf(s_appLevels))], s_appSources[bounded(countOf(s_appSources))], 1 + bounded(900));
+        return head + words(3, 20) + '\n';
+    default:
+        return QByteArray();
+    }
+}
+
+// 按开机、若干次登录登出、关机的顺序循环生成记录
+QByteArray CorpusGenerator::wtmpRecord(qint64 index, qint64 secs)
+{
+    struct utmp record;
+    memset(&record, 0, sizeof(record));
+    const int phase = static_cast<int>(index % 20);
+    const int user = static_cast<int>((index / 2) % 8);
+
+    if (phase == 0) {
+        record.ut_type = BOOT_TIME;
+        strncpy(record.ut_line, "~", sizeof(record.ut_line));
+        strncpy(record.ut_user, "reboot", sizeof(record.ut_user));
+        strncpy(record.ut_host, "6.1.0-bench", sizeof(record.ut_host));
+    } else if (phase == 19) {
+        record.ut_type = RUN_LVL;
+        strncpy(record.ut_line, "~", sizeof(record.ut_line));
+        strncpy(record.ut_user, "shutdown", sizeof(record.ut_user));
+        strncpy(record.ut_host, "6.1.0-bench", sizeof(record.ut_host));
+    } else {
+        record.ut_type = (phase % 2) ? USER_PROCESS : DEAD_PROCESS;
+        snprintf(record.ut_line, sizeof(record.ut_line), "pts/%d", user);
+        snprintf(record.ut_id, sizeof(record.ut_id), "ts/%d", user);
+        if (record.ut_type == USER_PROCESS) {
+            snprintf(record.ut_user, sizeof(record.ut_user), "user%d", user);
+            snprintf(record.ut_host, sizeof(record.ut_host), "10.0.0.%d", 1 + user);
+        }
+    }
+    record.ut_pid = 100 + bounded(30000);
+    record.ut_tv.tv_sec = static_cast<decltype(record.ut_tv.tv_sec)>(secs);
+    record.ut_tv.tv_usec = bounded(1000000);
+
+    return QByteArray(reinterpret_cast<const char *>(&record), sizeof(record));
+}
+
+qint64 CorpusGenerator::generate(Type type, const QString &path, qint64 bytes, qint64 *lines)
+{
+    if (type >= TypeCount)
+        return -1;
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return -1;
+
+    // 每种类型使用独立的序列，单独生成某一类型时内容不变
+    m_state = (m_seed + 1) * 0x9E3779B97F4A7C15ULL + static_cast<quint64>(type);
+    if (m_state == 0)
+        m_state = 1;
+
+    qint64 written = 0;
+    qint64 index = 0;
+    qint64 secs = CORPUS_BASE_TIME;
+    QByteArray buffer;
+    buffer.reserve(CORPUS_WRITE_CHUNK + 4096);
+    while (written + buffer.size() < bytes) {
+        secs += bounded(4);
+        buffer += type == Wtmp ? wtmpRecord(index, secs) : textLine(type, index, secs);
+        ++index;
+        if (buffer.size() >= CORPUS_WRITE_CHUNK) {
+            if (file.write(buffer) != buffer.size())
+                return -1;
+            written += buffer.size();
+            buffer.clear();
+        }
+    }
+    if (!buffer.isEmpty() && file.write(buffer) != buffer.size())
+        return -1;
+    written += buffer.size();
+
+    if (lines)
+        *lines = index;
+    return file.flush() ? written : -1;
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef CORPUSGENERATOR_H
+#define CORPUSGENERATOR_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The CorpusGenerator class 基准测试用的合成日志语料生成器
+ * 按各解析器期望的行格式生成kern.log、auth.log、dpkg.log、Xorg.log、audit.log、应用日志和wtmp文件，
+ * 时间戳从固定起点递增，相同种子与大小生成的文件逐字节一致，便于不同版本间对比
+ */
+class CorpusGenerator
+{
+public:
+    enum Type {
+        Kern,
+        Auth,
+        Dpkg,
+        Xorg,
+        Audit,
+        App,
+        Wtmp,
+        TypeCount
+    };
+
+    explicit CorpusGenerator(quint64 seed = 1);
+
+    static QString typeName(Type type);
+    static bool typeFromName(const QString &name, Type &type);
+    // 生成文件的默认文件名，如kern.log
+    static QString fileName(Type type);
+
+    /**
+     * @brief generate 生成不小于bytes字节的语料文件，文件已存在时覆盖
+     * @param lines 生成的行数(wtmp为记录数)
+     * @return 实际写入的字节数，失败返回-1
+     */
+    qint64 generate(Type type, const QString &path, qint64 bytes, qint64 *lines = nullptr);
+
+private:
+    quint64 next();
+    int bounded(int n);
+    QByteArray words(int minCount, int maxCount);
+    QByteArray textLine(Type type, qint64 index, qint64 secs);
+    QByteArray wtmpRecord(qint64 index, qint64 secs);
+
+    quint64 m_seed;
+    quint64 m_state = 0;
+};
+
+#endif // CORPUSGENERATOR_H
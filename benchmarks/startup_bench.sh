@@ -0,0 +1,100 @@
+#!/bin/bash
+# SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+# 冷、热启动耗时测量
+# 通过DEEPIN_LOG_VIEWER_STARTUP_TRACE让程序在首个日志种类数据显示后写入启动打点并退出，
+# 每次启动输出一行JSON，各耗时均从脚本启动进程时计起：first_frame_ms 窗口显示耗时，first_data_ms 首屏数据显示耗时，
+# wall_ms 进程总耗时；打点记录中的时间相对第一个打点，借助其origin_unix_us换算为相对进程启动的时间
+# 用法：startup_bench.sh [-b 程序路径] [-n 每种模式次数] [-m 热启动首屏数据耗时中位数上限(ms)] [--sync]
+# 冷启动需root权限清空页缓存，非root时只测热启动；指定-m且中位数超过上限时返回1，用于回归检查
+
+BIN=deepin-log-viewer
+RUNS=5
+MAX_MS=0
+EXTRA_ENV=()
+MODE_SUFFIX=lazy
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+    -b) BIN="$2"; shift 2 ;;
+    -n) RUNS="$2"; shift 2 ;;
+    -m) MAX_MS="$2"; shift 2 ;;
+    --sync) EXTRA_ENV=(DEEPIN_LOG_VIEWER_SYNC_STARTUP=1); MODE_SUFFIX=sync; shift ;;
+    *) echo "unknown option: $1" >&2; exit 2 ;;
+    esac
+done
+
+TRACE_FILE=$(mktemp /tmp/log-viewer-startup-XXXXXX.jsonl)
+trap 'rm -f "$TRACE_FILE"' EXIT
+
+# 从打点记录中取指定打点的结束时刻(相对进程启动)，$2为启动进程时的系统时间(纳秒)
+point_end_ms() {
+    grep "\"point\":\"$1\"" "$TRACE_FILE" | head -n 1 \
+        | sed -E 's/.*"begin_ms":([0-9.e+-]+).*"duration_ms":([0-9.e+-]+).*"origin_unix_us":([0-9.e+-]+).*/\1 \2 \3/' \
+        | awk -v launch="$2" 'NF == 3 { printf "%.3f", $3 / 1000 - launch / 1000000 + $1 + $2 }'
+}
+
+run_once() {
+    local mode=$1 run=$2
+    : > "$TRACE_FILE"
+    if [ "$mode" = cold ]; then
+        sync
+        echo 3 > /proc/sys/vm/drop_caches
+    fi
+
+    local begin end
+    begin=$(date +%s%N)
+    env "${EXTRA_ENV[@]}" DEEPIN_LOG_VIEWER_STARTUP_TRACE="$TRACE_FILE" DEEPIN_LOG_VIEWER_EXIT_AFTER_STARTUP=1 \
+        timeout 60 "$BIN" > /dev/null 2>&1
+    end=$(date +%s%N)
+
+    local firstFrame firstData
+    firstFrame=$(point_end_ms STARTUP-FIRSTFRAME "$begin")
+    firstData=$(point_end_ms POINT-03 "$begin")
+    if [ -z "$firstData" ]; then
+        echo "run $run ($mode) produced no startup trace" >&2
+        return 1
+    fi
+
+    printf '{"benchmark":"startup","mode":"%s_%s","run":%d,"first_frame_ms":%s,"first_data_ms":%s,"wall_ms":%d}\n' \
+        "$mode" "$MODE_SUFFIX" "$run" "${firstFrame:-null}" "$firstData" $(((end - begin) / 1000000))
+    echo "$firstData" >> "$TRACE_FILE.$mode"
+}
+
+median() {
+    sort -n "$1" | awk '{ v[NR] = $1 } END { if (NR == 0) print 0; else if (NR % 2) print v[(NR + 1) / 2]; else print (v[NR / 2] + v[NR / 2 + 1]) / 2 }'
+}
+
+modes=(warm)
+if [ "$(id -u)" -eq 0 ]; then
+    modes=(cold warm)
+else
+    echo "not running as root, cold start skipped" >&2
+fi
+
+status=0
+for mode in "${modes[@]}"; do
+    rm -f "$TRACE_FILE.$mode"
+    # 热启动前先启动一次预热页缓存
+    if [ "$mode" = warm ]; then
+        run_once warm 0 > /dev/null
+        rm -f "$TRACE_FILE.warm"
+    fi
+    for ((i = 1; i <= RUNS; ++i)); do
+        run_once "$mode" "$i" || status=1
+    done
+done
+
+if [ -f "$TRACE_FILE.warm" ]; then
+    warmMedian=$(median "$TRACE_FILE.warm")
+    printf '{"benchmark":"startup","mode":"warm_%s","median_first_data_ms":%s}\n' "$MODE_SUFFIX" "$warmMedian"
+    if [ "$MAX_MS" != 0 ] && awk -v m="$warmMedian" -v max="$MAX_MS" 'BEGIN { exit !(m > max) }'; then
+        echo "warm start median ${warmMedian}ms exceeds ${MAX_MS}ms" >&2
+        status=1
+    fi
+fi
+rm -f "$TRACE_FILE".cold "$TRACE_FILE".warm
+
+exit $status
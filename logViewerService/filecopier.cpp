@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "filecopier.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QRunnable>
+#include <QThread>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+
+Q_DECLARE_LOGGING_CATEGORY(logService)
+
+// 单次内核复制的最大字节数
+const size_t FILE_COPY_KERNEL_CHUNK = 1 << 30;
+// 读写循环缓冲区大小
+const int FILE_COPY_BUFFER_SIZE = 1024 * 1024;
+// 目录复制时同时复制的最大文件数
+const int FILE_COPY_MAX_THREADS = 4;
+
+/**
+   @brief 内核复制方式在当前文件系统或文件类型上不可用，此时从当前偏移继续使用下一种方式
+ */
+static bool isUnsupported(int err)
+{
+    return err == EXDEV || err == ENOSYS || err == EOPNOTSUPP || err == EINVAL || err == EBADF || err == EPERM;
+}
+
+// 以下复制函数均从文件当前偏移开始复制到文件末尾
+// 返回值：1 复制完成；0 不支持该方式；-1 出错
+static int copyByCopyFileRange(int srcFd, int dstFd)
+{
+    while (true) {
+        ssize_t n = ::copy_file_range(srcFd, nullptr, dstFd, nullptr, FILE_COPY_KERNEL_CHUNK, 0);
+        if (n > 0)
+            continue;
+        if (n == 0)
+            return 1;
+        if (errno == EINTR)
+            continue;
+        return isUnsupported(errno) ? 0 : -1;
+    }
+}
+
+static int copyBySendFile(int srcFd, int dstFd)
+{
+    while (true) {
+        ssize_t n = ::sendfile(dstFd, srcFd, nullptr, FILE_COPY_KERNEL_CHUNK);
+        if (n > 0)
+            continue;
+        if (n == 0)
+            return 1;
+        if (errno == EINTR)
+            continue;
+        return isUnsupported(errno) ? 0 : -1;
+    }
+}
+
+static int copyByReadWrite(int srcFd, int dstFd)
+{
+    QByteArray buffer(FILE_COPY_BUFFER_SIZE, Qt::Uninitialized);
+    while (true) {
+        ssize_t n = ::read(srcFd, buffer.data(), static_cast<size_t>(buffer.size()));
+        if (n == 0)
+            return 1;
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        const char *p = buffer.constData();
+        while (n > 0) {
+            ssize_t written = ::write(dstFd, p, static_cast<size_t>(n));
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                return -1;
+            }
+            p += written;
+            n -= written;
+        }
+    }
+}
+
+class FileCopyTask : public QRunnable
+{
+public:
+    FileCopyTask(const QString &src, const QString &dst, QAtomicInt &failed)
+        : m_src(src)
+        , m_dst(dst)
+        , m_failed(failed)
+    {
+    }
+
+    void run() override
+    {
+        if (!FileCopier::copyFile(m_src, m_dst))
+            m_failed.ref();
+    }
+
+private:
+    QString m_src;
+    QString m_dst;
+    QAtomicInt &m_failed;
+};
+
+FileCopier::FileCopier(int maxThreads)
+{
+    m_pool.setMaxThreadCount(maxThreads > 0 ? maxThreads : qBound(1, QThread::idealThreadCount(), FILE_COPY_MAX_THREADS));
+}
+
+FileCopier::~FileCopier()
+{
+    waitForDone();
+}
+
+bool FileCopier::copyFile(const QString &src, const QString &dst, Method method, Method *used)
+{
+    int srcFd = ::open(QFile::encodeName(src).constData(), O_RDONLY | O_CLOEXEC);
+    if (srcFd < 0) {
+        qCWarning(logService) << "Failed to open copy source:" << src << strerror(errno);
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(srcFd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        qCWarning(logService) << "Copy source is not a regular file:" << src;
+        ::close(srcFd);
+        return false;
+    }
+
+    int dstFd = ::open(QFile::encodeName(dst).constData(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (dstFd < 0) {
+        qCWarning(logService) << "Failed to open copy target:" << dst << strerror(errno);
+        ::close(srcFd);
+        return false;
+    }
+
+    // proc等伪文件大小为0，内核复制读不到数据，直接使用读写循环
+    const bool pseudoFile = st.st_size == 0;
+    Method usedMethod = ReadWrite;
+    int ret = 0;
+    if (!pseudoFile && (method == Auto || method == Reflink) && ::ioctl(dstFd, FICLONE, srcFd) == 0) {
+        usedMethod = Reflink;
+        ret = 1;
+    }
+    if (ret == 0 && !pseudoFile && (method == Auto || method == CopyFileRange)) {
+        usedMethod = CopyFileRange;
+        ret = copyByCopyFileRange(srcFd, dstFd);
+    }
+    if (ret == 0 && !pseudoFile && (method == Auto || method == SendFile)) {
+        usedMethod = SendFile;
+        ret = copyBySendFile(srcFd, dstFd);
+    }
+    // 部分文件系统的内核复制会提前返回0，未复制完的部分继续用读写循环补齐
+    if (ret == 0 || (ret == 1 && usedMethod != Reflink && ::lseek(dstFd, 0, SEEK_CUR) < st.st_size)) {
+        usedMethod = ReadWrite;
+        ret = copyByReadWrite(srcFd, dstFd);
+    }
+
+    const int err = errno;
+    if (::close(dstFd) != 0 && ret == 1)
+        ret = -1;
+    ::close(srcFd);
+
+    if (ret != 1) {
+        qCWarning(logService) << "Failed to copy file:" << src << "to:" << dst << strerror(err);
+        return false;
+    }
+
+    if (used)
+        *used = usedMethod;
+    return true;
+}
+
+void FileCopier::copyToDir(const QString &src, const QString &dstDir)
+{
+    QFileInfo srcInfo(src);
+    if (!srcInfo.exists())
+        return;
+
+    if (!srcInfo.isDir()) {
+        QDir().mkpath(dstDir);
+        enqueue(src, QDir(dstDir).filePath(srcInfo.fileName()));
+        return;
+    }
+
+    // 目标目录已存在时复制到其下的同名目录，否则目标目录即为副本，与cp -r一致
+    const QString dstRoot = QFileInfo(dstDir).isDir() ? QDir(dstDir).filePath(srcInfo.fileName()) : dstDir;
+    QDir().mkpath(dstRoot);
+
+    const QDir srcDir(src);
+    QDirIterator it(src, QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        const QFileInfo info = it.fileInfo();
+        const QString dst = dstRoot + "/" + srcDir.relativeFilePath(info.filePath());
+        if (info.isSymLink()) {
+            // 符号链接按链接本身复制，不复制指向的内容
+            QByteArray target(PATH_MAX, '\0');
+            ssize_t len = ::readlink(QFile::encodeName(info.filePath()).constData(), target.data(), static_cast<size_t>(target.size()));
+            if (len > 0) {
+                target.truncate(static_cast<int>(len));
+                QFile::remove(dst);
+                if (::symlink(target.constData(), QFile::encodeName(dst).constData()) != 0)
+                    qCWarning(logService) << "Failed to copy symlink:" << info.filePath() << strerror(errno);
+            }
+        } else if (info.isDir()) {
+            QDir().mkpath(dst);
+        } else if (info.isFile()) {
+            enqueue(info.filePath(), dst);
+        }
+    }
+}
+
+void FileCopier::enqueue(const QString &src, const QString &dst)
+{
+    m_pool.start(new FileCopyTask(src, dst, m_failed));
+}
+
+void FileCopier::waitForDone()
+{
+    m_pool.waitForDone();
+}
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef FILECOPIER_H
+#define FILECOPIER_H
+
+#include <QAtomicInt>
+#include <QString>
+#include <QThreadPool>
+
+/**
+ * @brief The FileCopier class 导出日志时的文件复制
+ * 单个文件优先使用内核复制(reflink、copy_file_range、sendfile)，数据不经过用户态缓冲，
+ * 都不支持时退回到读写循环；目录复制时各文件提交到线程池并发复制
+ */
+class FileCopier
+{
+public:
+    enum Method {
+        Auto,           // 依次尝试以下方式
+        Reflink,        // FICLONE，支持的文件系统上只共享数据块，不复制数据
+        CopyFileRange,  // copy_file_range，在内核中复制
+        SendFile,       // sendfile
+        ReadWrite       // 用户态读写循环
+    };
+
+    explicit FileCopier(int maxThreads = -1);
+    ~FileCopier();
+
+    /**
+     * @brief copyFile 复制单个文件，目标文件存在时覆盖
+     * @param method 指定复制方式时只使用该方式及读写循环，用于性能对比
+     * @param used 实际完成复制所用的方式
+     */
+    static bool copyFile(const QString &src, const QString &dst, Method method = Auto, Method *used = nullptr);
+
+    /**
+     * @brief copyToDir 与cp -rf语义一致，将文件或目录src复制到目录dstDir下
+     * 目录结构同步创建，文件异步复制，需调用waitForDone等待完成
+     */
+    void copyToDir(const QString &src, const QString &dstDir);
+    void waitForDone();
+    // 复制失败的文件个数
+    int failedCount() const { return m_failed.loadAcquire(); }
+
+private:
+    void enqueue(const QString &src, const QString &dst);
+
+    QThreadPool m_pool;
+    QAtomicInt m_failed;
+};
+
+#endif // FILECOPIER_H
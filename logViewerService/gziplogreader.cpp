@@ -0,0 +1,355 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gziplogreader.h"
+
+#include <QLoggingCategory>
+
+#include <string.h>
+
+#include <utility>
+
+Q_DECLARE_LOGGING_CATEGORY(logService)
+
+// 解压字典大小，即deflate最大回溯距离
+#define GZIP_WINDOW_SIZE 32768
+// 每次从文件读取的压缩数据大小
+#define GZIP_INPUT_SIZE (64 * 1024)
+// 按行读取时每次解压的数据大小
+#define GZIP_BUFFER_SIZE (256 * 1024)
+// 索引中保存的行首长度，足够解析行首时间
+#define GZIP_LINE_HEAD 256
+// gzip成员尾部CRC32和ISIZE字段长度
+#define GZIP_TRAILER_SIZE 8
+
+GzipLogReader::GzipLogReader(const QString &filePath)
+    : m_file(filePath)
+{
+    memset(&m_stream, 0, sizeof(m_stream));
+}
+
+GzipLogReader::~GzipLogReader()
+{
+    close();
+}
+
+bool GzipLogReader::isGzipFile(const QString &filePath)
+{
+    return filePath.endsWith(".gz", Qt::CaseInsensitive);
+}
+
+bool GzipLogReader::open()
+{
+    close();
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        qCWarning(logService) << "Failed to open gzip file:" << m_file.fileName() << m_file.errorString();
+        return false;
+    }
+
+    // 16 + MAX_WBITS：按gzip格式解析头部和尾部
+    if (inflateInit2(&m_stream, 16 + MAX_WBITS) != Z_OK) {
+        qCWarning(logService) << "Failed to init inflate for:" << m_file.fileName();
+        m_file.close();
+        return false;
+    }
+
+    m_inited = true;
+    m_inMember = true;
+    m_input.resize(GZIP_INPUT_SIZE);
+    return true;
+}
+
+bool GzipLogReader::openAt(const GzipCheckpoint &point)
+{
+    close();
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        qCWarning(logService) << "Failed to open gzip file:" << m_file.fileName() << m_file.errorString();
+        return false;
+    }
+
+    // 检查点位于deflate数据中间，按原始deflate流解压
+    if (inflateInit2(&m_stream, -MAX_WBITS) != Z_OK) {
+        qCWarning(logService) << "Failed to init inflate for:" << m_file.fileName();
+        m_file.close();
+        return false;
+    }
+    m_inited = true;
+    m_raw = true;
+    m_inMember = true;
+    m_input.resize(GZIP_INPUT_SIZE);
+
+    if (!m_file.seek(point.inOffset - (point.bits ? 1 : 0))) {
+        qCWarning(logService) << "Failed to seek gzip file:" << m_file.fileName() << point.inOffset;
+        close();
+        return false;
+    }
+
+    if (point.bits) {
+        char c = 0;
+        if (!m_file.getChar(&c)) {
+            close();
+            return false;
+        }
+        inflatePrime(&m_stream, point.bits, static_cast<unsigned char>(c) >> (8 - point.bits));
+    }
+
+    if (inflateSetDictionary(&m_stream, reinterpret_cast<const Bytef *>(point.window.constData()),
+                             static_cast<uInt>(point.window.size())) != Z_OK) {
+        qCWarning(logService) << "Failed to restore gzip checkpoint:" << m_file.fileName() << point.outOffset;
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void GzipLogReader::close()
+{
+    if (m_inited) {
+        inflateEnd(&m_stream);
+        m_inited = false;
+    }
+    memset(&m_stream, 0, sizeof(m_stream));
+    m_file.close();
+
+    m_raw = false;
+    m_inMember = false;
+    m_skipTrailer = 0;
+    m_inputEnd = false;
+    m_end = false;
+    m_error = false;
+    m_buffer.clear();
+    m_bufferPos = 0;
+}
+
+bool GzipLogReader::fillInput()
+{
+    qint64 n = m_file.read(m_input.data(), m_input.size());
+    if (n < 0) {
+        qCWarning(logService) << "Failed to read gzip file:" << m_file.fileName() << m_file.errorString();
+        m_error = true;
+        return false;
+    }
+    if (n == 0) {
+        m_inputEnd = true;
+        return false;
+    }
+
+    m_stream.next_in = reinterpret_cast<Bytef *>(m_input.data());
+    m_stream.avail_in = static_cast<uInt>(n);
+    return true;
+}
+
+/**
+   @brief 解压数据到 \a out ，最多 \a outSize 字节，返回解压出的字节数。
+        \a stopAtBlock 为true时在deflate块边界返回，用于记录检查点。
+ */
+qint64 GzipLogReader::inflateChunk(unsigned char *out, qint64 outSize, bool stopAtBlock)
+{
+    m_stream.next_out = out;
+    m_stream.avail_out = static_cast<uInt>(outSize);
+    while (m_stream.avail_out > 0 && !m_end && !m_error) {
+        if (m_stream.avail_in == 0 && !fillInput()) {
+            if (m_inputEnd) {
+                // 文件被截断(如正在写入)时，已解压的数据照常返回
+                if (m_inMember)
+                    qCWarning(logService) << "Unexpected end of gzip file:" << m_file.fileName();
+                m_end = true;
+            }
+            break;
+        }
+
+        // 原始deflate流结束后跳过gzip成员尾部
+        if (m_skipTrailer > 0) {
+            uInt n = qMin(m_stream.avail_in, static_cast<uInt>(m_skipTrailer));
+            m_stream.next_in += n;
+            m_stream.avail_in -= n;
+            m_skipTrailer -= static_cast<int>(n);
+            continue;
+        }
+
+        if (!m_inMember) {
+            // 多个gzip成员首尾相接，成员后不是gzip头时视为填充数据，按文件结束处理
+            if (m_stream.next_in[0] != 0x1f) {
+                m_end = true;
+                break;
+            }
+            inflateReset2(&m_stream, 16 + MAX_WBITS);
+            m_raw = false;
+            m_inMember = true;
+        }
+
+        int ret = inflate(&m_stream, stopAtBlock ? Z_BLOCK : Z_NO_FLUSH);
+        if (ret == Z_STREAM_END) {
+            m_inMember = false;
+            if (m_raw)
+                m_skipTrailer = GZIP_TRAILER_SIZE;
+        } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            qCWarning(logService) << "Failed to inflate gzip file:" << m_file.fileName() << (m_stream.msg ? m_stream.msg : "");
+            m_error = true;
+            break;
+        }
+
+        if (stopAtBlock && m_inMember && (m_stream.data_type & 128))
+            break;
+    }
+
+    return outSize - m_stream.avail_out;
+}
+
+bool GzipLogReader::fillBuffer()
+{
+    if (m_bufferPos < m_buffer.size())
+        return true;
+
+    m_buffer.resize(GZIP_BUFFER_SIZE);
+    m_bufferPos = 0;
+    qint64 n = 0;
+    while (n == 0 && !m_end && !m_error)
+        n = inflateChunk(reinterpret_cast<unsigned char *>(m_buffer.data()), m_buffer.size(), false);
+    m_buffer.resize(static_cast<int>(n));
+
+    return n > 0;
+}
+
+bool GzipLogReader::readLine(QByteArray &line)
+{
+    line.clear();
+    bool hasData = false;
+    while (fillBuffer()) {
+        hasData = true;
+        const char *begin = m_buffer.constData() + m_bufferPos;
+        const int left = m_buffer.size() - m_bufferPos;
+        const char *nl = static_cast<const char *>(memchr(begin, '\n', static_cast<size_t>(left)));
+        if (nl) {
+            const int len = static_cast<int>(nl - begin);
+            line.append(begin, len);
+            m_bufferPos += len + 1;
+            return true;
+        }
+        line.append(begin, left);
+        m_bufferPos = m_buffer.size();
+    }
+
+    return hasData;
+}
+
+qint64 GzipLogReader::skipLines(qint64 count)
+{
+    qint64 skipped = 0;
+    while (skipped < count && fillBuffer()) {
+        const char *begin = m_buffer.constData() + m_bufferPos;
+        const int left = m_buffer.size() - m_bufferPos;
+        const char *nl = static_cast<const char *>(memchr(begin, '\n', static_cast<size_t>(left)));
+        if (nl) {
+            m_bufferPos += static_cast<int>(nl - begin) + 1;
+            ++skipped;
+        } else {
+            m_bufferPos = m_buffer.size();
+        }
+    }
+
+    return skipped;
+}
+
+QByteArray GzipLogReader::readAll()
+{
+    QByteArray data;
+    if (m_bufferPos < m_buffer.size()) {
+        data = m_buffer.mid(m_bufferPos);
+        m_bufferPos = m_buffer.size();
+    }
+
+    while (!m_end && !m_error) {
+        const int oldSize = data.size();
+        data.resize(oldSize + GZIP_BUFFER_SIZE);
+        qint64 n = inflateChunk(reinterpret_cast<unsigned char *>(data.data()) + oldSize, GZIP_BUFFER_SIZE, false);
+        data.resize(oldSize + static_cast<int>(n));
+    }
+
+    return data;
+}
+
+bool GzipLogReader::atEnd()
+{
+    return !fillBuffer();
+}
+
+bool GzipLogReader::buildIndex(GzipIndex &index, qint64 span)
+{
+    index = GzipIndex();
+    if (!open())
+        return false;
+
+    // 解压数据循环写入窗口，窗口中始终保留最近32K数据，用于生成检查点字典
+    QByteArray window(GZIP_WINDOW_SIZE, '\0');
+    unsigned char *win = reinterpret_cast<unsigned char *>(window.data());
+    int winPos = 0;
+    qint64 lastPointOut = 0;
+
+    // 仅保留当前行和上一个非空行的行首
+    char headBuf[2][GZIP_LINE_HEAD];
+    char *curHead = headBuf[0];
+    char *lastHead = headBuf[1];
+    int curLen = 0;
+    int lastLen = 0;
+
+    while (!m_end && !m_error) {
+        qint64 n = inflateChunk(win + winPos, GZIP_WINDOW_SIZE - winPos, true);
+        const char *p = reinterpret_cast<const char *>(win + winPos);
+        const char *end = p + n;
+        while (p < end) {
+            const char *nl = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+            const char *segEnd = nl ? nl : end;
+            if (curLen < GZIP_LINE_HEAD) {
+                const int len = static_cast<int>(qMin<qint64>(segEnd - p, GZIP_LINE_HEAD - curLen));
+                memcpy(curHead + curLen, p, static_cast<size_t>(len));
+                curLen += len;
+            }
+            if (!nl)
+                break;
+
+            ++index.lineCount;
+            if (curLen > 0) {
+                if (index.firstLine.isEmpty())
+                    index.firstLine = QByteArray(curHead, curLen);
+                std::swap(curHead, lastHead);
+                lastLen = curLen;
+            }
+            curLen = 0;
+            p = nl + 1;
+        }
+
+        index.size += n;
+        winPos += static_cast<int>(n);
+        if (winPos == GZIP_WINDOW_SIZE)
+            winPos = 0;
+
+        // 在deflate块边界记录检查点，成员最后一个块之后无需记录
+        if (!m_end && m_inMember && (m_stream.data_type & 128) && !(m_stream.data_type & 64)
+                && index.size - lastPointOut >= span) {
+            GzipCheckpoint point;
+            point.line = index.lineCount;
+            point.outOffset = index.size;
+            point.inOffset = m_file.pos() - m_stream.avail_in;
+            point.bits = m_stream.data_type & 7;
+            point.window = window.mid(winPos) + window.left(winPos);
+            index.points.append(point);
+            lastPointOut = index.size;
+        }
+    }
+
+    if (curLen > 0) {
+        index.partialTail = true;
+        if (index.firstLine.isEmpty())
+            index.firstLine = QByteArray(curHead, curLen);
+        index.lastLine = QByteArray(curHead, curLen);
+    } else {
+        index.lastLine = QByteArray(lastHead, lastLen);
+    }
+
+    const bool ok = !m_error;
+    close();
+    return ok;
+}
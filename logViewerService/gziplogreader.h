@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef GZIPLOGREADER_H
+#define GZIPLOGREADER_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QVector>
+
+#include <zlib.h>
+
+/**
+ * @brief The GzipCheckpoint struct 压缩日志随机访问检查点
+ * 记录deflate块边界处的压缩/解压偏移和之前32K解压数据，从检查点恢复解压时无需从头解压
+ */
+struct GzipCheckpoint {
+    qint64 line = 0;        // 检查点之前的换行符个数
+    qint64 outOffset = 0;   // 解压数据偏移
+    qint64 inOffset = 0;    // 压缩数据偏移
+    int bits = 0;           // inOffset前一字节中尚未解压的位数
+    QByteArray window;      // 检查点之前的32K解压数据，用作解压字典
+};
+
+/**
+ * @brief The GzipIndex struct 压缩日志索引，一次完整扫描得到
+ */
+struct GzipIndex {
+    qint64 lineCount = 0;       // 换行符个数，与wc -l一致
+    bool partialTail = false;   // 最后一行是否没有换行符
+    qint64 size = 0;            // 解压后大小
+    QByteArray firstLine;       // 首个非空行的行首，用于解析时间
+    QByteArray lastLine;        // 最后一个非空行的行首
+    QVector<GzipCheckpoint> points;
+};
+
+/**
+ * @brief The GzipLogReader class 流式解压.gz日志，解压数据直接交给读取接口，不落临时文件
+ * 支持多成员gzip文件，可从检查点恢复解压
+ */
+class GzipLogReader
+{
+public:
+    explicit GzipLogReader(const QString &filePath);
+    ~GzipLogReader();
+
+    static bool isGzipFile(const QString &filePath);
+
+    bool open();
+    // 从检查点开始解压
+    bool openAt(const GzipCheckpoint &point);
+    void close();
+
+    // 读取一行，不含换行符，读取结束返回false
+    bool readLine(QByteArray &line);
+    // 跳过count个换行符，返回实际跳过的行数
+    qint64 skipLines(qint64 count);
+    QByteArray readAll();
+    bool atEnd();
+    bool hasError() const { return m_error; }
+
+    /**
+     * @brief buildIndex 完整解压一遍，统计行数、首尾行，并每隔span字节解压数据记录一个检查点
+     */
+    bool buildIndex(GzipIndex &index, qint64 span);
+
+private:
+    qint64 inflateChunk(unsigned char *out, qint64 outSize, bool stopAtBlock);
+    bool fillInput();
+    bool fillBuffer();
+
+    QFile m_file;
+    z_stream m_stream;
+    bool m_inited = false;
+    bool m_raw = false;          // 从检查点恢复时为原始deflate流，成员结束后需跳过gzip尾部
+    bool m_inMember = false;     // 是否正在解压某个gzip成员
+    int m_skipTrailer = 0;
+    bool m_inputEnd = false;
+    bool m_end = false;
+    bool m_error = false;
+    QByteArray m_input;
+    QByteArray m_buffer;         // 按行读取时的解压缓冲
+    int m_bufferPos = 0;
+};
+
+#endif // GZIPLOGREADER_H
@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logarchivecache.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QSaveFile>
+
+#include <sys/stat.h>
+
+Q_DECLARE_LOGGING_CATEGORY(logService)
+
+// 归档索引持久化目录
+const QString LOG_ARCHIVE_CACHE_DIR = "/var/cache/deepin/deepin-log-viewer/archive-index";
+const quint32 LOG_ARCHIVE_MAGIC = 0x475a4958;
+const qint32 LOG_ARCHIVE_VERSION = 1;
+// 每隔1M解压数据记录一个检查点
+const qint64 LOG_ARCHIVE_CHECKPOINT_SPAN = 1024 * 1024;
+// 磁盘上保留的索引文件个数
+const int LOG_ARCHIVE_CACHE_MAX = 256;
+// 内存中保留的索引个数
+const int LOG_ARCHIVE_MEMORY_MAX = 16;
+// 内存中保留的首尾行时间个数
+const int LOG_ARCHIVE_TIME_RANGE_MAX = 1024;
+
+LogArchiveCache::LogArchiveCache()
+    : m_cacheDir(LOG_ARCHIVE_CACHE_DIR)
+{
+}
+
+void LogArchiveCache::setCacheDir(const QString &dir)
+{
+    QMutexLocker locker(&m_mutex);
+    m_cacheDir = dir;
+    m_indexes.clear();
+    m_indexOrder.clear();
+    m_timeRanges.clear();
+    m_timeRangeOrder.clear();
+}
+
+QString LogArchiveCache::keyOf(const QString &filePath, QDateTime *mtime) const
+{
+    struct stat st;
+    if (::stat(filePath.toLocal8Bit().constData(), &st) != 0 || !S_ISREG(st.st_mode))
+        return QString();
+
+    if (mtime)
+        *mtime = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(st.st_mtim.tv_sec) * 1000 + st.st_mtim.tv_nsec / 1000000);
+
+    return QString("%1-%2-%3.%4-%5")
+        .arg(static_cast<quint64>(st.st_dev))
+        .arg(static_cast<quint64>(st.st_ino))
+        .arg(static_cast<qint64>(st.st_mtim.tv_sec))
+        .arg(static_cast<qint64>(st.st_mtim.tv_nsec))
+        .arg(static_cast<qint64>(st.st_size));
+}
+
+QSharedPointer<const GzipIndex> LogArchiveCache::index(const QString &filePath)
+{
+    const QString key = keyOf(filePath);
+    if (key.isEmpty())
+        return QSharedPointer<const GzipIndex>();
+
+    QMutexLocker locker(&m_mutex);
+    forever {
+        auto it = m_indexes.constFind(key);
+        if (it != m_indexes.constEnd())
+            return it.value();
+        if (!m_building.contains(key))
+            break;
+        m_indexBuilt.wait(&m_mutex);
+    }
+    m_building.insert(key);
+    locker.unlock();
+
+    // 读取磁盘索引与完整解压期间其他归档的请求不受影响
+    QSharedPointer<GzipIndex> index(new GzipIndex);
+    bool ok = load(key, *index);
+    if (!ok) {
+        qCDebug(logService) << "Building archive index for:" << filePath;
+        GzipLogReader reader(filePath);
+        ok = reader.buildIndex(*index, LOG_ARCHIVE_CHECKPOINT_SPAN);
+        if (ok) {
+            save(key, *index);
+            qCDebug(logService) << "Archive index built, lines:" << index->lineCount << "checkpoints:" << index->points.size();
+        }
+    }
+
+    locker.relock();
+    m_building.remove(key);
+    if (ok)
+        insert(key, index);
+    m_indexBuilt.wakeAll();
+    return ok ? index : QSharedPointer<const GzipIndex>();
+}
+
+bool LogArchiveCache::timeRange(const QString &filePath, qint64 &firstTime, qint64 &lastTime)
+{
+    firstTime = -1;
+    lastTime = -1;
+
+    QDateTime mtime;
+    const QString key = keyOf(filePath, &mtime);
+    if (key.isEmpty())
+        return false;
+
+    QMutexLocker locker(&m_mutex);
+    auto rangeIt = m_timeRanges.constFind(key);
+    if (rangeIt != m_timeRanges.constEnd()) {
+        firstTime = rangeIt->first;
+        lastTime = rangeIt->second;
+        return true;
+    }
+    QSharedPointer<const GzipIndex> index = m_indexes.value(key);
+    locker.unlock();
+
+    // 读取文件期间不持有锁，同一文件的并发请求各自读取，结果相同
+    if (!index && GzipLogReader::isGzipFile(filePath)) {
+        QSharedPointer<GzipIndex> loaded(new GzipIndex);
+        if (load(key, *loaded))
+            index = loaded;
+    }
+
+    if (index) {
+        firstTime = parseLineTime(index->firstLine, mtime);
+        lastTime = parseLineTime(index->lastLine, mtime);
+    } else {
+        // 只读取首个非空行
+        QByteArray line;
+        if (GzipLogReader::isGzipFile(filePath)) {
+            GzipLogReader reader(filePath);
+            if (reader.open()) {
+                while (line.isEmpty() && reader.readLine(line)) {}
+            }
+        } else {
+            QFile file(filePath);
+            if (file.open(QIODevice::ReadOnly)) {
+                while (line.isEmpty() && !file.atEnd())
+                    line = file.readLine(1024).trimmed();
+            }
+        }
+        firstTime = parseLineTime(line, mtime);
+    }
+
+    // 末行时间不会晚于文件最后修改时间
+    if (lastTime < 0)
+        lastTime = mtime.toMSecsSinceEpoch();
+
+    locker.relock();
+    insertTimeRange(key, firstTime, lastTime);
+    return true;
+}
+
+qint64 LogArchiveCache::parseLineTime(const QByteArray &line, const QDateTime &refTime)
+{
+    // RFC3339格式：2024-05-01T10:00:00.123456+08:00
+    if (line.size() >= 19 && line.at(4) == '-' && line.at(7) == '-' && (line.at(10) == 'T' || line.at(10) == ' ')) {
+        QDateTime dt = QDateTime::fromString(QString::fromLatin1(line.left(19)),
+                                             line.at(10) == 'T' ? "yyyy-MM-ddThh:mm:ss" : "yyyy-MM-dd hh:mm:ss");
+        return dt.isValid() ? dt.toMSecsSinceEpoch() : -1;
+    }
+
+    // 传统syslog格式：May  1 10:00:00，无年份
+    static const char *const months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                         "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    if (line.size() >= 15 && line.at(3) == ' ') {
+        int month = 0;
+        for (int i = 0; i < 12; ++i) {
+            if (qstrncmp(line.constData(), months[i], 3) == 0) {
+                month = i + 1;
+                break;
+            }
+        }
+        bool ok = false;
+        const int day = line.mid(4, 2).trimmed().toInt(&ok);
+        const QTime time = QTime::fromString(QString::fromLatin1(line.mid(7, 8)), "hh:mm:ss");
+        if (month == 0 || !ok || !time.isValid())
+            return -1;
+
+        // 晚于参考时间的记录属于上一年
+        int year = refTime.date().year();
+        QDate date(year, month, day);
+        if (!date.isValid() || QDateTime(date, time) > refTime.addDays(1))
+            date = QDate(year - 1, month, day);
+        if (!date.isValid())
+            return -1;
+        return QDateTime(date, time).toMSecsSinceEpoch();
+    }
+
+    return -1;
+}
+
+void LogArchiveCache::insert(const QString &key, const QSharedPointer<const GzipIndex> &index)
+{
+    if (!m_indexes.contains(key))
+        m_indexOrder.append(key);
+    m_indexes.insert(key, index);
+    while (m_indexOrder.size() > LOG_ARCHIVE_MEMORY_MAX)
+        m_indexes.remove(m_indexOrder.takeFirst());
+}
+
+void LogArchiveCache::insertTimeRange(const QString &key, qint64 firstTime, qint64 lastTime)
+{
+    if (!m_timeRanges.contains(key))
+        m_timeRangeOrder.append(key);
+    m_timeRanges.insert(key, qMakePair(firstTime, lastTime));
+    while (m_timeRangeOrder.size() > LOG_ARCHIVE_TIME_RANGE_MAX)
+        m_timeRanges.remove(m_timeRangeOrder.takeFirst());
+}
+
+bool LogArchiveCache::load(const QString &key, GzipIndex &index) const
+{
+    QFile file(m_cacheDir + "/" + key + ".idx");
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_11);
+    quint32 magic = 0;
+    qint32 version = 0;
+    in >> magic >> version;
+    if (magic != LOG_ARCHIVE_MAGIC || version != LOG_ARCHIVE_VERSION) {
+        qCWarning(logService) << "Archive index version mismatch, rebuilding:" << file.fileName();
+        return false;
+    }
+
+    qint32 pointCount = 0;
+    in >> index.lineCount >> index.partialTail >> index.size >> index.firstLine >> index.lastLine >> pointCount;
+    for (qint32 i = 0; i < pointCount && in.status() == QDataStream::Ok; ++i) {
+        GzipCheckpoint point;
+        qint32 bits = 0;
+        QByteArray window;
+        in >> point.line >> point.outOffset >> point.inOffset >> bits >> window;
+        point.bits = bits;
+        point.window = qUncompress(window);
+        index.points.append(point);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(logService) << "Archive index corrupted, rebuilding:" << file.fileName();
+        index = GzipIndex();
+        return false;
+    }
+
+    return true;
+}
+
+void LogArchiveCache::save(const QString &key, const GzipIndex &index)
+{
+    QDir dir;
+    if (!dir.exists(m_cacheDir) && !dir.mkpath(m_cacheDir)) {
+        qCWarning(logService) << "Failed to create archive index dir:" << m_cacheDir;
+        return;
+    }
+
+    // 先写临时文件再替换，避免服务退出时留下不完整的索引
+    QSaveFile file(m_cacheDir + "/" + key + ".idx");
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logService) << "Failed to open archive index file:" << file.fileName();
+        return;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_11);
+    out << LOG_ARCHIVE_MAGIC << LOG_ARCHIVE_VERSION;
+    out << index.lineCount << index.partialTail << index.size << index.firstLine << index.lastLine
+        << static_cast<qint32>(index.points.size());
+    for (const GzipCheckpoint &point : index.points)
+        out << point.line << point.outOffset << point.inOffset << static_cast<qint32>(point.bits) << qCompress(point.window);
+
+    if (file.commit())
+        prune();
+}
+
+void LogArchiveCache::prune()
+{
+    QDir dir(m_cacheDir);
+    const QFileInfoList files = dir.entryInfoList(QStringList() << "*.idx", QDir::Files, QDir::Time);
+    for (int i = LOG_ARCHIVE_CACHE_MAX; i < files.size(); ++i)
+        QFile::remove(files.at(i).absoluteFilePath());
+}
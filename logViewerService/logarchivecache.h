@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGARCHIVECACHE_H
+#define LOGARCHIVECACHE_H
+
+#include "gziplogreader.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QPair>
+#include <QSet>
+#include <QSharedPointer>
+#include <QStringList>
+#include <QWaitCondition>
+
+/**
+ * @brief The LogArchiveCache class 轮转日志归档元数据缓存
+ * 以设备号、inode、修改时间和大小为键持久化保存压缩日志的行数、首尾行和检查点，
+ * 轮转改名后仍可命中；归档未变化时重复查看不再解压
+ */
+class LogArchiveCache
+{
+public:
+    static LogArchiveCache *instance()
+    {
+        static LogArchiveCache cache;
+        return &cache;
+    }
+
+    /**
+     * @brief index 获取压缩日志索引，缓存未命中时完整解压一遍建立索引
+     * 解压时不持有锁，同一归档的并发请求等待首个请求建立完成后复用
+     * @return 文件不存在或解压失败时返回空
+     */
+    QSharedPointer<const GzipIndex> index(const QString &filePath);
+
+    /**
+     * @brief timeRange 获取日志文件首尾行时间(ms)，无法解析时为-1
+     * 已有索引时直接使用，否则只解压首行，末行时间以文件修改时间为上限
+     */
+    bool timeRange(const QString &filePath, qint64 &firstTime, qint64 &lastTime);
+
+    // 解析行首时间，支持RFC3339和传统syslog格式，syslog无年份时按参考时间推断
+    static qint64 parseLineTime(const QByteArray &line, const QDateTime &refTime);
+
+    QString cacheDir() const { return m_cacheDir; }
+    void setCacheDir(const QString &dir);
+
+protected:
+    LogArchiveCache();
+
+private:
+    QString keyOf(const QString &filePath, QDateTime *mtime = nullptr) const;
+    bool load(const QString &key, GzipIndex &index) const;
+    void save(const QString &key, const GzipIndex &index);
+    void prune();
+    void insert(const QString &key, const QSharedPointer<const GzipIndex> &index);
+    void insertTimeRange(const QString &key, qint64 firstTime, qint64 lastTime);
+
+    QMutex m_mutex;
+    QString m_cacheDir;
+    QHash<QString, QSharedPointer<const GzipIndex>> m_indexes;
+    QStringList m_indexOrder;    // 内存中索引的加入顺序，超出上限时淘汰最早的
+    QSet<QString> m_building;    // 正在建立索引的键
+    QWaitCondition m_indexBuilt; // 有索引建立结束时唤醒等待的请求
+    QHash<QString, QPair<qint64, qint64>> m_timeRanges;
+    QStringList m_timeRangeOrder; // 首尾行时间的加入顺序，超出上限时淘汰最早的
+};
+
+#endif // LOGARCHIVECACHE_H
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logrequestpool.h"
+
+#include <QLoggingCategory>
+#include <QRunnable>
+#include <QThread>
+
+Q_DECLARE_LOGGING_CATEGORY(logService)
+
+// 工作线程数上下限，请求多为读文件和等待子进程，线程数不必超过CPU核数太多
+const int LOG_REQUEST_THREAD_MIN = 2;
+const int LOG_REQUEST_THREAD_MAX = 8;
+// 每个调用方默认同时执行的请求数
+const int LOG_REQUEST_PER_CLIENT = 4;
+
+// 工作线程正在执行的请求所属调用方
+static thread_local QString s_currentClient;
+
+class LogRequestJob : public QRunnable
+{
+public:
+    LogRequestJob(LogRequestPool *pool, const QString &client, const std::function<void()> &job)
+        : m_pool(pool)
+        , m_client(client)
+        , m_job(job)
+    {
+    }
+
+    void run() override
+    {
+        s_currentClient = m_client;
+        m_job();
+        s_currentClient.clear();
+        m_pool->finished(m_client);
+    }
+
+private:
+    LogRequestPool *m_pool;
+    QString m_client;
+    std::function<void()> m_job;
+};
+
+LogRequestPool::LogRequestPool(int maxThreads, int maxPerClient)
+    : m_maxPerClient(maxPerClient > 0 ? maxPerClient : LOG_REQUEST_PER_CLIENT)
+{
+    if (maxThreads <= 0)
+        maxThreads = qBound(LOG_REQUEST_THREAD_MIN, QThread::idealThreadCount(), LOG_REQUEST_THREAD_MAX);
+    m_pool.setMaxThreadCount(maxThreads);
+    qCDebug(logService) << "LogRequestPool threads:" << maxThreads << "per client:" << m_maxPerClient;
+}
+
+LogRequestPool::~LogRequestPool()
+{
+    waitForDone();
+}
+
+void LogRequestPool::submit(const QString &client, const std::function<void()> &job)
+{
+    QMutexLocker locker(&m_mutex);
+    int &running = m_running[client];
+    if (running >= m_maxPerClient) {
+        qCDebug(logService) << "LogRequestPool queue request of:" << client << "running:" << running;
+        m_pending[client].enqueue(job);
+        return;
+    }
+    ++running;
+    start(client, job);
+}
+
+void LogRequestPool::submitReply(const QDBusMessage &msg, const QDBusConnection &conn, const std::function<QVariant()> &work)
+{
+    submit(msg.service(), [msg, conn, work]() {
+        QDBusConnection(conn).send(msg.createReply(work()));
+    });
+}
+
+QString LogRequestPool::currentClient()
+{
+    return s_currentClient;
+}
+
+void LogRequestPool::waitForDone()
+{
+    // 排队中的请求在前一个请求结束前启动，线程池空闲时已无排队请求
+    m_pool.waitForDone();
+}
+
+int LogRequestPool::maxThreadCount() const
+{
+    return m_pool.maxThreadCount();
+}
+
+void LogRequestPool::start(const QString &client, const std::function<void()> &job)
+{
+    LogRequestJob *runnable = new LogRequestJob(this, client, job);
+    runnable->setAutoDelete(true);
+    m_pool.start(runnable);
+}
+
+void LogRequestPool::finished(const QString &client)
+{
+    QMutexLocker locker(&m_mutex);
+    auto pending = m_pending.find(client);
+    if (pending != m_pending.end()) {
+        const std::function<void()> job = pending->dequeue();
+        if (pending->isEmpty())
+            m_pending.erase(pending);
+        start(client, job);
+        return;
+    }
+
+    auto running = m_running.find(client);
+    if (running != m_running.end() && --running.value() <= 0)
+        m_running.erase(running);
+}
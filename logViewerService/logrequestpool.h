@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef LOGREQUESTPOOL_H
+#define LOGREQUESTPOOL_H
+
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QHash>
+#include <QMutex>
+#include <QQueue>
+#include <QString>
+#include <QThreadPool>
+#include <QVariant>
+
+#include <functional>
+
+/**
+ * @brief The LogRequestPool class 服务端请求工作线程池
+ * 读取日志、执行命令等耗时请求在有界线程池中执行，不阻塞服务的事件循环；
+ * 每个调用方同时执行的请求数有上限，超出的请求按到达顺序排队，不会占满其他调用方可用的线程
+ */
+class LogRequestPool
+{
+public:
+    /**
+     * @param maxThreads 工作线程数，小于等于0时按CPU核数取值
+     * @param maxPerClient 每个调用方同时执行的请求数，小于等于0时使用默认值
+     */
+    explicit LogRequestPool(int maxThreads = 0, int maxPerClient = 0);
+    ~LogRequestPool();
+
+    // 提交请求，client为调用方标识(dbus唯一名)
+    void submit(const QString &client, const std::function<void()> &job);
+    // 提交dbus请求，work在工作线程中执行，完成后以其返回值作为msg的延迟应答发出
+    void submitReply(const QDBusMessage &msg, const QDBusConnection &conn, const std::function<QVariant()> &work);
+    // 当前工作线程正在执行的请求所属调用方，不在请求中时为空
+    static QString currentClient();
+    // 等待所有请求(包括排队中的)执行完成
+    void waitForDone();
+
+    int maxThreadCount() const;
+    int maxPerClient() const { return m_maxPerClient; }
+
+private:
+    friend class LogRequestJob;
+    void start(const QString &client, const std::function<void()> &job);
+    // 请求执行完成，启动该调用方排队中的下一个请求
+    void finished(const QString &client);
+
+    QThreadPool m_pool;
+    QMutex m_mutex;
+    int m_maxPerClient;
+    QHash<QString, int> m_running;
+    QHash<QString, QQueue<std::function<void()>>> m_pending;
+};
+
+#endif // LOGREQUESTPOOL_H
@@ -4,11 +4,19 @@
 
 #include "logviewerservice.h"
 #include "opslogexport.h"
+#include "filecopier.h"
+#include "gziplogreader.h"
+#include "logarchivecache.h"
 #include "qtcompat.h"
 
 #include <pwd.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
 #include <fstream>
+#include <algorithm>
 
 #include <dgiofile.h>
 #include <dgiovolume.h>
@@ -35,7 +43,10 @@ using namespace PolkitQt1;
 #include <QLoggingCategory>
 #include <QJsonDocument>
 #include <QJsonObject>
-#include <QTemporaryFile>
+#include <QDateTime>
+#include <QUuid>
+#include <QSocketNotifier>
+#include <QDBusServiceWatcher>
 
 #ifdef QT_DEBUG
 Q_LOGGING_CATEGORY(logService, "org.deepin.log.viewer.service")
@@ -48,51 +59,78 @@ Q_LOGGING_CATEGORY(logService, "org.deepin.log.viewer.service", QtInfoMsg)
 
 const QString s_Action_View = "com.deepin.pkexec.logViewerAuth";
 const QString s_Action_Export = "com.deepin.pkexec.logViewerAuth.exportLogs";
-
-/**
-   @brief 移除路径 \a dirPath 下的文件，注意，不会递归删除文件夹
- */
-void removeDirFiles(const QString &dirPath)
+// 提权读取会话有效时长(ms)，到期后需重新鉴权，与前端DLDBusHandler保持一致
+const qint64 READER_SESSION_LIFETIME = 10 * 60 * 1000;
+// 内核日志设备，每次read返回一条完整记录
+const char *const KMSG_DEVICE = "/dev/kmsg";
+// 单条记录最大长度，与内核CONSOLE_EXT_LOG_MAX一致，缓冲区不足时read返回EINVAL
+#define KMSG_RECORD_MAX 8192
+// 单次读取内核日志的最大记录数
+#define KMSG_MAX_BATCH 10000
+// 按偏移单次读取日志的最大字节数，避免DBUS消息过大
+const qint64 LOG_OFFSET_READ_MAX = 64 * 1024 * 1024;
+// 文件标识中开头摘要覆盖的字节数
+const qint64 LOG_IDENTITY_HEAD_SIZE = 4096;
+
+static inline int hexValue(char c)
 {
-    qCDebug(logService) << "Removing files in directory:" << dirPath;
-    QDir dir(dirPath);
-    dir.setFilter(QDir::NoDotAndDotDot | QDir::Files);
-    foreach(QString dirItem, dir.entryList()) {
-        if (!dir.remove(dirItem)) {
-            qCWarning(logService) << QString("Remove temporary dir file [%1] failed").arg(dirItem);
-        }
-    }
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
 }
 
 /**
-   @brief 将压缩源文件 \a sourceFile 解压到临时文件，临时文件由模板 \a tempFileTemplate 生成，
-        若文件创建异常，将返回空路径；正常解压返回临时文件路径。
+   @brief 解析一条/dev/kmsg记录："优先级,序号,时间戳(us),标志[,...];消息\n[ KEY=VALUE\n...]"，
+        按分隔符逐字节解码，不使用正则。消息中的\xHH转义被还原，控制字符替换为空格，附加的KEY=VALUE行被忽略。
+        \a msg 为空时只解析头部。
  */
-QString unzipToTempFile(const QString &sourceFile, const QString &tempFileTemplate)
+static bool parseKmsgRecord(const char *data, ssize_t len, int &level, qulonglong &seq, qulonglong &usec, QByteArray *msg)
 {
-    qCDebug(logService) << "Unzipping file:" << sourceFile << "to temporary file:" << tempFileTemplate;
-    QProcess m_process;
-
-    // 每次创建临时文件，销毁由 QTemporaryDir 处理
-    QTemporaryFile tmpFile;
-    tmpFile.setAutoRemove(false);
-    tmpFile.setFileTemplate(tempFileTemplate);
-    tmpFile.open();
-    if (!tmpFile.open()) {
-        qCWarning(logService) << QString("Create temporary file [%1](FileTemplate:%2) failed: %3")
-                                 .arg(tmpFile.fileName()).arg(tempFileTemplate).arg(tmpFile.errorString());
-        return QString();
+    const char *p = data;
+    const char *end = data + len;
+    qulonglong fields[3] = {0, 0, 0};
+    for (qulonglong &field : fields) {
+        if (p >= end || *p < '0' || *p > '9')
+            return false;
+        while (p < end && *p >= '0' && *p <= '9')
+            field = field * 10 + static_cast<qulonglong>(*p++ - '0');
+        if (p >= end || *p != ',')
+            return false;
+        ++p;
     }
 
-    QString command = "gunzip";
-    QStringList args;
-    args.append("-c");
-    args.append(sourceFile);
-    m_process.setStandardOutputFile(tmpFile.fileName());
-    m_process.start(command, args);
-    m_process.waitForFinished(-1);
+    // 跳过标志及扩展字段
+    const char *msgBegin = static_cast<const char *>(memchr(p, ';', static_cast<size_t>(end - p)));
+    if (!msgBegin)
+        return false;
+    ++msgBegin;
 
-    return tmpFile.fileName();
+    // 优先级低3位为日志级别，高位为facility
+    level = static_cast<int>(fields[0] & 7);
+    seq = fields[1];
+    usec = fields[2];
+    if (!msg)
+        return true;
+
+    const char *msgEnd = static_cast<const char *>(memchr(msgBegin, '\n', static_cast<size_t>(end - msgBegin)));
+    if (!msgEnd)
+        msgEnd = end;
+    msg->clear();
+    msg->reserve(static_cast<int>(msgEnd - msgBegin));
+    for (p = msgBegin; p < msgEnd; ++p) {
+        char c = *p;
+        if (c == '\\' && msgEnd - p >= 4 && p[1] == 'x' && hexValue(p[2]) >= 0 && hexValue(p[3]) >= 0) {
+            c = static_cast<char>((hexValue(p[2]) << 4) | hexValue(p[3]));
+            p += 3;
+        }
+        msg->append((static_cast<unsigned char>(c) < 0x20 || c == 0x7f) ? ' ' : c);
+    }
+
+    return true;
 }
 
 LogViewerService::LogViewerService(QObject *parent)
@@ -112,16 +150,50 @@ LogViewerService::LogViewerService(QObject *parent)
 LogViewerService::~LogViewerService()
 {
     qCDebug(logService) << "LogViewerService destructor called";
+    m_requestPool.waitForDone();
     if(!m_logMap.isEmpty()) {
         qCDebug(logService) << "Cleaning up" << m_logMap.size() << "log map entries";
-        for(auto eachPair : m_logMap) {
-            delete eachPair.second;
+        for(const LogStream &eachStream : m_logMap) {
+            delete eachStream.stream;
         }
     }
 
+    for (const KmsgCursor &cursor : m_kmsgCursors)
+        ::close(cursor.fd);
+    stopKernelFollow();
+
     clearTempFiles();
 }
 
+template<typename T, typename Work>
+T LogViewerService::dispatchRequest(Work work)
+{
+    if (!calledFromDBus())
+        return work();
+
+    watchClient(message().service());
+    // 应答由工作线程发出，同一调用方的多个请求及多个调用方之间并行执行
+    setDelayedReply(true);
+    m_requestPool.submitReply(message(), connection(), [work]() mutable {
+        return QVariant::fromValue(T(work()));
+    });
+    return T();
+}
+
+/*!
+ * \~chinese \brief LogViewerService::setExitCode 记录当前请求所属调用方最近一次执行命令的返回值，
+ * \~chinese 工作线程中无法通过message()取得调用方，本地调用时调用方为空
+ */
+void LogViewerService::setExitCode(int code)
+{
+    const QString client = LogRequestPool::currentClient();
+    QMutexLocker locker(&m_exitCodeMutex);
+    // 调用方已退出总线时请求可能仍在执行，不再为其记录
+    if (!client.isEmpty() && !m_clients.contains(client))
+        return;
+    m_exitCodes.insert(client, code);
+}
+
 /*!
  * \~chinese \brief LogViewerService::readLog 读取日志文件
  * \~chinese \param fd 文件句柄
@@ -151,25 +223,28 @@ QString LogViewerService::readLog(const QDBusUnixFileDescriptor &fd)
 
     QTextStream in(&file);
     QString targetFilePath = in.readAll();
+    file.close();
 
-    if (!targetFilePath.isEmpty()) {
-        qCDebug(logService) << "Reading log from path:" << targetFilePath;
-        log = readLog(targetFilePath);
-    } else {
+    if (targetFilePath.isEmpty()) {
         qCWarning(logService) << "target log file path is empty.";
+        return log;
     }
 
-    file.close();
-
-    return log;
+    qCDebug(logService) << "Reading log from path:" << targetFilePath;
+    return dispatchRequest<QString>([this, targetFilePath]() {
+        return readLog(targetFilePath);
+    });
 }
 
 QByteArray LogViewerService::processCatFile(const QString &filePath)
 {
     qCDebug(logService) << "Processing cat file:" << filePath;
-    m_process.start("cat", QStringList() << filePath);
-    m_process.waitForFinished(-1);
-    QByteArray byte = m_process.readAllStandardOutput();
+    // 每个请求使用自己的进程，并发请求互不覆盖
+    QProcess process;
+    process.start("cat", QStringList() << filePath);
+    process.waitForFinished(-1);
+    setExitCode(process.exitCode());
+    QByteArray byte = process.readAllStandardOutput();
     qCDebug(logService) << "Cat process completed, read" << byte.size() << "bytes";
     return byte;
 }
@@ -185,17 +260,13 @@ static QByteArray processCmdWithArgs(const QString &cmdStr, const QStringList &a
 }
 
 /*!
- * \~chinese \brief LogViewerService::readLog 读取日志文件
+ * \~chinese \brief LogViewerService::readLog 读取日志文件，可在工作线程中执行，调用前须完成鉴权
  * \~chinese \param filePath 文件路径
  * \~chinese \return 读取的日志
  */
 QString LogViewerService::readLog(const QString &filePath)
 {
     qCDebug(logService) << "Reading log from file path:" << filePath;
-    if(!checkAuth(s_Action_View)) {
-        qCWarning(logService) << "Authorization check failed for readLog";
-        return " ";
-    }
 
     //增加服务黑名单，只允许通过提权接口读取/var/log下，家目录下和临时目录下的文件
     //部分设备是直接从root账户进入，因此还需要监控/root目录
@@ -208,7 +279,15 @@ QString LogViewerService::readLog(const QString &filePath)
         return " ";
     }
 
-    QByteArray byte = processCatFile(filePath);
+    QByteArray byte;
+    if (GzipLogReader::isGzipFile(filePath)) {
+        // 轮转的压缩日志直接流式解压，不再解压到临时文件
+        GzipLogReader reader(filePath);
+        if (reader.open())
+            byte = reader.readAll();
+    } else {
+        byte = processCatFile(filePath);
+    }
 
     //QByteArray -> QString 如果遇到0x00，会导致转换终止
     //replace("\x00", "")和replace("\u0000", "")无效
@@ -344,15 +423,16 @@ QStringList LogViewerService::readLogLinesInRange(const QDBusUnixFileDescriptor
 
     QTextStream in(&file);
     QString targetFilePath = in.readAll();
+    file.close();
 
-    if (!targetFilePath.isEmpty())
-        lines = readLogLinesInRange(targetFilePath, startLine, lineCount, bReverse);
-    else
+    if (targetFilePath.isEmpty()) {
         qCWarning(logService) << "target log file path is empty.";
+        return lines;
+    }
 
-    file.close();
-
-    return lines;
+    return dispatchRequest<QStringList>([this, targetFilePath, startLine, lineCount, bReverse]() {
+        return readLogLinesInRange(targetFilePath, startLine, lineCount, bReverse);
+    });
 }
 
 QStringList LogViewerService::readLogLinesInRange(const QString &filePath, qint64 startLine, qint64 lineCount, bool bReverse)
@@ -360,10 +440,6 @@ QStringList LogViewerService::readLogLinesInRange(const QString &filePath, qint6
     qCDebug(logService) << "Reading log lines in range with file path, start line:" << startLine << "line count:" << lineCount << "reverse order:" << bReverse;
     QStringList lines;
 
-    // 开启鉴权
-    if (!checkAuth(s_Action_View))
-        return lines;
-
     //增加服务黑名单，只允许通过提权接口读取/var/log下，家目录下和临时目录下的文件
     //部分设备是直接从root账户进入，因此还需要监控/root目录
     if ((!filePath.startsWith("/var/log/") &&
@@ -375,34 +451,45 @@ QStringList LogViewerService::readLogLinesInRange(const QString &filePath, qint6
         return lines;
     }
 
+    if (GzipLogReader::isGzipFile(filePath))
+        return readGzipLinesInRange(filePath, startLine, lineCount, bReverse);
+
+    QString token = QCryptographicHash::hash(filePath.toUtf8(), QCryptographicHash::Md5).toHex();
     QFile file(filePath);
     if (!file.open(QIODevice::ReadOnly)) {
         qCDebug(logService) << "Failed to open file for readLogLinesInRange:" << filePath;
-        QString token = QCryptographicHash::hash(filePath.toUtf8(), QCryptographicHash::Md5).toHex();
-        if (m_logLineIndex.contains(token))
-            m_logLineIndex.remove(token);
+        QMutexLocker locker(&m_lineIndexMutex);
+        m_logLineIndex.remove(token);
         return lines;
     }
 
+    // 每个文件的行索引各有一把锁，查找和增量更新在锁内完成，同一文件的并发请求依次复用同一份索引，
+    // 不同文件的请求互不阻塞
+    QSharedPointer<LineIndex> lineIndex;
+    {
+        QMutexLocker locker(&m_lineIndexMutex);
+        QSharedPointer<LineIndex> &entry = m_logLineIndex[token];
+        if (!entry)
+            entry.reset(new LineIndex);
+        lineIndex = entry;
+    }
+    QList<uint64_t> indexList;
     qint64 startLineIndex = 0;
-    QString token = QCryptographicHash::hash(filePath.toUtf8(), QCryptographicHash::Md5).toHex();
-    if (m_logLineIndex.contains(token)) {
-        startLineIndex = readFileAndReturnIndex(filePath, startLine, m_logLineIndex[token], bReverse);
-    } else {
-        QList<uint64_t> indexList;
-        startLineIndex = readFileAndReturnIndex(filePath, startLine, indexList, bReverse);
-        m_logLineIndex.insert(token, indexList);
+    {
+        QMutexLocker locker(&lineIndex->mutex);
+        startLineIndex = readFileAndReturnIndex(filePath, startLine, lineIndex->lines, bReverse);
+        indexList = lineIndex->lines;
     }
 
     if (bReverse) {
-        int startLineCount = m_logLineIndex[token].size() - lineCount;
+        int startLineCount = indexList.size() - lineCount;
         startLineIndex = startLineCount > 0 ? startLineCount : 0;
     }
 
-    if (startLineIndex < 0)
+    if (startLineIndex < 0 || startLineIndex >= indexList.size())
         return lines;
 
-    if (!file.seek(m_logLineIndex[token].at(startLineIndex))) {
+    if (!file.seek(indexList.at(startLineIndex))) {
         qCDebug(logService) << "Failed to seek file for readLogLinesInRange:" << filePath;
         file.close();
         return lines;
@@ -422,6 +509,55 @@ QStringList LogViewerService::readLogLinesInRange(const QString &filePath, qint6
     return lines;
 }
 
+/*!
+ * \~chinese \brief LogViewerService::readGzipLinesInRange 分段读取压缩日志，从起始行之前最近的检查点开始解压
+ * \~chinese \param filePath 压缩日志路径
+ * \~chinese \return 读取的日志行
+ */
+QStringList LogViewerService::readGzipLinesInRange(const QString &filePath, qint64 startLine, qint64 lineCount, bool bReverse)
+{
+    QStringList lines;
+    QSharedPointer<const GzipIndex> index = LogArchiveCache::instance()->index(filePath);
+    if (!index) {
+        qCDebug(logService) << "Failed to index gzip file for readLogLinesInRange:" << filePath;
+        return lines;
+    }
+
+    // 倒序时读取最后lineCount行
+    if (bReverse) {
+        const qint64 totalLines = index->lineCount + (index->partialTail ? 1 : 0);
+        startLine = qMax<qint64>(totalLines - lineCount, 0);
+    }
+    if (startLine < 0)
+        return lines;
+
+    // 检查点位于行中间，取换行数小于起始行的最后一个检查点，跳过剩余换行后即为起始行行首
+    auto point = std::lower_bound(index->points.cbegin(), index->points.cend(), startLine,
+                                  [](const GzipCheckpoint &p, qint64 line) { return p.line < line; });
+    GzipLogReader reader(filePath);
+    qint64 skip = startLine;
+    if (point != index->points.cbegin()) {
+        --point;
+        if (!reader.openAt(*point))
+            return lines;
+        skip -= point->line;
+    } else if (!reader.open()) {
+        return lines;
+    }
+
+    if (reader.skipLines(skip) < skip)
+        return lines;
+
+    QByteArray line;
+    while (lines.size() < lineCount && reader.readLine(line)) {
+        if (line.contains('\x00'))
+            line.replace('\x00', "");
+        lines.append(QString::fromUtf8(line));
+    }
+
+    return lines;
+}
+
 qint64 LogViewerService::findLineStartOffsetWithCaching(const QString &filePath, qint64 targetLine) {
     qCDebug(logService) << "Finding line start offset with caching for file:" << filePath << "and target line:" << targetLine;
 
@@ -475,6 +611,38 @@ qint64 LogViewerService::findLineStartOffsetWithCaching(const QString &filePath,
     return -1; // 没有找到目标行
 }
 
+/*!
+ * \~chinese \brief countLines 统计日志文件行数，压缩日志取自归档索引
+ * \~chinese \return 文件无法打开时返回-1
+ */
+static qint64 countLines(const QString &filePath)
+{
+    if (GzipLogReader::isGzipFile(filePath)) {
+        // 压缩日志行数取自归档索引，归档未变化时不再解压
+        QSharedPointer<const GzipIndex> index = LogArchiveCache::instance()->index(filePath);
+        return index ? index->lineCount : -1;
+    }
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(logService) << "Failed to open file for line count:" << filePath;
+        // 文件打开失败处理
+        return -1;
+    }
+
+    qint64 lineCount = -1;
+    QString result = processCmdWithArgs("wc", QStringList() << "-l" << filePath);
+    QStringList splitResult = result.split(' ');
+    if (splitResult.size() > 0) {
+        lineCount = splitResult.first().toLongLong();
+        qCDebug(logService) << "Line count result:" << lineCount;
+    } else {
+        qCWarning(logService) << "Failed to parse line count result:" << result;
+    }
+
+    return lineCount;
+}
+
 qint64 LogViewerService::getLineCount(const QString &filePath)
 {
     qCDebug(logService) << "Getting line count for file:" << filePath;
@@ -493,29 +661,131 @@ qint64 LogViewerService::getLineCount(const QString &filePath)
         return -1;
     }
 
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qCWarning(logService) << "Failed to open file for line count:" << filePath;
-        // 文件打开失败处理
-        return -1;
+    return dispatchRequest<qint64>([filePath]() {
+        return countLines(filePath);
+    });
+}
+
+/*!
+ * \~chinese \brief LogViewerService::getFileIdentity 获取文件标识
+ * \~chinese \param filePath 文件路径
+ * \~chinese 开头摘要为文件开头最多LOG_IDENTITY_HEAD_SIZE字节的md5，copytruncate后重新写入的文件inode不变，客户端据此识别
+ * \~chinese \return [设备号, inode, 修改时间(ms), 大小, 开头摘要]，文件不存在或路径不在白名单内时为空
+ */
+QStringList LogViewerService::getFileIdentity(const QString &filePath)
+{
+    qCDebug(logService) << "Getting file identity for:" << filePath;
+    // 摘要由日志内容计算，与读取日志相同需要鉴权
+    if (!checkAuth(s_Action_View))
+        return QStringList();
+
+    if ((!filePath.startsWith("/var/log/") &&
+         !filePath.startsWith("/tmp") &&
+         !filePath.startsWith("/home") &&
+         !filePath.startsWith("/root")) ||
+            filePath.contains("..")) {
+        qCWarning(logService) << "File path not in whitelist for getFileIdentity:" << filePath;
+        return QStringList();
     }
 
-    qint64 lineCount = -1;
-    QString result = processCmdWithArgs("wc", QStringList() << "-l" << filePath);
-    QStringList splitResult = result.split(' ');
-    if (splitResult.size() > 0) {
-        lineCount = splitResult.first().toLongLong();
-        qCDebug(logService) << "Line count result:" << lineCount;
-    } else {
-        qCWarning(logService) << "Failed to parse line count result:" << result;
+    struct stat st;
+    if (::stat(filePath.toLocal8Bit().constData(), &st) != 0 || !S_ISREG(st.st_mode))
+        return QStringList();
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return QStringList();
+    const QString head = QCryptographicHash::hash(file.read(LOG_IDENTITY_HEAD_SIZE), QCryptographicHash::Md5).toHex();
+
+    const qint64 mtime = static_cast<qint64>(st.st_mtim.tv_sec) * 1000 + st.st_mtim.tv_nsec / 1000000;
+    return QStringList() << QString::number(static_cast<quint64>(st.st_dev))
+                         << QString::number(static_cast<quint64>(st.st_ino))
+                         << QString::number(mtime)
+                         << QString::number(static_cast<qint64>(st.st_size))
+                         << head;
+}
+
+/*!
+ * \~chinese \brief LogViewerService::readLogFromOffset 从字节偏移读取日志
+ * \~chinese 只返回以换行结尾的完整行，客户端以offset加返回长度作为下次读取的偏移；不支持压缩日志
+ * \~chinese \param maxBytes 单次读取上限，超过LOG_OFFSET_READ_MAX时按LOG_OFFSET_READ_MAX读取
+ * \~chinese \return 读取的日志，0x00替换为空格，到达文件末尾或出错时为空
+ */
+QByteArray LogViewerService::readLogFromOffset(const QString &filePath, qint64 offset, qint64 maxBytes)
+{
+    qCDebug(logService) << "Reading log from offset:" << offset << "max bytes:" << maxBytes;
+    if (!checkAuth(s_Action_View))
+        return QByteArray();
+
+    if ((!filePath.startsWith("/var/log/") &&
+         !filePath.startsWith("/tmp") &&
+         !filePath.startsWith("/home") &&
+         !filePath.startsWith("/root")) ||
+            filePath.contains("..")) {
+        qCWarning(logService) << "File path not in whitelist for readLogFromOffset:" << filePath;
+        return QByteArray();
     }
 
-    return lineCount;
+    if (offset < 0 || maxBytes <= 0 || GzipLogReader::isGzipFile(filePath))
+        return QByteArray();
+
+    return dispatchRequest<QByteArray>([filePath, offset, maxBytes]() {
+        QFile file(filePath);
+        if (!file.open(QIODevice::ReadOnly) || !file.seek(offset)) {
+            qCWarning(logService) << "Failed to open file for readLogFromOffset:" << filePath;
+            return QByteArray();
+        }
+
+        QByteArray byte = file.read(qMin(maxBytes, LOG_OFFSET_READ_MAX));
+        // 末尾不完整的行留到下次读取
+        const int lastLineEnd = byte.lastIndexOf('\n');
+        byte.truncate(lastLineEnd + 1);
+        for (int i = 0; i != byte.size(); ++i) {
+            if (byte.at(i) == 0x00)
+                byte[i] = 0x20;
+        }
+        return byte;
+    });
 }
 
-void LogViewerService::processCmdArgs(const QString &cmdStr, const QStringList &args)
+/*!
+ * \~chinese \brief LogViewerService::filterLogFilesByTime 按首尾行时间过滤日志文件
+ * \~chinese 首尾行时间取自归档元数据缓存，未缓存时只读取首行，时间范围之外的压缩归档不会被解压
+ * \~chinese \param files 日志文件路径列表
+ * \~chinese \return 与时间范围有交集或无法判断时间的文件
+ */
+QStringList LogViewerService::filterLogFilesByTime(const QStringList &files, qint64 timeBegin, qint64 timeEnd)
 {
-    m_process.start(cmdStr, args);
+    qCDebug(logService) << "Filtering" << files.size() << "log files by time:" << timeBegin << "to:" << timeEnd;
+    if (!checkAuth(s_Action_View))
+        return QStringList();
+
+    // 未缓存时间范围的压缩归档需要解压首行，在工作线程中执行
+    return dispatchRequest<QStringList>([files, timeBegin, timeEnd]() {
+        QStringList result;
+        for (const QString &filePath : files) {
+            if ((!filePath.startsWith("/var/log/") &&
+                 !filePath.startsWith("/tmp") &&
+                 !filePath.startsWith("/home") &&
+                 !filePath.startsWith("/root")) ||
+                    filePath.contains("..")) {
+                qCWarning(logService) << "File path not in whitelist for filterLogFilesByTime:" << filePath;
+                continue;
+            }
+
+            qint64 firstTime = -1;
+            qint64 lastTime = -1;
+            if (timeBegin > 0 && timeEnd > 0 && LogArchiveCache::instance()->timeRange(filePath, firstTime, lastTime)) {
+                if ((lastTime > 0 && lastTime < timeBegin) || (firstTime > 0 && firstTime > timeEnd)) {
+                    qCDebug(logService) << "Skipping log file out of time range:" << filePath << firstTime << lastTime;
+                    continue;
+                }
+            }
+            result.append(filePath);
+        }
+
+        return result;
+    });
 }
 
 QString LogViewerService::executeCmd(const QString &cmd)
@@ -529,7 +799,17 @@ QString LogViewerService::executeCmd(const QString &cmd)
 
     QString cmdStr;
     QStringList args;
-    if (cmd.startsWith("coredumpctl-list")) {
+    if (cmd.startsWith("coredumpctl-list-since ")) {
+        // 增量读取指定时间(秒)之后的崩溃日志信息
+        bool isOk = false;
+        qint64 secs = cmd.section(' ', 1, 1).toLongLong(&isOk);
+        if (!isOk || secs < 0) {
+            qCWarning(logService) << "invalid coredumpctl-list-since argument:" << cmd;
+            return result;
+        }
+        cmdStr = "coredumpctl";
+        args << "list" << "--no-pager" << "--since" << QString("@%1").arg(secs);
+    } else if (cmd.startsWith("coredumpctl-list")) {
         // 通过后端服务，读取系统下所有账户的崩溃日志信息
         cmdStr = "coredumpctl";
         args << "list" << "--no-pager";
@@ -547,17 +827,24 @@ QString LogViewerService::executeCmd(const QString &cmd)
         args = cmd.mid(QString("readelf").size() + 1).split(' ');
     }
 
-    if (!cmdStr.isEmpty()) {
+    if (cmdStr.isEmpty())
+        return result;
+
+    // coredumpctl、readelf耗时较长，在工作线程中执行，每个请求使用自己的进程
+    return dispatchRequest<QString>([this, cmd, cmdStr, args]() {
         qCDebug(logService) << "Executing command:" << cmdStr << "with args:" << args;
-        processCmdArgs(cmdStr, args);
+        QString result;
+        QProcess process;
+        process.start(cmdStr, args);
 
-        if (!m_process.waitForFinished(-1)) {
+        if (!process.waitForFinished(-1)) {
             qCWarning(logService()) << "invalid command:" << QString("%1 %2").arg(cmdStr).arg(args.join(' '));
-            return "";
+            return QString("");
         }
+        setExitCode(process.exitCode());
 
         if (cmd == "coredumpctl-list-count") {
-            result = m_process.readAllStandardOutput();
+            result = process.readAllStandardOutput();
             QStringList rows = result.split('\n');
             int nCnt = rows.size();
             // 去掉表头和表尾行
@@ -568,7 +855,7 @@ QString LogViewerService::executeCmd(const QString &cmd)
             result = QString::number(nCnt);
         } else if (cmd.startsWith("readelf")) {
             // 因原始maps信息过大，基本几百KB，埋点平台并不需要全量数据，仅取前200行maps信息即可
-            QTextStream in(m_process.readAllStandardOutput());
+            QTextStream in(process.readAllStandardOutput());
             QStringList lines;
             QString str;
             while (!in.atEnd()) {
@@ -582,11 +869,10 @@ QString LogViewerService::executeCmd(const QString &cmd)
 
             result = lines.join('\n').toUtf8();
         } else {
-            result = m_process.readAllStandardOutput();
+            result = process.readAllStandardOutput();
         }
-    }
-
-    return result;
+        return result;
+    });
 }
 
 /*!
@@ -597,21 +883,30 @@ QString LogViewerService::executeCmd(const QString &cmd)
 QString LogViewerService::openLogStream(const QString &filePath)
 {
     qCDebug(logService) << "Opening log stream for file:" << filePath;
-    QString result = readLog(filePath);
-    if(result == " ") {
-        qCWarning(logService) << "Failed to read log file for stream";
+    if (!checkAuth(s_Action_View))
         return "";
-    }
-
-    QString token = QCryptographicHash::hash(filePath.toUtf8(), QCryptographicHash::Md5).toHex();
-    qCDebug(logService) << "Generated token for log stream:" << token;
 
-    auto stream = new QTextStream;
-
-    m_logMap[token] = std::make_pair(result, stream);
-    stream->setString(&(m_logMap[token].first), QIODevice::ReadOnly);
+    // 工作线程中无法通过message()取得调用方，先在主线程记下
+    const QString sender = calledFromDBus() ? message().service() : QString();
+    return dispatchRequest<QString>([this, filePath, sender]() {
+        QString result = readLog(filePath);
+        if (result == " ") {
+            qCWarning(logService) << "Failed to read log file for stream";
+            return QString();
+        }
 
-    return token;
+        // token随机生成，同一文件的多个通道互不影响，也不能由路径推算出其他调用方的token
+        QString token = QUuid::createUuid().toString(QUuid::WithoutBraces);
+        qCDebug(logService) << "Generated token for log stream:" << token;
+
+        QMutexLocker locker(&m_logMapMutex);
+        LogStream &logStream = m_logMap[token];
+        logStream.content = result;
+        logStream.sender = sender;
+        logStream.stream = new QTextStream;
+        logStream.stream->setString(&logStream.content, QIODevice::ReadOnly);
+        return token;
+    });
 }
 
 /*!
@@ -622,12 +917,17 @@ QString LogViewerService::openLogStream(const QString &filePath)
 QString LogViewerService::readLogInStream(const QString &token)
 {
     qCDebug(logService) << "Reading log in stream with token:" << token;
-    if(!m_logMap.contains(token)) {
+    if(!ownsLogStream(token)) {
         qCWarning(logService) << "Token not found in log map:" << token;
         return "";
     }
 
-    auto stream = m_logMap[token].second;
+    // 通道只在主线程中删除，工作线程插入新通道不影响已有节点，读取时无需持锁
+    QTextStream *stream = nullptr;
+    {
+        QMutexLocker locker(&m_logMapMutex);
+        stream = m_logMap.value(token).stream;
+    }
 
     QString result;
     constexpr int maxReadSize = 10 * 1024 * 1024;
@@ -649,8 +949,8 @@ QString LogViewerService::readLogInStream(const QString &token)
 
     if(result.isEmpty()) {
         qCDebug(logService) << "Stream finished, cleaning up token:" << token;
-        delete m_logMap[token].second;
-        m_logMap.remove(token);
+        QMutexLocker locker(&m_logMapMutex);
+        delete m_logMap.take(token).stream;
     } else {
         qCDebug(logService) << "Read" << linesRead << "lines from stream";
     }
@@ -782,13 +1082,14 @@ void LogViewerService::clearTempFiles()
 }
 
 /*!
- * \~chinese \brief LogViewerService::exitCode 返回进程状态
+ * \~chinese \brief LogViewerService::exitCode 返回调用方自己最近一次执行命令的进程状态，不受其他调用方的请求影响
  * \~chinese \return 进程返回值
  */
 int LogViewerService::exitCode()
 {
     // qCDebug(logService) << "Getting exit code";
-    return m_process.exitCode();
+    QMutexLocker locker(&m_exitCodeMutex);
+    return m_exitCodes.value(calledFromDBus() ? message().service() : QString(), 0);
 }
 
 /*!
@@ -803,6 +1104,7 @@ void LogViewerService::quit()
 /*!
  * \~chinese \brief LogViewerService::getFileInfo 获取想到读取日志文件的路径
  * \~chinese \param file 日志文件的类型
+ * \~chinese \param unzip 已废弃，压缩日志不再解压到临时文件，保留参数以兼容旧接口
  * \~chinese \return 所有日志文件路径列表
  */
 QStringList LogViewerService::getFileInfo(const QString &file, bool unzip)
@@ -813,16 +1115,19 @@ QStringList LogViewerService::getFileInfo(const QString &file, bool unzip)
         return {};
     }
 
-    if (tmpDir.isValid()) {
-        qCDebug(logService) << "Tmp dir is valid";
-        m_tmpDirPath = tmpDir.path();
-        // 每次解压前移除旧有的文件
-        if (unzip) {
-            qCDebug(logService) << "Removing old files in tmp dir";
-            removeDirFiles(m_tmpDirPath);
-        }
-    }
+    // 崩溃日志需逐个执行coredumpctl info，在工作线程中执行
+    return dispatchRequest<QStringList>([this, file]() {
+        return findLogFiles(file);
+    });
+}
 
+/*!
+ * \~chinese \brief LogViewerService::findLogFiles 查找指定类型的日志文件，可在工作线程中执行，调用前须完成鉴权
+ * \~chinese \param file 日志文件的类型
+ * \~chinese \return 所有日志文件路径列表
+ */
+QStringList LogViewerService::findLogFiles(const QString &file)
+{
     QStringList fileNamePath;
     QString nameFilter;
     QDir dir;
@@ -905,25 +1210,16 @@ QStringList LogViewerService::getFileInfo(const QString &file, bool unzip)
     dir.setNameFilters(QStringList() << nameFilter + ".*"); //设置过滤
     dir.setSorting(QDir::Time);
     QFileInfoList fileList = dir.entryInfoList();
-    QString tempFileTemplate = m_tmpDirPath + QDir::separator() + "Log_extract_XXXXXX.txt";
-
-    for (int i = 0; i < fileList.count(); i++) {
-        if (QString::compare(fileList[i].suffix(), "gz", Qt::CaseInsensitive) == 0 && unzip) {
-            QString unzipFile = unzipToTempFile(fileList[i].absoluteFilePath(), tempFileTemplate);
-            if (!unzipFile.isEmpty()) {
-                fileNamePath.append(unzipFile);
-            }
-        }
-        else {
-            fileNamePath.append(fileList[i].absoluteFilePath());
-        }
-    }
+    // 压缩日志原样返回，读取接口按需流式解压
+    for (int i = 0; i < fileList.count(); i++)
+        fileNamePath.append(fileList[i].absoluteFilePath());
     return fileNamePath;
 }
 
 /*!
  * \~chinese \brief LogViewerService::getOtherFileInfo 获取其他日志文件的路径
  * \~chinese \param file 日志文件的类型
+ * \~chinese \param unzip 已废弃，压缩日志不再解压到临时文件，保留参数以兼容旧接口
  * \~chinese \return 所有日志文件路径列表
  */
 QStringList LogViewerService::getOtherFileInfo(const QString &file, bool unzip)
@@ -934,16 +1230,6 @@ QStringList LogViewerService::getOtherFileInfo(const QString &file, bool unzip)
         return {};
     }
 
-    if (tmpDir.isValid()) {
-        qCDebug(logService) << "Tmp dir is valid";
-        m_tmpDirPath = tmpDir.path();
-        // 每次解压前移除旧有的文件
-        if (unzip) {
-            qCDebug(logService) << "Removing old files in tmp dir";
-            removeDirFiles(m_tmpDirPath);
-        }
-    }
-
     QStringList fileNamePath;
     QString nameFilter;
     QDir dir;
@@ -968,19 +1254,9 @@ QStringList LogViewerService::getOtherFileInfo(const QString &file, bool unzip)
     dir.setFilter(QDir::Files | QDir::NoSymLinks | QDir::Hidden); //实现对文件的过滤
     dir.setSorting(QDir::Time);
     fileList = dir.entryInfoList();
-    QString tempFileTemplate = m_tmpDirPath + QDir::separator() + "Log_extract_XXXXXX.txt";
-
-    for (int i = 0; i < fileList.count(); i++) {
-        if (QString::compare(fileList[i].suffix(), "gz", Qt::CaseInsensitive) == 0 && unzip) {
-            QString unzipFile = unzipToTempFile(fileList[i].absoluteFilePath(), tempFileTemplate);
-            if (!unzipFile.isEmpty()) {
-                fileNamePath.append(unzipFile);
-            }
-        }
-        else {
-            fileNamePath.append(fileList[i].absoluteFilePath());
-        }
-    }
+    // 压缩日志原样返回，读取接口按需流式解压
+    for (int i = 0; i < fileList.count(); i++)
+        fileNamePath.append(fileList[i].absoluteFilePath());
     return fileNamePath;
 }
 
@@ -1052,45 +1328,20 @@ bool LogViewerService::exportLog(const QString &outDir, const QString &in, bool
 
         outFullPath = outDirInfo.absoluteFilePath() + filein.fileName();
         
-        // 使用更高效的文件复制方法替代cp命令
-        QFile sourceFile(in);
-        QFile targetFile(outFullPath);
-        
-        // 使用块复制提高大文件复制效率
-        if (sourceFile.open(QIODevice::ReadOnly) && targetFile.open(QIODevice::WriteOnly)) {
-            const qint64 chunkSize = 1024 * 1024; // 1MB chunks
-            QScopedPointer<char> buffer(new char[chunkSize]);
-            
-            while (!sourceFile.atEnd()) {
-                qint64 bytesRead = sourceFile.read(buffer.data(), chunkSize);
-                if (bytesRead > 0) {
-                    if (targetFile.write(buffer.data(), bytesRead) != bytesRead) {
-                        qCWarning(logService) << "Failed to write all bytes to target file:" << outFullPath;
-                        sourceFile.close();
-                        targetFile.close();
-                        return false;
-                    }
-                } else if (bytesRead < 0) {
-                    qCWarning(logService) << "Error reading from source file:" << in;
-                    sourceFile.close();
-                    targetFile.close();
-                    return false;
-                }
-            }
-            
-            sourceFile.close();
-            targetFile.close();
-            
-            // 设置文件权限
-            QFile::setPermissions(outFullPath, QFileDevice::ReadOwner | QFileDevice::WriteOwner | 
-                                             QFileDevice::ReadGroup | QFileDevice::WriteGroup |
-                                             QFileDevice::ReadOther | QFileDevice::WriteOther);
-            
-            return true;
-        } else {
-            qCWarning(logService) << "Failed to open source or target file. Source:" << in << "Target:" << outFullPath;
+        // 优先使用reflink/copy_file_range等内核复制，数据不经过用户态缓冲
+        FileCopier::Method method = FileCopier::Auto;
+        if (!FileCopier::copyFile(in, outFullPath, FileCopier::Auto, &method)) {
+            qCWarning(logService) << "Failed to export file:" << in << "to:" << outFullPath;
             return false;
         }
+        qCDebug(logService) << "Exported file:" << in << "copy method:" << method;
+
+        // 设置文件权限
+        QFile::setPermissions(outFullPath, QFileDevice::ReadOwner | QFileDevice::WriteOwner |
+                                         QFileDevice::ReadGroup | QFileDevice::WriteGroup |
+                                         QFileDevice::ReadOther | QFileDevice::WriteOther);
+
+        return true;
     } else {
         QString cmdStr;
         QStringList args;
@@ -1167,7 +1418,7 @@ bool LogViewerService::exportLog(const QString &outDir, const QString &in, bool
     return true;
 }
 
-bool LogViewerService::checkAuth(const QString &actionId)
+bool LogViewerService::checkAuth(const QString &actionId, bool allowSession)
 {
     qCDebug(logService) << "Checking auth for:" << actionId;
     if (!calledFromDBus()) {
@@ -1181,6 +1432,12 @@ bool LogViewerService::checkAuth(const QString &actionId)
         return  true;
     }
 
+    // 查看日志的请求在会话有效期内复用已通过的鉴权结果
+    if (allowSession && actionId == s_Action_View && hasValidSession(message().service())) {
+        qCDebug(logService) << "dbus caller holds a valid reader session.";
+        return true;
+    }
+
     bool bAuthVaild = false;
     bAuthVaild = checkAuthorization(actionId);
     if (!bAuthVaild) {
@@ -1191,6 +1448,294 @@ bool LogViewerService::checkAuth(const QString &actionId)
     return  bAuthVaild;
 }
 
+bool LogViewerService::hasValidSession(const QString &sender)
+{
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    bool bValid = false;
+    for (auto it = m_sessions.begin(); it != m_sessions.end();) {
+        if (it->expireTime <= now) {
+            it = m_sessions.erase(it);
+            continue;
+        }
+        if (it->sender == sender)
+            bValid = true;
+        ++it;
+    }
+
+    return bValid;
+}
+
+/*!
+ * \~chinese \brief LogViewerService::openSession 鉴权并创建提权读取会话
+ * \~chinese \return 会话token，鉴权失败时返回空
+ */
+QString LogViewerService::openSession()
+{
+    qCDebug(logService) << "Opening reader session";
+    // 创建会话必须重新鉴权，不能由已有会话续期，保证会话时长有界
+    if (!checkAuth(s_Action_View, false))
+        return "";
+
+    ReaderSession session;
+    session.sender = message().service();
+    session.expireTime = QDateTime::currentMSecsSinceEpoch() + READER_SESSION_LIFETIME;
+    hasValidSession(session.sender);
+
+    QString token = QUuid::createUuid().toString(QUuid::WithoutBraces);
+    m_sessions.insert(token, session);
+    qCInfo(logService) << "Reader session opened for:" << session.sender;
+
+    return token;
+}
+
+/*!
+ * \~chinese \brief LogViewerService::closeSession 关闭提权读取会话，仅会话所属调用方可关闭
+ */
+bool LogViewerService::closeSession(const QString &session)
+{
+    qCDebug(logService) << "Closing reader session";
+    if (!calledFromDBus())
+        return false;
+
+    auto it = m_sessions.find(session);
+    if (it == m_sessions.end() || it->sender != message().service())
+        return false;
+
+    m_sessions.erase(it);
+    return true;
+}
+
+/*!
+ * \~chinese \brief LogViewerService::cancelRequest 取消流式读取请求，释放已缓存的日志数据，
+ * \~chinese 之后对该token的readLogInStream调用直接返回空，仅通道所属调用方可取消
+ * \~chinese \param token openLogStream返回的通道token
+ */
+bool LogViewerService::cancelRequest(const QString &token)
+{
+    qCDebug(logService) << "Cancel stream request:" << token;
+    if (!checkAuth(s_Action_View))
+        return false;
+
+    if (!ownsLogStream(token)) {
+        qCWarning(logService) << "Cancel stream request rejected:" << token;
+        return false;
+    }
+
+    QMutexLocker locker(&m_logMapMutex);
+    delete m_logMap.take(token).stream;
+    return true;
+}
+
+bool LogViewerService::ownsLogStream(const QString &token)
+{
+    QMutexLocker locker(&m_logMapMutex);
+    auto it = m_logMap.constFind(token);
+    if (it == m_logMap.constEnd())
+        return false;
+
+    return it->sender == (calledFromDBus() ? message().service() : QString());
+}
+
+/*!
+ * \~chinese \brief LogViewerService::readKernelMessages 直接读取/dev/kmsg内核日志记录
+ * \~chinese 同一调用方连续分批读取时复用上次打开的设备，从上次位置继续读取
+ * \~chinese \param sinceSeq 只返回序号大于该值的记录，0表示从缓冲区最早的记录开始
+ * \~chinese \param maxCount 本次最多返回的记录数
+ * \~chinese \return 每行一条记录，格式为"级别,序号,时间戳(us);消息"，返回为空表示没有更多记录
+ */
+QString LogViewerService::readKernelMessages(qulonglong sinceSeq, int maxCount)
+{
+    qCDebug(logService) << "Reading kernel messages since:" << sinceSeq << "max:" << maxCount;
+    if (!checkAuth(s_Action_View))
+        return "";
+
+    if (maxCount <= 0 || maxCount > KMSG_MAX_BATCH)
+        maxCount = KMSG_MAX_BATCH;
+
+    const QString sender = message().service();
+    KmsgCursor &cursor = m_kmsgCursors[sender];
+    if (cursor.fd < 0 || cursor.lastSeq != sinceSeq) {
+        if (cursor.fd >= 0)
+            ::close(cursor.fd);
+        // 新打开的设备从缓冲区中最早的记录开始读取
+        cursor.fd = ::open(KMSG_DEVICE, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        cursor.lastSeq = sinceSeq;
+        if (cursor.fd < 0) {
+            qCWarning(logService) << "open" << KMSG_DEVICE << "failed:" << strerror(errno);
+            m_kmsgCursors.remove(sender);
+            return "";
+        }
+    }
+
+    QByteArray result;
+    QByteArray msg;
+    char buf[KMSG_RECORD_MAX];
+    int count = 0;
+    bool drained = false;
+    while (count < maxCount) {
+        ssize_t len = ::read(cursor.fd, buf, sizeof(buf));
+        if (len < 0) {
+            // EPIPE表示未读记录已被覆盖，下次读取从最早的可用记录继续
+            if (errno == EINTR || errno == EPIPE)
+                continue;
+            if (errno != EAGAIN)
+                qCWarning(logService) << "read" << KMSG_DEVICE << "failed:" << strerror(errno);
+            drained = true;
+            break;
+        }
+        if (len == 0) {
+            drained = true;
+            break;
+        }
+
+        int level = 0;
+        qulonglong seq = 0;
+        qulonglong usec = 0;
+        if (!parseKmsgRecord(buf, len, level, seq, usec, &msg) || seq <= sinceSeq)
+            continue;
+
+        result.append(QByteArray::number(level)).append(',')
+              .append(QByteArray::number(seq)).append(',')
+              .append(QByteArray::number(usec)).append(';')
+              .append(msg).append('\n');
+        cursor.lastSeq = seq;
+        ++count;
+    }
+
+    if (drained) {
+        ::close(cursor.fd);
+        m_kmsgCursors.remove(sender);
+    } else {
+        watchClient(sender);
+    }
+
+    return QString::fromUtf8(result);
+}
+
+/*!
+ * \~chinese \brief LogViewerService::followKernelMessages 开启/关闭内核日志跟随模式
+ * \~chinese 所有调用方共用一个监听/dev/kmsg的描述符，最后一个跟随方退出后关闭
+ */
+bool LogViewerService::followKernelMessages(bool enable)
+{
+    qCDebug(logService) << "Follow kernel messages:" << enable;
+    if (!checkAuth(s_Action_View))
+        return false;
+
+    const QString sender = message().service();
+    if (!enable) {
+        m_kmsgFollowers.remove(sender);
+        if (m_kmsgFollowers.isEmpty())
+            stopKernelFollow();
+        return true;
+    }
+
+    if (!m_kmsgNotifier) {
+        m_kmsgFollowFd = ::open(KMSG_DEVICE, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (m_kmsgFollowFd < 0) {
+            qCWarning(logService) << "open" << KMSG_DEVICE << "failed:" << strerror(errno);
+            return false;
+        }
+        // 只关注开启跟随之后产生的记录
+        ::lseek(m_kmsgFollowFd, 0, SEEK_END);
+        m_kmsgNotifier = new QSocketNotifier(m_kmsgFollowFd, QSocketNotifier::Read, this);
+        connect(m_kmsgNotifier, &QSocketNotifier::activated, this, &LogViewerService::onKernelMessagesReadable);
+    }
+
+    m_kmsgFollowers.insert(sender);
+    watchClient(sender);
+    return true;
+}
+
+void LogViewerService::onKernelMessagesReadable()
+{
+    char buf[KMSG_RECORD_MAX];
+    qulonglong lastSeq = 0;
+    while (true) {
+        ssize_t len = ::read(m_kmsgFollowFd, buf, sizeof(buf));
+        if (len < 0) {
+            if (errno == EINTR || errno == EPIPE)
+                continue;
+            break;
+        }
+        if (len == 0)
+            break;
+
+        int level = 0;
+        qulonglong seq = 0;
+        qulonglong usec = 0;
+        if (parseKmsgRecord(buf, len, level, seq, usec, nullptr))
+            lastSeq = seq;
+    }
+
+    // 一次唤醒内的多条新记录合并为一个通知
+    if (lastSeq > 0)
+        Q_EMIT kernelMessagesAvailable(lastSeq);
+}
+
+void LogViewerService::stopKernelFollow()
+{
+    if (m_kmsgNotifier) {
+        m_kmsgNotifier->setEnabled(false);
+        m_kmsgNotifier->deleteLater();
+        m_kmsgNotifier = nullptr;
+    }
+    if (m_kmsgFollowFd >= 0) {
+        ::close(m_kmsgFollowFd);
+        m_kmsgFollowFd = -1;
+    }
+}
+
+void LogViewerService::watchClient(const QString &service)
+{
+    if (service.isEmpty())
+        return;
+
+    {
+        QMutexLocker locker(&m_exitCodeMutex);
+        m_clients.insert(service);
+    }
+    if (!m_clientWatcher) {
+        m_clientWatcher = new QDBusServiceWatcher(this);
+        m_clientWatcher->setConnection(QDBusConnection::systemBus());
+        m_clientWatcher->setWatchMode(QDBusServiceWatcher::WatchForUnregistration);
+        connect(m_clientWatcher, &QDBusServiceWatcher::serviceUnregistered, this, &LogViewerService::releaseClient);
+    }
+    if (!m_clientWatcher->watchedServices().contains(service))
+        m_clientWatcher->addWatchedService(service);
+}
+
+void LogViewerService::releaseClient(const QString &service)
+{
+    qCDebug(logService) << "Client left:" << service;
+    m_clientWatcher->removeWatchedService(service);
+    {
+        QMutexLocker locker(&m_exitCodeMutex);
+        m_clients.remove(service);
+        m_exitCodes.remove(service);
+    }
+    {
+        QMutexLocker locker(&m_logMapMutex);
+        for (auto it = m_logMap.begin(); it != m_logMap.end();) {
+            if (it->sender == service) {
+                delete it->stream;
+                it = m_logMap.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    auto it = m_kmsgCursors.find(service);
+    if (it != m_kmsgCursors.end()) {
+        ::close(it->fd);
+        m_kmsgCursors.erase(it);
+    }
+    m_kmsgFollowers.remove(service);
+    if (m_kmsgFollowers.isEmpty())
+        stopKernelFollow();
+}
+
 bool LogViewerService::exportOpsLog(const QString &outDir, const QString &homeDir)
 {
     qCDebug(logService) << "exportOpsLog for outDir:" << outDir << "and homeDir:" << homeDir;
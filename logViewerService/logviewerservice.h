@@ -5,16 +5,23 @@
 #ifndef LOGVIEWERSERVICE_H
 #define LOGVIEWERSERVICE_H
 
+#include "logrequestpool.h"
+
 #include <dgiomount.h>
 
 #include <QObject>
 #include <QDBusContext>
 #include <QScopedPointer>
 #include <QProcess>
-#include <QTemporaryDir>
 #include <QDBusUnixFileDescriptor>
+#include <QSet>
+#include <QHash>
+#include <QMutex>
+#include <QSharedPointer>
 
 class QTextStream;
+class QSocketNotifier;
+class QDBusServiceWatcher;
 class DGioVolumeManager;
 class LogViewerService : public QObject
     , protected QDBusContext
@@ -26,6 +33,8 @@ public:
     ~LogViewerService();
 
 Q_SIGNALS:
+    // 内核环形缓冲区有新记录，仅携带最新记录序号，不携带日志内容
+    void kernelMessagesAvailable(qulonglong lastSeq);
 
 public Q_SLOTS:
     Q_SCRIPTABLE QString readLog(const QDBusUnixFileDescriptor &fd);
@@ -41,12 +50,29 @@ public Q_SLOTS:
     Q_SCRIPTABLE QString isFileExist(const QString &filePath);
     Q_SCRIPTABLE quint64 getFileSize(const QString &filePath);
     Q_SCRIPTABLE qint64 getLineCount(const QString &filePath);
+    // 文件标识[设备号, inode, 修改时间(ms), 大小, 开头摘要]，供客户端判断解析缓存是否有效
+    Q_SCRIPTABLE QStringList getFileIdentity(const QString &filePath);
+    // 从字节偏移offset起读取最多maxBytes字节的完整行，文件只追加时客户端只读取新增部分
+    Q_SCRIPTABLE QByteArray readLogFromOffset(const QString &filePath, qint64 offset, qint64 maxBytes);
+    // 按首尾行时间过滤日志文件，跳过与时间范围[timeBegin, timeEnd](ms)无交集的轮转归档
+    Q_SCRIPTABLE QStringList filterLogFilesByTime(const QStringList &files, qint64 timeBegin, qint64 timeEnd);
     // 仅能执行特定合法命令
     Q_SCRIPTABLE QString executeCmd(const QString &cmd);
     Q_SCRIPTABLE QStringList whiteListOutPaths();
 
     Q_SCRIPTABLE bool exportOpsLog(const QString &outDir, const QString &homeDir);
 
+    // 提权读取会话：鉴权一次后，会话有效期内同一调用方的读取请求不再重复走polkit鉴权
+    Q_SCRIPTABLE QString openSession();
+    Q_SCRIPTABLE bool closeSession(const QString &session);
+    // 取消会话中正在进行的流式读取请求
+    Q_SCRIPTABLE bool cancelRequest(const QString &token);
+
+    // 从/dev/kmsg读取序号大于sinceSeq的内核日志记录，每次最多maxCount条
+    Q_SCRIPTABLE QString readKernelMessages(qulonglong sinceSeq, int maxCount);
+    // 开启/关闭内核日志跟随模式，开启后有新记录时发出kernelMessagesAvailable信号
+    Q_SCRIPTABLE bool followKernelMessages(bool enable);
+
 public:
     // 获取用户家目录
     QStringList getHomePaths();
@@ -57,6 +83,7 @@ public:
 private:
     QString readLog(const QString &filePath);
     Q_SCRIPTABLE QStringList readLogLinesInRange(const QString &filePath, qint64 startLine, qint64 lineCount, bool bReverse);
+    QStringList readGzipLinesInRange(const QString &filePath, qint64 startLine, qint64 lineCount, bool bReverse);
     // 清理临时目录下一些缓存文件，如解压后dump文件等（前端可能没权限删除，因此统一放到后端清理）
     void clearTempFiles();
 
@@ -64,21 +91,73 @@ private:
     qint64 findLineStartOffsetWithCaching(const QString &filePath, qint64 targetLine);
 
     qint64 readFileAndReturnIndex(const QString &filePath, qint64 startLine, QList<uint64_t>& lineIndexes, bool reverseOrder);
+    QStringList findLogFiles(const QString &file);
+
+    // 在工作线程中执行work并以延迟应答返回结果，不是dbus调用时直接执行；鉴权须在调用前完成
+    template<typename T, typename Work>
+    T dispatchRequest(Work work);
+    void setExitCode(int code);
 
 private:
     bool checkAuthorization(const QString &actionId);
+    // 调用方是否持有未过期的读取会话
+    bool hasValidSession(const QString &sender);
+
+    void onKernelMessagesReadable();
+    void stopKernelFollow();
+    // 调用方退出总线时释放其返回值记录、流式读取通道、读取游标和跟随状态
+    void watchClient(const QString &service);
+    void releaseClient(const QString &service);
+
+    struct ReaderSession {
+        QString sender;          // 会话所属调用方的dbus唯一名
+        qint64 expireTime = 0;   // 会话过期时间(ms)
+    };
+    // 流式读取通道，token随机生成，只有打开通道的调用方可以读取或取消
+    struct LogStream {
+        QString content;                 // 待读取的日志内容
+        QTextStream *stream = nullptr;   // 读取content的文本流
+        QString sender;                  // 通道所属调用方的dbus唯一名，不是dbus调用时为空
+    };
+    // 通道是否存在且属于当前调用方
+    bool ownsLogStream(const QString &token);
+
 private:
-    QTemporaryDir tmpDir;
-    QProcess m_process;
-    QString m_tmpDirPath;
+    // 各调用方最近一次执行命令的返回值，key为调用方dbus唯一名
+    QMutex m_exitCodeMutex;
+    QHash<QString, int> m_exitCodes;
+    // 仍在总线上的调用方，由m_exitCodeMutex保护
+    QSet<QString> m_clients;
     QString m_actionId;
     QMap<QString, QStringList> m_commands;
-    QMap<QString, std::pair<QString, QTextStream*>> m_logMap;
-    QMap<QString, QList<uint64_t>> m_logLineIndex;
+    // 通道在工作线程中创建，只在主线程中删除
+    QMutex m_logMapMutex;
+    QMap<QString, LogStream> m_logMap;
+    // 纯文本日志的行索引，key为文件路径的md5
+    struct LineIndex {
+        QMutex mutex;
+        QList<uint64_t> lines;
+    };
+    QMap<QString, QSharedPointer<LineIndex>> m_logLineIndex;
+    QMutex m_lineIndexMutex;
+    QMap<QString, ReaderSession> m_sessions;
+    // 各调用方分批读取/dev/kmsg的游标，key为调用方dbus唯一名
+    struct KmsgCursor {
+        int fd = -1;
+        qulonglong lastSeq = 0;
+    };
+    QMap<QString, KmsgCursor> m_kmsgCursors;
+    // 跟随模式
+    QSet<QString> m_kmsgFollowers;
+    int m_kmsgFollowFd = -1;
+    QSocketNotifier *m_kmsgNotifier = nullptr;
+    QDBusServiceWatcher *m_clientWatcher = nullptr;
 
-    bool checkAuth(const QString &actionId);
+    bool checkAuth(const QString &actionId, bool allowSession = true);
     QByteArray processCatFile(const QString &filePath);
-    void processCmdArgs(const QString &cmdStr, const QStringList &args);
+
+    // 耗时请求的工作线程池
+    LogRequestPool m_requestPool;
 };
 
 #endif // LOGVIEWERSERVICE_H
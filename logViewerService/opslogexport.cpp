@@ -182,6 +182,11 @@ void OpsLogExport::run()
     exportUosSteLogs();
     exportUosSteTwoLogs();
 
+    // 等待所有文件复制完成
+    copier.waitForDone();
+    if (copier.failedCount() > 0)
+        qWarning() << "Failed to copy" << copier.failedCount() << "files";
+
     // 递归设置目录及文件的权限
     setDirectoryPermissionsSafe(target_dir);
 }
@@ -201,20 +206,8 @@ void OpsLogExport::copy_file_or_dir(const string &src, const string &dst_dir)
 {
     if (!path_exists(src)) return;
 
-    QString qSrc = QString::fromStdString(src);
-    QString qDst = QString::fromStdString(dst_dir);
-
-    QFileInfo srcInfo(qSrc);
-    if (srcInfo.isFile()) {
-        // 单个文件：确保目标目录存在后用 QFile::copy
-        QDir().mkpath(qDst);
-        QString dstFile = qDst + "/" + srcInfo.fileName();
-        QFile::remove(dstFile);  // QFile::copy 要求目标不存在
-        QFile::copy(qSrc, dstFile);
-    } else {
-        // 目录：使用 cp -rf 通过 QProcess 参数数组传递
-        runProcess({"cp", "-rf", qSrc, qDst});
-    }
+    // 文件和目录均按cp -rf语义复制，文件提交到线程池使用内核复制
+    copier.copyToDir(QString::fromStdString(src), QString::fromStdString(dst_dir));
 }
 
 void OpsLogExport::execute_command(const QStringList &args, const string &output_file)
@@ -443,14 +436,8 @@ void OpsLogExport::exportSystemLogs()
     copy_file_or_dir("/var/log/syslog", target_dir + "/system/");
     copy_file_or_dir("/var/log/dpkg.log", target_dir + "/system/");
     // xorg /var/log/目录下所有log文件
-    {
-        QStringList xorgFiles = expandPathWithWildcardIterator("/var/log/Xorg*");
-        if (!xorgFiles.isEmpty()) {
-            QStringList cpArgs;
-            cpArgs << "cp" << "-rf" << xorgFiles << QString::fromStdString(target_dir + "/system/");
-            runProcess(cpArgs);
-        }
-    }
+    for (const QString &xorgFile : expandPathWithWildcardIterator("/var/log/Xorg*"))
+        copy_file_or_dir(xorgFile.toStdString(), target_dir + "/system/");
     // pulse　audio /home/uos/pulse.log
     copy_file_or_dir(home_dir + "/pulse.log", target_dir + "/system/pulseaudio/");
 }
@@ -463,14 +450,8 @@ void OpsLogExport::exportKernelLogs()
     execute_command({"dmesg"}, target_dir + "/kernel/dmesg.log");
     copy_file_or_dir("/sys/firmware/acpi/tables/DSDT", target_dir + "/kernel/");
     copy_file_or_dir("/var/log/lightdm/lightdm.log", target_dir + "/kernel/");
-    {
-        QStringList xorgFiles = expandPathWithWildcardIterator("/var/log/Xorg.0.log*");
-        if (!xorgFiles.isEmpty()) {
-            QStringList cpArgs;
-            cpArgs << "cp" << "-rf" << xorgFiles << QString::fromStdString(target_dir + "/kernel/");
-            runProcess(cpArgs);
-        }
-    }
+    for (const QString &xorgFile : expandPathWithWildcardIterator("/var/log/Xorg.0.log*"))
+        copy_file_or_dir(xorgFile.toStdString(), target_dir + "/kernel/");
     runProcess({"lspci", "-vvv"}, (target_dir + "/kernel/lspci_VGA.log").c_str(), "VGA c", 12);
     //    execute_command("ifconfig", target_dir + "/kernel/ifconfig.log");
     //    execute_command("ethtool -i $(ifconfig | grep --max-count=1 ^en | awk -F ':' '{print $1}')", target_dir + "/kernel/eth_info.log");
@@ -497,8 +478,7 @@ void OpsLogExport::exportDDELogs()
     execute_command({"udisksctl", "dump"}, target_dir + "/dde/udiskctl_dump.txt");
     execute_command({"df", "-h"}, target_dir + "/dde/df-h.txt");
     // DDE
-    runProcess({"cp", QString::fromStdString(home_dir + "/Desktop/DDE_LOG.zip"),
-               QString::fromStdString(target_dir + "/dde/")});
+    copy_file_or_dir(home_dir + "/Desktop/DDE_LOG.zip", target_dir + "/dde/");
     copy_file_or_dir("/var/log/journalLog", target_dir + "/dde/");
 }
 
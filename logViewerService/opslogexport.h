@@ -5,6 +5,8 @@
 #ifndef OPS_LOG_EXPORT_H
 #define OPS_LOG_EXPORT_H
 
+#include "filecopier.h"
+
 #include <string>
 #include <QStringList>
 
@@ -17,6 +19,8 @@ public:
 private:
     std::string target_dir;
     std::string home_dir;
+    // 独立文件并发复制，导出结束前统一等待
+    FileCopier copier;
 
     bool path_exists(const std::string& path);
     bool create_directories(const std::string& path);
@@ -78,7 +78,6 @@ popd
 %{_prefix}/lib/deepin-daemon/log-view-service
 %{_datadir}/dbus-1/system-services/com.deepin.logviewer.service
 %{_datadir}/dbus-1/system.d/com.deepin.logviewer.conf
-%{_datadir}/%{name}/DocxTemplate/*.dfw
 %{_datadir}/dsg/configs/org.deepin.deepin-log-viewer/*.json
 %{_datadir}/glib-2.0/schemas/*.gschema.xml
 
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "coredumpstatistics.h"
+
+#include <gtest/gtest.h>
+
+#include <QDateTime>
+#include <QTemporaryDir>
+
+static QString coredumpRow(const QDateTime &dt, int pid, const QString &exe)
+{
+    return QString("%1 %2 CST %3 1000 1000 11 present %4 1.2M\n")
+        .arg(dt.toString("ddd"))
+        .arg(dt.toString("yyyy-MM-dd hh:mm:ss"))
+        .arg(pid)
+        .arg(exe);
+}
+
+TEST(CoredumpStatistics_UT, ingest_incremental_UT)
+{
+    QTemporaryDir dir;
+    CoredumpStatistics *p = CoredumpStatistics::instance();
+    p->setStorePath(dir.filePath("coredumpStatistics.json"));
+
+    QDateTime now = QDateTime::currentDateTime().addSecs(-60);
+    QString data = "TIME PID UID GID SIG COREFILE EXE SIZE\n";
+    data += coredumpRow(now.addSecs(-2), 100, "/usr/bin/a");
+    data += coredumpRow(now.addSecs(-1), 101, "/usr/bin/a");
+    data += coredumpRow(now, 102, "/usr/bin/b");
+    EXPECT_EQ(p->ingest(data), 3);
+
+    // 重复拉取游标所在秒的记录不重复统计
+    data = coredumpRow(now, 102, "/usr/bin/b") + coredumpRow(now, 103, "/usr/bin/a");
+    EXPECT_EQ(p->ingest(data), 1);
+
+    QList<LOG_REPEAT_COREDUMP_INFO> infos = p->countRepeat();
+    EXPECT_EQ(infos.size(), 2);
+    for (const auto &info : infos) {
+        if (info.exePath == "/usr/bin/a")
+            EXPECT_EQ(info.times, 3);
+        else
+            EXPECT_EQ(info.times, 1);
+    }
+
+    infos = p->countRepeat(now.addSecs(-1).toMSecsSinceEpoch(), now.toMSecsSinceEpoch());
+    int total = 0;
+    for (const auto &info : infos)
+        total += info.times;
+    EXPECT_EQ(total, 3);
+
+    p->setStorePath(QString());
+}
+
+TEST(CoredumpStatistics_UT, updateRepeatExePaths_UT)
+{
+    QTemporaryDir dir;
+    CoredumpStatistics *p = CoredumpStatistics::instance();
+    p->setStorePath(dir.filePath("coredumpStatistics.json"));
+
+    LOG_REPEAT_COREDUMP_INFO info;
+    info.exePath = "/usr/bin/a";
+    info.times = 3;
+    p->updateRepeatExePaths({info});
+    EXPECT_TRUE(p->repeatExePaths().contains("/usr/bin/a"));
+
+    // 重新加载后名单仍然存在
+    p->setStorePath(dir.filePath("coredumpStatistics.json"));
+    EXPECT_TRUE(p->repeatExePaths().contains("/usr/bin/a"));
+
+    p->setStorePath(QString());
+}
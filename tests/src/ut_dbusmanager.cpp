@@ -20,3 +20,15 @@ TEST(DBusManager_GetSystemInfo_UT, DBusManager_GetSystemInfo_UT_001)
     EXPECT_EQ(rs, true);
     delete p;
 }
+
+TEST(DBusManager_Cache_UT, DBusManager_Cache_UT_001)
+{
+    DBusManager::prefetch();
+    // 结果在运行期间不变，重复查询返回缓存的结果
+    const bool seOpen = DBusManager::isSEOpen();
+    EXPECT_EQ(DBusManager::isSEOpen(), seOpen);
+    const bool auditAdmin = DBusManager::isAuditAdmin();
+    EXPECT_EQ(DBusManager::isAuditAdmin(), auditAdmin);
+    const QString homePath = DBusManager::getHomePathByFreeDesktop();
+    EXPECT_EQ(DBusManager::getHomePathByFreeDesktop(), homePath);
+}
@@ -6,6 +6,16 @@
 #include <stub.h>
 #include <gtest/gtest.h>
 
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
 
 TEST(UT_DebugTimeManager_clear, UT_DebugTimeManager_clear_001)
 {
@@ -14,3 +24,94 @@ TEST(UT_DebugTimeManager_clear, UT_DebugTimeManager_clear_001)
     Dtime->clear();
     delete Dtime;
 }
+
+TEST(UT_DebugTimeManager_metrics, UT_DebugTimeManager_metrics_001)
+{
+    DebugTimeManager *Dtime = new DebugTimeManager();
+    const int threadCount = 4;
+    const int loop = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([Dtime]() {
+            for (int i = 0; i < loop; ++i)
+                Dtime->addDuration(PerfParseRows, i % 100, 2);
+            Dtime->addValue(PerfReadBytes, 10);
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    // 线程退出时已释放分片，计数并入实例
+    EXPECT_TRUE(Dtime->m_shards.isEmpty());
+    QJsonObject json = Dtime->metricsJson();
+    EXPECT_EQ(json.value("threads").toInt(), threadCount);
+    QJsonObject parse = json.value("metrics").toObject().value("parse_rows").toObject();
+    EXPECT_EQ(parse.value("count").toInt(), threadCount * loop);
+    EXPECT_EQ(parse.value("value").toInt(), threadCount * loop * 2);
+    EXPECT_EQ(parse.value("max_us").toInt(), 99);
+    qint64 histogramCount = 0;
+    for (const QJsonValue &bucket : parse.value("histogram").toArray())
+        histogramCount += bucket.toObject().value("count").toInt();
+    EXPECT_EQ(histogramCount, threadCount * loop);
+    QJsonObject read = json.value("metrics").toObject().value("read_bytes").toObject();
+    EXPECT_EQ(read.value("count").toInt(), 0);
+    EXPECT_EQ(read.value("value").toInt(), threadCount * 10);
+
+    Dtime->resetMetrics();
+    parse = Dtime->metricsJson().value("metrics").toObject().value("parse_rows").toObject();
+    EXPECT_EQ(parse.value("count").toInt(), 0);
+    delete Dtime;
+}
+
+TEST(UT_DebugTimeManager_chromeTrace, UT_DebugTimeManager_chromeTrace_001)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString traceFile = dir.filePath("trace.json");
+
+    DebugTimeManager *Dtime = new DebugTimeManager();
+    Dtime->addTraceEvent("ignored", "test", 0, 1);
+    Dtime->setDumpFiles("", traceFile);
+    EXPECT_TRUE(Dtime->isChromeTraceEnabled());
+    Dtime->addTraceEvent("readLog", "dbus_call", 100, 20);
+    Dtime->beginPointLinux("POINT-TEST", "");
+    Dtime->endPointLinux("POINT-TEST", "");
+    ASSERT_TRUE(Dtime->writeChromeTrace(traceFile));
+
+    QFile file(traceFile);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    QJsonArray events = QJsonDocument::fromJson(file.readAll()).object().value("traceEvents").toArray();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events.at(0).toObject().value("name").toString(), QString("readLog"));
+    EXPECT_EQ(events.at(0).toObject().value("ph").toString(), QString("X"));
+    EXPECT_EQ(events.at(1).toObject().value("name").toString(), QString("POINT-TEST"));
+    delete Dtime;
+}
+
+TEST(UT_DebugTimeManager_shard, UT_DebugTimeManager_shard_001)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString metricsFile = dir.filePath("metrics.json");
+
+    DebugTimeManager *Dtime = new DebugTimeManager();
+    Dtime->setDumpFiles(metricsFile, "");
+    std::atomic<bool> counted {false};
+    std::atomic<bool> managerDeleted {false};
+    // 线程在实例析构后才退出
+    std::thread thread([Dtime, &counted, &managerDeleted]() {
+        Dtime->addDuration(PerfParseRows, 1, 1);
+        counted = true;
+        while (!managerDeleted)
+            std::this_thread::yield();
+    });
+    while (!counted)
+        std::this_thread::yield();
+    EXPECT_EQ(Dtime->m_shards.size(), 1);
+    delete Dtime;
+    managerDeleted = true;
+    thread.join();
+
+    // 析构时不写入，只由退出流程显式调用dump
+    EXPECT_FALSE(QFile::exists(metricsFile));
+}
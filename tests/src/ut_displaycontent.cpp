@@ -508,6 +508,52 @@ TEST_F(DisplayContentlx_UT, createDmesgTable_UT)
     EXPECT_NE(m_content->m_pModel, nullptr)<<"check the status after createDmesgTable()";
 }
 
+TEST_F(DisplayContentlx_UT, slot_dmesgAppended_UT)
+{
+    m_content->m_flag = LOG_FLAG::Dmesg;
+    m_content->createDmesgForm();
+    QList<LOG_MSG_DMESG> dmesgList;
+    LOG_MSG_DMESG oldLog = {"ERR", "2021-05-21", "old"};
+    dmesgList.push_back(oldLog);
+    m_content->createDmesgTable(dmesgList);
+    m_content->m_curTreeIndex = m_content->m_pModel->index(0, 0);
+
+    // 新记录插入到头部，已有行与选中项保留
+    QList<LOG_MSG_DMESG> appended;
+    appended.push_back({"ERR", "2021-05-23", "newest"});
+    appended.push_back({"ERR", "2021-05-22", "newer"});
+    m_content->slot_dmesgAppended(appended);
+    ASSERT_EQ(m_content->m_pModel->rowCount(), 3);
+    EXPECT_EQ(m_content->m_pModel->item(0, 2)->text(), QString("newest"));
+    EXPECT_EQ(m_content->m_pModel->item(1, 2)->text(), QString("newer"));
+    EXPECT_EQ(m_content->m_pModel->item(2, 2)->text(), QString("old"));
+    EXPECT_EQ(m_content->m_curTreeIndex.row(), 2);
+}
+
+TEST_F(DisplayContentlx_UT, dmesgIncrementalHistogram_UT)
+{
+    LogBackend *backend = m_content->m_pLogBackend;
+    backend->m_flag = LOG_FLAG::Dmesg;
+    backend->m_sessionType = LogBackend::View;
+    backend->m_dmesgFollowing = true;
+    backend->m_dmesgFilter = DMESG_FILTERS();
+
+    QList<LOG_MSG_DMESG> full;
+    full.push_back({"ERR", "2021-05-21 08:00:00.000", "first"});
+    full.push_back({"ERR", "2021-05-21 07:00:00.000", "second"});
+    backend->slot_dmesgFinished(full, 2);
+
+    // 重新加载时先清空数据与统计，增量读取只返回新记录，统计仍应覆盖全部记录
+    backend->clearAllDatalist();
+    backend->m_dmesgFilter.sinceSeq = 2;
+    QList<LOG_MSG_DMESG> delta;
+    delta.push_back({"ERR", "2021-05-21 09:00:00.000", "third"});
+    backend->slot_dmesgFinished(delta, 3);
+    backend->histogram()->waitForDone();
+    EXPECT_EQ(backend->dmesgListOrigin.size(), 3);
+    EXPECT_EQ(backend->histogram()->total(), 3);
+}
+
 TEST_F(DisplayContentlx_UT, createDnfForm_UT)
 {
     m_content->createDnfForm();
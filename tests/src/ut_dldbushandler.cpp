@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dldbushandler.h"
+
+#include <stub.h>
+
+#include <QCoreApplication>
+#include <QDBusMessage>
+
+#include <gtest/gtest.h>
+
+static QStringList s_calledMethods;
+
+// 代替服务端应答，按方法名返回固定结果
+static QDBusPendingCall stub_asyncCallWithArgumentList(void *, const QString &method, const QList<QVariant> &)
+{
+    s_calledMethods.append(method);
+    QVariant value;
+    if (method == "readLog" || method == "executeCmd")
+        value = QVariant::fromValue(QString("%1 result").arg(method));
+    else if (method == "isFileExist")
+        value = QVariant::fromValue(QString("exist"));
+    else if (method == "readLogLinesInRange" || method == "getFileInfo")
+        value = QVariant::fromValue(QStringList() << method << "line");
+    else if (method == "getLineCount")
+        value = QVariant::fromValue(qint64(7));
+    else if (method == "getFileSize")
+        value = QVariant::fromValue(quint64(42));
+    else
+        return QDBusPendingCall::fromError(QDBusError(QDBusError::UnknownMethod, method));
+
+    QDBusMessage call = QDBusMessage::createMethodCall("com.deepin.logviewer", "/com/deepin/logviewer", "com.deepin.logviewer", method);
+    return QDBusPendingCall::fromCompletedCall(call.createReply(value));
+}
+
+class DLDBusHandler_async_UT : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        s_calledMethods.clear();
+        m_stub.set(ADDR(QDBusAbstractInterface, asyncCallWithArgumentList), stub_asyncCallWithArgumentList);
+        m_handler = DLDBusHandler::instance(qApp);
+    }
+
+    Stub m_stub;
+    DLDBusHandler *m_handler = nullptr;
+};
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_ReadLog)
+{
+    QDBusPendingReply<QString> reply = m_handler->readLogAsync("/var/log/kern.log");
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), QString("readLog result"));
+    EXPECT_EQ(m_handler->readLog("/var/log/kern.log"), QString("readLog result"));
+    EXPECT_EQ(s_calledMethods, QStringList({"readLog", "readLog"}));
+}
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_ReadLogLinesInRange)
+{
+    QDBusPendingReply<QStringList> reply = m_handler->readLogLinesInRangeAsync("/var/log/kern.log", 0, 10);
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), QStringList({"readLogLinesInRange", "line"}));
+    EXPECT_EQ(m_handler->readLogLinesInRange("/var/log/kern.log", 0, 10), QStringList({"readLogLinesInRange", "line"}));
+}
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_GetFileInfo)
+{
+    QDBusPendingReply<QStringList> reply = m_handler->getFileInfoAsync("kern");
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), QStringList({"getFileInfo", "line"}));
+    EXPECT_EQ(m_handler->getFileInfo("kern"), QStringList({"getFileInfo", "line"}));
+}
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_GetLineCount)
+{
+    QDBusPendingReply<qint64> reply = m_handler->getLineCountAsync("/var/log/kern.log");
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), 7);
+    EXPECT_EQ(m_handler->getLineCount("/var/log/kern.log"), 7);
+    EXPECT_EQ(m_handler->getLineCounts({"/var/log/kern.log", "/var/log/kern.log.1"}), QList<qint64>({7, 7}));
+}
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_GetFileSize)
+{
+    QDBusPendingReply<quint64> reply = m_handler->getFileSizeAsync("/var/log/audit/audit.log");
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), 42u);
+    EXPECT_EQ(m_handler->getFileSize("/var/log/audit/audit.log"), 42u);
+    EXPECT_EQ(s_calledMethods, QStringList({"getFileSize", "getFileSize"}));
+}
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_IsFileExist)
+{
+    QDBusPendingReply<QString> reply = m_handler->isFileExistAsync("/var/log/kern.log");
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), QString("exist"));
+    EXPECT_TRUE(m_handler->isFileExist("/var/log/kern.log"));
+}
+
+TEST_F(DLDBusHandler_async_UT, DLDBusHandler_async_UT_ExecuteCmd)
+{
+    QDBusPendingReply<QString> reply = m_handler->executeCmdAsync("coredumpctl-list");
+    reply.waitForFinished();
+    ASSERT_FALSE(reply.isError());
+    EXPECT_EQ(reply.value(), QString("executeCmd result"));
+    EXPECT_EQ(m_handler->executeCmd("coredumpctl-list"), QString("executeCmd result"));
+    EXPECT_EQ(s_calledMethods, QStringList({"executeCmd", "executeCmd"}));
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "docxstreamwriter.h"
+#include "unzip.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+
+static QByteArray readZipEntry(const QString &fileName, const char *entryName)
+{
+    QByteArray data;
+    unzFile zip = unzOpen64(fileName.toUtf8().constData());
+    if (!zip)
+        return data;
+    if (unzLocateFile(zip, entryName, 0) == UNZ_OK && unzOpenCurrentFile(zip) == UNZ_OK) {
+        char buf[4096];
+        int len = 0;
+        while ((len = unzReadCurrentFile(zip, buf, sizeof(buf))) > 0)
+            data.append(buf, len);
+        unzCloseCurrentFile(zip);
+    }
+    unzClose(zip);
+    return data;
+}
+
+TEST(DocxStreamWriter_escape_UT, DocxStreamWriter_escape_UT)
+{
+    EXPECT_EQ(DocxStreamWriter::escapeText("a<b>&\"c\""), QByteArray("a&lt;b&gt;&amp;&quot;c&quot;"));
+    EXPECT_EQ(DocxStreamWriter::escapeText(QString("x") + QChar(0x1b) + "[0m"), QByteArray("x[0m"));
+    EXPECT_EQ(DocxStreamWriter::escapeText("a\nb"), QByteArray("a</w:t><w:br/><w:t xml:space=\"preserve\">b"));
+}
+
+TEST(DocxStreamWriter_write_UT, DocxStreamWriter_write_UT_Rows)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString fileName = dir.filePath("kern.doc");
+
+    DocxStreamWriter writer;
+    ASSERT_TRUE(writer.open(fileName, 2));
+    EXPECT_TRUE(writer.writeRow(QStringList() << "Time" << "Info", true));
+    // 行数较多时分多次压缩写入
+    for (int i = 0; i < 5000; ++i) {
+        writer.appendCell(QString::number(i));
+        writer.appendCell("kernel <msg>");
+        writer.appendCell("ignored");
+        ASSERT_TRUE(writer.endRow());
+    }
+    EXPECT_TRUE(writer.writeRow(QStringList() << "last"));
+    EXPECT_EQ(writer.rowCount(), 5001);
+    ASSERT_TRUE(writer.close());
+    EXPECT_FALSE(writer.isOpen());
+
+    EXPECT_TRUE(readZipEntry(fileName, "[Content_Types].xml").contains("/word/document.xml"));
+    EXPECT_TRUE(readZipEntry(fileName, "_rels/.rels").contains("word/document.xml"));
+    const QByteArray document = readZipEntry(fileName, "word/document.xml");
+    EXPECT_TRUE(document.endsWith("</w:document>"));
+    EXPECT_EQ(document.count("<w:tr>"), 5001);
+    EXPECT_EQ(document.count("<w:tblHeader/>"), 1);
+    EXPECT_EQ(document.count("<w:gridCol "), 2);
+    EXPECT_TRUE(document.contains("kernel &lt;msg&gt;"));
+    EXPECT_FALSE(document.contains("ignored"));
+    // 不足列数的行补空单元格
+    EXPECT_TRUE(document.contains("last</w:t></w:r></w:p></w:tc><w:tc><w:p/></w:tc></w:tr>"));
+}
+
+TEST(DocxStreamWriter_write_UT, DocxStreamWriter_write_UT_Abort)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString fileName = dir.filePath("kwin.doc");
+
+    {
+        DocxStreamWriter writer;
+        ASSERT_TRUE(writer.open(fileName, 1));
+        writer.writeRow(QStringList() << "Info", true);
+        EXPECT_TRUE(QFile::exists(fileName));
+    }
+    // 未关闭即销毁时删除不完整的文件
+    EXPECT_FALSE(QFile::exists(fileName));
+
+    DocxStreamWriter writer;
+    EXPECT_FALSE(writer.endRow());
+    EXPECT_FALSE(writer.close());
+    EXPECT_FALSE(writer.open(dir.filePath("missing/kwin.doc"), 1));
+}
@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gziplogreader.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <zlib.h>
+
+#include <gtest/gtest.h>
+
+// 生成不易压缩的日志内容，保证解压数据跨越多个deflate块
+static QByteArray makeLogContent(int lines, quint32 seed)
+{
+    QByteArray data;
+    quint32 value = seed;
+    for (int i = 0; i < lines; ++i) {
+        data += "2024-05-01T10:00:00.000000+08:00 host app[" + QByteArray::number(i) + "]:";
+        for (int j = 0; j < 6; ++j) {
+            value = value * 1664525u + 1013904223u;
+            data += ' ' + QByteArray::number(value, 16);
+        }
+        data += '\n';
+    }
+    return data;
+}
+
+// mode为"ab"时在文件末尾追加一个gzip成员
+static bool writeGzip(const QString &filePath, const QByteArray &data, const char *mode = "wb")
+{
+    gzFile gz = gzopen(filePath.toLocal8Bit().constData(), mode);
+    if (!gz)
+        return false;
+    const int written = gzwrite(gz, data.constData(), static_cast<unsigned>(data.size()));
+    return gzclose(gz) == Z_OK && written == data.size();
+}
+
+static QByteArray readFile(const QString &filePath)
+{
+    QFile file(filePath);
+    return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+static bool writeFile(const QString &filePath, const QByteArray &data)
+{
+    QFile file(filePath);
+    return file.open(QIODevice::WriteOnly | QIODevice::Truncate) && file.write(data) == data.size();
+}
+
+class GzipLogReader_UT : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(m_dir.isValid());
+        m_path = m_dir.filePath("syslog.2.gz");
+    }
+
+    QTemporaryDir m_dir;
+    QString m_path;
+};
+
+TEST_F(GzipLogReader_UT, GzipLogReader_UT_ReadLine)
+{
+    // 最后一行没有换行符，也应作为一行读出
+    const QByteArray content = makeLogContent(20000, 1) + "tail without newline";
+    ASSERT_TRUE(writeGzip(m_path, content));
+
+    GzipLogReader reader(m_path);
+    ASSERT_TRUE(reader.open());
+    QList<QByteArray> lines;
+    QByteArray line;
+    while (reader.readLine(line))
+        lines.append(line);
+
+    EXPECT_FALSE(reader.hasError());
+    EXPECT_TRUE(reader.atEnd());
+    ASSERT_EQ(lines.size(), content.count('\n') + 1);
+    EXPECT_EQ(lines.first(), content.left(content.indexOf('\n')));
+    EXPECT_EQ(lines.last(), QByteArray("tail without newline"));
+}
+
+TEST_F(GzipLogReader_UT, GzipLogReader_UT_MultiMember)
+{
+    const QByteArray first = makeLogContent(3000, 2);
+    const QByteArray second = makeLogContent(3000, 3);
+    ASSERT_TRUE(writeGzip(m_path, first));
+    ASSERT_TRUE(writeGzip(m_path, second, "ab"));
+
+    GzipLogReader reader(m_path);
+    ASSERT_TRUE(reader.open());
+    EXPECT_EQ(reader.readAll(), first + second);
+    EXPECT_FALSE(reader.hasError());
+
+    // 跳过第一个成员的全部行后从第二个成员继续读取
+    ASSERT_TRUE(reader.open());
+    EXPECT_EQ(reader.skipLines(first.count('\n')), first.count('\n'));
+    QByteArray line;
+    ASSERT_TRUE(reader.readLine(line));
+    EXPECT_EQ(line, second.left(second.indexOf('\n')));
+}
+
+TEST_F(GzipLogReader_UT, GzipLogReader_UT_IndexCheckpoint)
+{
+    const QByteArray first = makeLogContent(20000, 4);
+    const QByteArray second = makeLogContent(2000, 5);
+    const QByteArray content = first + second;
+    ASSERT_TRUE(writeGzip(m_path, first));
+    ASSERT_TRUE(writeGzip(m_path, second, "ab"));
+
+    GzipIndex index;
+    GzipLogReader reader(m_path);
+    ASSERT_TRUE(reader.buildIndex(index, 64 * 1024));
+    EXPECT_EQ(index.size, content.size());
+    EXPECT_EQ(index.lineCount, content.count('\n'));
+    EXPECT_FALSE(index.partialTail);
+    EXPECT_EQ(index.firstLine, content.left(content.indexOf('\n')));
+    ASSERT_GT(index.points.size(), 2);
+
+    // 从检查点恢复解压的数据与完整解压的对应部分一致，并能越过成员边界读到文件末尾
+    for (const GzipCheckpoint &point : {index.points.first(), index.points.at(index.points.size() / 2), index.points.last()}) {
+        EXPECT_EQ(point.line, content.left(static_cast<int>(point.outOffset)).count('\n'));
+        GzipLogReader pointReader(m_path);
+        ASSERT_TRUE(pointReader.openAt(point));
+        EXPECT_EQ(pointReader.readAll(), content.mid(static_cast<int>(point.outOffset)));
+        EXPECT_FALSE(pointReader.hasError());
+    }
+}
+
+TEST_F(GzipLogReader_UT, GzipLogReader_UT_Truncated)
+{
+    const QByteArray content = makeLogContent(20000, 6);
+    ASSERT_TRUE(writeGzip(m_path, content));
+    const QByteArray gz = readFile(m_path);
+    ASSERT_TRUE(writeFile(m_path, gz.left(gz.size() * 3 / 5)));
+
+    // 截断的文件(如正在写入)返回已能解压的部分，不视为错误
+    GzipLogReader reader(m_path);
+    ASSERT_TRUE(reader.open());
+    const QByteArray data = reader.readAll();
+    EXPECT_FALSE(reader.hasError());
+    EXPECT_FALSE(data.isEmpty());
+    EXPECT_LT(data.size(), content.size());
+    EXPECT_TRUE(content.startsWith(data));
+
+    GzipIndex index;
+    EXPECT_TRUE(reader.buildIndex(index, 64 * 1024));
+    EXPECT_EQ(index.size, data.size());
+    EXPECT_EQ(index.lineCount, data.count('\n'));
+}
+
+TEST_F(GzipLogReader_UT, GzipLogReader_UT_Corrupt)
+{
+    const QByteArray content = makeLogContent(20000, 7);
+    ASSERT_TRUE(writeGzip(m_path, content));
+    QByteArray gz = readFile(m_path);
+    gz.replace(gz.size() / 2, 64, QByteArray(64, '\xff'));
+    ASSERT_TRUE(writeFile(m_path, gz));
+
+    GzipLogReader reader(m_path);
+    ASSERT_TRUE(reader.open());
+    // 损坏的数据块或校验和不符时报错，之前已解压的数据仍然返回
+    reader.readAll();
+    EXPECT_TRUE(reader.hasError());
+
+    GzipIndex index;
+    EXPECT_FALSE(reader.buildIndex(index, 64 * 1024));
+}
+
+TEST_F(GzipLogReader_UT, GzipLogReader_UT_NotGzip)
+{
+    ASSERT_TRUE(writeFile(m_path, makeLogContent(10, 8)));
+
+    GzipLogReader reader(m_path);
+    ASSERT_TRUE(reader.open());
+    QByteArray line;
+    EXPECT_FALSE(reader.readLine(line));
+    EXPECT_TRUE(reader.hasError());
+
+    GzipLogReader missing(m_dir.filePath("missing.gz"));
+    EXPECT_FALSE(missing.open());
+    EXPECT_TRUE(GzipLogReader::isGzipFile("/var/log/syslog.2.GZ"));
+    EXPECT_FALSE(GzipLogReader::isGzipFile("/var/log/syslog.1"));
+}
@@ -41,6 +41,7 @@ TEST(LogApplicationHelper_initAppLog_UT, LogApplicationHelper_initAppLog_UT)
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
     EXPECT_NE(p, nullptr);
+    p->m_appLogFuture.waitForFinished();
     p->initAppLog();
     p->deleteLater();
 }
@@ -53,6 +54,18 @@ TEST(LogApplicationHelper_initOtherLog_UT, LogApplicationHelper_initOtherLog_UT)
     p->deleteLater();
 }
 
+TEST(LogApplicationHelper_getOtherLogList_UT, LogApplicationHelper_getOtherLogList_UT_Lazy)
+{
+    LogApplicationHelper *p = new LogApplicationHelper(nullptr);
+    p->m_appLogFuture.waitForFinished();
+    // 其他日志列表在首次获取时生成
+    const QList<QStringList> list = p->getOtherLogList();
+    EXPECT_TRUE(p->m_otherLogInited);
+    EXPECT_FALSE(list.isEmpty());
+    EXPECT_EQ(list, p->getOtherLogList());
+    p->deleteLater();
+}
+
 TEST(LogApplicationHelper_initCustomLog_UT, LogApplicationHelper_initCustomLog_UT)
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
@@ -65,6 +78,7 @@ TEST(LogApplicationHelper_createDesktopFiles_UT, LogApplicationHelper_createDesk
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
     EXPECT_NE(p, nullptr);
+    p->m_appLogFuture.waitForFinished();
     p->createDesktopFiles();
     p->deleteLater();
 }
@@ -73,6 +87,7 @@ TEST(LogApplicationHelper_createDesktopFiles_UT, LogApplicationHelper_createDesk
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
     EXPECT_NE(p, nullptr);
+    p->m_appLogFuture.waitForFinished();
     Stub stub;
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), stub_readLine);
     stub.set(ADDR(LogApplicationHelper, generateTransName), stub_parseField);
@@ -84,6 +99,7 @@ TEST(LogApplicationHelper_createDesktopFiles_UT, LogApplicationHelper_createDesk
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
     EXPECT_NE(p, nullptr);
+    p->m_appLogFuture.waitForFinished();
     Stub stub;
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), stub_readLine001);
     stub.set(ADDR(LogApplicationHelper, generateTransName), stub_parseField);
@@ -95,6 +111,7 @@ TEST(LogApplicationHelper_createLogFiles_UT, LogApplicationHelper_createLogFiles
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
     EXPECT_NE(p, nullptr);
+    p->m_appLogFuture.waitForFinished();
     p->createLogFiles();
     p->deleteLater();
 }
@@ -125,6 +142,7 @@ TEST_P(LogApplicationHelper_parseField_UT, LogApplicationHelper_parseField_UT)
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
     EXPECT_NE(p, nullptr);
+    p->m_appLogFuture.waitForFinished();
     LogApplicationHelper_parseField_UT_Param param = GetParam();
     QString path = param.isPathEmpty ? "" : "../sources/dde-calendar.log";
     p->generateTransName(path, "dde-calendar.log", param.isDeepin, param.isGeneric, param.isName);
@@ -132,6 +150,25 @@ TEST_P(LogApplicationHelper_parseField_UT, LogApplicationHelper_parseField_UT)
     p->deleteLater();
 }
 
+TEST(LogApplicationHelper_getAppLogConfigs_UT, LogApplicationHelper_getAppLogConfigs_UT_Cache)
+{
+    LogApplicationHelper *p = new LogApplicationHelper(nullptr);
+    EXPECT_NE(p, nullptr);
+    AppLogConfigList configs = p->getAppLogConfigs();
+    // 目录未变化时使用缓存
+    EXPECT_FALSE(p->isAppLogStale());
+    EXPECT_EQ(p->getAppLogConfigs().size(), configs.size());
+    // 反向索引与显示文本一致
+    for (auto it = p->m_trans_en_map.constBegin(); it != p->m_trans_en_map.constEnd(); ++it)
+        EXPECT_EQ(p->m_en_trans_map.value(it.value()), it.key());
+    // 监视到目录变化后重新发现
+    p->onAppLogDirChanged();
+    EXPECT_TRUE(p->isAppLogStale());
+    p->getAppLogConfigs();
+    EXPECT_FALSE(p->isAppLogStale());
+    p->deleteLater();
+}
+
 TEST(LogApplicationHelper_getLogFile_UT, LogApplicationHelper_getLogFile_UT_001)
 {
     LogApplicationHelper *p = new LogApplicationHelper(nullptr);
@@ -13,6 +13,7 @@
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
+#include <QtConcurrent>
 
 #include <gtest/gtest.h>
 
@@ -126,3 +127,88 @@ TEST_F(LogApplicationParseThread_UT, UT_GetIndex_001){
     int index= m_logAppThread->getIndex();
     EXPECT_EQ(index, 6);
 }
+
+TEST_F(LogApplicationParseThread_UT, UT_ParseLineTime_001)
+{
+    qint64 dt = 0;
+    EXPECT_TRUE(LogApplicationParseThread::parseLineTime("2021-04-06 13:29:32.123 [Info] test", dt));
+    EXPECT_EQ(dt, QDateTime::fromString("2021-04-06 13:29:32.123", "yyyy-MM-dd hh:mm:ss.zzz").toMSecsSinceEpoch());
+    EXPECT_TRUE(LogApplicationParseThread::parseLineTime("2021-04-06, 13:29:32.5 [Info] test", dt));
+    EXPECT_EQ(dt, QDateTime::fromString("2021-04-06 13:29:32.500", "yyyy-MM-dd hh:mm:ss.zzz").toMSecsSinceEpoch());
+    EXPECT_FALSE(LogApplicationParseThread::parseLineTime("Apr  6 13:29:32 host test", dt));
+    EXPECT_FALSE(LogApplicationParseThread::parseLineTime("2021-04-06 13:29", dt));
+}
+
+TEST_F(LogApplicationParseThread_UT, UT_ParseFileContent_001)
+{
+    APP_FILTERS filter;
+    filter.submodule = "test";
+    filter.lvlFilter = LVALL;
+    filter.timeFilterBegin = QDateTime::fromString("2021-04-06 13:00:00", "yyyy-MM-dd hh:mm:ss").toMSecsSinceEpoch();
+    filter.timeFilterEnd = QDateTime::fromString("2021-04-06 14:00:00", "yyyy-MM-dd hh:mm:ss").toMSecsSinceEpoch();
+    std::atomic<bool> canRun {true};
+    QString content = "2021-04-06 12:59:59.000 [Info] [main.cpp:1] too early\n"
+                      "2021-04-06 13:10:00.000 [Warning] [main.cpp:2] first\n"
+                      "invalid line\n"
+                      "2021-04-06 13:20:00.000 [Info] [main.cpp:3] " + QString(600, 'a') + "\n";
+    auto result = LogApplicationParseThread::parseFileContent(filter, content, m_logAppThread->m_levelDict, canRun);
+    ASSERT_EQ(result.msgs.size(), 2);
+    EXPECT_EQ(result.msgs[0].msg.size(), 500);
+    EXPECT_EQ(result.msgs[0].detailInfo.size(), 600);
+    EXPECT_EQ(result.msgs[1].msg, "first");
+    EXPECT_GT(result.times[0], result.times[1]);
+}
+
+static LogApplicationParseThread::FileParseResult makeParseResult(const QString &submodule, const QVector<qint64> &times)
+{
+    LogApplicationParseThread::FileParseResult result;
+    for (qint64 time : times) {
+        LOG_MSG_APPLICATOIN msg;
+        msg.subModule = submodule;
+        msg.msg = QString::number(time);
+        result.msgs.append(msg);
+        result.times.append(time);
+    }
+    return result;
+}
+
+TEST_F(LogApplicationParseThread_UT, UT_DrainMerged_001)
+{
+    m_logAppThread->m_canRun = true;
+    // 按耗时分批时部分数据已通过信号发出，与余下未发出的数据一起比较
+    QStringList emitted;
+    QObject::connect(m_logAppThread, &LogApplicationParseThread::appData, [&emitted](int, QList<LOG_MSG_APPLICATOIN> list) {
+        for (const auto &msg : list)
+            emitted << msg.subModule + msg.msg;
+    });
+    auto order = [this, &emitted]() {
+        QStringList result = emitted;
+        for (const auto &msg : m_logAppThread->m_appList)
+            result << msg.subModule + msg.msg;
+        return result;
+    };
+    QList<LogApplicationParseThread::MergeStream> streams;
+    streams.append(LogApplicationParseThread::MergeStream());
+    streams.append(LogApplicationParseThread::MergeStream());
+    streams[0].futures.append(QtConcurrent::run([] { return makeParseResult("a", {50, 30}); }));
+    streams[0].futures.append(QtConcurrent::run([] { return makeParseResult("a", {20}); }));
+    streams[0].closed = true;
+    streams[0].futures.first().waitForFinished();
+
+    // 第二个子模块还未读取，其数据可能更新，不能发出
+    EXPECT_FALSE(m_logAppThread->drainMerged(streams, false));
+    EXPECT_TRUE(order().isEmpty());
+
+    streams[1].futures.append(QtConcurrent::run([] { return makeParseResult("b", {40}); }));
+    streams[1].futures.first().waitForFinished();
+    streams[0].futures.last().waitForFinished();
+    // 第二个子模块当前文件取完后下一文件未提交，只能发出比它更新的数据
+    EXPECT_FALSE(m_logAppThread->drainMerged(streams, false));
+    EXPECT_EQ(order(), QStringList({"a50", "b40"}));
+
+    streams[1].futures.append(QtConcurrent::run([] { return makeParseResult("b", {30, 10}); }));
+    streams[1].closed = true;
+    EXPECT_TRUE(m_logAppThread->drainMerged(streams, true));
+    EXPECT_EQ(order(), QStringList({"a50", "b40", "a30", "b30", "a20", "b10"}));
+    m_logAppThread->m_canRun = false;
+}
@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logarchivecache.h"
+
+#include <stub.h>
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <atomic>
+
+#include <utime.h>
+#include <zlib.h>
+
+#include <gtest/gtest.h>
+
+static bool writeArchive(const QString &filePath, const QByteArray &data)
+{
+    gzFile gz = gzopen(filePath.toLocal8Bit().constData(), "wb");
+    if (!gz)
+        return false;
+    const int written = gzwrite(gz, data.constData(), static_cast<unsigned>(data.size()));
+    return gzclose(gz) == Z_OK && written == data.size();
+}
+
+static QByteArray makeArchiveContent(int lines)
+{
+    QByteArray data;
+    for (int i = 0; i < lines; ++i)
+        data += "May  1 10:00:" + QByteArray::number(10 + i % 50) + " host app: line " + QByteArray::number(i) + '\n';
+    return data;
+}
+
+// 代替完整解压，用于确认索引来自磁盘缓存
+static bool stub_buildIndexFail(void *, GzipIndex &, qint64)
+{
+    return false;
+}
+
+static std::atomic<int> s_buildCount {0};
+
+// 建立索引耗时较长，期间同一归档的其他请求应等待而不是重复解压
+static bool stub_buildIndexSlow(void *, GzipIndex &index, qint64)
+{
+    s_buildCount++;
+    QThread::msleep(100);
+    index.lineCount = 1;
+    return true;
+}
+
+class LogArchiveCache_UT : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(m_dir.isValid());
+        m_cache = LogArchiveCache::instance();
+        m_oldCacheDir = m_cache->cacheDir();
+        m_cache->setCacheDir(m_dir.filePath("cache"));
+    }
+
+    void TearDown() override
+    {
+        m_cache->setCacheDir(m_oldCacheDir);
+    }
+
+    QString archivePath(int i) const { return m_dir.filePath(QString("syslog.%1.gz").arg(i)); }
+
+    QTemporaryDir m_dir;
+    LogArchiveCache *m_cache = nullptr;
+    QString m_oldCacheDir;
+};
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_PersistAndReload)
+{
+    const QByteArray content = makeArchiveContent(100);
+    ASSERT_TRUE(writeArchive(archivePath(1), content));
+
+    QSharedPointer<const GzipIndex> index = m_cache->index(archivePath(1));
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index->lineCount, 100);
+    EXPECT_EQ(index->firstLine, QByteArray("May  1 10:00:10 host app: line 0"));
+    EXPECT_EQ(QDir(m_cache->cacheDir()).entryList(QStringList() << "*.idx", QDir::Files).size(), 1);
+
+    // 清空内存缓存后从磁盘加载，不再解压
+    Stub stub;
+    stub.set(ADDR(GzipLogReader, buildIndex), stub_buildIndexFail);
+    m_cache->setCacheDir(m_cache->cacheDir());
+    QSharedPointer<const GzipIndex> loaded = m_cache->index(archivePath(1));
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->lineCount, index->lineCount);
+    EXPECT_EQ(loaded->size, index->size);
+    EXPECT_EQ(loaded->lastLine, index->lastLine);
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_ChangedFile)
+{
+    ASSERT_TRUE(writeArchive(archivePath(1), makeArchiveContent(100)));
+    QSharedPointer<const GzipIndex> index = m_cache->index(archivePath(1));
+    ASSERT_TRUE(index);
+
+    // 文件内容变化后键不同，重新建立索引
+    ASSERT_TRUE(writeArchive(archivePath(1), makeArchiveContent(200)));
+    QSharedPointer<const GzipIndex> rebuilt = m_cache->index(archivePath(1));
+    ASSERT_TRUE(rebuilt);
+    EXPECT_EQ(rebuilt->lineCount, 200);
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_CorruptIndexFile)
+{
+    const QByteArray content = makeArchiveContent(100);
+    ASSERT_TRUE(writeArchive(archivePath(1), content));
+    ASSERT_TRUE(m_cache->index(archivePath(1)));
+
+    const QStringList files = QDir(m_cache->cacheDir()).entryList(QStringList() << "*.idx", QDir::Files);
+    ASSERT_EQ(files.size(), 1);
+    QFile idx(QDir(m_cache->cacheDir()).filePath(files.first()));
+    ASSERT_TRUE(idx.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    idx.write("broken");
+    idx.close();
+
+    // 磁盘上的索引损坏时重新解压建立
+    m_cache->setCacheDir(m_cache->cacheDir());
+    QSharedPointer<const GzipIndex> index = m_cache->index(archivePath(1));
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index->lineCount, 100);
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_CorruptArchive)
+{
+    QFile file(archivePath(1));
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write("not a gzip file\n");
+    file.close();
+
+    EXPECT_FALSE(m_cache->index(archivePath(1)));
+    EXPECT_FALSE(m_cache->index(archivePath(2)));
+    EXPECT_TRUE(QDir(m_cache->cacheDir()).entryList(QStringList() << "*.idx", QDir::Files).isEmpty());
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_MemoryEviction)
+{
+    const int count = 17;
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(writeArchive(archivePath(i), makeArchiveContent(10 + i)));
+        ASSERT_TRUE(m_cache->index(archivePath(i)));
+    }
+
+    // 内存中只保留最近加入的16个索引，最早的被淘汰
+    EXPECT_EQ(m_cache->m_indexes.size(), count - 1);
+    EXPECT_EQ(m_cache->m_indexOrder.size(), count - 1);
+    EXPECT_FALSE(m_cache->m_indexes.contains(m_cache->keyOf(archivePath(0))));
+    EXPECT_TRUE(m_cache->m_indexes.contains(m_cache->keyOf(archivePath(count - 1))));
+
+    // 被淘汰的索引再次使用时从磁盘加载
+    QSharedPointer<const GzipIndex> index = m_cache->index(archivePath(0));
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index->lineCount, 10);
+    EXPECT_FALSE(m_cache->m_indexes.contains(m_cache->keyOf(archivePath(1))));
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_DiskPrune)
+{
+    QDir dir;
+    ASSERT_TRUE(dir.mkpath(m_cache->cacheDir()));
+    // 磁盘上最多保留256个索引文件，按修改时间淘汰最早的
+    const int count = 260;
+    for (int i = 0; i < count; ++i) {
+        const QString path = QDir(m_cache->cacheDir()).filePath(QString("%1.idx").arg(i));
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.close();
+        struct utimbuf times;
+        times.actime = times.modtime = 1700000000 + i;
+        ASSERT_EQ(::utime(path.toLocal8Bit().constData(), &times), 0);
+    }
+
+    m_cache->prune();
+    const QStringList files = QDir(m_cache->cacheDir()).entryList(QStringList() << "*.idx", QDir::Files);
+    EXPECT_EQ(files.size(), 256);
+    for (int i = 0; i < count - 256; ++i)
+        EXPECT_FALSE(files.contains(QString("%1.idx").arg(i)));
+    EXPECT_TRUE(files.contains(QString("%1.idx").arg(count - 1)));
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_TimeRange)
+{
+    ASSERT_TRUE(writeArchive(archivePath(1), makeArchiveContent(100)));
+    qint64 firstTime = 0;
+    qint64 lastTime = 0;
+    ASSERT_TRUE(m_cache->timeRange(archivePath(1), firstTime, lastTime));
+    EXPECT_GT(firstTime, 0);
+    EXPECT_GE(lastTime, firstTime);
+    EXPECT_FALSE(m_cache->timeRange(archivePath(2), firstTime, lastTime));
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_ConcurrentBuild)
+{
+    ASSERT_TRUE(writeArchive(archivePath(1), makeArchiveContent(10)));
+    ASSERT_TRUE(writeArchive(archivePath(2), makeArchiveContent(10)));
+
+    Stub stub;
+    stub.set(ADDR(GzipLogReader, buildIndex), stub_buildIndexSlow);
+    s_buildCount = 0;
+    QList<QFuture<QSharedPointer<const GzipIndex>>> futures;
+    for (int i = 0; i < 4; ++i)
+        futures.append(QtConcurrent::run([this, i]() { return m_cache->index(archivePath(1 + i % 2)); }));
+    for (auto &future : futures)
+        future.waitForFinished();
+
+    // 每个归档只解压一次，同一归档的请求得到同一份索引
+    EXPECT_EQ(s_buildCount, 2);
+    EXPECT_EQ(futures.at(0).result(), futures.at(2).result());
+    EXPECT_EQ(futures.at(1).result(), futures.at(3).result());
+    EXPECT_TRUE(m_cache->m_building.isEmpty());
+}
+
+TEST_F(LogArchiveCache_UT, LogArchiveCache_UT_TimeRangeEviction)
+{
+    // 首尾行时间与索引一样有数量上限，最早加入的被淘汰
+    const int count = 1025;
+    qint64 firstTime = 0;
+    qint64 lastTime = 0;
+    for (int i = 0; i < count; ++i) {
+        const QString path = m_dir.filePath(QString("plain.%1.log").arg(i));
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("2024-05-01 10:00:00 host app: line\n");
+        file.close();
+        ASSERT_TRUE(m_cache->timeRange(path, firstTime, lastTime));
+    }
+
+    EXPECT_EQ(m_cache->m_timeRanges.size(), count - 1);
+    EXPECT_EQ(m_cache->m_timeRangeOrder.size(), count - 1);
+    EXPECT_FALSE(m_cache->m_timeRanges.contains(m_cache->keyOf(m_dir.filePath("plain.0.log"))));
+}
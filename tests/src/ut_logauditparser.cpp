@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logauditparser.h"
+
+#include <gtest/gtest.h>
+
+TEST(LogAuditParser_scanLine_UT, LogAuditParser_scanLine_UT_Fields)
+{
+    LogAuditParser::Record record;
+    const QString line = "type=USER_LOGIN msg=audit(1688526389.214:61): pid=1234 uid=0 "
+                         "msg='op=login acct=\"root\" exe=\"/usr/sbin/sshd\" addr=10.0.0.1 res=failed'";
+    ASSERT_TRUE(LogAuditParser::scanLine(line, record));
+    EXPECT_EQ(record.eventType(), QString("USER_LOGIN"));
+    EXPECT_EQ(record.text(record.id), QString("1688526389.214:61"));
+    EXPECT_EQ(record.time, 1688526389000LL);
+    EXPECT_EQ(record.text(record.value(QLatin1String("pid"))), QString("1234"));
+    // 单引号内的嵌套字段
+    EXPECT_EQ(record.text(record.value(QLatin1String("res"))), QString("failed"));
+    EXPECT_EQ(record.text(record.value(QLatin1String("addr"))), QString("10.0.0.1"));
+    EXPECT_EQ(record.decoded(record.value(QLatin1String("exe"))), QString("/usr/sbin/sshd"));
+    EXPECT_EQ(line.mid(record.msgPos).left(8), QString("pid=1234"));
+
+    EXPECT_FALSE(LogAuditParser::scanLine("no audit record here", record));
+}
+
+TEST(LogAuditParser_scanLine_UT, LogAuditParser_scanLine_UT_Decode)
+{
+    // "cat"与"cat\0/etc/passwd"的十六进制编码
+    LogAuditParser::Record record;
+    ASSERT_TRUE(LogAuditParser::scanLine("type=PROCTITLE msg=audit(1.0:1): comm=636174 proctitle=636174002F6574632F706173737764", record));
+    EXPECT_EQ(record.decoded(record.value(QLatin1String("comm"))), QString("cat"));
+    EXPECT_EQ(record.decoded(record.value(QLatin1String("proctitle"))), QString("cat /etc/passwd"));
+    EXPECT_TRUE(LogAuditParser::decodeHex("(null)").isEmpty());
+    EXPECT_TRUE(LogAuditParser::decodeHex("abc").isEmpty());
+
+    EXPECT_EQ(LogAuditParser::stripColor("\x1b[1;31mtype=AVC\x1b[0m msg"), QString("type=AVC msg"));
+    EXPECT_EQ(LogAuditParser::stripColor("#033[32mtype=AVC"), QString("type=AVC"));
+}
+
+TEST(LogAuditParser_correlate_UT, LogAuditParser_correlate_UT_Event)
+{
+    const QStringList lines = {
+        "type=SYSCALL msg=audit(1700000000.100:10): arch=c000003e syscall=257 success=no pid=42 comm=\"cat\" key=\"passwd\"",
+        "type=USER_AUTH msg=audit(1700000000.150:11): pid=7 msg='op=PAM:authentication res=success'",
+        "type=CWD msg=audit(1700000000.100:10): cwd=\"/root\"",
+        "type=PATH msg=audit(1700000000.100:10): item=0 name=\"/etc/shadow\"",
+        "type=EOE msg=audit(1700000000.100:10): "
+    };
+
+    LogAuditParser parser;
+    QList<LogAuditParser::Event> events;
+    for (const QString &line : lines)
+        parser.addLine(line, events);
+    // 第一个事件以EOE结束，第二个事件在窗口中等待
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events.at(0).msg.eventType, QString("SYSCALL"));
+    EXPECT_EQ(events.at(0).msg.processName, QString("cat"));
+    EXPECT_EQ(events.at(0).msg.processId, QString("42"));
+    EXPECT_EQ(events.at(0).msg.status, QString("Failed"));
+    EXPECT_EQ(events.at(0).msg.origin.count('\n'), 3);
+    EXPECT_TRUE(events.at(0).msg.msg.startsWith("arch=c000003e"));
+    EXPECT_EQ(events.at(0).msg.origin.mid(events.at(0).msgPos, 13), QString("arch=c000003e"));
+
+    parser.flush(events);
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events.at(1).msg.eventType, QString("USER_AUTH"));
+    EXPECT_EQ(events.at(1).msg.status, QString("OK"));
+
+    // 从新到旧输入时事件同样按从新到旧输出，事件内各行保持文件中的顺序
+    LogAuditParser reverseParser(true);
+    QList<LogAuditParser::Event> reverseEvents;
+    for (int i = lines.size() - 1; i >= 0; --i)
+        reverseParser.addLine(lines.at(i), reverseEvents);
+    reverseParser.flush(reverseEvents);
+    ASSERT_EQ(reverseEvents.size(), 2);
+    EXPECT_EQ(reverseEvents.at(0).msg.eventType, QString("SYSCALL"));
+    EXPECT_EQ(reverseEvents.at(0).msg.origin, events.at(0).msg.origin);
+    EXPECT_EQ(reverseEvents.at(1).msg.eventType, QString("USER_AUTH"));
+}
+
+TEST(LogAuditParser_correlate_UT, LogAuditParser_correlate_UT_Window)
+{
+    LogAuditParser parser(false, 2);
+    QList<LogAuditParser::Event> events;
+    parser.addLine("type=SYSCALL msg=audit(1.0:1): success=yes", events);
+    parser.addLine("type=SYSCALL msg=audit(1.0:2): success=yes", events);
+    EXPECT_TRUE(events.isEmpty());
+    // 窗口已满，最早的事件先行输出
+    parser.addLine("type=SYSCALL msg=audit(1.0:3): success=yes", events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_TRUE(events.at(0).msg.origin.contains("1.0:1"));
+    // 超出窗口后到达的记录作为新的事件
+    parser.addLine("type=PATH msg=audit(1.0:1): item=0", events);
+    parser.flush(events);
+    EXPECT_EQ(events.size(), 4);
+}
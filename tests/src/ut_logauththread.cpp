@@ -13,6 +13,8 @@
 
 #include <QDebug>
 #include <QDateTime>
+#include <QDir>
+#include <QTemporaryDir>
 
 #include <gtest/gtest.h>
 bool stub_isAttached()
@@ -122,6 +124,27 @@ QString stub_KernReadLog(const QString &filePath)
     return "Aug 21 13:23:33 uos-PC deepin-deepinid-daemon[2946]: #033[33m[WAR] manager.go:218:#033[0m skip doSync";
 }
 
+bool stub_ensureSession()
+{
+    return true;
+}
+
+QString stub_readKernelMessages(quint64 sinceSeq, int maxCount)
+{
+    Q_UNUSED(sinceSeq);
+    Q_UNUSED(maxCount);
+    static int i = 0;
+    // 第一次返回一批记录，第二次返回空表示读取结束
+    return (i++ % 2 == 0) ? "6,100,101619805280;snd_hda_codec_hdmi hdaudioC1D0: hda_codec_cleanup_stream: NID=0x8\n"
+                            "3,101,101619900000;usb 1-1: device descriptor read/64, error -71\n"
+                          : "";
+}
+
+QString stub_startTime()
+{
+    return "100.00";
+}
+
 QByteArray fileReadLine(qint64 maxlen = 0)
 {
     Q_UNUSED(maxlen);
@@ -337,6 +360,7 @@ TEST_F(LogAuthThread_UT, UT_HandleKern_001)
     stub.set(wtmp_close, stub_wtmp_close);
     stub.set(ADDR(QProcess, setProcessChannelMode), stub_setProcessChannelMode);
     stub.set(ADDR(QProcess, exitCode), stub_exitCode);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
     stub.set(ADDR(DLDBusHandler, openLogStream), stub_dnfReadLog);
     stub.set(ADDR(DLDBusHandler, readLogInStream), stub_dnfReadStream);
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), fileReadLine);
@@ -374,6 +398,8 @@ TEST_F(LogAuthThread_UT, UT_HandleDmesg_001)
     stub.set(ADDR(QProcess, setProcessChannelMode), stub_setProcessChannelMode);
     stub.set(ADDR(QProcess, exitCode), stub_exitCode);
     stub.set(ADDR(DLDBusHandler, readLog), stub_KernReadLog);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
+    stub.set(ADDR(DLDBusHandler, readKernelMessages), stub_readKernelMessages);
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), fileReadLine);
     stub.set(ADDR(QDateTime, toMSecsSinceEpoch), dnfToMSecsSinceEpoch);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
@@ -389,6 +415,32 @@ TEST_F(LogAuthThread_UT, UT_HandleDmesg_001)
     EXPECT_EQ(m_logAuthThread->m_canRun,true);
 }
 
+TEST_F(LogAuthThread_UT, UT_HandleDmesg_Stream)
+{
+    Stub stub;
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
+    stub.set(ADDR(DLDBusHandler, readKernelMessages), stub_readKernelMessages);
+    stub.set(ADDR(LogAuthThread, startTime), stub_startTime);
+
+    QList<LOG_MSG_DMESG> streamed;
+    int finishedSize = -1;
+    QObject::connect(m_logAuthThread, &LogAuthThread::dmesgData, [&streamed](int, QList<LOG_MSG_DMESG> list) {
+        streamed.append(list);
+    });
+    QObject::connect(m_logAuthThread, &LogAuthThread::dmesgFinished, [&finishedSize](QList<LOG_MSG_DMESG> list, quint64) {
+        finishedSize = list.size();
+    });
+
+    // 分批发出时数据按读取顺序由旧到新经数据信号给出，结束信号不再携带数据
+    m_logAuthThread->setStreamData(true);
+    m_logAuthThread->m_canRun = true;
+    m_logAuthThread->handleDmesg();
+    ASSERT_EQ(streamed.size(), 2);
+    EXPECT_TRUE(streamed[0].msg.startsWith("snd_hda_codec_hdmi"));
+    EXPECT_TRUE(streamed[1].msg.startsWith("usb 1-1"));
+    EXPECT_EQ(finishedSize, 0);
+}
+
 TEST_F(LogAuthThread_UT, handleBoot_UT_001)
 {
     Stub stub;
@@ -407,6 +459,7 @@ TEST_F(LogAuthThread_UT, handleBoot_UT_001)
     stub.set(ADDR(QProcess, setProcessChannelMode), stub_setProcessChannelMode);
     stub.set(ADDR(QProcess, exitCode), stub_exitCode);
     stub.set(ADDR(DLDBusHandler, readLog), stub_BootReadLog);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), fileReadLine);
     stub.set(ADDR(QDateTime, toMSecsSinceEpoch), dnfToMSecsSinceEpoch);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
@@ -439,6 +492,7 @@ TEST_F(LogAuthThread_UT, handleKwin_UT_001)
     stub.set(ADDR(QProcess, setProcessChannelMode), stub_setProcessChannelMode);
     stub.set(ADDR(QProcess, exitCode), stub_exitCode);
     stub.set(ADDR(DLDBusHandler, readLog), stub_BootReadLog);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), fileReadLine);
     stub.set(ADDR(QDateTime, toMSecsSinceEpoch), dnfToMSecsSinceEpoch);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
@@ -471,6 +525,7 @@ TEST_F(LogAuthThread_UT, handleDpkg_UT_001)
     stub.set(ADDR(QProcess, setProcessChannelMode), stub_setProcessChannelMode);
     stub.set(ADDR(QProcess, exitCode), stub_exitCode);
     stub.set(ADDR(DLDBusHandler, readLog), stub_BootReadLog);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), fileReadLine);
     stub.set(ADDR(QDateTime, toMSecsSinceEpoch), dnfToMSecsSinceEpoch);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
@@ -503,6 +558,7 @@ TEST_F(LogAuthThread_UT, handleNormal_UT_001)
     stub.set(ADDR(QProcess, setProcessChannelMode), stub_setProcessChannelMode);
     stub.set(ADDR(QProcess, exitCode), stub_exitCode);
     stub.set(ADDR(DLDBusHandler, readLog), stub_BootReadLog);
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_ensureSession);
     stub.set((QByteArray(QIODevice::*)(qint64))ADDR(QIODevice, readLine), fileReadLine);
     stub.set(ADDR(QDateTime, toMSecsSinceEpoch), dnfToMSecsSinceEpoch);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
@@ -708,5 +764,77 @@ TEST(LogAuthThread_run_UT, LogAuthThread_run_UT_008)
     delete p;
 }
 
+static int s_auditReadCount = 0;
+static const QByteArray s_auditLog = "type=USER_LOGIN msg=audit(1688526389.214:61): pid=1 uid=0 comm=\"sshd\" res=success\n"
+                                     "type=SYSCALL msg=audit(1688526390.100:62): success=no exe=\"/usr/bin/cat\" key=\"test\"\n";
+
+bool stub_auditIsFileExist(void *, const QString &filePath)
+{
+    Q_UNUSED(filePath);
+    return true;
+}
+
+QStringList stub_auditGetFileIdentity(void *, const QString &filePath)
+{
+    Q_UNUSED(filePath);
+    return QStringList() << "1" << "100" << "1688526390000" << QString::number(s_auditLog.size()) << "head";
+}
 
+QByteArray stub_auditReadLogFromOffset(void *, const QString &filePath, qint64 offset, qint64 maxBytes)
+{
+    Q_UNUSED(filePath);
+    s_auditReadCount++;
+    return s_auditLog.mid(static_cast<int>(offset), static_cast<int>(maxBytes));
+}
 
+TEST(LogAuthThread_handleAudit_UT, LogAuthThread_handleAudit_UT_Cache)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString oldDir = LogParseCache::instance()->cacheDir();
+    LogParseCache::instance()->setCacheDir(dir.path());
+    const bool oldRunInCmd = Utils::runInCmd;
+    Utils::runInCmd = true;
+
+    Stub stub;
+    stub.set(ADDR(DLDBusHandler, isFileExist), stub_auditIsFileExist);
+    stub.set(ADDR(DLDBusHandler, getFileIdentity), stub_auditGetFileIdentity);
+    stub.set(ADDR(DLDBusHandler, readLogFromOffset), stub_auditReadLogFromOffset);
+
+    s_auditReadCount = 0;
+    QList<LOG_MSG_AUDIT> first;
+    LogAuthThread *p = new LogAuthThread();
+    p->m_FilePath = QStringList() << "/var/log/audit/audit.log";
+    p->m_canRun = true;
+    QObject::connect(p, &LogAuthThread::auditData, [&first](int, QList<LOG_MSG_AUDIT> list) { first.append(list); });
+    p->handleAudit();
+    delete p;
+    ASSERT_EQ(first.size(), 2);
+    EXPECT_GT(s_auditReadCount, 0);
+    EXPECT_EQ(first.at(0).processName, QString("cat"));
+    EXPECT_EQ(first.at(0).status, QString("Failed"));
+    EXPECT_EQ(first.at(1).processName, QString("sshd"));
+    // 审计日志内容需要提权读取，不写入磁盘缓存
+    EXPECT_TRUE(QDir(dir.path()).entryList(QDir::Files | QDir::NoDotAndDotDot).isEmpty());
+
+    // 文件未变化时直接使用缓存，不再读取
+    s_auditReadCount = 0;
+    QList<LOG_MSG_AUDIT> second;
+    p = new LogAuthThread();
+    p->m_FilePath = QStringList() << "/var/log/audit/audit.log";
+    p->m_canRun = true;
+    QObject::connect(p, &LogAuthThread::auditData, [&second](int, QList<LOG_MSG_AUDIT> list) { second.append(list); });
+    p->handleAudit();
+    delete p;
+    EXPECT_EQ(s_auditReadCount, 0);
+    ASSERT_EQ(second.size(), first.size());
+    for (int i = 0; i < first.size(); ++i) {
+        EXPECT_EQ(second.at(i).dateTime, first.at(i).dateTime);
+        EXPECT_EQ(second.at(i).auditType, first.at(i).auditType);
+        EXPECT_EQ(second.at(i).msg, first.at(i).msg);
+        EXPECT_EQ(second.at(i).origin, first.at(i).origin);
+    }
+
+    Utils::runInCmd = oldRunInCmd;
+    LogParseCache::instance()->setCacheDir(oldDir);
+}
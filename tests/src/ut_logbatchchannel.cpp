@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logbatchchannel.h"
+
+#include <QThread>
+
+#include <gtest/gtest.h>
+
+TEST(LogBatchChannel_acquire_UT, LogBatchChannel_acquire_UT_Capacity)
+{
+    LogBatchChannel channel(2);
+    EXPECT_TRUE(channel.tryAcquire());
+    EXPECT_TRUE(channel.tryAcquire());
+    EXPECT_FALSE(channel.tryAcquire(10));
+    // 必须发送的批次不受上限限制
+    channel.acquire();
+    EXPECT_EQ(channel.pending(), 3);
+
+    channel.release();
+    channel.release();
+    EXPECT_TRUE(channel.tryAcquire());
+    channel.reset();
+    EXPECT_EQ(channel.pending(), 0);
+    // 重置后迟到的释放不会使计数为负
+    channel.release();
+    EXPECT_EQ(channel.pending(), 0);
+}
+
+TEST(LogBatchSender_due_UT, LogBatchSender_due_UT_Frame)
+{
+    std::atomic_bool canRun {true};
+    LogBatchSender sender;
+    EXPECT_FALSE(sender.due(0, canRun));
+    // 不足一帧的时间继续累积
+    EXPECT_FALSE(sender.due(1, canRun));
+    QThread::msleep(20);
+    EXPECT_TRUE(sender.due(2, canRun));
+    EXPECT_FALSE(sender.due(1, canRun));
+    // 累积达到上限时不再等待一帧
+    EXPECT_TRUE(sender.due(20000, canRun));
+}
+
+TEST(LogBatchSender_due_UT, LogBatchSender_due_UT_Backpressure)
+{
+    std::atomic_bool canRun {true};
+    QSharedPointer<LogBatchChannel> channel(new LogBatchChannel(1));
+    LogBatchSender sender;
+    sender.setChannel(channel);
+
+    sender.commit();
+    EXPECT_EQ(channel->pending(), 1);
+    QThread::msleep(20);
+    // 接收端积压时合并为更大的批次
+    EXPECT_FALSE(sender.due(100, canRun));
+    channel->release();
+    EXPECT_TRUE(sender.due(101, canRun));
+    EXPECT_EQ(channel->pending(), 1);
+
+    // 累积达到上限后等待接收端，线程停止时不再等待
+    canRun = false;
+    EXPECT_TRUE(sender.due(20000, canRun));
+    EXPECT_EQ(channel->pending(), 2);
+}
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logcolumnsorter.h"
+
+#include <QThreadPool>
+
+#include <gtest/gtest.h>
+
+TEST(LogColumnSorter_keys_UT, LogColumnSorter_keys_UT_Dictionary)
+{
+    const QStringList texts {"warning", "Error", "info", "error", "warning"};
+    const QVector<qint64> keys = LogColumnSorter::dictionaryKeys(texts);
+    ASSERT_EQ(keys.size(), texts.size());
+    // 只有大小写不同的文本编码相同，编码顺序即文本顺序
+    EXPECT_EQ(keys[1], keys[3]);
+    EXPECT_EQ(keys[0], keys[4]);
+    EXPECT_LT(keys[1], keys[2]);
+    EXPECT_LT(keys[2], keys[0]);
+}
+
+TEST(LogColumnSorter_keys_UT, LogColumnSorter_keys_UT_Level)
+{
+    const QStringList texts {"Info", "Emergency", "custom", "warning", "Debug", "Error", "abc", "Super critical", "Trace"};
+    const QVector<qint64> keys = LogColumnSorter::levelKeys(texts, LogColumnSorter::levelRanks());
+    ASSERT_EQ(keys.size(), texts.size());
+    // 按严重程度排序，不按文本顺序
+    EXPECT_EQ(LogColumnSorter::permute(texts, LogColumnSorter::sortPermutation(keys, Qt::AscendingOrder)),
+              QList<QString>({"Emergency", "Super critical", "Error", "warning", "Info", "Debug", "Trace", "abc", "custom"}));
+}
+
+TEST(LogColumnSorter_keys_UT, LogColumnSorter_keys_UT_Time)
+{
+    const QStringList texts {"2024-03-01 10:00:00", "2024-02-29 23:59:59", "invalid"};
+    const QVector<qint64> keys = LogColumnSorter::timeKeys(texts);
+    ASSERT_EQ(keys.size(), texts.size());
+    EXPECT_GT(keys[0], keys[1]);
+    EXPECT_EQ(keys[2], -1);
+}
+
+TEST(LogColumnSorter_sortPermutation_UT, LogColumnSorter_sortPermutation_UT_Stable)
+{
+    const QVector<qint64> keys {3, 1, 2, 1, 3};
+    EXPECT_EQ(LogColumnSorter::sortPermutation(keys, Qt::AscendingOrder), QVector<int>({1, 3, 2, 0, 4}));
+    // 降序时键相同的行仍保持原有顺序
+    EXPECT_EQ(LogColumnSorter::sortPermutation(keys, Qt::DescendingOrder), QVector<int>({0, 4, 2, 1, 3}));
+
+    const QList<QString> rows {"c0", "a1", "b2", "a3", "c4"};
+    EXPECT_EQ(LogColumnSorter::permute(rows, LogColumnSorter::sortPermutation(keys, Qt::AscendingOrder)),
+              QList<QString>({"a1", "a3", "b2", "c0", "c4"}));
+}
+
+TEST(LogColumnSorter_sortPermutation_UT, LogColumnSorter_sortPermutation_UT_Parallel)
+{
+    const int count = 300001;
+    QVector<qint64> keys(count);
+    for (int i = 0; i < count; ++i)
+        keys[i] = (static_cast<qint64>(i) * 7919) % 1000;
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+    const QVector<int> parallel = LogColumnSorter::sortPermutation(keys, Qt::DescendingOrder, &pool);
+    EXPECT_EQ(parallel, LogColumnSorter::sortPermutation(keys, Qt::DescendingOrder));
+    ASSERT_EQ(parallel.size(), count);
+    for (int i = 1; i < count; ++i) {
+        ASSERT_GE(keys[parallel[i - 1]], keys[parallel[i]]);
+        if (keys[parallel[i - 1]] == keys[parallel[i]])
+            ASSERT_LT(parallel[i - 1], parallel[i]);
+    }
+}
+
+TEST(LogColumnSorter_isPermutation_UT, LogColumnSorter_isPermutation_UT_001)
+{
+    EXPECT_TRUE(LogColumnSorter::isPermutation({2, 0, 1}, 3));
+    EXPECT_TRUE(LogColumnSorter::isPermutation({}, 0));
+    // 长度不符、越界或重复的行号
+    EXPECT_FALSE(LogColumnSorter::isPermutation({0, 1}, 3));
+    EXPECT_FALSE(LogColumnSorter::isPermutation({0, 1, 3}, 3));
+    EXPECT_FALSE(LogColumnSorter::isPermutation({0, -1, 2}, 3));
+    EXPECT_FALSE(LogColumnSorter::isPermutation({0, 1, 1}, 3));
+}
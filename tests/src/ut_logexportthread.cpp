@@ -5,7 +5,7 @@
 #include "logexportthread.h"
 #include "structdef.h"
 #include "ut_stuballthread.h"
-#include "../../3rdparty/DocxFactory/include/DocxFactory/WordProcessingMerger/WordProcessingMerger.h"
+#include "unzip.h"
 #include <stub.h>
 #include "../../application/qtcompat.h"
 
@@ -16,29 +16,26 @@
 #include <QIcon>
 #include <QFile>
 #include <QStandardItemModel>
+#include <QTemporaryDir>
 
 #include <iostream>
 #include <gtest/gtest.h>
-void stub_load(const std::string &p_fileName)
+//读取导出的docx中的正文内容
+static QByteArray readDocxDocument(const QString &fileName)
 {
-    Q_UNUSED(p_fileName);
-}
-
-void stub_setClipboardValue(const std::string &p_itemName, const std::string &p_fieldName, const std::string &p_value)
-{
-    Q_UNUSED(p_itemName);
-    Q_UNUSED(p_fieldName);
-    Q_UNUSED(p_value);
-}
-
-void stub_paste(const std::string &p_itemName)
-{
-    Q_UNUSED(p_itemName);
-}
-
-void stub_save(const std::string &p_fileName)
-{
-    Q_UNUSED(p_fileName);
+    QByteArray data;
+    unzFile zip = unzOpen64(fileName.toUtf8().constData());
+    if (!zip)
+        return data;
+    if (unzLocateFile(zip, "word/document.xml", 0) == UNZ_OK && unzOpenCurrentFile(zip) == UNZ_OK) {
+        char buf[4096];
+        int len = 0;
+        while ((len = unzReadCurrentFile(zip, buf, sizeof(buf))) > 0)
+            data.append(buf, len);
+        unzCloseCurrentFile(zip);
+    }
+    unzClose(zip);
+    return data;
 }
 
 bool stub_dfwexists()
@@ -284,10 +281,6 @@ TEST_F(LogExportthread_UT, UT_ExportToXlsPublic_001){
 TEST_F(LogExportthread_UT, ExportToText_UT)
 {
     Stub stub;
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, load), stub_load);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, paste), stub_paste);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, save), stub_save);
-    stub.set((void (DocxFactory::WordProcessingMerger::*)(const std::string &, const std::string &, const std::string &))ADDR(DocxFactory::WordProcessingMerger, setClipboardValue), stub_setClipboardValue);
     stub.set(ADDR(QStandardItem, text), stub_text);
     QStandardItemModel model;
     QStandardItem item;
@@ -384,14 +377,8 @@ TEST_F(LogExportthread_UT, ExportToText_UT)
 
 TEST_F(LogExportthread_UT, ExportToDoc_UT)
 {
-    Stub stub;
-    typedef bool (QFile::*fptr)() const;
-    fptr A_foo = (fptr)(&QFile::exists); //获取虚函数地址
-    stub.set(A_foo, stub_dfwexists);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, load), stub_load);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, paste), stub_paste);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, save), stub_save);
-    stub.set((void (DocxFactory::WordProcessingMerger::*)(const std::string &, const std::string &, const std::string &))ADDR(DocxFactory::WordProcessingMerger, setClipboardValue), stub_setClipboardValue);
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
     QStandardItemModel m_model;
     m_model.appendRow(new QStandardItem());
     LOG_FLAG m_flag = LOG_FLAG::JOURNAL;
@@ -417,21 +404,37 @@ TEST_F(LogExportthread_UT, ExportToDoc_UT)
     QString test = "test";
     exportThread->m_canRunning = true;
 
-
-    exportThread->exportToDoc("test", m_journalList, QStringList() << "test", m_flag);
-    exportThread->exportToDoc("test", m_appList, QStringList() << "test", test);
-    exportThread->exportToDoc("test", m_dpkgList, QStringList() << "test");
-    exportThread->exportToDoc("test", m_bootList, QStringList() << "test");
-    exportThread->exportToDoc("test", m_xorgList, QStringList() << "test");
-    exportThread->exportToDoc("test", m_normalList, QStringList() << "test");
-    exportThread->exportToDoc("test", m_kwinList, QStringList() << "test");
-    exportThread->exportToDoc("test", m_dmesgList, QStringList() << "test");
-    exportThread->exportToDoc("test", m_dnfList, QStringList() << "test");
+    //每种日志导出到单独的文件，检查生成的docx中的表头和数据
+    const QStringList labels = QStringList() << "label";
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("journal.doc"), m_journalList, labels, m_flag));
+    QByteArray document = readDocxDocument(dir.filePath("journal.doc"));
+    EXPECT_TRUE(document.contains("label"));
+    EXPECT_TRUE(document.contains("20190503"));
+    EXPECT_TRUE(document.contains("uos"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("app.doc"), m_appList, labels, test));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("app.doc")).contains("20190503"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("dpkg.doc"), m_dpkgList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("dpkg.doc")).contains("20190503"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("boot.doc"), m_bootList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("boot.doc")).contains("20190503"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("xorg.doc"), m_xorgList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("xorg.doc")).contains("20190503"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("normal.doc"), m_normalList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("normal.doc")).contains("20190503"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("kwin.doc"), m_kwinList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("kwin.doc")).contains("test"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("dmesg.doc"), m_dmesgList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("dmesg.doc")).contains("test"));
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("dnf.doc"), m_dnfList, labels));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("dnf.doc")).contains("test"));
 
     m_flag = LOG_FLAG::KERN;
-    exportThread->exportToDoc("test", m_journalList, QStringList() << "test", m_flag);
+    EXPECT_TRUE(exportThread->exportToDoc(dir.filePath("kern.doc"), m_journalList, labels, m_flag));
+    EXPECT_TRUE(readDocxDocument(dir.filePath("kern.doc")).contains("20190503"));
+    //不支持的日志类型不生成文件
     m_flag =LOG_FLAG::BOOT;
-    exportThread->exportToDoc("test", m_journalList, QStringList() << "test", m_flag);
+    EXPECT_FALSE(exportThread->exportToDoc(dir.filePath("unsupported.doc"), m_journalList, labels, m_flag));
+    EXPECT_FALSE(QFile::exists(dir.filePath("unsupported.doc")));
 
     m_flag =LOG_FLAG::JOURNAL;
     exportThread->m_canRunning=false;
@@ -453,10 +456,6 @@ TEST_F(LogExportthread_UT, ExportToHtml_UT)
     typedef bool (QFile::*fptr)() const;
     fptr A_foo = (fptr)(&QFile::exists); //获取虚函数地址
     stub.set(A_foo, stub_dfwexists);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, load), stub_load);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, paste), stub_paste);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, save), stub_save);
-    stub.set((void (DocxFactory::WordProcessingMerger::*)(const std::string &, const std::string &, const std::string &))ADDR(DocxFactory::WordProcessingMerger, setClipboardValue), stub_setClipboardValue);
     stub.set(ADDR(QStandardItem, text), stub_text);
     QStandardItemModel model;
     model.appendRow(new QStandardItem());
@@ -551,10 +550,6 @@ TEST_F(LogExportthread_UT, ExportToXls_UT)
     typedef bool (QFile::*fptr)() const;
     fptr A_foo = (fptr)(&QFile::exists); //获取虚函数地址
     stub.set(A_foo, stub_dfwexists);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, load), stub_load);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, paste), stub_paste);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, save), stub_save);
-    stub.set((void (DocxFactory::WordProcessingMerger::*)(const std::string &, const std::string &, const std::string &))ADDR(DocxFactory::WordProcessingMerger, setClipboardValue), stub_setClipboardValue);
     QStandardItemModel m_model;
     m_model.appendRow(new QStandardItem());
     LOG_FLAG m_flag = LOG_FLAG::JOURNAL;
@@ -611,10 +606,6 @@ TEST_F(LogExportthread_UT, ExportRun_UT)
     typedef bool (QFile::*fptr)() const;
     fptr A_foo = (fptr)(&QFile::exists); //获取虚函数地址
     stub.set(A_foo, stub_dfwexists);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, load), stub_load);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, paste), stub_paste);
-    stub.set(ADDR(DocxFactory::WordProcessingMerger, save), stub_save);
-    stub.set((void (DocxFactory::WordProcessingMerger::*)(const std::string &, const std::string &, const std::string &))ADDR(DocxFactory::WordProcessingMerger, setClipboardValue), stub_setClipboardValue);
     QStandardItemModel m_model;
     m_model.appendRow(new QStandardItem());
     LOG_FLAG m_flag = LOG_FLAG::JOURNAL;
@@ -109,6 +109,21 @@ TEST(LogFileParser_stopAllLoad_UT, LogFileParser_stopAllLoad_UT)
     p->deleteLater();
 }
 
+TEST(LogFileParser_prefetch_UT, LogFileParser_prefetch_UT)
+{
+    Stub stub;
+    stub.set((void (QThreadPool::*)(QRunnable *, int))ADDR(QThreadPool, start), stub_start001);
+    LogFileParser *p = new LogFileParser(nullptr);
+    LOG_FILTER_BASE filter;
+    filter.type = DPKG;
+    filter.segementIndex = 1;
+    // 只有分段加载的日志支持预取
+    EXPECT_EQ(p->prefetch(filter), -1);
+    filter.type = KERN;
+    EXPECT_GT(p->prefetch(filter), 0);
+    p->deleteLater();
+}
+
 TEST(LogFileParser_quitLogAuththread_UT, LogFileParser_quitLogAuththread_UT_001)
 {
     Stub stub;
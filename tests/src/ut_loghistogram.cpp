@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "loghistogram.h"
+
+#include <QDateTime>
+
+#include <gtest/gtest.h>
+
+TEST(LogHistogram_parse_UT, LogHistogram_parse_UT_Span)
+{
+    EXPECT_EQ(LogHistogram::parseSpan("30s"), 30000);
+    EXPECT_EQ(LogHistogram::parseSpan("15m"), 15 * 60000);
+    EXPECT_EQ(LogHistogram::parseSpan("1h"), 3600000);
+    EXPECT_EQ(LogHistogram::parseSpan("1d"), 86400000);
+    EXPECT_EQ(LogHistogram::parseSpan("0h"), -1);
+    EXPECT_EQ(LogHistogram::parseSpan("1w"), -1);
+    EXPECT_EQ(LogHistogram::parseSpan(""), -1);
+}
+
+TEST(LogHistogram_parse_UT, LogHistogram_parse_UT_GroupBy)
+{
+    LogHistogram::GroupBy group = LogHistogram::GroupLevel;
+    EXPECT_TRUE(LogHistogram::parseGroupBy("category", group));
+    EXPECT_EQ(group, LogHistogram::GroupCategory);
+    EXPECT_TRUE(LogHistogram::parseGroupBy("process", group));
+    EXPECT_EQ(group, LogHistogram::GroupProcess);
+    EXPECT_FALSE(LogHistogram::parseGroupBy("daemon", group));
+    EXPECT_EQ(group, LogHistogram::GroupProcess);
+}
+
+TEST(LogHistogram_bucket_UT, LogHistogram_bucket_UT_Rebucket)
+{
+    const qint64 hour = 3600 * 1000;
+    const qint64 day = QDateTime(QDate(2024, 3, 5), QTime(0, 0)).toMSecsSinceEpoch();
+    EXPECT_EQ(LogHistogram::alignTime(day + 90 * 60000, hour), day + hour);
+    EXPECT_EQ(LogHistogram::alignTime(day + 23 * hour, 24 * hour), day);
+
+    LogHistogram::Buckets buckets;
+    buckets[day]["info"] = 2;
+    buckets[day + hour]["info"] = 3;
+    buckets[day + hour]["error"] = 1;
+    buckets[day + 2 * hour]["error"] = 4;
+    const LogHistogram::Buckets merged = LogHistogram::rebucket(buckets, 2 * hour);
+    ASSERT_EQ(merged.size(), 2);
+    EXPECT_EQ(merged.value(day).value("info"), 5);
+    EXPECT_EQ(merged.value(day).value("error"), 1);
+    EXPECT_EQ(merged.value(day + 2 * hour).value("error"), 4);
+
+    const QList<QPair<QString, qint64>> totals = LogHistogram::keyTotals(buckets);
+    ASSERT_EQ(totals.size(), 2);
+    EXPECT_EQ(totals.at(0).first, "info");
+    EXPECT_EQ(totals.at(1).second, 5);
+}
+
+TEST(LogHistogram_addRecords_UT, LogHistogram_addRecords_UT)
+{
+    QList<LOG_MSG_AUDIT> list;
+    for (int i = 0; i < 10; ++i) {
+        LOG_MSG_AUDIT msg;
+        msg.dateTime = QString("2024-03-05 %1:10:00").arg(8 + i % 2, 2, 10, QChar('0'));
+        msg.auditType = i < 7 ? "IdentAuth" : "DAC";
+        msg.processName = "sshd";
+        list.append(msg);
+    }
+    LOG_MSG_AUDIT untimed;
+    untimed.auditType = "DAC";
+    list.append(untimed);
+
+    LogHistogram histogram;
+    histogram.addRecords(list);
+    histogram.waitForDone();
+    EXPECT_EQ(histogram.total(), 11);
+    EXPECT_EQ(histogram.untimedCount(), 1);
+
+    const qint64 eight = QDateTime(QDate(2024, 3, 5), QTime(8, 0)).toMSecsSinceEpoch();
+    const LogHistogram::Buckets buckets = histogram.buckets(LogHistogram::GroupCategory);
+    ASSERT_EQ(buckets.size(), 2);
+    EXPECT_EQ(buckets.firstKey(), eight);
+    EXPECT_EQ(buckets.value(eight).value("IdentAuth"), 4);
+    EXPECT_EQ(buckets.value(eight).value("DAC"), 1);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.total(), 0);
+    EXPECT_TRUE(histogram.buckets(LogHistogram::GroupLevel).isEmpty());
+}
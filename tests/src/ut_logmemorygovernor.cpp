@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logmemorygovernor.h"
+
+#include <gtest/gtest.h>
+
+static QList<QString> makeSegement(const QString &prefix, int count)
+{
+    QList<QString> data;
+    for (int i = 0; i < count; ++i)
+        data.append(QString("%1 line %2").arg(prefix).arg(i));
+    return data;
+}
+
+TEST(LogMemoryGovernor_insert_UT, LogMemoryGovernor_insert_UT_Unlimited)
+{
+    LogMemoryGovernor governor;
+    const QList<QString> kern = makeSegement("kern", 100);
+    governor.insert("kern|0", kern);
+    governor.insert("kwin|0", makeSegement("kwin", 100));
+    EXPECT_TRUE(governor.contains("kern|0"));
+    EXPECT_FALSE(governor.isSpilled("kern|0"));
+    EXPECT_EQ(governor.memoryBytes(), LogMemoryGovernor::estimateBytes(kern) * 2);
+    EXPECT_EQ(governor.diskBytes(), 0);
+
+    QList<QString> data;
+    EXPECT_FALSE(governor.take("none", data));
+    governor.clear();
+    EXPECT_FALSE(governor.contains("kern|0"));
+    EXPECT_EQ(governor.memoryBytes(), 0);
+}
+
+TEST(LogMemoryGovernor_trim_UT, LogMemoryGovernor_trim_UT_SpillAndRehydrate)
+{
+    const QList<QString> kern = makeSegement("kern", 1000);
+    const QList<QString> kwin = makeSegement("kwin", 1000);
+    const qint64 segementBytes = LogMemoryGovernor::estimateBytes(kern);
+
+    // 预算只够缓存一段
+    LogMemoryGovernor governor(segementBytes + segementBytes / 2);
+    governor.insert("kern|0", kern);
+    governor.insert("kwin|0", kwin);
+    EXPECT_TRUE(governor.isSpilled("kern|0"));
+    EXPECT_FALSE(governor.isSpilled("kwin|0"));
+    EXPECT_GT(governor.diskBytes(), 0);
+    EXPECT_LE(governor.memoryBytes(), governor.budget());
+
+    // 回到最久未使用的数据时从磁盘恢复，取出后不再计入缓存
+    QList<QString> data;
+    ASSERT_TRUE(governor.take("kern|0", data));
+    EXPECT_EQ(data, kern);
+    EXPECT_FALSE(governor.contains("kern|0"));
+    EXPECT_EQ(governor.memoryBytes(), segementBytes);
+    EXPECT_EQ(governor.diskBytes(), 0);
+
+    // 取出的数据作为当前展示的数据计入预算，另一段被写入磁盘
+    governor.addResidentBytes(segementBytes);
+    EXPECT_TRUE(governor.isSpilled("kwin|0"));
+    EXPECT_EQ(governor.memoryBytes(), 0);
+
+    governor.setResidentBytes(0);
+    ASSERT_TRUE(governor.take("kwin|0", data));
+    EXPECT_EQ(data, kwin);
+
+    governor.clear();
+    EXPECT_EQ(governor.memoryBytes(), 0);
+    EXPECT_EQ(governor.diskBytes(), 0);
+}
+
+TEST(LogMemoryGovernor_trim_UT, LogMemoryGovernor_trim_UT_Resident)
+{
+    const QList<QString> kern = makeSegement("kern", 1000);
+    const qint64 segementBytes = LogMemoryGovernor::estimateBytes(kern);
+
+    LogMemoryGovernor governor(segementBytes * 2);
+    governor.insert("kern|0", kern);
+    EXPECT_FALSE(governor.isSpilled("kern|0"));
+
+    // 当前展示的数据挤占缓存的预算
+    governor.addResidentBytes(segementBytes + 1);
+    EXPECT_TRUE(governor.isSpilled("kern|0"));
+    EXPECT_EQ(governor.memoryBytes(), 0);
+
+    governor.setResidentBytes(0);
+    QList<QString> data;
+    ASSERT_TRUE(governor.take("kern|0", data));
+    EXPECT_EQ(data.size(), kern.size());
+    EXPECT_FALSE(governor.contains("kern|0"));
+    EXPECT_EQ(governor.memoryBytes(), 0);
+}
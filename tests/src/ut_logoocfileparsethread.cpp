@@ -23,6 +23,11 @@ QStringList stub_getOtherFileInfo(const QString &flag)
     return QStringList() << "test";
 }
 
+bool stub_oocEnsureSession()
+{
+    return false;
+}
+
 class LogOOCFileParseThread_UT : public testing::Test
 {
 public:
@@ -99,5 +104,8 @@ TEST_F(LogOOCFileParseThread_UT, UT_GetIndex_001){
 }
 
 TEST_F(LogOOCFileParseThread_UT, UT_checkAuthentication_001){
-    m_logThread->checkAuthentication("test");
+    Stub stub;
+    stub.set(ADDR(DLDBusHandler, ensureSession), stub_oocEnsureSession);
+    // 无读权限且鉴权未通过
+    EXPECT_FALSE(m_logThread->checkAuthentication("test"));
 }
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logparsecache.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+
+class LogParseCache_UT : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_TRUE(m_dir.isValid());
+        m_oldDir = LogParseCache::instance()->cacheDir();
+        LogParseCache::instance()->setCacheDir(m_dir.path());
+
+        m_identity.device = 1;
+        m_identity.inode = 100;
+        m_identity.mtime = 1000;
+        m_identity.size = 4096;
+
+        // 第一列重复值多，使用字典编码；第二列各不相同，使用拼接编码
+        m_table.reset(2);
+        for (int i = 0; i < 100; ++i) {
+            m_table.times.append(i % 10 == 0 ? -1 : 1000LL * i);
+            m_table.columns[0].append(i % 2 ? "OK" : QString::fromUtf8("失败"));
+            m_table.columns[1].append(QString("line %1").arg(i));
+        }
+        m_table.offset = 4000;
+    }
+    void TearDown() override
+    {
+        LogParseCache::instance()->setCacheDir(m_oldDir);
+    }
+
+    QTemporaryDir m_dir;
+    QString m_oldDir;
+    LogFileIdentity m_identity;
+    LogCacheTable m_table;
+};
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Hit)
+{
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table));
+
+    LogCacheTable table;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", m_identity, 2, table), LogParseCache::Hit);
+    EXPECT_EQ(table.offset, m_table.offset);
+    EXPECT_EQ(table.times, m_table.times);
+    EXPECT_EQ(table.columns[0], m_table.columns[0]);
+    EXPECT_EQ(table.columns[1], m_table.columns[1]);
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Grown)
+{
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table));
+
+    LogFileIdentity grown = m_identity;
+    grown.size += 100;
+    grown.mtime += 10;
+    LogCacheTable table;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", grown, 2, table), LogParseCache::Grown);
+    EXPECT_EQ(table.rowCount(), m_table.rowCount());
+    EXPECT_EQ(table.offset, m_table.offset);
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Miss)
+{
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table));
+
+    LogCacheTable table;
+    // 轮转后的新文件
+    LogFileIdentity rotated = m_identity;
+    rotated.inode = 101;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", rotated, 2, table), LogParseCache::Miss);
+    EXPECT_EQ(table.rowCount(), 0);
+    EXPECT_EQ(table.columns.size(), 2);
+
+    // 原地改写，大小不增长
+    LogFileIdentity rewritten = m_identity;
+    rewritten.mtime += 10;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", rewritten, 2, table), LogParseCache::Miss);
+
+    // 解析器版本变化
+    EXPECT_EQ(LogParseCache::instance()->load("test", 2, "/var/log/test.log", m_identity, 2, table), LogParseCache::Miss);
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/other.log", m_identity, 2, table), LogParseCache::Miss);
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Truncated)
+{
+    m_identity.head = "head-1";
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table));
+
+    // copytruncate后重新写入并超过原大小，inode不变但开头内容不同
+    LogFileIdentity regrown = m_identity;
+    regrown.size += 100;
+    regrown.mtime += 10;
+    regrown.head = "head-2";
+    LogCacheTable table;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", regrown, 2, table), LogParseCache::Miss);
+    EXPECT_EQ(table.rowCount(), 0);
+
+    regrown.head = m_identity.head;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", regrown, 2, table), LogParseCache::Grown);
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Memory)
+{
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table, LogParseCache::MemoryStorage));
+    // 内存缓存不写入缓存目录
+    EXPECT_TRUE(QDir(m_dir.path()).entryList(QDir::Files | QDir::NoDotAndDotDot).isEmpty());
+
+    LogCacheTable table;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", m_identity, 2, table, LogParseCache::MemoryStorage),
+              LogParseCache::Hit);
+    EXPECT_EQ(table.offset, m_table.offset);
+    EXPECT_EQ(table.columns[1], m_table.columns[1]);
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", m_identity, 2, table), LogParseCache::Miss);
+
+    LogFileIdentity rotated = m_identity;
+    rotated.inode = 101;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", rotated, 2, table, LogParseCache::MemoryStorage),
+              LogParseCache::Miss);
+
+    LogParseCache::instance()->remove("test", "/var/log/test.log");
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", m_identity, 2, table, LogParseCache::MemoryStorage),
+              LogParseCache::Miss);
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Permissions)
+{
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table));
+
+    const QFileInfoList files = QDir(m_dir.path()).entryInfoList(QStringList() << "*.cache", QDir::Files);
+    ASSERT_EQ(files.size(), 1);
+    const QFileDevice::Permissions others = QFileDevice::ReadGroup | QFileDevice::WriteGroup | QFileDevice::ReadOther | QFileDevice::WriteOther;
+    EXPECT_FALSE(files.first().permissions() & others);
+    EXPECT_FALSE(QFileInfo(m_dir.path()).permissions() & (others | QFileDevice::ExeGroup | QFileDevice::ExeOther));
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Corrupted)
+{
+    ASSERT_TRUE(LogParseCache::instance()->save("test", 1, "/var/log/test.log", m_identity, m_table));
+
+    const QStringList files = QDir(m_dir.path()).entryList(QStringList() << "*.cache", QDir::Files);
+    ASSERT_EQ(files.size(), 1);
+    QFile file(m_dir.path() + "/" + files.first());
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    file.resize(file.size() / 2);
+    file.close();
+
+    LogCacheTable table;
+    EXPECT_EQ(LogParseCache::instance()->load("test", 1, "/var/log/test.log", m_identity, 2, table), LogParseCache::Miss);
+    EXPECT_EQ(table.rowCount(), 0);
+}
+
+TEST(LogFileIdentity_UT, LogFileIdentity_UT_FromList)
+{
+    LogFileIdentity identity = LogFileIdentity::fromList(QStringList() << "2049" << "123" << "1700000000000" << "42");
+    EXPECT_TRUE(identity.isValid());
+    EXPECT_EQ(identity.inode, 123u);
+    EXPECT_EQ(identity.size, 42);
+    EXPECT_TRUE(identity.head.isEmpty());
+    EXPECT_EQ(LogFileIdentity::fromList(QStringList() << "2049" << "123" << "1700000000000" << "42" << "abc").head, QString("abc"));
+    EXPECT_FALSE(LogFileIdentity::fromList(QStringList()).isValid());
+    EXPECT_FALSE(LogFileIdentity::fromList(QStringList() << "a" << "1" << "2" << "3").isValid());
+}
+
+TEST_F(LogParseCache_UT, LogParseCache_UT_Update)
+{
+    // 本人可读的文件写入磁盘缓存，文件增长时只读取新增部分
+    QFile file(m_dir.filePath("test.log"));
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write("a\nb\n");
+    file.close();
+    EXPECT_EQ(LogParseCache::storageFor(file.fileName()), LogParseCache::DiskStorage);
+    EXPECT_EQ(LogParseCache::storageFor("/nonexistent/test.log"), LogParseCache::MemoryStorage);
+
+    QByteArray content = "a\nb\n";
+    QList<qint64> offsets;
+    auto read = [&content, &offsets](qint64 offset, qint64 maxBytes) {
+        offsets.append(offset);
+        return content.mid(static_cast<int>(offset), static_cast<int>(maxBytes));
+    };
+    auto parse = [](const QStringList &lines, LogCacheTable &table) {
+        for (const QString &line : lines) {
+            table.times.append(-1);
+            table.columns[0].append(line);
+        }
+    };
+    const std::atomic<bool> canRun {true};
+
+    LogFileIdentity identity = m_identity;
+    identity.size = content.size();
+    LogCacheTable table;
+    ASSERT_TRUE(LogParseCache::instance()->update("test", 1, file.fileName(), identity, 1, table, read, parse, canRun));
+    EXPECT_EQ(table.columns[0], QStringList() << "a" << "b");
+    EXPECT_EQ(offsets, QList<qint64>() << 0);
+    EXPECT_EQ(QDir(m_dir.path()).entryList(QStringList() << "*.cache", QDir::Files).size(), 1);
+
+    content.append("c\n");
+    identity.size = content.size();
+    identity.mtime += 1;
+    offsets.clear();
+    ASSERT_TRUE(LogParseCache::instance()->update("test", 1, file.fileName(), identity, 1, table, read, parse, canRun));
+    EXPECT_EQ(table.columns[0], QStringList() << "a" << "b" << "c");
+    EXPECT_EQ(offsets, QList<qint64>() << 4);
+
+    // 没有缓存且无法按偏移读取时由调用方完整读取
+    auto unreadable = [](qint64, qint64) { return QByteArray(); };
+    EXPECT_FALSE(LogParseCache::instance()->update("test", 1, "/var/log/other.log", identity, 1, table, unreadable, parse, canRun));
+}
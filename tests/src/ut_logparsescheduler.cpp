@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logparsescheduler.h"
+
+#include <QRunnable>
+#include <QSemaphore>
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+class SchedulerTestJob : public QRunnable
+{
+public:
+    SchedulerTestJob(std::atomic_int &counter, QSemaphore *gate = nullptr)
+        : m_counter(counter)
+        , m_gate(gate)
+    {
+        setAutoDelete(true);
+    }
+
+    void run() override
+    {
+        if (m_gate)
+            m_gate->acquire();
+        ++m_counter;
+    }
+
+private:
+    std::atomic_int &m_counter;
+    QSemaphore *m_gate;
+};
+
+TEST(LogParseScheduler_start_UT, LogParseScheduler_start_UT_Lanes)
+{
+    LogParseScheduler *scheduler = LogParseScheduler::instance();
+    EXPECT_NE(scheduler->pool(LogParseScheduler::IoLane), scheduler->pool(LogParseScheduler::CpuLane));
+
+    std::atomic_int counter {0};
+    scheduler->start(new SchedulerTestJob(counter));
+    scheduler->start(new SchedulerTestJob(counter), LogParseScheduler::CpuLane, LogParseScheduler::Background);
+    scheduler->start(nullptr);
+    EXPECT_TRUE(scheduler->waitForDone(5000));
+    EXPECT_EQ(counter.load(), 2);
+}
+
+TEST(LogParseScheduler_cancel_UT, LogParseScheduler_cancel_UT_Pending)
+{
+    LogParseScheduler *scheduler = LogParseScheduler::instance();
+    QThreadPool *ioPool = scheduler->pool(LogParseScheduler::IoLane);
+
+    // 占满读取线程，之后提交的任务在队列中等待
+    QSemaphore gate;
+    std::atomic_int running {0};
+    const int threads = ioPool->maxThreadCount();
+    for (int i = 0; i < threads; ++i)
+        scheduler->start(new SchedulerTestJob(running, &gate));
+
+    std::atomic_int cancelled {0};
+    scheduler->start(new SchedulerTestJob(cancelled));
+    scheduler->cancelPending();
+
+    gate.release(threads);
+    EXPECT_TRUE(scheduler->waitForDone(5000));
+    EXPECT_EQ(running.load(), threads);
+    EXPECT_EQ(cancelled.load(), 0);
+}
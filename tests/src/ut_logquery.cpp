@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logquery.h"
+#include "qtcompat.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <gtest/gtest.h>
+
+TEST(LogQuery_parseTime_UT, LogQuery_parseTime_UT_Relative)
+{
+    QDateTime now = QDateTime::fromSecsSinceEpoch(1704067200);
+    EXPECT_EQ(LogQuery::parseTime("30s", now), (1704067200 - 30) * 1000LL);
+    EXPECT_EQ(LogQuery::parseTime("12h", now), (1704067200 - 12 * 3600) * 1000LL);
+    EXPECT_EQ(LogQuery::parseTime("3d", now), (1704067200 - 3 * 86400) * 1000LL);
+    EXPECT_EQ(LogQuery::parseTime("1w", now), (1704067200 - 7 * 86400) * 1000LL);
+}
+
+TEST(LogQuery_parseTime_UT, LogQuery_parseTime_UT_Absolute)
+{
+    EXPECT_EQ(LogQuery::parseTime("1704067200"), 1704067200000LL);
+    QDateTime dt(QDate(2024, 1, 2), QTime(8, 30, 15));
+    EXPECT_EQ(LogQuery::parseTime("2024-01-02 08:30:15"), dt.toMSecsSinceEpoch());
+    EXPECT_EQ(LogQuery::parseTime("2024-01-02"), QDateTime(QDate(2024, 1, 2), QTime(0, 0)).toMSecsSinceEpoch());
+    EXPECT_EQ(LogQuery::parseTime("2024-01-02T08:30:15"), dt.toMSecsSinceEpoch());
+}
+
+TEST(LogQuery_parseTime_UT, LogQuery_parseTime_UT_Invalid)
+{
+    EXPECT_EQ(LogQuery::parseTime(""), -1);
+    EXPECT_EQ(LogQuery::parseTime("yesterday"), -1);
+    EXPECT_EQ(LogQuery::parseTime("3y"), -1);
+}
+
+TEST(LogQuery_formatRecord_UT, LogQuery_formatRecord_UT_Tsv)
+{
+    LOG_MSG_DPKG msg;
+    msg.dateTime = "2024-01-01 00:00:00";
+    msg.action = "install";
+    msg.msg = "a\tb\\c\nd";
+    QByteArray line = LogQuery::formatRecord(LogQuery::Tsv, LogQuery::fieldNames(DPKG), LogQuery::recordFields(msg));
+    EXPECT_EQ(line, QByteArray("2024-01-01 00:00:00\tinstall\ta\\tb\\\\c\\nd\n"));
+}
+
+TEST(LogQuery_formatRecord_UT, LogQuery_formatRecord_UT_JsonLines)
+{
+    LOG_MSG_AUTH msg;
+    msg.dateTime = "2024-01-01 00:00:00";
+    msg.hostName = "host";
+    msg.processName = "sshd";
+    msg.msg = "line\nbreak";
+    QByteArray line = LogQuery::formatRecord(LogQuery::JsonLines, LogQuery::fieldNames(Auth), LogQuery::recordFields(msg));
+    ASSERT_TRUE(line.endsWith('\n'));
+    EXPECT_EQ(line.count('\n'), 1);
+
+    QJsonObject obj = QJsonDocument::fromJson(line).object();
+    EXPECT_EQ(obj.value("processName").toString(), QString("sshd"));
+    EXPECT_EQ(obj.value("msg").toString(), QString("line\nbreak"));
+}
+
+TEST(LogQuery_fieldNames_UT, LogQuery_fieldNames_UT)
+{
+    EXPECT_EQ(LogQuery::fieldNames(JOURNAL).size(), LogQuery::recordFields(LOG_MSG_JOURNAL()).size());
+    EXPECT_EQ(LogQuery::fieldNames(Audit).size(), LogQuery::recordFields(LOG_MSG_AUDIT()).size());
+    EXPECT_EQ(LogQuery::fieldNames(COREDUMP).size(), LogQuery::recordFields(LOG_MSG_COREDUMP()).size());
+    EXPECT_TRUE(LogQuery::fieldNames(OtherLog).isEmpty());
+}
+
+static QList<LOG_MSG_DPKG> makeDpkgList(int begin, int count)
+{
+    QList<LOG_MSG_DPKG> list;
+    for (int i = begin; i < begin + count; ++i) {
+        LOG_MSG_DPKG msg;
+        msg.dateTime = "2024-01-01 00:00:00";
+        msg.action = "install";
+        msg.msg = QString("pkg%1").arg(i);
+        list.append(msg);
+    }
+    return list;
+}
+
+TEST(LogQuery_writeRecords_UT, LogQuery_writeRecords_UT_Limit)
+{
+    LogQuery query;
+    query.setFormat(LogQuery::Tsv);
+    query.setLimit(3);
+    query.m_fieldNames = LogQuery::fieldNames(DPKG);
+
+    testing::internal::CaptureStdout();
+    query.writeRecords(makeDpkgList(0, 2));
+    EXPECT_FALSE(query.m_stopped);
+    // 达到上限后本批余下的记录不再写出，之后的批次直接丢弃
+    query.writeRecords(makeDpkgList(2, 2));
+    EXPECT_TRUE(query.m_stopped);
+    query.writeRecords(makeDpkgList(4, 2));
+    const QString output = QString::fromStdString(testing::internal::GetCapturedStdout());
+
+    EXPECT_EQ(query.recordCount(), 3);
+    const QStringList lines = output.split('\n', SKIP_EMPTY_PARTS);
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_TRUE(lines.last().endsWith("pkg2"));
+}
+
+TEST(LogQuery_writeRecords_UT, LogQuery_writeRecords_UT_Incremental)
+{
+    LogQuery query;
+    query.setFormat(LogQuery::JsonLines);
+    query.m_fieldNames = LogQuery::fieldNames(DPKG);
+
+    // 每批记录在解析线程内立即写出，不等后续批次或解析结束
+    testing::internal::CaptureStdout();
+    query.writeRecords(makeDpkgList(0, 2));
+    const QString first = QString::fromStdString(testing::internal::GetCapturedStdout());
+    EXPECT_EQ(first.count('\n'), 2);
+    EXPECT_TRUE(first.contains("pkg1"));
+
+    testing::internal::CaptureStdout();
+    query.writeRecords(makeDpkgList(2, 1));
+    const QString second = QString::fromStdString(testing::internal::GetCapturedStdout());
+    EXPECT_EQ(second.count('\n'), 1);
+    EXPECT_TRUE(second.contains("pkg2"));
+    EXPECT_FALSE(query.m_stopped);
+    EXPECT_EQ(query.recordCount(), 3);
+}
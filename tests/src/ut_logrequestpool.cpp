@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logrequestpool.h"
+
+#include <stub.h>
+
+#include <QLoggingCategory>
+#include <QSemaphore>
+#include <QStringList>
+#include <QThread>
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+// 服务端源码使用的日志分类，服务的main不参与单元测试编译
+Q_LOGGING_CATEGORY(logService, "org.deepin.log.viewer.service", QtWarningMsg)
+
+static QMutex s_sentMutex;
+static QList<QDBusMessage> s_sentMessages;
+
+// 代替总线发送，记录工作线程发出的应答
+static bool stub_send(void *, const QDBusMessage &message)
+{
+    QMutexLocker locker(&s_sentMutex);
+    s_sentMessages.append(message);
+    return true;
+}
+
+TEST(LogRequestPool_UT, LogRequestPool_UT_ClientFairness)
+{
+    LogRequestPool pool(2, 1);
+    QSemaphore releaseA;
+    QSemaphore doneB;
+    QMutex orderMutex;
+    QStringList order;
+
+    // 调用方A的请求阻塞时，其后续请求排队，不占用调用方B可用的线程
+    for (int i = 0; i < 3; ++i) {
+        pool.submit("A", [&, i]() {
+            releaseA.acquire();
+            QMutexLocker locker(&orderMutex);
+            order << QString("A%1").arg(i);
+        });
+    }
+    pool.submit("B", [&]() {
+        {
+            QMutexLocker locker(&orderMutex);
+            order << "B0";
+        }
+        doneB.release();
+    });
+
+    EXPECT_TRUE(doneB.tryAcquire(1, 5000));
+    releaseA.release(3);
+    pool.waitForDone();
+
+    // 同一调用方排队的请求按到达顺序执行
+    EXPECT_EQ(order, QStringList({"B0", "A0", "A1", "A2"}));
+    EXPECT_TRUE(pool.m_running.isEmpty());
+    EXPECT_TRUE(pool.m_pending.isEmpty());
+}
+
+TEST(LogRequestPool_UT, LogRequestPool_UT_PerClientLimit)
+{
+    LogRequestPool pool(4, 2);
+    std::atomic<int> running {0};
+    std::atomic<int> maxRunning {0};
+    QMutex clientMutex;
+    QStringList clients;
+
+    for (int i = 0; i < 8; ++i) {
+        pool.submit("A", [&]() {
+            const int now = ++running;
+            int expected = maxRunning;
+            while (now > expected && !maxRunning.compare_exchange_weak(expected, now)) {
+            }
+            {
+                QMutexLocker locker(&clientMutex);
+                clients << LogRequestPool::currentClient();
+            }
+            QThread::msleep(20);
+            --running;
+        });
+    }
+    pool.waitForDone();
+
+    EXPECT_LE(maxRunning.load(), 2);
+    EXPECT_EQ(clients.size(), 8);
+    EXPECT_EQ(clients.count("A"), 8);
+    EXPECT_TRUE(LogRequestPool::currentClient().isEmpty());
+}
+
+TEST(LogRequestPool_UT, LogRequestPool_UT_DelayedReply)
+{
+    Stub stub;
+    stub.set(ADDR(QDBusConnection, send), stub_send);
+    s_sentMessages.clear();
+
+    LogRequestPool pool(2, 1);
+    QSemaphore releaseWork;
+    QDBusMessage call = QDBusMessage::createMethodCall("com.deepin.logviewer", "/com/deepin/logviewer",
+                                                       "com.deepin.logviewer", "readLogLinesInRange");
+    QDBusConnection conn("ut-logrequestpool");
+    pool.submitReply(call, conn, [&releaseWork]() {
+        releaseWork.acquire();
+        return QVariant::fromValue(QStringList({"line1", "line2"}));
+    });
+
+    // 工作完成前不发出应答
+    QThread::msleep(20);
+    {
+        QMutexLocker locker(&s_sentMutex);
+        EXPECT_TRUE(s_sentMessages.isEmpty());
+    }
+
+    releaseWork.release();
+    pool.waitForDone();
+
+    QMutexLocker locker(&s_sentMutex);
+    ASSERT_EQ(s_sentMessages.size(), 1);
+    const QDBusMessage &reply = s_sentMessages.first();
+    EXPECT_EQ(reply.type(), QDBusMessage::ReplyMessage);
+    ASSERT_EQ(reply.arguments().size(), 1);
+    EXPECT_EQ(reply.arguments().first().toStringList(), QStringList({"line1", "line2"}));
+}
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logsegementexportthread.h"
+#include "../../application/qtcompat.h"
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+
+TEST(LogSegementExportThread_queue_UT, LogSegementExportThread_queue_UT_Drain)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString fileName = dir.filePath("kwin.txt");
+
+    LogSegementExportThread thread;
+    thread.enableAppendWrite();
+    thread.setTotalProcess(2);
+
+    LOG_MSG_BASE first;
+    first.msg = "first";
+    QList<QString> jsonList;
+    jsonList.append(QJsonDocument(first.toJson()).toJson(QJsonDocument::Compact));
+    thread.setParameter(fileName, jsonList, QStringList() << "Info", Kwin);
+    EXPECT_FALSE(thread.isQueueFull());
+
+    QList<LOG_MSG_BASE> records;
+    for (const QString &text : QStringList {"second", "third"}) {
+        LOG_MSG_BASE msg;
+        msg.msg = text;
+        records.append(msg);
+    }
+    thread.setParameter(fileName, records, QStringList() << "Info", Kwin);
+    EXPECT_TRUE(thread.isQueueFull());
+
+    // 正常停止时先写完队列中的数据
+    thread.stop();
+    thread.run();
+    EXPECT_FALSE(thread.isQueueFull());
+
+    QFile file(fileName);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    const QStringList lines = QString::fromUtf8(file.readAll()).split('\n', SKIP_EMPTY_PARTS);
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_TRUE(lines.at(0).contains("first"));
+    EXPECT_TRUE(lines.at(2).contains("third"));
+}
+
+TEST(LogSegementExportThread_queue_UT, LogSegementExportThread_queue_UT_ForceStop)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    LogSegementExportThread thread;
+    LOG_MSG_BASE msg;
+    msg.msg = "dropped";
+    thread.setParameter(dir.filePath("kwin.txt"), QList<LOG_MSG_BASE>() << msg, QStringList() << "Info", Kwin);
+    thread.stopImmediately();
+    EXPECT_FALSE(thread.isQueueFull());
+    EXPECT_FALSE(thread.isProcessing());
+    // 强制停止后不再接收数据
+    thread.setParameter(dir.filePath("kwin.txt"), QList<LOG_MSG_BASE>() << msg, QStringList() << "Info", Kwin);
+    EXPECT_FALSE(QFile::exists(dir.filePath("kwin.txt")));
+}
+
+TEST(LogSegementExportThread_queue_UT, LogSegementExportThread_queue_UT_ExportInfoOnce)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    LogSegementExportThread thread;
+    thread.enableAppendWrite();
+    LOG_MSG_BASE msg;
+    msg.msg = "kept";
+    thread.setParameter(dir.filePath("kwin.txt"), QList<LOG_MSG_BASE>() << msg, QStringList() << "Info", Kwin);
+    // 导出信息以首段为准，后续段传入的文件不生效
+    thread.setParameter(dir.filePath("other.txt"), QList<LOG_MSG_BASE>() << msg, QStringList() << "Other", KERN);
+    thread.stop();
+    thread.run();
+
+    EXPECT_FALSE(QFile::exists(dir.filePath("other.txt")));
+    QFile file(dir.filePath("kwin.txt"));
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    const QStringList lines = QString::fromUtf8(file.readAll()).split('\n', SKIP_EMPTY_PARTS);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_TRUE(lines.at(1).startsWith("Info:"));
+}
+
+TEST(LogSegementExportThread_queue_UT, LogSegementExportThread_queue_UT_StopOnFailure)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    // 目录不存在，打开文件失败
+    const QString fileName = dir.filePath("missing/kwin.txt");
+
+    LogSegementExportThread thread;
+    QList<bool> results;
+    int errorCount = 0;
+    int doneCount = 0;
+    QObject::connect(&thread, &LogSegementExportThread::sigResult, [&results](bool isSuccess) { results.append(isSuccess); });
+    QObject::connect(&thread, &LogSegementExportThread::sigError, [&errorCount](const QString &) { ++errorCount; });
+    QObject::connect(&thread, &LogSegementExportThread::sigSegementDone, [&doneCount]() { ++doneCount; });
+
+    LOG_MSG_BASE msg;
+    msg.msg = "lost";
+    thread.setParameter(fileName, QList<LOG_MSG_BASE>() << msg, QStringList() << "Info", Kwin);
+    thread.setParameter(fileName, QList<LOG_MSG_BASE>() << msg, QStringList() << "Info", Kwin);
+    thread.stop();
+    thread.run();
+
+    // 首段失败后不再写入后续段，只发出一次失败结果
+    EXPECT_EQ(results, QList<bool>() << false);
+    EXPECT_EQ(errorCount, 1);
+    EXPECT_EQ(doneCount, 0);
+    EXPECT_FALSE(thread.isProcessing());
+    EXPECT_FALSE(thread.isQueueFull());
+}
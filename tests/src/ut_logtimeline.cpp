@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "logtimeline.h"
+
+#include <QDateTime>
+
+#include <gtest/gtest.h>
+
+TEST(LogTimeline_toEpoch_UT, LogTimeline_toEpoch_UT_DateTime)
+{
+    QHash<qint64, qint64> cache;
+    QDateTime dt(QDate(2024, 3, 5), QTime(8, 30, 15));
+    EXPECT_EQ(LogTimeline::toEpoch("2024-03-05 08:30:15", &cache), dt.toMSecsSinceEpoch());
+    EXPECT_EQ(LogTimeline::toEpoch("2024-03-05 08:30:15", &cache), dt.toMSecsSinceEpoch());
+    EXPECT_EQ(LogTimeline::toEpoch("2024-03-05 08:31:15"), dt.toMSecsSinceEpoch() + 60000);
+    EXPECT_EQ(LogTimeline::toEpoch("2024-03-05 08:30:15.250", &cache), dt.toMSecsSinceEpoch() + 250);
+    EXPECT_EQ(LogTimeline::toEpoch("2024-03-05T08:30:15,5"), dt.toMSecsSinceEpoch() + 500);
+}
+
+TEST(LogTimeline_toEpoch_UT, LogTimeline_toEpoch_UT_Syslog)
+{
+    qint64 time = LogTimeline::toEpoch("Jan  1 00:00:00");
+    ASSERT_GT(time, 0);
+    QDateTime dt = QDateTime::fromMSecsSinceEpoch(time);
+    EXPECT_EQ(dt.date().month(), 1);
+    EXPECT_EQ(dt.date().day(), 1);
+    EXPECT_LE(time, QDateTime::currentMSecsSinceEpoch() + 86400000LL);
+}
+
+TEST(LogTimeline_toEpoch_UT, LogTimeline_toEpoch_UT_Invalid)
+{
+    EXPECT_EQ(LogTimeline::toEpoch(""), -1);
+    EXPECT_EQ(LogTimeline::toEpoch("not a time"), -1);
+}
+
+TEST(LogTimeline_setSources_UT, LogTimeline_setSources_UT)
+{
+    LogTimeline timeline;
+    QString error;
+    EXPECT_TRUE(timeline.setSources("system, audit", error));
+    EXPECT_EQ(timeline.m_sources.size(), 2);
+
+    error.clear();
+    EXPECT_FALSE(timeline.setSources("system,boot", error));
+    EXPECT_FALSE(error.isEmpty());
+
+    error.clear();
+    EXPECT_FALSE(timeline.setSources("", error));
+}
+
+TEST(LogTimeline_appendRecords_UT, LogTimeline_appendRecords_UT_XorgInvalidOffset)
+{
+    LogTimeline timeline;
+    auto *source = new LogTimeline::Source;
+    source->flag = XORG;
+    source->name = "xorg";
+    timeline.m_sources.append(source);
+    timeline.m_bootTime = QDateTime(QDate(2024, 3, 5), QTime(8, 0)).toMSecsSinceEpoch();
+
+    LOG_MSG_XORG valid;
+    valid.offset = "1.5";
+    valid.msg = "valid";
+    // 无法解析偏移的行不应换算为开机前1ms的记录
+    LOG_MSG_XORG invalid;
+    invalid.offset = "not a number";
+    invalid.msg = "invalid";
+    timeline.appendRecords(0, QList<LOG_MSG_XORG>() << valid << invalid);
+
+    ASSERT_EQ(source->entries.size(), 1);
+    EXPECT_EQ(source->entries.first().msg, QString("valid"));
+    EXPECT_EQ(source->entries.first().time, timeline.m_bootTime + 1500);
+}
+
+TEST(LogTimeline_fetch_UT, LogTimeline_fetch_UT_Merge)
+{
+    LogTimeline timeline;
+    QString error;
+    ASSERT_TRUE(timeline.setSources("system,audit", error));
+
+    auto entry = [](qint64 time, const QString &msg) {
+        LOG_MSG_TIMELINE item;
+        item.time = time;
+        item.msg = msg;
+        return item;
+    };
+    timeline.m_sources[0]->entries = {entry(50, "a50"), entry(30, "a30"), entry(10, "a10")};
+    timeline.m_sources[1]->entries = {entry(40, "b40"), entry(30, "b30"), entry(20, "b20")};
+
+    timeline.onSourceFinished(0);
+    EXPECT_FALSE(timeline.isReady());
+    EXPECT_TRUE(timeline.fetch(10).isEmpty());
+    timeline.onSourceFinished(1);
+    ASSERT_TRUE(timeline.isReady());
+    EXPECT_EQ(timeline.totalCount(), 6);
+
+    QStringList order;
+    while (!timeline.atEnd()) {
+        QList<LOG_MSG_TIMELINE> page = timeline.fetch(4);
+        EXPECT_LE(page.size(), 4);
+        for (const LOG_MSG_TIMELINE &item : page)
+            order << item.msg;
+    }
+    EXPECT_EQ(order, QStringList({"a50", "b40", "a30", "b30", "b20", "a10"}));
+}
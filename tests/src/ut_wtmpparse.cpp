@@ -7,6 +7,9 @@
 #include <stub.h>
 
 #include <QDebug>
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
 
 #include <gtest/gtest.h>
 #include <string.h>
@@ -137,3 +140,51 @@ TEST(wtmpparse_show_base_info_UT, wtmpparse_show_base_info_UT)
     show_base_info(&info1);
     EXPECT_NE(&info1, nullptr)<<"check the status after show_base_info()";
 }
+
+static utmp makeUtmp(short type, const char *user, const char *line, qint64 secs)
+{
+    utmp ut;
+    memset(&ut, 0, sizeof(ut));
+    ut.ut_type = type;
+    strncpy(ut.ut_user, user, sizeof(ut.ut_user));
+    strncpy(ut.ut_line, line, sizeof(ut.ut_line));
+    ut.ut_tv.tv_sec = static_cast<int32_t>(secs);
+    return ut;
+}
+
+TEST(wtmpparse_WtmpReader_UT, WtmpReader_events_UT)
+{
+    QTemporaryDir dir;
+    QString path = dir.filePath("wtmp");
+    const qint64 base = QDateTime::currentDateTime().addDays(-2).toSecsSinceEpoch();
+    QList<utmp> records;
+    records << makeUtmp(BOOT_TIME, "reboot", "~", base)
+            << makeUtmp(USER_PROCESS, "uos", "tty1", base + 60)
+            << makeUtmp(DEAD_PROCESS, "", "tty1", base + 60 + 1800)
+            << makeUtmp(RUN_LVL, "shutdown", "~~", base + 3600)
+            << makeUtmp(BOOT_TIME, "reboot", "~", base + 7200);
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    for (const utmp &ut : records)
+        file.write(reinterpret_cast<const char *>(&ut), sizeof(utmp));
+    file.close();
+
+    WtmpReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.count(), 5);
+    EXPECT_EQ(reader.lowerBound(base + 61), 2);
+
+    QList<WTMP_EVENT> events = reader.events();
+    ASSERT_EQ(events.size(), 4);
+    // 按时间倒序返回
+    EXPECT_TRUE(events[0].span.endsWith("still running"));
+    EXPECT_EQ(QString(events[1].record.ut_user), QString("shutdown"));
+    EXPECT_EQ(events[1].userName, QString("uos"));
+    EXPECT_TRUE(events[2].span.endsWith("(00:30)"));
+    EXPECT_TRUE(events[3].span.endsWith("(01:00)"));
+
+    // 时间范围过滤
+    events = reader.events((base + 3000) * 1000, (base + 4000) * 1000);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(QString(events[0].record.ut_user), QString("shutdown"));
+}